@@ -22,94 +22,112 @@ vec4 RaiseLowerBrush(vec3 worldPosition, vec3 brushCenter, float radius, float s
     return vec4(direction * delta, delta);
 }
 
-vec4 SampleVolumeSources(vec3 worldPosition, in vec4 terrainSample, in WorldVolumeSourcesList volumeSourcesList, in WorldVolumeSources volumeSourcesData)
+vec4 ApplyVolumeSource(vec3 worldPosition, in vec4 terrainSample, in VolumeSource source, in WorldVolumeSources volumeSourcesData)
 {
-    for (uint i = 0; i < volumeSourcesList.Count; ++i)
-    {
-        VolumeSource source = volumeSourcesList.Sources[i];
-        vec4 sourceGradient;
-        uint dataStartIndex = source.Index * VolumeSources_ItemSize;
-        
-        float strength = -1.0f;
-        float smoothness = -1.0f;
+    vec4 sourceGradient;
+    uint dataStartIndex = source.Index * VolumeSources_ItemSize;
+    
+    float strength = -1.0f;
+    float smoothness = -1.0f;
 
-        switch (uint(source.Type))
+    switch (uint(source.Type))
+    {
+        case VolumeSource_Sphere:
+        {
+            CsgSphere sphere = UnpackCsgSphere(volumeSourcesData, dataStartIndex);
+            sourceGradient = GetValueAndGradient(worldPosition, sphere);
+            break;
+        }
+        case VolumeSource_Cube:
+        {
+            CsgCube cube = UnpackCsgCube(volumeSourcesData, dataStartIndex);
+            sourceGradient = GetValueAndGradient(worldPosition, cube);
+            break;
+        }
+        case VolumeSource_Ellipsoid:
+        {
+            CsgEllipsoid ellipsoid;
+            UnpackCsgSource(volumeSourcesData, dataStartIndex, ellipsoid);
+            sourceGradient = GetValueAndGradient(worldPosition, ellipsoid);
+            break;
+        }
+        case VolumeSource_Plane:
+        {
+            //union = GetUnion(union, )
+            break;
+        }
+        case VolumeSource_Grid:
+        {
+            //union = GetUnion(union, )
+            break;
+        }
+        // TODO: Remove and merge into grid source
+        case VolumeSource_SphereBrush:
         {
-            case VolumeSource_Sphere:
-            {
-                CsgSphere sphere = UnpackCsgSphere(volumeSourcesData, dataStartIndex);
-                sourceGradient = GetValueAndGradient(worldPosition, sphere);
-                break;
-            }
-            case VolumeSource_Cube:
-            {
-                CsgCube cube = UnpackCsgCube(volumeSourcesData, dataStartIndex);
-                sourceGradient = GetValueAndGradient(worldPosition, cube);
-                break;
-            }
-            case VolumeSource_Ellipsoid:
-            {
-                CsgEllipsoid ellipsoid;
-                UnpackCsgSource(volumeSourcesData, dataStartIndex, ellipsoid);
-                sourceGradient = GetValueAndGradient(worldPosition, ellipsoid);
-                break;
-            }
-            case VolumeSource_Plane:
-            {
-                //union = GetUnion(union, )
-                break;
-            }
-            case VolumeSource_Grid:
-            {
-                //union = GetUnion(union, )
-                break;
-            }
-            // TODO: Remove and merge into grid source
-            case VolumeSource_SphereBrush:
-            {
-                CsgSphere sphere = UnpackCsgSphere(volumeSourcesData, dataStartIndex);
-                strength = volumeSourcesData.SourcesData[dataStartIndex + 4];
-                smoothness = volumeSourcesData.SourcesData[dataStartIndex + 5];
-                
-                sourceGradient = GetValueAndGradient(worldPosition, sphere);
-                break;
-            }
-            case VolumeSource_CubeBrush:
-            {
-                CsgCube cube = UnpackCsgCube(volumeSourcesData, dataStartIndex);
-                strength = volumeSourcesData.SourcesData[dataStartIndex + 6];
-                smoothness = volumeSourcesData.SourcesData[dataStartIndex + 7];
-                sourceGradient = GetValueAndGradient(worldPosition, cube);
-                break;
-            }
+            CsgSphere sphere = UnpackCsgSphere(volumeSourcesData, dataStartIndex);
+            strength = volumeSourcesData.SourcesData[dataStartIndex + 4];
+            smoothness = volumeSourcesData.SourcesData[dataStartIndex + 5];
+            
+            sourceGradient = GetValueAndGradient(worldPosition, sphere);
+            break;
         }
+        case VolumeSource_CubeBrush:
+        {
+            CsgCube cube = UnpackCsgCube(volumeSourcesData, dataStartIndex);
+            strength = volumeSourcesData.SourcesData[dataStartIndex + 6];
+            smoothness = volumeSourcesData.SourcesData[dataStartIndex + 7];
+            sourceGradient = GetValueAndGradient(worldPosition, cube);
+            break;
+        }
+    }
 
-        switch (uint(source.Operation))
+    switch (uint(source.Operation))
+    {
+        case VolumeOperation_Union:
         {
-            case VolumeOperation_Union:
-            {
-                if (smoothness < 0.0f)
-                    terrainSample = GetUnion(sourceGradient, terrainSample);
-                else
-                    terrainSample = GetUnionSmooth(sourceGradient, terrainSample, smoothness);
-                break;
-            }
-            case VolumeOperation_Difference:
-            {
-                if (smoothness < 0.0f)
-                    terrainSample = GetDifference(sourceGradient, terrainSample);
-                else
-                    terrainSample = -GetUnionSmooth(sourceGradient, -terrainSample, smoothness); 
-                break;
-            }
-            case VolumeOperation_Intersect:
-            {
-                terrainSample = GetIntersection(sourceGradient, terrainSample);
-                break;
-            }
+            if (smoothness < 0.0f)
+                terrainSample = GetUnion(sourceGradient, terrainSample);
+            else
+                terrainSample = GetUnionSmooth(sourceGradient, terrainSample, smoothness);
+            break;
+        }
+        case VolumeOperation_Difference:
+        {
+            if (smoothness < 0.0f)
+                terrainSample = GetDifference(sourceGradient, terrainSample);
+            else
+                terrainSample = -GetUnionSmooth(sourceGradient, -terrainSample, smoothness); 
+            break;
+        }
+        case VolumeOperation_Intersect:
+        {
+            terrainSample = GetIntersection(sourceGradient, terrainSample);
+            break;
         }
     }
-    
+
+    return terrainSample;
+}
+
+vec4 SampleVolumeSources(vec3 worldPosition, in vec4 terrainSample, in WorldVolumeSourcesList volumeSourcesList, in WorldVolumeSources volumeSourcesData)
+{
+    // only the sources overlapping the grid cell of the position can change the surface there
+    WorldVolumeSourcesGrid grid = volumeSourcesList.Grid;
+    uint cellStart;
+    uint cellCount;
+    FindVolumeSourcesCell(grid, worldPosition, cellStart, cellCount);
+
+    for (uint i = 0; i < cellCount; ++i)
+    {
+        uint sourceIndex = grid.Data[cellStart + i];
+        terrainSample = ApplyVolumeSource(worldPosition, terrainSample, volumeSourcesList.Sources[sourceIndex], volumeSourcesData);
+    }
+
+    for (uint i = volumeSourcesList.IndexedCount; i < volumeSourcesList.Count; ++i)
+    {
+        terrainSample = ApplyVolumeSource(worldPosition, terrainSample, volumeSourcesList.Sources[i], volumeSourcesData);
+    }
+
     return terrainSample;
 }
 
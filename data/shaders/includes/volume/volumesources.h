@@ -20,12 +20,62 @@ struct VolumeSource
     uint32_t Index;
 };
 
+// matches VolumeEditJournal::WriteGpuGrid, a hash table of the grid cells followed by the source indices of every cell in journal order
+const uint VolumeSourcesGrid_HeaderSize = 4;
+const uint VolumeSourcesGrid_CellSize = 5;
+
+layout(std430, buffer_reference, buffer_reference_align = 4) readonly buffer WorldVolumeSourcesGrid
+{
+    float InverseCellSize;
+    uint TableMask;
+    // sources of cells without an entry
+    uint DefaultStart;
+    uint DefaultCount;
+    // TableMask + 1 cells of (x, y, z, start, count), a count of zero marks an empty slot
+    uint Data[];
+};
+
 layout(std430, buffer_reference, buffer_reference_align = 8) buffer WorldVolumeSourcesList
 {
     uint Count;
+    // sources at and after IndexedCount got appended on the GPU since the last upload and are not in the grid yet
+    uint IndexedCount;
+    WorldVolumeSourcesGrid Grid;
     VolumeSource Sources[];
 };
 
+uint GetVolumeSourcesCellHash(ivec3 cell)
+{
+    return (uint(cell.x) * 73856093u) ^ (uint(cell.y) * 19349663u) ^ (uint(cell.z) * 83492791u);
+}
+
+void FindVolumeSourcesCell(in WorldVolumeSourcesGrid grid, vec3 worldPosition, out uint outStart, out uint outCount)
+{
+    ivec3 cell = ivec3(floor(worldPosition * grid.InverseCellSize));
+    uint slot = GetVolumeSourcesCellHash(cell) & grid.TableMask;
+
+    // at most half of the slots are used, so the probing always ends at an empty slot
+    while (true)
+    {
+        uint cellOffset = VolumeSourcesGrid_HeaderSize + slot * VolumeSourcesGrid_CellSize;
+        uint count = grid.Data[cellOffset + 4];
+        if (count == 0)
+            break;
+
+        if (ivec3(grid.Data[cellOffset], grid.Data[cellOffset + 1], grid.Data[cellOffset + 2]) == cell)
+        {
+            outStart = grid.Data[cellOffset + 3];
+            outCount = count;
+            return;
+        }
+
+        slot = (slot + 1) & grid.TableMask;
+    }
+
+    outStart = grid.DefaultStart;
+    outCount = grid.DefaultCount;
+}
+
 layout(std430, buffer_reference, buffer_reference_align = 4) buffer WorldVolumeSources
 {
     float SourcesData[];
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <random>
+
+namespace Onyx::Benchmark
+{
+    // fixed seed so every run measures the same input
+    constexpr onyxU32 RANDOM_SEED = 1337;
+
+    template <typename T>
+    DynamicArray<T> CreateRandomValues(onyxU32 count, T min, T max)
+    {
+        std::mt19937 engine(RANDOM_SEED);
+        DynamicArray<T> values(count);
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            std::uniform_real_distribution<T> distribution(min, max);
+            for (T& value : values)
+                value = distribution(engine);
+        }
+        else
+        {
+            std::uniform_int_distribution<T> distribution(min, max);
+            for (T& value : values)
+                value = distribution(engine);
+        }
+
+        return values;
+    }
+}
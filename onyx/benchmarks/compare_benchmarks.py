@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+"""Compares two onyx-bench json result files and fails if a benchmark got slower than the threshold,
+reported an error or is missing from the current results.
+
+Usage: compare_benchmarks.py baseline.json current.json [--threshold 10] [--metric real_time]
+
+The result files are written by 'onyx-bench --benchmark_out=<file> --benchmark_out_format=json',
+when repetitions were used only the median aggregate of each benchmark is compared.
+"""
+
+import argparse
+import json
+import sys
+
+TIME_UNIT_TO_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load_results(path, metric):
+    with open(path, "r", encoding="utf-8") as file:
+        report = json.load(file)
+
+    results = {}
+    errors = set()
+    has_aggregates = any(entry.get("run_type") == "aggregate" for entry in report.get("benchmarks", []))
+    for entry in report.get("benchmarks", []):
+        if entry.get("error_occurred"):
+            errors.add(entry.get("run_name", entry["name"]))
+            continue
+
+        if has_aggregates:
+            if entry.get("run_type") != "aggregate" or entry.get("aggregate_name") != "median":
+                continue
+            name = entry["run_name"]
+        else:
+            name = entry["name"]
+
+        results[name] = entry[metric] * TIME_UNIT_TO_NS[entry.get("time_unit", "ns")]
+
+    return results, errors
+
+
+def format_time(nanoseconds):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if nanoseconds >= scale:
+            return f"{nanoseconds / scale:.3f} {unit}"
+    return f"{nanoseconds:.1f} ns"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare two onyx-bench json result files.")
+    parser.add_argument("baseline", help="results of the reference run")
+    parser.add_argument("current", help="results of the run to check")
+    parser.add_argument("--threshold", type=float, default=10.0, help="allowed slowdown in percent (default: 10)")
+    parser.add_argument("--metric", choices=("real_time", "cpu_time"), default="real_time", help="time to compare (default: real_time)")
+    args = parser.parse_args()
+
+    baseline, _ = load_results(args.baseline, args.metric)
+    current, errors = load_results(args.current, args.metric)
+
+    regressions = []
+    failures = []
+    name_width = max((len(name) for name in current), default=9)
+    print(f"{'Benchmark':<{name_width}}  {'Baseline':>12}  {'Current':>12}  {'Change':>8}")
+    for name, current_time in current.items():
+        baseline_time = baseline.get(name)
+        if baseline_time is None:
+            print(f"{name:<{name_width}}  {'-':>12}  {format_time(current_time):>12}  {'new':>8}")
+            continue
+
+        change = (current_time - baseline_time) / baseline_time * 100.0 if baseline_time > 0.0 else 0.0
+        marker = ""
+        if change > args.threshold:
+            regressions.append(name)
+            marker = "  REGRESSION"
+        print(f"{name:<{name_width}}  {format_time(baseline_time):>12}  {format_time(current_time):>12}  {change:>+7.1f}%{marker}")
+
+    for name in sorted(errors):
+        failures.append(name)
+        print(f"{name:<{name_width}}  {'':>12}  {'-':>12}  {'error':>8}")
+
+    missing = sorted(set(baseline) - set(current) - errors)
+    for name in missing:
+        failures.append(name)
+        print(f"{name:<{name_width}}  {format_time(baseline[name]):>12}  {'-':>12}  {'removed':>8}")
+
+    if regressions or failures:
+        if regressions:
+            print(f"\n{len(regressions)} benchmark(s) are more than {args.threshold:.1f}% slower than the baseline.")
+        if failures:
+            print(f"\n{len(failures)} benchmark(s) failed or are missing from the current results.")
+        return 1
+
+    print(f"\nNo benchmark is more than {args.threshold:.1f}% slower than the baseline.")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
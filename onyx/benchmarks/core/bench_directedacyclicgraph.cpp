@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+
+#include <onyx/container/directedacyclicgraph.h>
+
+namespace Onyx::Benchmark
+{
+    namespace
+    {
+        using Graph = DirectedAcyclicGraph<onyxU32, onyxS32>;
+
+        // every node gets an edge to its next EDGES_PER_NODE successors, similar to a render graph with shared inputs
+        constexpr onyxS32 EDGES_PER_NODE = 4;
+
+        void BuildGraph(Graph& graph, onyxS32 nodeCount)
+        {
+            for (onyxS32 i = 0; i < nodeCount; ++i)
+                graph.AddNode(static_cast<onyxU32>(i));
+
+            for (onyxS32 i = 0; i < nodeCount; ++i)
+            {
+                const onyxS32 lastNode = std::min(i + EDGES_PER_NODE, nodeCount - 1);
+                for (onyxS32 j = i + 1; j <= lastNode; ++j)
+                    graph.AddEdge(i, j);
+            }
+        }
+    }
+
+    // includes the cycle check of every added edge
+    void BM_DirectedAcyclicGraph_Build(benchmark::State& state)
+    {
+        const onyxS32 nodeCount = static_cast<onyxS32>(state.range(0));
+        for (auto _ : state)
+        {
+            Graph graph;
+            BuildGraph(graph, nodeCount);
+            benchmark::DoNotOptimize(graph.GetNodes().size());
+        }
+
+        state.SetItemsProcessed(state.iterations() * nodeCount);
+    }
+    BENCHMARK(BM_DirectedAcyclicGraph_Build)->Arg(64)->Arg(256);
+
+    void BM_DirectedAcyclicGraph_TopologicalOrder(benchmark::State& state)
+    {
+        const onyxS32 nodeCount = static_cast<onyxS32>(state.range(0));
+
+        Graph graph;
+        BuildGraph(graph, nodeCount);
+
+        DynamicArray<Graph::NodeId> orderedNodes;
+        for (auto _ : state)
+        {
+            orderedNodes.clear();
+            graph.RetrieveTopologicalOrder(orderedNodes);
+            benchmark::DoNotOptimize(orderedNodes.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * nodeCount);
+    }
+    BENCHMARK(BM_DirectedAcyclicGraph_TopologicalOrder)->Arg(64)->Arg(256)->Arg(1024);
+
+    void BM_DirectedAcyclicGraph_RemoveNode(benchmark::State& state)
+    {
+        const onyxS32 nodeCount = static_cast<onyxS32>(state.range(0));
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            Graph graph;
+            BuildGraph(graph, nodeCount);
+            state.ResumeTiming();
+
+            for (onyxS32 i = 0; i < nodeCount; ++i)
+                graph.RemoveNode(i);
+        }
+
+        state.SetItemsProcessed(state.iterations() * nodeCount);
+    }
+    BENCHMARK(BM_DirectedAcyclicGraph_RemoveNode)->Arg(64)->Arg(256);
+}
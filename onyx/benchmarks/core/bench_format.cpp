@@ -0,0 +1,35 @@
+#include <benchmark/benchmark.h>
+
+#include <onyx/string/format.h>
+
+namespace Onyx::Benchmark
+{
+    void BM_Format_Format(benchmark::State& state)
+    {
+        onyxU32 frame = 0;
+        for (auto _ : state)
+        {
+            const char* text = Format::Format("Frame {} took {:.3f}ms ({} draw calls)", frame, 16.6f, frame * 3);
+            benchmark::DoNotOptimize(text);
+            ++frame;
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_Format_Format);
+
+    void BM_Format_FormatTo(benchmark::State& state)
+    {
+        InplaceString<128> buffer;
+        onyxU32 frame = 0;
+        for (auto _ : state)
+        {
+            Format::FormatTo(buffer, "Frame {} took {:.3f}ms ({} draw calls)", frame, 16.6f, frame * 3);
+            benchmark::DoNotOptimize(buffer.GetData());
+            ++frame;
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_Format_FormatTo);
+}
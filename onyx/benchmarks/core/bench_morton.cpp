@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+
+#include <benchmarkutils.h>
+
+#include <onyx/morton.h>
+
+namespace Onyx::Benchmark
+{
+    namespace
+    {
+        constexpr onyxU32 COORDINATE_COUNT = 4096;
+    }
+
+    template <typename MortonT>
+    void BM_MortonCode3D_Encode(benchmark::State& state)
+    {
+        using CoordinateT = typename MortonT::CoordinateT;
+        const DynamicArray<CoordinateT> coordinates = CreateRandomValues<CoordinateT>(COORDINATE_COUNT * 3, 0, std::numeric_limits<CoordinateT>::max());
+
+        for (auto _ : state)
+        {
+            for (onyxU32 i = 0; i < COORDINATE_COUNT * 3; i += 3)
+            {
+                MortonT morton = MortonT::Encode(coordinates[i], coordinates[i + 1], coordinates[i + 2]);
+                benchmark::DoNotOptimize(morton);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * COORDINATE_COUNT);
+    }
+    BENCHMARK(BM_MortonCode3D_Encode<MortonCode3D_U32>);
+    BENCHMARK(BM_MortonCode3D_Encode<MortonCode3D_U64>);
+
+    template <typename MortonT>
+    void BM_MortonCode3D_Decode(benchmark::State& state)
+    {
+        using CoordinateT = typename MortonT::CoordinateT;
+        const DynamicArray<CoordinateT> coordinates = CreateRandomValues<CoordinateT>(COORDINATE_COUNT * 3, 0, std::numeric_limits<CoordinateT>::max());
+
+        DynamicArray<MortonT> mortonCodes;
+        mortonCodes.reserve(COORDINATE_COUNT);
+        for (onyxU32 i = 0; i < COORDINATE_COUNT * 3; i += 3)
+            mortonCodes.push_back(MortonT::Encode(coordinates[i], coordinates[i + 1], coordinates[i + 2]));
+
+        CoordinateT x, y, z;
+        for (auto _ : state)
+        {
+            for (const MortonT& morton : mortonCodes)
+            {
+                MortonT::Decode(morton, x, y, z);
+                benchmark::DoNotOptimize(x);
+                benchmark::DoNotOptimize(y);
+                benchmark::DoNotOptimize(z);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * COORDINATE_COUNT);
+    }
+    BENCHMARK(BM_MortonCode3D_Decode<MortonCode3D_U32>);
+    BENCHMARK(BM_MortonCode3D_Decode<MortonCode3D_U64>);
+
+    template <typename MortonT>
+    void BM_MortonCode3D_GetNeighbor(benchmark::State& state)
+    {
+        using CoordinateT = typename MortonT::CoordinateT;
+        const DynamicArray<CoordinateT> coordinates = CreateRandomValues<CoordinateT>(COORDINATE_COUNT * 3, 1, std::numeric_limits<CoordinateT>::max() - 1);
+
+        DynamicArray<MortonT> mortonCodes;
+        mortonCodes.reserve(COORDINATE_COUNT);
+        for (onyxU32 i = 0; i < COORDINATE_COUNT * 3; i += 3)
+            mortonCodes.push_back(MortonT::Encode(coordinates[i], coordinates[i + 1], coordinates[i + 2]));
+
+        for (auto _ : state)
+        {
+            for (const MortonT& morton : mortonCodes)
+            {
+                MortonT neighbor = morton.template GetNeighbor<1, -1, 1>();
+                benchmark::DoNotOptimize(neighbor);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * COORDINATE_COUNT);
+    }
+    BENCHMARK(BM_MortonCode3D_GetNeighbor<MortonCode3D_U32>);
+    BENCHMARK(BM_MortonCode3D_GetNeighbor<MortonCode3D_U64>);
+}
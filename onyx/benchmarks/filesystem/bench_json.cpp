@@ -0,0 +1,137 @@
+#include <benchmark/benchmark.h>
+
+#include <onyx/filesystem/jsondeserializer.h>
+#include <onyx/filesystem/jsonserializer.h>
+#include <onyx/filesystem/jsonstreamdeserializer.h>
+
+namespace Onyx::FileSystem::Benchmark
+{
+    namespace
+    {
+        struct BenchmarkItem
+        {
+            String Name;
+            onyxS32 Count = 0;
+            onyxF32 Scale = 0.0f;
+            bool IsEnabled = false;
+        };
+    }
+}
+
+namespace Onyx
+{
+    template <>
+    struct Serialization<FileSystem::Benchmark::BenchmarkItem>
+    {
+        static bool Serialize(Serializer& serializer, const FileSystem::Benchmark::BenchmarkItem& item)
+        {
+            bool success = serializer.Write<"name">(item.Name);
+            success &= serializer.Write<"count">(item.Count);
+            success &= serializer.Write<"scale">(item.Scale);
+            success &= serializer.Write<"enabled">(item.IsEnabled);
+            return success;
+        }
+
+        static bool Deserialize(const Deserializer& deserializer, FileSystem::Benchmark::BenchmarkItem& outItem)
+        {
+            bool success = deserializer.Read<"name">(outItem.Name);
+            success &= deserializer.Read<"count">(outItem.Count);
+            success &= deserializer.Read<"scale">(outItem.Scale);
+            success &= deserializer.Read<"enabled">(outItem.IsEnabled);
+            return success;
+        }
+    };
+}
+
+namespace Onyx::FileSystem::Benchmark
+{
+    namespace
+    {
+        DynamicArray<BenchmarkItem> CreateItems(onyxU32 count)
+        {
+            DynamicArray<BenchmarkItem> items(count);
+            for (onyxU32 i = 0; i < count; ++i)
+            {
+                BenchmarkItem& item = items[i];
+                item.Name = Format::Format("item_{}", i);
+                item.Count = static_cast<onyxS32>(i) - 64;
+                item.Scale = static_cast<onyxF32>(i) * 0.25f;
+                item.IsEnabled = (i % 2) == 0;
+            }
+
+            return items;
+        }
+
+        String CreateJson(onyxU32 count)
+        {
+            JsonSerializer serializer;
+            serializer.Write<"version">(3u);
+            serializer.Write("items", CreateItems(count));
+            return serializer.JsonRoot.dump();
+        }
+    }
+
+    void BM_Json_Serialize(benchmark::State& state)
+    {
+        const DynamicArray<BenchmarkItem> items = CreateItems(static_cast<onyxU32>(state.range(0)));
+        for (auto _ : state)
+        {
+            JsonSerializer serializer;
+            serializer.Write<"version">(3u);
+            serializer.Write("items", items);
+
+            String json = serializer.JsonRoot.dump();
+            benchmark::DoNotOptimize(json.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * items.size());
+    }
+    BENCHMARK(BM_Json_Serialize)->Arg(16)->Arg(1024);
+
+    // parses into a json dom first and reads the values from it
+    void BM_Json_Deserialize(benchmark::State& state)
+    {
+        const onyxU32 itemCount = static_cast<onyxU32>(state.range(0));
+        const String json = CreateJson(itemCount);
+
+        DynamicArray<BenchmarkItem> items;
+        for (auto _ : state)
+        {
+            const nlohmann::ordered_json jsonRoot = nlohmann::ordered_json::parse(json);
+            JsonDeserializer deserializer(jsonRoot);
+
+            items.clear();
+            if (deserializer.Read("items", items) == false)
+            {
+                state.SkipWithError("Failed to read items");
+                break;
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * itemCount);
+        state.SetBytesProcessed(state.iterations() * json.size());
+    }
+    BENCHMARK(BM_Json_Deserialize)->Arg(16)->Arg(1024);
+
+    void BM_Json_StreamDeserialize(benchmark::State& state)
+    {
+        const onyxU32 itemCount = static_cast<onyxU32>(state.range(0));
+        const String json = CreateJson(itemCount);
+
+        DynamicArray<BenchmarkItem> items;
+        for (auto _ : state)
+        {
+            JsonStreamDeserializer deserializer;
+            items.clear();
+            if ((deserializer.Parse(json) == false) || (deserializer.Read("items", items) == false))
+            {
+                state.SkipWithError("Failed to parse items");
+                break;
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * itemCount);
+        state.SetBytesProcessed(state.iterations() * json.size());
+    }
+    BENCHMARK(BM_Json_StreamDeserialize)->Arg(16)->Arg(1024);
+}
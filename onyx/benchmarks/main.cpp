@@ -0,0 +1,33 @@
+#include <benchmark/benchmark.h>
+
+#include <onyx/log/logger.h>
+#include <onyx/log/backends/stdoutlogger.h>
+
+// own main instead of benchmark_main, engine code logs through the default logger which is otherwise set up by the application
+int main(int argc, char** argv)
+{
+    using namespace Onyx;
+
+    Thread::MAIN_THREAD_ID = std::this_thread::get_id();
+
+    // only warnings and errors, debug logs of the benchmarked code would end up in the timings
+    Logger logger;
+    logger.AddLoggingBackend<StdoutLogger>();
+    logger.SetSeverity(LogLevel::Warning);
+    logger.Init();
+    Logger::s_DefaultLogger = &logger;
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        logger.Shutdown();
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    logger.Shutdown();
+    Logger::s_DefaultLogger = nullptr;
+    return 0;
+}
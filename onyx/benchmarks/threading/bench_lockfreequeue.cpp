@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+
+#include <onyx/thread/container/lockfreempmcboundedqueue.h>
+#include <onyx/thread/container/lockfreempscboundedqueue.h>
+
+namespace Onyx::Benchmark
+{
+    namespace
+    {
+        constexpr onyxU32 QUEUE_SIZE = 1024;
+    }
+
+    // every thread pushes and pops, so all threads contend on both ends of the queue
+    void BM_LockFreeMPMCBoundedQueue_PushPop(benchmark::State& state)
+    {
+        static Threading::LockFreeMPMCBoundedQueue<onyxU64> queue(QUEUE_SIZE);
+
+        onyxU64 value = 0;
+        for (auto _ : state)
+        {
+            while (queue.Push(onyxU64(state.iterations())) == false)
+                std::this_thread::yield();
+
+            while (queue.Pop(value) == false)
+                std::this_thread::yield();
+
+            benchmark::DoNotOptimize(value);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_LockFreeMPMCBoundedQueue_PushPop)->ThreadRange(1, 8)->UseRealTime();
+
+    // thread 0 consumes what all other threads produce, per iteration it pops one value of every producer
+    void BM_LockFreeMPSCBoundedQueue_Contention(benchmark::State& state)
+    {
+        static LockFreeMPSCBoundedQueue<onyxU64, QUEUE_SIZE> queue;
+
+        const onyxS32 producerCount = state.threads() - 1;
+        const bool isConsumer = state.thread_index() == 0;
+
+        onyxU64 value = 0;
+        for (auto _ : state)
+        {
+            if (isConsumer)
+            {
+                for (onyxS32 i = 0; i < producerCount; ++i)
+                {
+                    while (queue.Pop(value) == false)
+                        std::this_thread::yield();
+                }
+
+                benchmark::DoNotOptimize(value);
+            }
+            else
+            {
+                while (queue.Push(onyxU64(state.thread_index())) == false)
+                    std::this_thread::yield();
+            }
+        }
+
+        if (isConsumer)
+            state.SetItemsProcessed(state.iterations() * producerCount);
+    }
+    BENCHMARK(BM_LockFreeMPSCBoundedQueue_Contention)->ThreadRange(2, 8)->UseRealTime();
+}
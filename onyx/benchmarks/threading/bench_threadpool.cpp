@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+
+#include <onyx/thread/threadpool/threadpool.h>
+#include <onyx/thread/synchronization/atomic_latch.h>
+
+namespace Onyx::Threading::Benchmark
+{
+    namespace
+    {
+        constexpr onyxS32 TASKS_PER_BATCH = 4096;
+
+        ThreadPoolOptions GetOptions(onyxS32 threadCount)
+        {
+            ThreadPoolOptions options(threadCount);
+            options.SetQueueSize(TASKS_PER_BATCH);
+            return options;
+        }
+
+        template <typename Handler>
+        void PostBlocking(ThreadPool& threadPool, Handler& handler)
+        {
+            while (threadPool.TryPost(handler) == false)
+                std::this_thread::yield();
+        }
+    }
+
+    // tasks posted from outside of the pool are distributed round robin over the workers
+    void BM_ThreadPool_Post(benchmark::State& state)
+    {
+        ThreadPool threadPool(GetOptions(static_cast<onyxS32>(state.range(0))));
+
+        AtomicLatch remainingTasks;
+        auto task = [&remainingTasks]() { remainingTasks.Decrement(); };
+
+        for (auto _ : state)
+        {
+            remainingTasks.SetCounter(TASKS_PER_BATCH);
+            for (onyxS32 i = 0; i < TASKS_PER_BATCH; ++i)
+                PostBlocking(threadPool, task);
+
+            remainingTasks.Wait();
+        }
+
+        state.SetItemsProcessed(state.iterations() * TASKS_PER_BATCH);
+    }
+    BENCHMARK(BM_ThreadPool_Post)->Arg(1)->Arg(4)->Arg(8)->UseRealTime();
+
+    // a worker posts a whole batch into its own queue, the other workers only get work by stealing it
+    void BM_ThreadPool_Steal(benchmark::State& state)
+    {
+        ThreadPool threadPool(GetOptions(static_cast<onyxS32>(state.range(0))));
+
+        AtomicLatch remainingTasks;
+        auto task = [&remainingTasks]() { remainingTasks.Decrement(); };
+        auto spawnTask = [&threadPool, &task]()
+        {
+            for (onyxS32 i = 0; i < TASKS_PER_BATCH; ++i)
+                PostBlocking(threadPool, task);
+        };
+
+        for (auto _ : state)
+        {
+            remainingTasks.SetCounter(TASKS_PER_BATCH);
+            PostBlocking(threadPool, spawnTask);
+
+            remainingTasks.Wait();
+        }
+
+        state.SetItemsProcessed(state.iterations() * TASKS_PER_BATCH);
+    }
+    BENCHMARK(BM_ThreadPool_Steal)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+}
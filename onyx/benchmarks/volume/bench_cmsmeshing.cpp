@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+
+#include <onyx/thread/synchronization/atomic_latch.h>
+#include <onyx/volume/chunk/volumechunkloadrequest.h>
+#include <onyx/volume/source/noise/simplexnoisesource.h>
+
+namespace Onyx::Volume::Benchmark
+{
+    namespace
+    {
+        constexpr onyxF32 CHUNK_SIZE = 64.0f;
+        constexpr onyxU32 CHUNK_COUNT = 8;
+    }
+
+    // meshes one chunk per iteration through the same load path the terrain streaming uses, cycling through a row of chunks
+    void BM_Volume_CMSMeshing(benchmark::State& state)
+    {
+        const onyxU8 maxOctreeLevel = static_cast<onyxU8>(state.range(0));
+        const SimplexNoiseSource noise(4, 0.01f, 16.0f, 2.0f, 0.5f);
+
+        onyxU32 chunkIndex = 0;
+        onyxU64 vertexCount = 0;
+        for (auto _ : state)
+        {
+            const Vector3f32 chunkPosition(static_cast<onyxF32>(chunkIndex % CHUNK_COUNT) * CHUNK_SIZE, 0.0f, 0.0f);
+            ++chunkIndex;
+
+            Threading::AtomicLatch isLoading(1);
+            VolumeChunckLoadRequestData requestData(IsoSurfaceMethod::CMS, chunkPosition, maxOctreeLevel, CHUNK_SIZE, 1.0f, 1.0f, 0.85f, noise);
+            VolumeChunkLoadRequest request(requestData, [&isLoading, &vertexCount](const VolumeChunckLoadRequestData& loadedData)
+            {
+                vertexCount += loadedData.m_MeshBuilder.GetVertices().size();
+                isLoading.Decrement();
+            });
+
+            request.Load();
+            isLoading.Wait();
+        }
+
+        state.SetItemsProcessed(state.iterations());
+        state.counters["Vertices"] = benchmark::Counter(static_cast<double>(vertexCount), benchmark::Counter::kAvgIterations);
+    }
+    BENCHMARK(BM_Volume_CMSMeshing)->DenseRange(4, 6)->Unit(benchmark::kMillisecond)->UseRealTime();
+}
@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+
+#include <benchmarkutils.h>
+
+#include <onyx/volume/octree/octree.h>
+
+namespace Onyx::Volume::Benchmark
+{
+    namespace
+    {
+        using BenchmarkOctree = Octree<onyxU32, onyxU32>;
+
+        // keys of the root node span [0, 2^31), the first subdivision uses bit 30
+        constexpr onyxU32 ROOT_KEY_SIZE = 1u << 31;
+        constexpr onyxF32 ROOT_SIZE = 1024.0f;
+        constexpr onyxF32 SPHERE_RADIUS = ROOT_SIZE * 0.3f;
+        constexpr onyxU32 LOOKUP_COUNT = 4096;
+
+        // key offset of every child index in x, y, z matching OctreeKey::GetChildBranchBit
+        constexpr onyxF32 CHILD_OFFSETS[8][3] =
+        {
+            { 0.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, 1.0f },
+            { 0.0f, 1.0f, 0.0f }, { 1.0f, 1.0f, 0.0f }, { 1.0f, 1.0f, 1.0f }, { 0.0f, 1.0f, 1.0f },
+        };
+
+        onyxF32 GetSphereDistance(const Vector3f32& position)
+        {
+            const Vector3f32 center(ROOT_SIZE * 0.5f);
+            return (position - center).Length() - SPHERE_RADIUS;
+        }
+
+        // subdivides all nodes intersecting the surface of a sphere, same shape as the octrees of the volume chunks
+        void SubdivideSurface(BenchmarkOctree::OctreeNodeT& node, const Vector3f32& nodeMin, onyxF32 nodeSize, onyxU8 level, onyxU8 maxLevel)
+        {
+            const onyxF32 halfSize = nodeSize * 0.5f;
+            const Vector3f32 center = nodeMin + Vector3f32(halfSize);
+            const onyxF32 halfDiagonal = halfSize * 1.7320508f;
+            if ((level >= maxLevel) || (std::abs(GetSphereDistance(center)) > halfDiagonal))
+                return;
+
+            node.Subdivide();
+            for (onyxU8 i = 0; i < 8; ++i)
+            {
+                const Vector3f32 childMin = nodeMin + Vector3f32(CHILD_OFFSETS[i][0], CHILD_OFFSETS[i][1], CHILD_OFFSETS[i][2]) * halfSize;
+                BenchmarkOctree::OctreeNodeT& child = node.GetChild(i);
+                child.GetData() = level + 1;
+                SubdivideSurface(child, childMin, halfSize, level + 1, maxLevel);
+            }
+        }
+
+        onyxU32 ToKey(onyxF32 position)
+        {
+            return static_cast<onyxU32>(position / ROOT_SIZE * static_cast<onyxF32>(ROOT_KEY_SIZE));
+        }
+    }
+
+    void BM_Octree_BuildSurface(benchmark::State& state)
+    {
+        const onyxU8 maxLevel = static_cast<onyxU8>(state.range(0));
+        for (auto _ : state)
+        {
+            BenchmarkOctree octree;
+            SubdivideSurface(octree.GetRootNode(), Vector3f32(0.0f), ROOT_SIZE, 0, maxLevel);
+            benchmark::DoNotOptimize(octree.GetRootNode().IsSubdivided());
+        }
+    }
+    BENCHMARK(BM_Octree_BuildSurface)->DenseRange(5, 7);
+
+    // lookups of positions on the sphere surface always end in leafs of the max level
+    void BM_Octree_FindLeaf(benchmark::State& state)
+    {
+        const onyxU8 maxLevel = static_cast<onyxU8>(state.range(0));
+
+        BenchmarkOctree octree;
+        SubdivideSurface(octree.GetRootNode(), Vector3f32(0.0f), ROOT_SIZE, 0, maxLevel);
+
+        const DynamicArray<onyxF32> directions = Onyx::Benchmark::CreateRandomValues<onyxF32>(LOOKUP_COUNT * 3, -1.0f, 1.0f);
+        DynamicArray<onyxU32> keys;
+        keys.reserve(LOOKUP_COUNT * 3);
+        for (onyxU32 i = 0; i < LOOKUP_COUNT * 3; i += 3)
+        {
+            Vector3f32 direction(directions[i], directions[i + 1], directions[i + 2]);
+            if (direction.IsZero())
+                direction[1] = 1.0f;
+
+            direction.Normalize();
+            const Vector3f32 position = Vector3f32(ROOT_SIZE * 0.5f) + direction * SPHERE_RADIUS;
+            keys.push_back(ToKey(position[0]));
+            keys.push_back(ToKey(position[1]));
+            keys.push_back(ToKey(position[2]));
+        }
+
+        onyxU32 level = 0;
+        for (auto _ : state)
+        {
+            for (onyxU32 i = 0; i < LOOKUP_COUNT * 3; i += 3)
+            {
+                BenchmarkOctree::OctreeNodeT& leaf = octree.FindLeaf(keys[i], keys[i + 1], keys[i + 2], level);
+                benchmark::DoNotOptimize(leaf.GetData());
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * LOOKUP_COUNT);
+    }
+    BENCHMARK(BM_Octree_FindLeaf)->DenseRange(5, 7);
+}
@@ -0,0 +1,133 @@
+#include <benchmark/benchmark.h>
+
+#include <benchmarkutils.h>
+
+#include <onyx/volume/source/csg/csgcube.h>
+#include <onyx/volume/source/csg/csgsphere.h>
+#include <onyx/volume/source/csg/operations/csgdifference.h>
+#include <onyx/volume/source/csg/operations/csgunion.h>
+#include <onyx/volume/source/noise/simplexnoisesource.h>
+#include <onyx/volume/source/volumeeditjournal.h>
+#include <onyx/volume/source/volumesamplecache.h>
+
+namespace Onyx::Volume::Benchmark
+{
+    namespace
+    {
+        constexpr onyxU32 SAMPLE_COUNT = 4096;
+        constexpr onyxF32 CHUNK_SIZE = 64.0f;
+        constexpr onyxU8 CHUNK_MAX_OCTREE_LEVEL = 5;
+
+        DynamicArray<Vector3f32> CreateSamplePositions()
+        {
+            const DynamicArray<onyxF32> coordinates = Onyx::Benchmark::CreateRandomValues<onyxF32>(SAMPLE_COUNT * 3, -CHUNK_SIZE * 0.5f, CHUNK_SIZE * 0.5f);
+
+            DynamicArray<Vector3f32> positions;
+            positions.reserve(SAMPLE_COUNT);
+            for (onyxU32 i = 0; i < SAMPLE_COUNT * 3; i += 3)
+                positions.emplace_back(coordinates[i], coordinates[i + 1], coordinates[i + 2]);
+
+            return positions;
+        }
+
+        // positions on the finest lattice of the sample cache, like the corners sampled by the split policies
+        DynamicArray<Vector3f32> CreateLatticePositions()
+        {
+            const onyxS32 latticeResolution = 1 << CHUNK_MAX_OCTREE_LEVEL;
+            const onyxF32 latticeSpacing = CHUNK_SIZE / static_cast<onyxF32>(latticeResolution);
+            const DynamicArray<onyxS32> coordinates = Onyx::Benchmark::CreateRandomValues<onyxS32>(SAMPLE_COUNT * 3, 0, latticeResolution);
+
+            DynamicArray<Vector3f32> positions;
+            positions.reserve(SAMPLE_COUNT);
+            for (onyxU32 i = 0; i < SAMPLE_COUNT * 3; i += 3)
+            {
+                const Vector3f32 latticePosition(static_cast<onyxF32>(coordinates[i]), static_cast<onyxF32>(coordinates[i + 1]), static_cast<onyxF32>(coordinates[i + 2]));
+                positions.push_back(latticePosition * latticeSpacing - Vector3f32(CHUNK_SIZE * 0.5f));
+            }
+
+            return positions;
+        }
+
+        template <typename Sampler>
+        void RunSampling(benchmark::State& state, const DynamicArray<Vector3f32>& positions, Sampler&& sampler)
+        {
+            for (auto _ : state)
+            {
+                for (const Vector3f32& position : positions)
+                {
+                    Vector4f32 valueAndGradient = sampler(position);
+                    benchmark::DoNotOptimize(valueAndGradient);
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * positions.size());
+        }
+    }
+
+    void BM_Volume_CSGTree(benchmark::State& state)
+    {
+        CSGSphere sphere(20.0f, Vector3f32(0.0f));
+        CSGCube cube(Vector3f32(10.0f, 0.0f, 0.0f), Vector3f32(8.0f));
+        CSGSphere innerSphere(6.0f, Vector3f32(-10.0f, 0.0f, 0.0f));
+        CSGDifference difference(&sphere, &cube);
+        CSGUnion csgUnion(&difference, &innerSphere);
+
+        const DynamicArray<Vector3f32> positions = CreateSamplePositions();
+        RunSampling(state, positions, [&](const Vector3f32& position) { return csgUnion.GetValueAndGradient(position); });
+    }
+    BENCHMARK(BM_Volume_CSGTree);
+
+    void BM_Volume_SimplexNoise(benchmark::State& state)
+    {
+        const SimplexNoiseSource noise(static_cast<onyxU32>(state.range(0)), 0.01f, 16.0f, 2.0f, 0.5f);
+
+        const DynamicArray<Vector3f32> positions = CreateSamplePositions();
+        RunSampling(state, positions, [&](const Vector3f32& position) { return noise.GetValueAndGradient(position); });
+    }
+    BENCHMARK(BM_Volume_SimplexNoise)->Arg(1)->Arg(4)->Arg(8);
+
+    // every iteration starts with an empty cache, so the first sample of a lattice position misses and every repeat hits
+    void BM_Volume_SampleCache(benchmark::State& state)
+    {
+        const SimplexNoiseSource noise(4, 0.01f, 16.0f, 2.0f, 0.5f);
+        const DynamicArray<Vector3f32> positions = CreateLatticePositions();
+
+        for (auto _ : state)
+        {
+            const VolumeSampleCache sampleCache(noise, Vector3f32(0.0f), CHUNK_SIZE, CHUNK_MAX_OCTREE_LEVEL);
+            for (const Vector3f32& position : positions)
+            {
+                Vector4f32 valueAndGradient = sampleCache.GetValueAndGradient(position);
+                benchmark::DoNotOptimize(valueAndGradient);
+            }
+
+            for (const Vector3f32& position : positions)
+            {
+                Vector4f32 valueAndGradient = sampleCache.GetValueAndGradient(position);
+                benchmark::DoNotOptimize(valueAndGradient);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * positions.size() * 2);
+    }
+    BENCHMARK(BM_Volume_SampleCache);
+
+    // edits are scattered over a terrain much larger than the sampled chunk, the grid index only visits the nearby ones
+    void BM_Volume_EditJournalApply(benchmark::State& state)
+    {
+        const onyxU32 editCount = static_cast<onyxU32>(state.range(0));
+        const DynamicArray<onyxF32> editCoordinates = Onyx::Benchmark::CreateRandomValues<onyxF32>(editCount * 3, -1024.0f, 1024.0f);
+
+        VolumeEditJournal journal;
+        for (onyxU32 i = 0; i < editCount; ++i)
+        {
+            const Vector3f32 center(editCoordinates[i * 3], editCoordinates[i * 3 + 1] * 0.05f, editCoordinates[i * 3 + 2]);
+            const VolumeEditOperation operation = (i % 3 == 0) ? VolumeEditOperation::Difference : VolumeEditOperation::Union;
+            journal.Add(VolumeEdit::CreateSphereBrush(operation, center, 8.0f, 0.5f));
+        }
+
+        const DynamicArray<Vector3f32> positions = CreateSamplePositions();
+        RunSampling(state, positions, [&](const Vector3f32& position) { return journal.Apply(position, Vector4f32(0.0f, 1.0f, 0.0f, position[1])); });
+    }
+    BENCHMARK(BM_Volume_EditJournalApply)->Arg(64)->Arg(1024)->Arg(16384);
+}
@@ -5,25 +5,41 @@
 #include <onyx/log/backends/stdoutlogger.h>
 #include <onyx/log/backends/visualstudiolog.h>
 #include <onyx/application/log/logsinkfile.h>
+#include <onyx/application/threading/renderthread.h>
 #include <onyx/application/debug/gui/notificationloggersink.h>
 
 #include <onyx/ui/imguisystem.h>
 #include <onyx/filesystem/filedialog.h>
-#include <onyx/filesystem/jsondeserializer.h>
+#include <onyx/filesystem/jsonstreamdeserializer.h>
 #include <onyx/filesystem/onyxfile.h>
 
 #include <onyx/rhi/graphicssystem.h>
+#include <onyx/input/inputsystem.h>
 #include <onyx/assets/assetsystem.h>
 #include <onyx/graphics/rendergraph/rendergraph.h>
 #include <onyx/profiler/profiler.h>
 
+#include <onyx/memory/frameallocator.h>
 #include <onyx/serialize/deserializer.h>
+#include <onyx/thread/async/mainthreadqueue.h>
 
 #include <onyx/platform/platformsystem.h>
 
+#include <charconv>
+
 namespace
 {
     const char* const sl_CPU_Frame = "CPU";
+
+    static_assert(Onyx::FrameAllocator::DEFAULT_FRAME_COUNT == Onyx::Graphics::MAX_FRAMES_IN_FLIGHT, "Frame memory has to live as long as the frame context.");
+
+    constexpr Onyx::StringView RECORD_INPUT_ARGUMENT = "--record-input";
+    constexpr Onyx::StringView REPLAY_INPUT_ARGUMENT = "--replay-input";
+    constexpr Onyx::StringView FIXED_FRAME_RATE_ARGUMENT = "--fixed-frame-rate";
+
+    constexpr Onyx::onyxU64 NANOSECONDS_PER_SECOND = 1'000'000'000;
+    // recordings always run at a fixed step, a replay with the frame times of the recording session would not simulate the same frames
+    constexpr Onyx::onyxU32 DEFAULT_RECORDING_FRAME_RATE = 60;
 }
 
 namespace Onyx::Application
@@ -31,7 +47,7 @@ namespace Onyx::Application
     Application::Application() = default;
     Application::~Application() = default;
 
-    void Application::Init()
+    void Application::Init(onyxS32 argc, const char* const* argv)
     {
         Thread::MAIN_THREAD_ID = std::this_thread::get_id();
 
@@ -46,23 +62,34 @@ namespace Onyx::Application
         ONYX_UNUSED(workingDir);
         
         FileSystem::OnyxFile appSettings(appConfigPath);
-        FileSystem::JsonValue appConfigJson = appSettings.LoadJson();
-
-        FileSystem::JsonDeserializer configDeserializer(appConfigJson.Json);
+        FileSystem::JsonStreamDeserializer configDeserializer;
+        const bool hasAppConfig = configDeserializer.Load(appSettings);
 
+        // without a config the application starts without mount points and modules and uses the default frame timing
         HashMap<StringId32, FileSystem::MountPoint> mountPoints;
-        configDeserializer.ReadForEach<"mountpoints">([&](const Deserializer& scopedDeserializer)
+        FrameTimerSettings frameTimerSettings;
+        if (hasAppConfig)
         {
-            FileSystem::MountPoint mountPoint;
-            if (scopedDeserializer.Read(mountPoint))
+            configDeserializer.ReadForEach<"mountpoints">([&](const Deserializer& scopedDeserializer)
             {
-                mountPoints[StringId32(mountPoint.Prefix)] = mountPoint;
-                return true;
-            }
-            return false;
-        });
-        
+                FileSystem::MountPoint mountPoint;
+                if (scopedDeserializer.Read(mountPoint))
+                {
+                    mountPoints[StringId32(mountPoint.Prefix)] = mountPoint;
+                    return true;
+                }
+                return false;
+            });
+
+            configDeserializer.ReadOptional<"timing">(frameTimerSettings);
+        }
+        else
+        {
+            ONYX_LOG_ERROR("Failed loading app config {}, falling back to the default settings", appConfigPath.string());
+        }
+
         FileSystem::Path::SetMountPoints(mountPoints);
+        m_FrameTimer.SetSettings(frameTimerSettings);
 
         FileSystem::FileDialog::Init();
 
@@ -88,7 +115,7 @@ namespace Onyx::Application
         m_Logger->SetSeverity(LogLevel::Trace);
         m_Logger->Init();
 
-        bool hasLoadedModules = configDeserializer.ReadForEach<"modules">([&](const Deserializer& scopedDeserializer)
+        bool hasLoadedModules = hasAppConfig && configDeserializer.ReadForEach<"modules">([&](const Deserializer& scopedDeserializer)
         {
             StringId32 moduleId;
             if (scopedDeserializer.Read<"typeId">(moduleId) == false)
@@ -112,11 +139,16 @@ namespace Onyx::Application
             ONYX_LOG_ERROR("Failed loading modules");
         }
 
+        ParseCommandLine(argc, argv);
+        StartInputRecording();
+
         OnApplicationCreated(*this);
     }
 
     void Application::Shutdown()
     {
+        StopInputRecording();
+
         FileSystem::FileDialog::Shutdown();
 
         OnApplicationShutdown(*this);
@@ -140,29 +172,47 @@ namespace Onyx::Application
     {
         ONYX_PROFILE_SET_THREAD(Main)
 
-#if ONYX_USE_IMGUI
-        bool hasImGuiSystem = HasSystem<Ui::ImGuiSystem>();
-#endif
-
         Graphics::GraphicsSystem& graphicsSystem = GetSystem<Graphics::GraphicsSystem>();
         // TODO: Fix
         // Graphics::WindowSystem& windowSystem = GetSystem<Graphics::WindowSystem>();
        // windowSystem.GetMainWindow().AddOnCloseHandler(this, &Application::OnWindowClose);
 
-        //onyxU64 lastFixedUpdateFrameTime = 0;
-        onyxU64 lastFrameTime = Time::GetCurrentMilliseconds();
+        bool isPipelined = graphicsSystem.IsPipelined();
+#if ONYX_USE_IMGUI
+        const bool hasImGuiSystem = HasSystem<Ui::ImGuiSystem>();
+        if (isPipelined && hasImGuiSystem)
+        {
+            // ImGui builds and renders its draw data in the same frame, so it can not be split across threads yet
+            ONYX_LOG_WARNING("Pipelined rendering is not supported with the ImGui system, falling back to sequential rendering.");
+            isPipelined = false;
+        }
+#endif
+
+        if (isPipelined)
+            RunPipelined(graphicsSystem);
+        else
+            RunSequential(graphicsSystem);
+    }
+
+    void Application::RunSequential(Graphics::GraphicsSystem& graphicsSystem)
+    {
+#if ONYX_USE_IMGUI
+        bool hasImGuiSystem = HasSystem<Ui::ImGuiSystem>();
+#endif
 
         while (m_IsRunning)
         {
-            const onyxU64 currentFrameTime = Time::GetCurrentMilliseconds();
-            const onyxU64 deltaFrameTime = currentFrameTime - lastFrameTime;
+            BeginFrameTime();
 
+            Graphics::FrameContext& frameContext = graphicsSystem.BeginSimulationFrame(graphicsSystem.GetFrameIndex());
             const bool hasBegunFrame = graphicsSystem.BeginFrame();
 
             if (hasBegunFrame == false)
                 continue;
 
-            Graphics::FrameContext& frameContext = graphicsSystem.GetFrameContext();
+            // frame memory lives as long as the frame context, so it can be reset once the frame index comes around again
+            DefaultFrameAllocator.BeginFrame(frameContext.FrameIndex);
+
 #if ONYX_USE_IMGUI
             if (hasImGuiSystem)
             {
@@ -172,14 +222,7 @@ namespace Onyx::Application
             
 #endif
 
-            {
-                ONYX_PROFILE_SECTION(UpdateModules)
-                EngineSystemUpdateContext context{ *this, deltaFrameTime, 0 };
-                for (const auto& updateInfo : m_UpdatableModules)
-                {
-                    updateInfo.UpdateFunctionPtr(*m_Modules[updateInfo.SystemIndex], context);
-                }
-            }
+            UpdateSimulation();
 
             if (hasBegunFrame)
             {
@@ -196,15 +239,172 @@ namespace Onyx::Application
                 graphicsSystem.EndFrame();
             }
 
-            lastFrameTime = currentFrameTime;
-            //loc_FpsStatusBarItem->Update(deltaFrameTime);
+            //loc_FpsStatusBarItem->Update(m_FrameTimer.GetDelta());
 
             FrameMarkNamed(sl_CPU_Frame);
             FrameMark;
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            m_FrameTimer.LimitFrameRate();
         }
     }
 
+    void Application::RunPipelined(Graphics::GraphicsSystem& graphicsSystem)
+    {
+        RenderThread renderThread(graphicsSystem);
+        renderThread.Start();
+
+        onyxU8 frameIndex = 0;
+
+        while (m_IsRunning)
+        {
+            BeginFrameTime();
+
+            // sync point: the render thread is done with the frame context of two frames ago
+            renderThread.WaitForFrameContext(frameIndex);
+
+            graphicsSystem.BeginSimulationFrame(frameIndex);
+            DefaultFrameAllocator.BeginFrame(frameIndex);
+
+            UpdateSimulation();
+
+            // sync point: the frame context is complete and read only until the render thread finished it
+            renderThread.SubmitFrame(frameIndex);
+            frameIndex = (frameIndex + 1) % Graphics::MAX_FRAMES_IN_FLIGHT;
+
+            FrameMarkNamed(sl_CPU_Frame);
+            FrameMark;
+            m_FrameTimer.LimitFrameRate();
+        }
+
+        renderThread.Shutdown();
+        graphicsSystem.WaitIdle();
+    }
+
+    void Application::BeginFrameTime()
+    {
+        const onyxU64 currentFrameTime = Time::GetCurrentNanoseconds();
+
+        // input recordings and replays run with a fixed delta time so they simulate the same frames on every run
+        if (HasSystem<Input::InputSystem>())
+        {
+            const Input::InputSystem& inputSystem = GetSystem<Input::InputSystem>();
+            if (inputSystem.HasFixedDeltaTime())
+            {
+                m_FrameTimer.BeginFrame(currentFrameTime, inputSystem.GetFixedDeltaTime());
+                return;
+            }
+        }
+
+        m_FrameTimer.BeginFrame(currentFrameTime);
+    }
+
+    void Application::UpdateSimulation()
+    {
+        {
+            // resumes coroutines and callbacks that got handed back to the main thread, e.g. finished asset loads
+            ONYX_PROFILE_SECTION(DispatchMainThreadQueue)
+            Threading::DefaultMainThreadQueue.Dispatch();
+        }
+
+#if !ONYX_IS_RETAIL
+        if (HasSystem<Assets::AssetSystem>())
+        {
+            // file watcher events are queued from the watcher thread, they have to be drained every frame
+            ONYX_PROFILE_SECTION(DispatchFileChanges)
+            GetSystem<Assets::AssetSystem>().DispatchFileChanges();
+        }
+#endif
+
+        {
+            ONYX_PROFILE_SECTION(UpdateModules)
+            EngineSystemUpdateContext context{ *this, m_FrameTimer.GetDelta(), m_FrameTimer.GetTime(), m_FrameTimer.GetFixedTime() };
+            for (const auto& updateInfo : m_UpdatableModules)
+            {
+                updateInfo.UpdateFunctionPtr(*m_Modules[updateInfo.SystemIndex], context);
+            }
+        }
+    }
+
+    void Application::ParseCommandLine(onyxS32 argc, const char* const* argv)
+    {
+        for (onyxS32 i = 1; i < argc; ++i)
+        {
+            const StringView argument(argv[i]);
+            const bool hasValue = (i + 1) < argc;
+
+            if (hasValue && (argument == RECORD_INPUT_ARGUMENT))
+            {
+                m_InputRecordingPath = FileSystem::Path::GetFullPath(argv[++i]);
+            }
+            else if (hasValue && (argument == REPLAY_INPUT_ARGUMENT))
+            {
+                m_InputReplayPath = FileSystem::Path::GetFullPath(argv[++i]);
+            }
+            else if (hasValue && (argument == FIXED_FRAME_RATE_ARGUMENT))
+            {
+                const StringView value(argv[++i]);
+                onyxU32 frameRate = 0;
+                const std::from_chars_result result = std::from_chars(value.data(), value.data() + value.size(), frameRate);
+                if ((result.ec != std::errc()) || (frameRate == 0))
+                {
+                    ONYX_LOG_ERROR("Invalid fixed frame rate {}", value);
+                    continue;
+                }
+
+                m_InputFixedDeltaTime = NANOSECONDS_PER_SECOND / frameRate;
+            }
+            else
+            {
+                ONYX_LOG_WARNING("Unknown command line argument {}", argument);
+            }
+        }
+    }
+
+    void Application::StartInputRecording()
+    {
+        if (m_InputRecordingPath.empty() && m_InputReplayPath.empty())
+            return;
+
+        if (HasSystem<Input::InputSystem>() == false)
+        {
+            ONYX_LOG_ERROR("Input recordings need the input module.");
+            return;
+        }
+
+        Input::InputSystem& inputSystem = GetSystem<Input::InputSystem>();
+        if (m_InputReplayPath.empty() == false)
+        {
+            if (m_InputRecordingPath.empty() == false)
+                ONYX_LOG_WARNING("Input can not be recorded while replaying {}, the recording is ignored.", m_InputReplayPath.string());
+
+            m_InputRecordingPath.clear();
+
+            // replays are used to benchmark fly-throughs, so the application quits once the recording is exhausted
+            inputSystem.OnReplayFinished().Connect<&Application::OnInputReplayFinished>(this);
+            inputSystem.StartReplay(m_InputReplayPath);
+            return;
+        }
+
+        if (m_InputFixedDeltaTime == 0)
+            m_InputFixedDeltaTime = NANOSECONDS_PER_SECOND / DEFAULT_RECORDING_FRAME_RATE;
+
+        inputSystem.StartRecording(m_InputFixedDeltaTime);
+    }
+
+    void Application::StopInputRecording()
+    {
+        if (m_InputRecordingPath.empty() || (HasSystem<Input::InputSystem>() == false))
+            return;
+
+        std::ignore = GetSystem<Input::InputSystem>().StopRecording(m_InputRecordingPath);
+        m_InputRecordingPath.clear();
+    }
+
+    void Application::OnInputReplayFinished()
+    {
+        ONYX_LOG_INFO("Finished replaying input recording {}", m_InputReplayPath.string());
+        m_IsRunning = false;
+    }
+
     void Application::OnWindowClose()
     {
         m_IsRunning = false;
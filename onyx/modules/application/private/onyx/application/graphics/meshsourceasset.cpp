@@ -1,101 +1,50 @@
 #include <onyx/application/graphics/meshsourceasset.h>
-#include <onyx/filesystem/onyxfile.h>
-#include <onyx/stream/stringstream.h>
 
 namespace Onyx::Application
 {
     MeshSourceAsset::MeshSourceAsset(const FilePath& path)
     {
-        FileSystem::OnyxFile meshSource(path);
-        FileSystem::FileStream stream = meshSource.OpenStream(FileSystem::OpenMode::Text | FileSystem::OpenMode::Read);
-
-        String meshSourceContent;
-        stream.ReadAll(meshSourceContent);
-        StringStream stringStream(meshSourceContent);
-
-        StringView line;
-
-        DynamicArray<onyxU32> vertexIndices, uvIndices, normalIndices;
-        DynamicArray<Vector3f32> tempVertices;
-        DynamicArray<Vector3f32> tempNormals;
-        DynamicArray<Vector2f32> tempTexCoords;
-
-        //TODO fix mesh asset import
-        while (stringStream.IsEof() == false)
+        if (path.extension() == Graphics::CookedMesh::FILE_EXTENSION)
         {
-            stringStream.ReadLine(line);
-
-            if (line.starts_with("vn"))
-            {
-                line.remove_prefix(4);
-                Vector3f32 vertexNormal;
-                //Vector3f::FromString(line, vertexNormal);
-                tempNormals.push_back(vertexNormal);
-            }
-            else if (line.starts_with("vt"))
-            {
-                line.remove_prefix(4);
-                Vector3f32 vertexTexCoord;
-                //Vector3f::FromString(line, vertexTexCoord);
-                tempTexCoords.push_back(Vector2f32(vertexTexCoord));
-            }
-            if (line.starts_with("v"))
-            {
-                line.remove_prefix(2);
-                Vector3f32 vertexPos;
-                //Vector3f::FromString(line, vertexPos);
-                tempVertices.push_back(vertexPos);
-            }
-            else if (line.starts_with("f"))
-            {
-                line.remove_prefix(2);
-                onyxU32 indices[9];
+            LoadCooked(path);
+            return;
+        }
 
-                DynamicArray<String> split = Split(line, " /");
-                onyxS32 i = -1;
-                for (const String& token : split)
-                {
-                    std::from_chars(token.data(), token.data() + token.size(), indices[++i]);
-                }
+        // the mesh is cooked next to its source, so it can be loaded without importing and optimizing it again
+        const FilePath cookedPath = FileSystem::Path::ReplaceExtension(path, Graphics::CookedMesh::FILE_EXTENSION);
+        if (FileSystem::Path::IsNewerThan(cookedPath, path) && LoadCooked(cookedPath))
+            return;
 
-                vertexIndices.push_back(indices[0]);
-                uvIndices.push_back(indices[1]);
-                normalIndices.push_back(indices[2]);
+        if (Import(path))
+            SaveCooked(cookedPath);
+    }
 
-                vertexIndices.push_back(indices[3]);
-                uvIndices.push_back(indices[4]);
-                normalIndices.push_back(indices[5]);
+    bool MeshSourceAsset::Import(const FilePath& sourcePath, const Graphics::ObjImportOptions& options)
+    {
+        Graphics::IndexedMesh mesh;
+        if (Graphics::ObjMeshImporter::Import(sourcePath, mesh, options) == false)
+            return false;
 
-                vertexIndices.push_back(indices[6]);
-                uvIndices.push_back(indices[7]);
-                normalIndices.push_back(indices[8]);
-            }
-        }
+        Graphics::CookedMesh::Cook(std::move(mesh), m_Mesh);
+        return true;
+    }
 
-        for (onyxU32 i = 0; i < vertexIndices.size(); i++)
-        {
-            onyxU32 vertexIndex = vertexIndices[i];
-            onyxU32 texCoordIndex = uvIndices[i];
-            onyxU32 normalIndex = normalIndices[i];
+    bool MeshSourceAsset::LoadCooked(const FilePath& cookedPath)
+    {
+        if (m_Mesh.Load(cookedPath))
+            return true;
 
-            Vector3f32 vertex = tempVertices[vertexIndex - 1];
-            auto it = std::find_if(m_Vertices.begin(), m_Vertices.end(), [&](const Graphics::Vertex& v)
-                {
-                    return v.Position == vertex;
-                });
+        ONYX_LOG_ERROR("Failed loading cooked mesh {}", cookedPath.string());
+        m_Mesh = {};
+        return false;
+    }
 
-            if (it != m_Vertices.end())
-            {
-                m_Indices.push_back(static_cast<onyxU32>(std::distance(m_Vertices.begin(), it)));
-            }
-            else
-            {
-                m_Indices.push_back(static_cast<onyxU32>(m_Vertices.size()));
+    bool MeshSourceAsset::SaveCooked(const FilePath& cookedPath) const
+    {
+        if (m_Mesh.Save(cookedPath))
+            return true;
 
-                Vector3f32 normal = tempNormals[normalIndex - 1];
-                Vector2f32 texCoord = tempTexCoords[texCoordIndex - 1];
-                m_Vertices.emplace_back(vertex, normal, texCoord);
-            }
-        }
+        ONYX_LOG_ERROR("Failed saving cooked mesh {}", cookedPath.string());
+        return false;
     }
 }
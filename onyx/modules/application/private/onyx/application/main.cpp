@@ -27,7 +27,7 @@ void operator delete(void* p) noexcept
 #if ONYX_IS_WINDOWS
 
 #if 1
-int main(int, char**)
+int main(int argc, char** argv)
 #else
 int CALLBACK WinMain(
     HINSTANCE   /*hInstance*/,
@@ -46,7 +46,7 @@ int main(const int argc, const char *argv[])
     OnApplicationCreate();
 
     Application application;
-    application.Init();
+    application.Init(argc, argv);
     application.Run();
     application.Shutdown();
 
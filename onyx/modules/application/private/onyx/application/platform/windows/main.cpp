@@ -24,7 +24,7 @@ void operator delete(void* p) noexcept
 
 
 #if 1
-int main(int, char**)
+int main(int argc, char** argv)
 #else
 int CALLBACK WinMain(
     HINSTANCE   /*hInstance*/,
@@ -40,7 +40,7 @@ int CALLBACK WinMain(
     OnApplicationCreate();
 
     Application application;
-    application.Init();
+    application.Init(argc, argv);
     application.Run();
     application.Shutdown();
 
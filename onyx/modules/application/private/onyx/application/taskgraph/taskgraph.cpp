@@ -11,10 +11,14 @@ namespace Onyx::Application
         if (m_Tasks.GetCount() == 0)
             return;
 
-        DynamicArray<DirectedAcyclicTaskGraph::NodeId> sortedTasks;
-        m_Tasks.RetrieveTopologicalOrder(sortedTasks);
+        if (m_IsSortedTasksOutdated)
+        {
+            m_SortedTasks.clear();
+            m_Tasks.RetrieveTopologicalOrder(m_SortedTasks);
+            m_IsSortedTasksOutdated = false;
+        }
 
-        for (DirectedAcyclicTaskGraph::NodeId nodeId : sortedTasks)
+        for (DirectedAcyclicTaskGraph::NodeId nodeId : m_SortedTasks)
         {
             TaskGraphNode& task = m_Tasks.GetNode(nodeId);
             task.Update(deltaTime, context);
@@ -0,0 +1,101 @@
+#include <onyx/application/threading/renderthread.h>
+
+#include <onyx/rhi/graphicssystem.h>
+#include <onyx/memory/frameallocator.h>
+#include <onyx/profiler/profiler.h>
+
+namespace Onyx::Application
+{
+    RenderThread::RenderThread(Graphics::GraphicsSystem& graphicsSystem)
+        : m_GraphicsSystem(&graphicsSystem)
+    {
+    }
+
+    RenderThread::~RenderThread()
+    {
+        Shutdown();
+    }
+
+    void RenderThread::Shutdown()
+    {
+        {
+            std::lock_guard lock(m_Mutex);
+            m_IsShuttingDown = true;
+        }
+
+        m_SubmitCondition.notify_one();
+        Stop(true);
+    }
+
+    void RenderThread::WaitForFrameContext(onyxU8 frameIndex)
+    {
+        ONYX_PROFILE_FUNCTION;
+
+        std::unique_lock lock(m_Mutex);
+        m_CompleteCondition.wait(lock, [&]() { return (m_SubmittedFrameIndex != frameIndex) && (m_RenderingFrameIndex != frameIndex); });
+    }
+
+    void RenderThread::SubmitFrame(onyxU8 frameIndex)
+    {
+        ONYX_PROFILE_FUNCTION;
+
+        {
+            std::unique_lock lock(m_Mutex);
+            m_CompleteCondition.wait(lock, [&]() { return m_SubmittedFrameIndex == NO_FRAME; });
+            m_SubmittedFrameIndex = frameIndex;
+        }
+
+        m_SubmitCondition.notify_one();
+    }
+
+    void RenderThread::OnStart()
+    {
+        ONYX_PROFILE_SET_THREAD(Render);
+    }
+
+    void RenderThread::OnStop()
+    {
+        DefaultFrameAllocator.UnbindThreadFrame();
+    }
+
+    void RenderThread::OnUpdate()
+    {
+        while (true)
+        {
+            onyxU8 frameIndex;
+            {
+                std::unique_lock lock(m_Mutex);
+                m_SubmitCondition.wait(lock, [&]() { return (m_SubmittedFrameIndex != NO_FRAME) || m_IsShuttingDown; });
+
+                // frames that got submitted before shutting down are still rendered
+                if (m_SubmittedFrameIndex == NO_FRAME)
+                    break;
+
+                frameIndex = m_SubmittedFrameIndex;
+                m_RenderingFrameIndex = frameIndex;
+                m_SubmittedFrameIndex = NO_FRAME;
+            }
+
+            m_CompleteCondition.notify_all();
+
+            {
+                ONYX_PROFILE_SECTION(RenderFrame);
+
+                // the simulation already begins the next frame of the frame allocator while this one is rendered
+                DefaultFrameAllocator.BindThreadFrame(frameIndex);
+                if (m_GraphicsSystem->BeginFrame(frameIndex))
+                {
+                    m_GraphicsSystem->Render();
+                    m_GraphicsSystem->EndFrame();
+                }
+            }
+
+            {
+                std::lock_guard lock(m_Mutex);
+                m_RenderingFrameIndex = NO_FRAME;
+            }
+
+            m_CompleteCondition.notify_all();
+        }
+    }
+}
@@ -2,6 +2,12 @@
 #include <onyx/engine/enginesystem.h>
 
 #include <onyx/engine/enginesystemfactory.h>
+#include <onyx/engine/frametimer.h>
+
+namespace Onyx::Graphics
+{
+    class GraphicsSystem;
+}
 
 namespace Onyx::Application
 {
@@ -20,7 +26,9 @@ namespace Onyx::Application
         Application(Application&& other) noexcept = default;
         Application& operator=(Application&& other) noexcept = default;
 
-        void Init();
+        // --record-input <path> records the input of the session, --replay-input <path> replays a recording and quits once it finished,
+        // --fixed-frame-rate <fps> sets the fixed delta time of the recording (60 fps by default) so replays simulate the same frames
+        void Init(onyxS32 argc, const char* const* argv);
         void Shutdown();
         void Run();
 
@@ -76,6 +84,16 @@ namespace Onyx::Application
         }
 
     private:
+        void RunSequential(Graphics::GraphicsSystem& graphicsSystem);
+        void RunPipelined(Graphics::GraphicsSystem& graphicsSystem);
+        void BeginFrameTime();
+        void UpdateSimulation();
+
+        void ParseCommandLine(onyxS32 argc, const char* const* argv);
+        void StartInputRecording();
+        void StopInputRecording();
+        void OnInputReplayFinished();
+
         void OnWindowClose();
 
     private:
@@ -89,9 +107,15 @@ namespace Onyx::Application
 
         UniquePtr<Logger> m_Logger;
 
+        FrameTimer m_FrameTimer;
+
         DynamicArray<UniquePtr<IEngineSystem>> m_Modules;
 
         DynamicArray<SystemUpdate> m_UpdatableModules;
+
+        FilePath m_InputRecordingPath;
+        FilePath m_InputReplayPath;
+        onyxU64 m_InputFixedDeltaTime = 0;
     };
 
     void OnApplicationCreate();
@@ -1,4 +1,6 @@
 #pragma once
+#include <onyx/graphics/mesh/cookedmesh.h>
+#include <onyx/graphics/mesh/objmeshimporter.h>
 #include <onyx/filesystem/path.h>
 #include <onyx/rhi/vertex.h>
 
@@ -8,13 +10,17 @@ namespace Onyx::Application
     {
     public:
         MeshSourceAsset() = default;
+        // loads cooked meshes (.omesh) directly, everything else gets imported and saved as cooked mesh next to its source
         MeshSourceAsset(const FilePath& path);
 
-        const DynamicArray<Graphics::Vertex>& GetVertices() const { return m_Vertices; }
-        const DynamicArray<onyxU32>& GetIndices() const { return m_Indices; }
-    private:
+        bool Import(const FilePath& sourcePath, const Graphics::ObjImportOptions& options = {});
+        bool LoadCooked(const FilePath& cookedPath);
+        bool SaveCooked(const FilePath& cookedPath) const;
 
-        DynamicArray<Graphics::Vertex> m_Vertices;
-        DynamicArray<onyxU32> m_Indices;
+        const DynamicArray<Graphics::Vertex>& GetVertices() const { return m_Mesh.Vertices; }
+        const DynamicArray<onyxU32>& GetIndices() const { return m_Mesh.Indices; }
+        const Graphics::MeshletBuildResult& GetMeshlets() const { return m_Mesh.Meshlets; }
+    private:
+        Graphics::CookedMesh m_Mesh;
     };
 }
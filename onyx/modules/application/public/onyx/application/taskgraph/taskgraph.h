@@ -23,17 +23,20 @@ namespace Onyx::Application
 
             TaskGraphNode newNode(MakeUnique<T>(std::forward<Args>(val)...));
             onyxS16 nodeId = m_Tasks.AddNode(std::move(newNode));
+            m_IsSortedTasksOutdated = true;
             return nodeId;
         }
 
         void AddDependency(onyxS16 fromNode, onyxS16 toNode)
         {
             m_Tasks.AddEdge(fromNode, toNode);
+            m_IsSortedTasksOutdated = true;
         }
 
         void Init()
         {
             m_Tasks.TransitiveReduction();
+            m_IsSortedTasksOutdated = true;
 
             // call on all tasks
             //init
@@ -43,5 +46,9 @@ namespace Onyx::Application
 
     private:
         DirectedAcyclicTaskGraph m_Tasks;
+
+        // the graph rarely changes, so the order is only sorted again after tasks or dependencies got added
+        DynamicArray<DirectedAcyclicTaskGraph::NodeId> m_SortedTasks;
+        bool m_IsSortedTasksOutdated = true;
     };
 }
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <condition_variable>
+
+namespace Onyx::Graphics
+{
+    class GraphicsSystem;
+}
+
+namespace Onyx::Application
+{
+    // Renders frame contexts that got filled by the simulation on the main thread.
+    // The simulation of frame N + 1 runs while frame N gets recorded, the frame contexts are handed over at two sync points:
+    // WaitForFrameContext before the simulation writes into a frame context and SubmitFrame once it is complete.
+    // While pipelined, systems must only write render data into the simulation frame context and not record GPU commands,
+    // work on render state is handed over with GraphicsSystem::QueueRenderCommand. Frame memory of the render thread is bound to the rendered frame.
+    class RenderThread : public Thread
+    {
+    public:
+        explicit RenderThread(Graphics::GraphicsSystem& graphicsSystem);
+        ~RenderThread() override;
+
+        // blocks until all submitted frames are rendered and stops the thread
+        void Shutdown();
+
+        // blocks until the render thread no longer reads the frame context of the frame index
+        void WaitForFrameContext(onyxU8 frameIndex);
+        // hands the filled frame context over to the render thread, blocks while an earlier frame is still waiting to be rendered
+        void SubmitFrame(onyxU8 frameIndex);
+
+    private:
+        void OnStart() override;
+        void OnUpdate() override;
+        void OnStop() override;
+
+    private:
+        static constexpr onyxU8 NO_FRAME = onyxMax_U8;
+
+        Graphics::GraphicsSystem* m_GraphicsSystem = nullptr;
+
+        std::mutex m_Mutex;
+        std::condition_variable m_SubmitCondition;
+        std::condition_variable m_CompleteCondition;
+
+        onyxU8 m_SubmittedFrameIndex = NO_FRAME;
+        onyxU8 m_RenderingFrameIndex = NO_FRAME;
+        bool m_IsShuttingDown = false;
+    };
+}
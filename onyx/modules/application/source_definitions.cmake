@@ -6,6 +6,7 @@ set(onyx_TARGET_PUBLIC_SOURCES
     debug/gui/fpsstatusbaritem.h
     graphics/meshsourceasset.h
     log/logsinkfile.h
+    threading/renderthread.h
     taskgraph/taskgraph.h
     taskgraph/taskgraphtask.h
 )
@@ -19,6 +20,7 @@ set(onyx_TARGET_PRIVATE_SOURCES
     debug/gui/fpsstatusbaritem.cpp
     graphics/meshsourceasset.cpp
     log/logsinkfile.cpp
+    threading/renderthread.cpp
     taskgraph/taskgraph.cpp
     taskgraph/taskgraphtask.cpp
 )
\ No newline at end of file
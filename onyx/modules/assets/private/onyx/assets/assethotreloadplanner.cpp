@@ -0,0 +1,94 @@
+#include <onyx/assets/assethotreloadplanner.h>
+
+namespace Onyx::Assets
+{
+    void AssetHotReloadPlanner::CollectSettledChanges(HashMap<AssetId, AssetHotReloadPendingChange>& pendingChanges, onyxU64 currentTime, DynamicArray<FilePath>& outChangedFiles, HashSet<AssetId>& outChangedAssets)
+    {
+        for (auto it = pendingChanges.begin(); it != pendingChanges.end();)
+        {
+            const AssetHotReloadPendingChange& change = it->second;
+            if ((currentTime - change.LastEventTime) < DEBOUNCE_MILLISECONDS)
+            {
+                ++it;
+                continue;
+            }
+
+            outChangedFiles.push_back(change.Path);
+            outChangedAssets.insert(it->first);
+            it = pendingChanges.erase(it);
+        }
+    }
+
+    onyxU32 AssetHotReloadPlanner::PlanReloadWaves(const HashSet<AssetId>& changedAssets, const AssetHotReloadDependencies& dependencies, Queue<DynamicArray<AssetId>>& outWaves)
+    {
+        // collect the changed assets and everything that (transitively) depends on them
+        HashSet<AssetId> reloadAssets;
+        DynamicArray<AssetId> openList(changedAssets.begin(), changedAssets.end());
+        while (openList.empty() == false)
+        {
+            AssetId id = openList.back();
+            openList.pop_back();
+
+            if (reloadAssets.insert(id).second == false)
+                continue;
+
+            for (const AssetId& dependent : dependencies.GetDependents(id))
+                openList.push_back(dependent);
+        }
+
+        // count the dependencies inside the reload set, assets without any can be reloaded in the first wave
+        HashMap<AssetId, onyxU32> pendingDependencies;
+        for (const AssetId& id : reloadAssets)
+        {
+            onyxU32 dependencyCount = 0;
+            for (const AssetId& dependency : dependencies.GetDependencies(id))
+            {
+                if (reloadAssets.contains(dependency))
+                    ++dependencyCount;
+            }
+
+            pendingDependencies[id] = dependencyCount;
+        }
+
+        DynamicArray<AssetId> wave;
+        for (const auto& [id, dependencyCount] : pendingDependencies)
+        {
+            if (dependencyCount == 0)
+                wave.push_back(id);
+        }
+
+        onyxU64 queuedCount = 0;
+        while (wave.empty() == false)
+        {
+            DynamicArray<AssetId> nextWave;
+            for (const AssetId& id : wave)
+            {
+                for (const AssetId& dependent : dependencies.GetDependents(id))
+                {
+                    auto dependentIt = pendingDependencies.find(dependent);
+                    if ((dependentIt != pendingDependencies.end()) && (--dependentIt->second == 0))
+                        nextWave.push_back(dependent);
+                }
+            }
+
+            queuedCount += wave.size();
+            outWaves.push(std::move(wave));
+            wave = std::move(nextWave);
+        }
+
+        if (queuedCount == reloadAssets.size())
+            return 0;
+
+        // assets in a dependency cycle never reach zero, reload them together after everything else
+        DynamicArray<AssetId> cyclicAssets;
+        for (const auto& [id, dependencyCount] : pendingDependencies)
+        {
+            if (dependencyCount != 0)
+                cyclicAssets.push_back(id);
+        }
+
+        const onyxU32 cyclicCount = static_cast<onyxU32>(cyclicAssets.size());
+        outWaves.push(std::move(cyclicAssets));
+        return cyclicCount;
+    }
+}
@@ -2,6 +2,7 @@
 
 #include <onyx/assets/assetid.h>
 #include <onyx/assets/assetsystem.h>
+#include <onyx/time.h>
 
 namespace Onyx::Assets
 {
@@ -11,30 +12,101 @@ namespace Onyx::Assets
         m_DirectoryWatcher.OnFileChanged.Connect<&AssetHotReloadSystem::OnFileChanged>(this);
     }
 
+    AssetHotReloadSystem::~AssetHotReloadSystem()
+    {
+        m_DirectoryWatcher.OnFileChanged.Disconnect(this);
+    }
+
     void AssetHotReloadSystem::MonitorDirectory(const FilePath& path)
     {
         m_DirectoryWatcher.AddPath(path, true);
     }
 
-    void AssetHotReloadSystem::OnFileChanged(const FilePath& path, FileSystem::FileWatcher::FileAction action)
+    void AssetHotReloadSystem::DispatchFileChanges()
     {
-        AssetId assetId(path);
+        m_DirectoryWatcher.OnFileChanged.Dispatch();
+
+        const onyxU32 droppedCount = m_DirectoryWatcher.OnFileChanged.GetDroppedCount();
+        if (droppedCount != m_ReportedDroppedCount)
+        {
+            ONYX_LOG_WARNING("Hot reload dropped {} file change events, the file watcher queue is full.", droppedCount - m_ReportedDroppedCount);
+            m_ReportedDroppedCount = droppedCount;
+        }
+
+        if (m_PendingChanges.empty() == false)
+            FlushPendingChanges(Time::GetCurrentMilliseconds());
 
+        if (m_ReloadWaves.empty() == false && IsLoadingWaveFinished())
+            StartNextWave();
+    }
+
+    void AssetHotReloadSystem::OnFileChanged(const FilePath& path, FileSystem::FileWatcher::FileAction action)
+    {
         switch (action)
         {
-        case FileSystem::FileWatcher::FileAction::Add:
-            break;
-        case FileSystem::FileWatcher::FileAction::Delete:
-            break;
-        case FileSystem::FileWatcher::FileAction::Modified:
-            m_AssetSystem->ReloadAsset(assetId);
-            break;
-        case FileSystem::FileWatcher::FileAction::Moved:
-            break;
-        case FileSystem::FileWatcher::FileAction::Invalid:
-            break;
+            case FileSystem::FileWatcher::FileAction::Add:
+            case FileSystem::FileWatcher::FileAction::Modified:
+            case FileSystem::FileWatcher::FileAction::Moved:
+            {
+                // the asset id is the hash of the mount path, the watcher reports the absolute path
+                FilePath mountPath = FileSystem::Path::ConvertToMountPath(path);
+                AssetId assetId(mountPath);
+
+                AssetHotReloadPendingChange& change = m_PendingChanges[assetId];
+                change.Path = std::move(mountPath);
+                change.LastEventTime = Time::GetCurrentMilliseconds();
+                break;
+            }
+            case FileSystem::FileWatcher::FileAction::Delete:
+            case FileSystem::FileWatcher::FileAction::Invalid:
+                break;
         }
-        
+    }
+
+    void AssetHotReloadSystem::FlushPendingChanges(onyxU64 currentTime)
+    {
+        DynamicArray<FilePath> changedFiles;
+        HashSet<AssetId> changedAssets;
+        AssetHotReloadPlanner::CollectSettledChanges(m_PendingChanges, currentTime, changedFiles, changedAssets);
+
+        if (changedFiles.empty())
+            return;
+
+        // caches have to be up to date before the assets that use them get reloaded
+        m_FilesChangedSignal.Dispatch(changedFiles);
+
+        AssetHotReloadDependencies dependencies;
+        dependencies.GetDependents = [this](AssetId id) { return m_AssetSystem->GetDependents(id); };
+        dependencies.GetDependencies = [this](AssetId id) { return m_AssetSystem->GetDependencies(id); };
+
+        const onyxU32 cyclicCount = AssetHotReloadPlanner::PlanReloadWaves(changedAssets, dependencies, m_ReloadWaves);
+        if (cyclicCount != 0)
+            ONYX_LOG_WARNING("Hot reload found a dependency cycle between {} assets.", cyclicCount);
+    }
+
+    bool AssetHotReloadSystem::IsLoadingWaveFinished() const
+    {
+        if (m_IsWaveLoading == false)
+            return true;
+
+        const DynamicArray<AssetId>& loadingWave = m_ReloadWaves.front();
+        return std::ranges::none_of(loadingWave, [&](const AssetId& id) { return m_AssetSystem->IsLoading(id); });
+    }
+
+    void AssetHotReloadSystem::StartNextWave()
+    {
+        if (m_IsWaveLoading)
+        {
+            m_ReloadWaves.pop();
+            m_IsWaveLoading = false;
+
+            if (m_ReloadWaves.empty())
+                return;
+        }
+
+        for (const AssetId& id : m_ReloadWaves.front())
+            m_AssetSystem->ReloadAsset(id);
 
+        m_IsWaveLoading = true;
     }
 }
@@ -2,33 +2,52 @@
 
 #include <onyx/assets/asset.h>
 #include <onyx/assets/assetserializer.h>
-#include <onyx/filesystem/jsondeserializer.h>
+#include <onyx/filesystem/jsonstreamdeserializer.h>
 #include <onyx/filesystem/jsonserializer.h>
 #include <onyx/filesystem/onyxfile.h>
-#include <onyx/thread/async/asynctask.h>
 #include <onyx/thread/thread.h>
 
 ONYX_PROFILE_CREATE_TAG(AssetSystem, 0xfc6203);
 
 namespace Onyx::Assets
 {
-    void AssetLoadRequest::Start(Threading::ThreadPool& loaderPool)
+    namespace
     {
-        Threading::AsyncTask<void()> loadingTask([this]() { Load(); });
-        m_Future = loadingTask.GetFuture();
-        m_Future.Then([this]()
-        {
-            if (OnLoadFinished)
-                OnLoadFinished(Asset);
-        });
+        thread_local AssetId t_LoadingAssetId;
+    }
 
-        loaderPool.Post(std::move(loadingTask));
+    AssetId GetLoadingAssetId()
+    {
+        return t_LoadingAssetId;
     }
 
+    void AssetLoadRequest::Start(Threading::ThreadPool& loaderPool)
+    {
+        m_Task = Run(loaderPool);
+    }
 
     void AssetLoadRequest::Cancel()
     {
-        m_Future.Cancel();
+        m_StopSource.request_stop();
+        m_Task.GetFuture().Cancel();
+    }
+
+    Threading::Task<void> AssetLoadRequest::Run(Threading::ThreadPool& loaderPool)
+    {
+        co_await Threading::ResumeOn(loaderPool);
+        if (m_StopSource.stop_requested())
+            co_return;
+
+        Load();
+
+        // finish on the main thread so the loader does not get modified from pool threads
+        co_await Threading::ResumeOnMainThread();
+        if (m_StopSource.stop_requested())
+            co_return;
+
+        // might destroy this request, nothing should access members after this
+        if (OnLoadFinished)
+            OnLoadFinished(Asset);
     }
 
     void AssetLoadRequest::Load()
@@ -45,6 +64,9 @@ namespace Onyx::Assets
         
         //tracy_scope_AssetSystem.NameFmt("%s", assetName.c_str());
 
+        // assets requested while deserializing get recorded as dependencies of this asset
+        t_LoadingAssetId = MetaData.Id;
+
         bool succeeded = false;
         FileSystem::OnyxFile assetFile(path);
         switch (MetaData.Format)
@@ -55,13 +77,15 @@ namespace Onyx::Assets
                 break;
             case AssetFormat::Json:
             {
-                const FileSystem::JsonValue& inputConfigData = assetFile.LoadJson();
-                FileSystem::JsonDeserializer serializer(inputConfigData.Json);
-                succeeded = Serializer->Deserialize(Asset, MetaData, serializer, *Engine);
+                FileSystem::JsonStreamDeserializer deserializer;
+                if (deserializer.Load(assetFile))
+                    succeeded = Serializer->Deserialize(Asset, MetaData, deserializer, *Engine);
                 break;
             }
         }
 
+        t_LoadingAssetId = AssetId();
+
         // first trigger loaded callbacks, than set the asset to be valid / loaded
         AssetState state = succeeded ? AssetState::Loaded : AssetState::Invalid;
         Asset->OnLoadFinished(Asset.GetId(), state);
@@ -70,22 +94,30 @@ namespace Onyx::Assets
 #if ONYX_IS_EDITOR
     void AssetSaveRequest::Start(Threading::ThreadPool& loaderPool)
     {
-        ONYX_PROFILE(AssetSystem);
-        
-        Threading::AsyncTask<void()> saveTask([this]() { Save(); });
-        m_Future = saveTask.GetFuture();
-        m_Future.Then([this]()
-            {
-                if (OnSaveFinished)
-                    OnSaveFinished(Asset);
-            });
-
-        loaderPool.Post(saveTask);
+        m_Task = Run(loaderPool);
     }
 
     void AssetSaveRequest::Cancel()
     {
-        m_Future.Cancel();
+        m_StopSource.request_stop();
+        m_Task.GetFuture().Cancel();
+    }
+
+    Threading::Task<void> AssetSaveRequest::Run(Threading::ThreadPool& loaderPool)
+    {
+        co_await Threading::ResumeOn(loaderPool);
+        if (m_StopSource.stop_requested())
+            co_return;
+
+        Save();
+
+        co_await Threading::ResumeOnMainThread();
+        if (m_StopSource.stop_requested())
+            co_return;
+
+        // might destroy this request, nothing should access members after this
+        if (OnSaveFinished)
+            OnSaveFinished(Asset);
     }
 
     void AssetSaveRequest::Save()
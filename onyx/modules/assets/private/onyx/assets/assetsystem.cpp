@@ -69,10 +69,24 @@ namespace Onyx::Assets
             ONYX_LOG_FATAL("Failed loading asset meta data");
             return;
         }
+
+#if !ONYX_IS_RETAIL
+        m_HotReloadSystem = MakeUnique<AssetHotReloadSystem>(*this);
+        for (auto& [mountIdentifier, mountPoint] : FileSystem::Path::GetMountPoints())
+        {
+            if (mountIdentifier == FileSystem::Path::TMP_MOUNT_POINT_ID)
+                continue;
+
+            m_HotReloadSystem->MonitorDirectory(mountPoint.Path);
+        }
+#endif
     }
 
     AssetSystem::~AssetSystem()
     {
+#if !ONYX_IS_RETAIL
+        m_HotReloadSystem.reset();
+#endif
         m_AssetsMetaData.clear();
         m_LoadedAssets.clear();
     }
@@ -90,6 +104,9 @@ namespace Onyx::Assets
         const AssetMetaData& metaData = assetIt->second;
         if (metaData.Handle != INVALID_INDEX_64)
         {
+            // the reload records the dependencies again
+            ClearDependencies(id);
+
             AssetHandle<AssetInterface>& reloadAsset = m_LoadedAssets[metaData.Handle];
             reloadAsset->SetState(AssetState::Loading);
             {
@@ -99,4 +116,73 @@ namespace Onyx::Assets
             }
         }
     }
+
+    void AssetSystem::AddDependency(AssetId asset, AssetId dependency)
+    {
+        if ((asset.IsValid() == false) || (dependency.IsValid() == false) || (asset == dependency))
+            return;
+
+        std::lock_guard lock(m_DependencyMutex);
+        m_Dependencies[asset].insert(dependency);
+        m_Dependents[dependency].insert(asset);
+    }
+
+    void AssetSystem::AddLoadDependency(AssetId dependency)
+    {
+        AddDependency(GetLoadingAssetId(), dependency);
+    }
+
+    DynamicArray<AssetId> AssetSystem::GetDependencies(AssetId id) const
+    {
+        std::lock_guard lock(m_DependencyMutex);
+        auto it = m_Dependencies.find(id);
+        if (it == m_Dependencies.end())
+            return {};
+
+        return DynamicArray<AssetId>(it->second.begin(), it->second.end());
+    }
+
+    DynamicArray<AssetId> AssetSystem::GetDependents(AssetId id) const
+    {
+        std::lock_guard lock(m_DependencyMutex);
+        auto it = m_Dependents.find(id);
+        if (it == m_Dependents.end())
+            return {};
+
+        return DynamicArray<AssetId>(it->second.begin(), it->second.end());
+    }
+
+    bool AssetSystem::IsLoading(AssetId id)
+    {
+        std::lock_guard lock(m_Mutex);
+        return m_IOHandler.IsLoading(id);
+    }
+
+#if !ONYX_IS_RETAIL
+    void AssetSystem::DispatchFileChanges()
+    {
+        m_HotReloadSystem->DispatchFileChanges();
+    }
+#endif
+
+    void AssetSystem::ClearDependencies(AssetId id)
+    {
+        std::lock_guard lock(m_DependencyMutex);
+        auto it = m_Dependencies.find(id);
+        if (it == m_Dependencies.end())
+            return;
+
+        for (const AssetId& dependency : it->second)
+        {
+            auto dependentsIt = m_Dependents.find(dependency);
+            if (dependentsIt == m_Dependents.end())
+                continue;
+
+            dependentsIt->second.erase(id);
+            if (dependentsIt->second.empty())
+                m_Dependents.erase(dependentsIt);
+        }
+
+        m_Dependencies.erase(it);
+    }
 }
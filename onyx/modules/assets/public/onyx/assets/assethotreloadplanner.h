@@ -0,0 +1,34 @@
+#pragma once
+
+#include <onyx/assets/assetid.h>
+#include <onyx/inplacefunction.h>
+
+namespace Onyx::Assets
+{
+    struct AssetHotReloadPendingChange
+    {
+        FilePath Path;
+        onyxU64 LastEventTime = 0;
+    };
+
+    // dependents are the assets that load the asset, dependencies the assets it loads
+    struct AssetHotReloadDependencies
+    {
+        InplaceFunction<DynamicArray<AssetId>(AssetId)> GetDependents;
+        InplaceFunction<DynamicArray<AssetId>(AssetId)> GetDependencies;
+    };
+
+    // Decides which file changes settled and in which order the affected assets get reloaded, the hot reload system applies the result.
+    class AssetHotReloadPlanner
+    {
+    public:
+        static constexpr onyxU64 DEBOUNCE_MILLISECONDS = 150;
+
+        // moves the changes that did not get an event for DEBOUNCE_MILLISECONDS out of the pending changes
+        static void CollectSettledChanges(HashMap<AssetId, AssetHotReloadPendingChange>& pendingChanges, onyxU64 currentTime, DynamicArray<FilePath>& outChangedFiles, HashSet<AssetId>& outChangedAssets);
+
+        // appends the changed assets and their transitive dependents in waves, an asset is only in a wave after all its dependencies
+        // assets in a dependency cycle are appended together as the last wave, returns their count
+        static onyxU32 PlanReloadWaves(const HashSet<AssetId>& changedAssets, const AssetHotReloadDependencies& dependencies, Queue<DynamicArray<AssetId>>& outWaves);
+    };
+}
@@ -1,7 +1,10 @@
 #pragma once
 
 #include <onyx/noncopyable.h>
+#include <onyx/assets/assetid.h>
+#include <onyx/assets/assethotreloadplanner.h>
 #include <onyx/filesystem/filewatcher.h>
+#include <onyx/function/signal.h>
 
 namespace Onyx::Assets
 {
@@ -10,16 +13,57 @@ namespace Onyx::Assets
 
 namespace Onyx::Assets
 {
+    // Collects the file changes of the monitored directories and reloads the changed assets in batches.
+    // Events are debounced per file until it did not change for DEBOUNCE_MILLISECONDS, editors that save through a temporary file produce several events per save.
+    // Assets that depend on a changed asset are reloaded as well, in waves so dependencies finished loading before their dependents start.
     class AssetHotReloadSystem : public NonCopyable
     {
     public:
+        static constexpr onyxU64 DEBOUNCE_MILLISECONDS = AssetHotReloadPlanner::DEBOUNCE_MILLISECONDS;
+
+        // mount paths of the changed files, called before the assets get reloaded
+        using FilesChangedSignalT = Signal<void(const DynamicArray<FilePath>&)>;
+
         AssetHotReloadSystem(AssetSystem& assetSystem);
+        ~AssetHotReloadSystem();
+
         void MonitorDirectory(const FilePath& path);
 
+        // has to be called from the main thread
+        void DispatchFileChanges();
+
+        // for caches of files that are not loaded as assets (e.g.: shader includes)
+        template<auto Candidate, typename Type>
+        void OnFilesChanged(Type* instance)
+        {
+            Sink sink(m_FilesChangedSignal);
+            sink.template Connect<Candidate>(instance);
+        }
+
+        template <typename Type>
+        void DisconnectSignals(Type* instance)
+        {
+            Sink sink(m_FilesChangedSignal);
+            sink.Disconnect(instance);
+        }
+
+    private:
         void OnFileChanged(const FilePath& path, FileSystem::FileWatcher::FileAction action);
 
+        void FlushPendingChanges(onyxU64 currentTime);
+        bool IsLoadingWaveFinished() const;
+        void StartNextWave();
+
     private:
         AssetSystem* m_AssetSystem = nullptr;
         FileSystem::FileWatcher m_DirectoryWatcher;
+        onyxU32 m_ReportedDroppedCount = 0;
+        FilesChangedSignalT m_FilesChangedSignal;
+
+        HashMap<AssetId, AssetHotReloadPendingChange> m_PendingChanges;
+
+        // front wave is loading
+        Queue<DynamicArray<AssetId>> m_ReloadWaves;
+        bool m_IsWaveLoading = false;
     };
 }
@@ -5,6 +5,7 @@
 namespace Onyx::Assets
 {
     // AssetId is the hash of the asset full path e.g.: C:/MyProject/data/mytext.txt
+    // Stays on FNV-1a as ids are serialized into asset files (e.g. .orendergraph shader references) and have to be computable at compile time
     struct AssetId
     {
         static constexpr onyxU64 Invalid = 0;
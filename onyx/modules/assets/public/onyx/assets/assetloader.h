@@ -31,6 +31,8 @@ namespace Onyx::Assets
             m_LoadRequests[metaData.Id] = std::move(loadRequest);
         }
 
+        bool IsLoading(AssetId id) const { return m_LoadRequests.contains(id); }
+
 #if ONYX_IS_EDITOR
         void RequestSave(const AssetMetaData& metaData, const AssetHandle<AssetInterface>& assetHandle, const UniquePtr<IAssetSerializer>& serializer, const IEngine* engine)
         {
@@ -2,7 +2,7 @@
 
 #include <onyx/assets/asset.h>
 
-#include <onyx/thread/async/future.h>
+#include <onyx/thread/async/task.h>
 #include <onyx/thread/threadpool/threadpool.h>
 
 #include <onyx/assets/assethandle.h>
@@ -19,6 +19,9 @@ namespace Onyx::Assets
     struct AssetId;
     class AssetInterface;
 
+    // id of the asset that is deserialized on the calling thread, invalid outside of a load
+    AssetId GetLoadingAssetId();
+
     struct AssetLoadRequest
     {
     public:
@@ -32,10 +35,12 @@ namespace Onyx::Assets
 
         Callback<void(AssetHandle<AssetInterface>&)> OnLoadFinished;
     private:
+        Threading::Task<void> Run(Threading::ThreadPool& loaderPool);
         void Load();
 
     private:
-        Threading::Future<void> m_Future;
+        Threading::Task<void> m_Task;
+        std::stop_source m_StopSource;
     };
 
 #if ONYX_IS_EDITOR
@@ -52,10 +57,12 @@ namespace Onyx::Assets
 
         Callback<void(const AssetHandle<AssetInterface>&)> OnSaveFinished;
     private:
+        Threading::Task<void> Run(Threading::ThreadPool& loaderPool);
         void Save();
 
     private:
-        Threading::Future<void> m_Future;
+        Threading::Task<void> m_Task;
+        std::stop_source m_StopSource;
     };
 #endif
 
@@ -3,6 +3,7 @@
 #include <onyx/engine/enginesystem.h>
 
 #include <onyx/assets/asset.h>
+#include <onyx/assets/assethotreloadsystem.h>
 #include <onyx/assets/assetloader.h>
 
 #include <onyx/filesystem/path.h>
@@ -173,10 +174,38 @@ namespace Onyx::Assets
 
         void ReloadAsset(AssetId id);
 
+        // asset gets reloaded after dependency changed, assets requested while loading are recorded automatically
+        void AddDependency(AssetId asset, AssetId dependency);
+        // adds the dependency to the asset that is loading on the calling thread, for files that are not loaded as assets (e.g.: shader includes)
+        void AddLoadDependency(AssetId dependency);
+
+        DynamicArray<AssetId> GetDependencies(AssetId id) const;
+        DynamicArray<AssetId> GetDependents(AssetId id) const;
+
+        bool IsLoading(AssetId id);
+
+#if !ONYX_IS_RETAIL
+        AssetHotReloadSystem& GetHotReloadSystem() { return *m_HotReloadSystem; }
+
+        // reloads changed assets and their dependents, has to be called from the main thread
+        void DispatchFileChanges();
+#endif
+
+    private:
+        void ClearDependencies(AssetId id);
+
     private:
         std::mutex m_Mutex;
         AssetIOHandler m_IOHandler;
 
+        mutable std::mutex m_DependencyMutex;
+        HashMap<AssetId, HashSet<AssetId>> m_Dependencies;
+        HashMap<AssetId, HashSet<AssetId>> m_Dependents;
+
+#if !ONYX_IS_RETAIL
+        UniquePtr<AssetHotReloadSystem> m_HotReloadSystem;
+#endif
+
         HashMap<AssetId, AssetMetaData> m_AssetsMetaData;
         DynamicArray<AssetHandle<AssetInterface>> m_LoadedAssets;
 
@@ -199,6 +228,8 @@ namespace Onyx::Assets
         }
 #endif
 
+        AddLoadDependency(id);
+
         AssetMetaData& metaData = assetIt->second;
         if ((metaData.Handle != INVALID_INDEX_64) && (forceLoad == false))
         {
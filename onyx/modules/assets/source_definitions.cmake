@@ -2,6 +2,7 @@ set(onyx_TARGET_PUBLIC_SOURCES
     asset.h
     assetformat.h
     assethandle.h
+    assethotreloadplanner.h
     assethotreloadsystem.h
     assetid.h
     assetloader.h
@@ -11,6 +12,7 @@ set(onyx_TARGET_PUBLIC_SOURCES
 )
 
 set(onyx_TARGET_PRIVATE_SOURCES
+    assethotreloadplanner.cpp
     assethotreloadsystem.cpp
     assetid.cpp
     assetloader.cpp
@@ -0,0 +1,132 @@
+#include <onyx/engine/frametimer.h>
+
+#include <onyx/serialize/deserializer.h>
+#include <onyx/serialize/serializer.h>
+
+#include <thread>
+
+namespace Onyx
+{
+    namespace
+    {
+        constexpr onyxU64 NANOSECONDS_PER_SECOND = 1'000'000'000;
+        constexpr onyxU64 NANOSECONDS_PER_MICROSECOND = 1'000;
+
+        onyxU64 GetIntervalNanoseconds(onyxU32 ratePerSecond)
+        {
+            return (ratePerSecond == 0) ? 0 : NANOSECONDS_PER_SECOND / ratePerSecond;
+        }
+    }
+
+    FrameTimer::FrameTimer(const FrameTimerSettings& settings)
+    {
+        SetSettings(settings);
+    }
+
+    void FrameTimer::SetSettings(const FrameTimerSettings& settings)
+    {
+        m_Settings = settings;
+        m_FixedStepNanoseconds = GetIntervalNanoseconds(settings.FixedUpdateRate);
+        m_FrameLimitNanoseconds = GetIntervalNanoseconds(settings.FrameRateLimit);
+
+        // the next deadline gets scheduled from the current frame start
+        m_NextFrameStart = 0;
+        if (m_FixedStepNanoseconds != 0)
+            m_Accumulator %= m_FixedStepNanoseconds;
+    }
+
+    void FrameTimer::BeginFrame()
+    {
+        BeginFrame(Time::GetCurrentNanoseconds());
+    }
+
+    void FrameTimer::BeginFrame(onyxU64 currentNanoseconds)
+    {
+        BeginFrame(currentNanoseconds, m_HasStarted ? (currentNanoseconds - m_LastFrameStart) : 0);
+    }
+
+    void FrameTimer::BeginFrame(onyxU64 currentNanoseconds, DeltaGameTime delta)
+    {
+        const onyxU64 deltaNanoseconds = delta.DeltaNanoseconds;
+        m_HasStarted = true;
+        m_LastFrameStart = currentNanoseconds;
+
+        m_Delta = deltaNanoseconds;
+        m_Time = m_Time + deltaNanoseconds;
+
+        if (m_FixedStepNanoseconds == 0)
+        {
+            // without a fixed step the simulation runs once per frame with the frame delta
+            m_FixedTime.StepCount = 1;
+            m_FixedTime.StepDelta = deltaNanoseconds;
+            m_FixedTime.Interpolation = 1.0f;
+            return;
+        }
+
+        m_Accumulator += deltaNanoseconds;
+
+        // steps above the maximum are dropped instead of being carried over, otherwise a single hitch makes every following frame catch up
+        const onyxU64 stepCount = std::min<onyxU64>(m_Accumulator / m_FixedStepNanoseconds, m_Settings.MaxFixedStepsPerFrame);
+        m_Accumulator %= m_FixedStepNanoseconds;
+
+        m_FixedTime.StepCount = static_cast<onyxU32>(stepCount);
+        m_FixedTime.StepDelta = m_FixedStepNanoseconds;
+        m_FixedTime.Interpolation = static_cast<onyxF32>(static_cast<onyxF64>(m_Accumulator) / static_cast<onyxF64>(m_FixedStepNanoseconds));
+    }
+
+    onyxU64 FrameTimer::GetRemainingFrameTime(onyxU64 currentNanoseconds) const
+    {
+        if (m_FrameLimitNanoseconds == 0)
+            return 0;
+
+        const onyxU64 nextFrameStart = (m_NextFrameStart == 0) ? (m_LastFrameStart + m_FrameLimitNanoseconds) : m_NextFrameStart;
+        return (nextFrameStart > currentNanoseconds) ? (nextFrameStart - currentNanoseconds) : 0;
+    }
+
+    void FrameTimer::LimitFrameRate()
+    {
+        if (m_FrameLimitNanoseconds == 0)
+            return;
+
+        if (m_NextFrameStart == 0)
+            m_NextFrameStart = m_LastFrameStart + m_FrameLimitNanoseconds;
+
+        // sleep wakes up late by up to a scheduler tick, so the last part of the wait is spent spinning
+        const onyxU64 spinNanoseconds = static_cast<onyxU64>(m_Settings.SpinMicroseconds) * NANOSECONDS_PER_MICROSECOND;
+        onyxU64 currentNanoseconds = Time::GetCurrentNanoseconds();
+        for (onyxU64 remaining = GetRemainingFrameTime(currentNanoseconds); remaining != 0; remaining = GetRemainingFrameTime(currentNanoseconds))
+        {
+            if (remaining > spinNanoseconds)
+                std::this_thread::sleep_for(std::chrono::nanoseconds(remaining - spinNanoseconds));
+            else
+                std::this_thread::yield();
+
+            currentNanoseconds = Time::GetCurrentNanoseconds();
+        }
+
+        // deadlines advance by a fixed interval so overshooting one frame is made up in the next,
+        // if we fell behind by more than a frame the schedule restarts from now instead of rushing through frames
+        m_NextFrameStart += m_FrameLimitNanoseconds;
+        if (m_NextFrameStart <= currentNanoseconds)
+            m_NextFrameStart = currentNanoseconds + m_FrameLimitNanoseconds;
+    }
+
+    bool Serialization<FrameTimerSettings>::Serialize(Serializer& serializer, const FrameTimerSettings& settings)
+    {
+        serializer.Write<"fixedupdaterate">(settings.FixedUpdateRate);
+        serializer.Write<"maxfixedsteps">(settings.MaxFixedStepsPerFrame);
+        serializer.Write<"framelimit">(settings.FrameRateLimit);
+        serializer.Write<"spinmicroseconds">(settings.SpinMicroseconds);
+        return true;
+    }
+
+    bool Serialization<FrameTimerSettings>::Deserialize(const Deserializer& deserializer, FrameTimerSettings& outSettings)
+    {
+        // all keys are optional, missing ones keep their default
+        deserializer.Read<"fixedupdaterate">(outSettings.FixedUpdateRate);
+        deserializer.Read<"maxfixedsteps">(outSettings.MaxFixedStepsPerFrame);
+        deserializer.Read<"framelimit">(outSettings.FrameRateLimit);
+        deserializer.Read<"spinmicroseconds">(outSettings.SpinMicroseconds);
+        return true;
+    }
+}
@@ -1,5 +1,12 @@
 #include <onyx/hash.h>
 
+#include <bit>
+#include <cstring>
+
+#if ONYX_IS_MSVC
+#include <intrin.h>
+#endif
+
 namespace Onyx::Hash
 {
     namespace
@@ -59,6 +66,127 @@ namespace Onyx::Hash
             0x5D681B02U, 0x2A6F2B94U, 0xB40BBE37U, 0xC30C8EA1U, 0x5A05DF1BU,
             0x2D02EF8DU
         };
+
+        // wyhash secrets, odd 64 bit constants with 32 bits set
+        constexpr onyxU64 SECRET_0 = 0xa0761d6478bd642full;
+        constexpr onyxU64 SECRET_1 = 0xe7037ed1a0b428dbull;
+        constexpr onyxU64 SECRET_2 = 0x8ebc6af09c88c6e3ull;
+        constexpr onyxU64 SECRET_3 = 0x589965cc75374cc3ull;
+
+        // full 128 bit product of a and b, low half in a and high half in b
+        inline void Multiply(onyxU64& a, onyxU64& b)
+        {
+#if ONYX_IS_MSVC
+            const onyxU64 low = a * b;
+            b = __umulh(a, b);
+            a = low;
+#else
+            const __uint128_t product = static_cast<__uint128_t>(a) * b;
+            a = static_cast<onyxU64>(product);
+            b = static_cast<onyxU64>(product >> 64);
+#endif
+        }
+
+        inline onyxU64 Mix(onyxU64 a, onyxU64 b)
+        {
+            Multiply(a, b);
+            return a ^ b;
+        }
+
+        inline onyxU64 Read8(const onyxU8* data)
+        {
+            onyxU64 value;
+            std::memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        inline onyxU64 Read4(const onyxU8* data)
+        {
+            onyxU32 value;
+            std::memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        // 1 to 3 bytes
+        inline onyxU64 Read3(const onyxU8* data, onyxU64 length)
+        {
+            return (static_cast<onyxU64>(data[0]) << 16) | (static_cast<onyxU64>(data[length >> 1]) << 8) | data[length - 1];
+        }
+
+        inline onyxU64 InitSeed(onyxU64 seed)
+        {
+            return seed ^ Mix(seed ^ SECRET_0, SECRET_1);
+        }
+
+        inline void ProcessBlock(onyxU64 (&lanes)[3], const onyxU8* block)
+        {
+            lanes[0] = Mix(Read8(block) ^ SECRET_1, Read8(block + 8) ^ lanes[0]);
+            lanes[1] = Mix(Read8(block + 16) ^ SECRET_2, Read8(block + 24) ^ lanes[1]);
+            lanes[2] = Mix(Read8(block + 32) ^ SECRET_3, Read8(block + 40) ^ lanes[2]);
+        }
+
+        // the 128 bit hash folds the lanes a second way so both halves depend on all of them
+        inline onyxU64 FoldLanesHigh(const onyxU64 (&lanes)[3])
+        {
+            return (lanes[0] ^ SECRET_3) + std::rotl(lanes[1], 23) + std::rotl(lanes[2], 47);
+        }
+
+        // tail is the unprocessed input, 0 to 16 bytes for inputs of up to 16 bytes and 17 to 64 bytes otherwise
+        inline void MixTail(const onyxU8* tail, onyxU64 tailLength, onyxU64 length, onyxU64& seed, onyxU64& a, onyxU64& b)
+        {
+            if (length <= 16)
+            {
+                if (tailLength >= 4)
+                {
+                    const onyxU64 offset = (tailLength >> 3) << 2;
+                    a = (Read4(tail) << 32) | Read4(tail + offset);
+                    b = (Read4(tail + tailLength - 4) << 32) | Read4(tail + tailLength - 4 - offset);
+                }
+                else if (tailLength > 0)
+                {
+                    a = Read3(tail, tailLength);
+                    b = 0;
+                }
+                else
+                {
+                    a = 0;
+                    b = 0;
+                }
+                return;
+            }
+
+            for (onyxU64 i = 16; i < tailLength; i += 16)
+                seed = Mix(Read8(tail + i - 16) ^ SECRET_1, Read8(tail + i - 8) ^ seed);
+
+            a = Read8(tail + tailLength - 16);
+            b = Read8(tail + tailLength - 8);
+        }
+
+        inline onyxU64 Finalize(onyxU64 a, onyxU64 b, onyxU64 seed, onyxU64 length, onyxU64 secretA, onyxU64 secretB)
+        {
+            a ^= SECRET_1;
+            b ^= seed;
+            Multiply(a, b);
+            return Mix(a ^ secretA ^ length, b ^ secretB);
+        }
+
+        onyxU64 Hash64Tail(const onyxU8* tail, onyxU64 tailLength, onyxU64 length, onyxU64 seed)
+        {
+            onyxU64 a, b;
+            MixTail(tail, tailLength, length, seed, a, b);
+            return Finalize(a, b, seed, length, SECRET_0, SECRET_1);
+        }
+
+        Hash128 Hash128Tail(const onyxU8* tail, onyxU64 tailLength, onyxU64 length, onyxU64 lowSeed, onyxU64 highSeed)
+        {
+            Hash128 hash;
+            hash.Low = Hash64Tail(tail, tailLength, length, lowSeed);
+
+            onyxU64 a, b;
+            MixTail(tail, tailLength, length, highSeed, a, b);
+            hash.High = Finalize(a, b, highSeed, length, SECRET_2, SECRET_3);
+            return hash;
+        }
     }
 
     constexpr onyxU32 CRC32(const char* data, onyxU64 len, onyxU32 crc)
@@ -77,4 +205,98 @@ namespace Onyx::Hash
     {
         return CRC32(str.data(), str.length(), crc);
     };
+
+    onyxU64 FastHash64Bytes(const void* data, onyxU64 length, onyxU64 seed)
+    {
+        const onyxU8* input = static_cast<const onyxU8*>(data);
+        seed = InitSeed(seed);
+
+        onyxU64 remaining = length;
+        if (remaining > FastHasher::BUFFER_SIZE)
+        {
+            onyxU64 lanes[3] = { seed, seed, seed };
+            for (; remaining > FastHasher::BUFFER_SIZE; remaining -= FastHasher::BLOCK_SIZE, input += FastHasher::BLOCK_SIZE)
+                ProcessBlock(lanes, input);
+
+            seed = lanes[0] ^ lanes[1] ^ lanes[2];
+        }
+
+        return Hash64Tail(input, remaining, length, seed);
+    }
+
+    Hash128 FastHash128Bytes(const void* data, onyxU64 length, onyxU64 seed)
+    {
+        const onyxU8* input = static_cast<const onyxU8*>(data);
+        seed = InitSeed(seed);
+
+        onyxU64 remaining = length;
+        if (remaining > FastHasher::BUFFER_SIZE)
+        {
+            onyxU64 lanes[3] = { seed, seed, seed };
+            for (; remaining > FastHasher::BUFFER_SIZE; remaining -= FastHasher::BLOCK_SIZE, input += FastHasher::BLOCK_SIZE)
+                ProcessBlock(lanes, input);
+
+            return Hash128Tail(input, remaining, length, lanes[0] ^ lanes[1] ^ lanes[2], FoldLanesHigh(lanes));
+        }
+
+        return Hash128Tail(input, remaining, length, seed, seed ^ SECRET_2);
+    }
+
+    FastHasher::FastHasher(onyxU64 seed)
+    {
+        Reset(seed);
+    }
+
+    void FastHasher::Reset(onyxU64 seed)
+    {
+        m_Seed = InitSeed(seed);
+        m_Lanes[0] = m_Seed;
+        m_Lanes[1] = m_Seed;
+        m_Lanes[2] = m_Seed;
+        m_Length = 0;
+        m_BufferSize = 0;
+    }
+
+    void FastHasher::Update(const void* data, onyxU64 length)
+    {
+        const onyxU8* input = static_cast<const onyxU8*>(data);
+        m_Length += length;
+
+        // a block is only consumed once more input follows, so the last BUFFER_SIZE bytes stay buffered like in the one shot version
+        if ((m_BufferSize == 0) && (length > BUFFER_SIZE))
+        {
+            for (; length > BUFFER_SIZE; length -= BLOCK_SIZE, input += BLOCK_SIZE)
+                ProcessBlock(m_Lanes, input);
+        }
+
+        while (length > 0)
+        {
+            if (m_BufferSize == BUFFER_SIZE)
+            {
+                ProcessBlock(m_Lanes, m_Buffer);
+                std::memmove(m_Buffer, m_Buffer + BLOCK_SIZE, BUFFER_SIZE - BLOCK_SIZE);
+                m_BufferSize = BUFFER_SIZE - BLOCK_SIZE;
+            }
+
+            const onyxU64 copySize = std::min(length, BUFFER_SIZE - m_BufferSize);
+            std::memcpy(m_Buffer + m_BufferSize, input, copySize);
+            m_BufferSize += copySize;
+            input += copySize;
+            length -= copySize;
+        }
+    }
+
+    onyxU64 FastHasher::Finalize64() const
+    {
+        const onyxU64 seed = (m_Length > BUFFER_SIZE) ? (m_Lanes[0] ^ m_Lanes[1] ^ m_Lanes[2]) : m_Seed;
+        return Hash64Tail(m_Buffer, m_BufferSize, m_Length, seed);
+    }
+
+    Hash128 FastHasher::Finalize128() const
+    {
+        if (m_Length > BUFFER_SIZE)
+            return Hash128Tail(m_Buffer, m_BufferSize, m_Length, m_Lanes[0] ^ m_Lanes[1] ^ m_Lanes[2], FoldLanesHigh(m_Lanes));
+
+        return Hash128Tail(m_Buffer, m_BufferSize, m_Length, m_Seed, m_Seed ^ SECRET_2);
+    }
 }
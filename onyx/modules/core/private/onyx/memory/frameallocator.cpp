@@ -0,0 +1,173 @@
+#include <onyx/memory/frameallocator.h>
+
+#include <bit>
+
+namespace Onyx
+{
+    namespace
+    {
+        Atomic<onyxU32> s_NextFrameAllocatorId = 1;
+
+        // most threads only ever use one frame allocator, cache it to skip the lookup
+        struct ThreadAllocatorCache
+        {
+            onyxU32 FrameAllocatorId = 0;
+            void* Allocator = nullptr;
+        };
+
+        thread_local ThreadAllocatorCache t_ThreadAllocatorCache;
+    }
+
+    LinearAllocator::LinearAllocator(onyxU32 blockSize)
+        : m_BlockSize(blockSize)
+    {
+    }
+
+    void* LinearAllocator::Allocate(size_t size, size_t alignment)
+    {
+        ONYX_ASSERT(std::has_single_bit(alignment), "Alignment has to be a power of 2");
+
+        if (m_Blocks.empty() == false)
+        {
+            Block& block = m_Blocks[m_CurrentBlock];
+            const uintptr_t blockStart = reinterpret_cast<uintptr_t>(block.Data.get());
+            const uintptr_t alignedAddress = (blockStart + m_Offset + alignment - 1) & ~(alignment - 1);
+            const size_t newOffset = (alignedAddress - blockStart) + size;
+
+            if (newOffset <= block.Size)
+            {
+                m_UsedBytes += newOffset - m_Offset;
+                m_Offset = newOffset;
+                return reinterpret_cast<void*>(alignedAddress);
+            }
+        }
+
+        // the rest of the current block is wasted for this frame, Reset merges the blocks so the next frame fits in one
+        if ((m_CurrentBlock + 1) < m_Blocks.size() && (m_Blocks[m_CurrentBlock + 1].Size >= size + alignment))
+            ++m_CurrentBlock;
+        else
+            AddBlock(size + alignment);
+
+        m_Offset = 0;
+        return Allocate(size, alignment);
+    }
+
+    void LinearAllocator::Reset()
+    {
+        m_HighWaterMark = std::max(m_HighWaterMark, m_UsedBytes);
+
+        if (m_Blocks.size() > 1)
+        {
+            const size_t capacity = GetCapacity();
+            m_Blocks.clear();
+            AddBlock(capacity);
+        }
+
+        m_CurrentBlock = 0;
+        m_Offset = 0;
+        m_UsedBytes = 0;
+    }
+
+    size_t LinearAllocator::GetCapacity() const
+    {
+        size_t capacity = 0;
+        for (const Block& block : m_Blocks)
+            capacity += block.Size;
+
+        return capacity;
+    }
+
+    void LinearAllocator::AddBlock(size_t minSize)
+    {
+        Block& block = m_Blocks.emplace_back();
+        block.Size = std::max(minSize, m_BlockSize);
+        block.Data = UniquePtr<onyxU8[]>(new onyxU8[block.Size]);
+
+        m_CurrentBlock = static_cast<onyxU32>(m_Blocks.size() - 1);
+    }
+
+    FrameAllocator::ThreadAllocator::ThreadAllocator(onyxU8 frameCount, onyxU32 blockSize)
+        : ThreadId(std::this_thread::get_id())
+    {
+        for (onyxU8 i = 0; i < frameCount; ++i)
+            Frames.emplace_back(MakeUnique<LinearAllocator>(blockSize));
+    }
+
+    FrameAllocator::FrameAllocator(onyxU8 frameCount, onyxU32 blockSize)
+        : m_FrameCount(frameCount)
+        , m_BlockSize(blockSize)
+        , m_Id(s_NextFrameAllocatorId.fetch_add(1, std::memory_order_relaxed))
+    {
+        ONYX_ASSERT((frameCount > 0) && (frameCount <= MAX_FRAME_COUNT), "Frame count has to be in the range [1, {}]", MAX_FRAME_COUNT);
+    }
+
+    FrameAllocator::~FrameAllocator()
+    {
+        if (t_ThreadAllocatorCache.FrameAllocatorId == m_Id)
+            t_ThreadAllocatorCache = {};
+    }
+
+    void FrameAllocator::BeginFrame(onyxU8 frameIndex)
+    {
+        const onyxU8 frame = frameIndex % m_FrameCount;
+
+        std::lock_guard lock(m_Mutex);
+        FrameAllocatorStats stats;
+        stats.ThreadCount = static_cast<onyxU32>(m_ThreadAllocators.size());
+
+        for (UniquePtr<ThreadAllocator>& threadAllocator : m_ThreadAllocators)
+        {
+            LinearAllocator& allocator = *threadAllocator->Frames[frame];
+            stats.UsedBytes += allocator.GetUsedBytes();
+            stats.CapacityBytes += allocator.GetCapacity();
+            allocator.Reset();
+        }
+
+        stats.HighWaterMark = std::max(m_Stats.HighWaterMark, stats.UsedBytes);
+        m_Stats = stats;
+
+        m_CurrentFrame.store(frame, std::memory_order_release);
+    }
+
+    void FrameAllocator::BindThreadFrame(onyxU8 frameIndex)
+    {
+        GetThreadAllocatorEntry().BoundFrame = frameIndex % m_FrameCount;
+    }
+
+    void FrameAllocator::UnbindThreadFrame()
+    {
+        GetThreadAllocatorEntry().BoundFrame = NO_BOUND_FRAME;
+    }
+
+    void* FrameAllocator::Allocate(size_t size, size_t alignment)
+    {
+        return GetThreadAllocator().Allocate(size, alignment);
+    }
+
+    FrameAllocatorStats FrameAllocator::GetStats() const
+    {
+        std::lock_guard lock(m_Mutex);
+        return m_Stats;
+    }
+
+    FrameAllocator::ThreadAllocator& FrameAllocator::GetThreadAllocatorEntry()
+    {
+        if (t_ThreadAllocatorCache.FrameAllocatorId == m_Id)
+            return *static_cast<ThreadAllocator*>(t_ThreadAllocatorCache.Allocator);
+
+        std::lock_guard lock(m_Mutex);
+        const std::thread::id threadId = std::this_thread::get_id();
+        auto it = std::ranges::find_if(m_ThreadAllocators, [&](const UniquePtr<ThreadAllocator>& threadAllocator) { return threadAllocator->ThreadId == threadId; });
+
+        ThreadAllocator* threadAllocator = (it != m_ThreadAllocators.end()) ? it->get() : m_ThreadAllocators.emplace_back(MakeUnique<ThreadAllocator>(m_FrameCount, m_BlockSize)).get();
+        t_ThreadAllocatorCache = { m_Id, threadAllocator };
+        return *threadAllocator;
+    }
+
+    LinearAllocator& FrameAllocator::GetThreadAllocator()
+    {
+        ThreadAllocator& threadAllocator = GetThreadAllocatorEntry();
+        const onyxU8 frame = (threadAllocator.BoundFrame != NO_BOUND_FRAME) ? threadAllocator.BoundFrame : m_CurrentFrame.load(std::memory_order_acquire);
+        return *threadAllocator.Frames[frame];
+    }
+}
@@ -0,0 +1,190 @@
+#include <onyx/memory/objectpool.h>
+
+#include <bit>
+#include <new>
+#include <thread>
+
+namespace Onyx
+{
+    namespace
+    {
+        Atomic<onyxU32> s_NextThreadSlot = 0;
+
+        onyxU32 GetThreadSlot()
+        {
+            thread_local const onyxU32 threadSlot = s_NextThreadSlot.fetch_add(1, std::memory_order_relaxed);
+            return threadSlot;
+        }
+    }
+
+    PoolAllocator::PoolAllocator(onyxU32 objectSize, onyxU32 objectAlignment, onyxU32 chunkCapacity, onyxU32 maxChunkCount)
+        : m_ObjectAlignment(objectAlignment)
+        , m_ChunkCapacity(chunkCapacity)
+        , m_MaxChunkCount(maxChunkCount)
+    {
+        ONYX_ASSERT(std::has_single_bit(chunkCapacity), "Chunk capacity has to be a power of 2");
+        ONYX_ASSERT(maxChunkCount > 0, "Pool needs at least one chunk");
+
+        // round up so every slot in a chunk is aligned
+        m_ObjectSize = (objectSize + objectAlignment - 1) & ~(objectAlignment - 1);
+        m_ChunkShift = static_cast<onyxU32>(std::countr_zero(chunkCapacity));
+
+        m_Chunks = MakeUnique<Chunk[]>(maxChunkCount);
+        m_FreeIndices.reserve(chunkCapacity);
+
+        if (maxChunkCount == 1)
+            AddChunk();
+    }
+
+    PoolAllocator::~PoolAllocator()
+    {
+        const onyxU32 chunkCount = m_ChunkCount.load(std::memory_order_acquire);
+        for (onyxU32 i = 0; i < chunkCount; ++i)
+            ::operator delete(m_Chunks[i].Objects, std::align_val_t(m_ObjectAlignment));
+    }
+
+    bool PoolAllocator::Acquire(PoolHandle& outHandle)
+    {
+        Magazine& magazine = LockMagazine();
+        if ((magazine.Count == 0) && (RefillMagazine(magazine) == false))
+        {
+            UnlockMagazine(magazine);
+            return false;
+        }
+
+        const onyxU32 index = magazine.Indices[--magazine.Count];
+        UnlockMagazine(magazine);
+
+        outHandle.Index = index;
+        outHandle.Generation = GetGeneration(index).load(std::memory_order_acquire);
+        m_AcquiredCount.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void PoolAllocator::Release(const PoolHandle& handle)
+    {
+        ONYX_ASSERT(IsValid(handle), "Handle is stale or not from this pool");
+
+        GetGeneration(handle.Index).fetch_add(1, std::memory_order_release);
+        m_AcquiredCount.fetch_sub(1, std::memory_order_relaxed);
+
+        Magazine& magazine = LockMagazine();
+        if (magazine.Count == MAGAZINE_SIZE)
+            FlushMagazine(magazine, MAGAZINE_SIZE / 2);
+
+        magazine.Indices[magazine.Count++] = handle.Index;
+        UnlockMagazine(magazine);
+    }
+
+    bool PoolAllocator::IsValid(const PoolHandle& handle) const
+    {
+        if (handle.Index >= GetCapacity())
+            return false;
+
+        return GetGeneration(handle.Index).load(std::memory_order_acquire) == handle.Generation;
+    }
+
+    void* PoolAllocator::Get(onyxU32 index)
+    {
+        ONYX_ASSERT(index < GetCapacity(), "Index is not in range of the pool");
+        return m_Chunks[index >> m_ChunkShift].Objects + (index & (m_ChunkCapacity - 1)) * m_ObjectSize;
+    }
+
+    const void* PoolAllocator::Get(onyxU32 index) const
+    {
+        ONYX_ASSERT(index < GetCapacity(), "Index is not in range of the pool");
+        return m_Chunks[index >> m_ChunkShift].Objects + (index & (m_ChunkCapacity - 1)) * m_ObjectSize;
+    }
+
+    PoolAllocator::Magazine& PoolAllocator::LockMagazine()
+    {
+        Magazine& magazine = m_Magazines[GetThreadSlot() % MAGAZINE_COUNT];
+        while (TryLockMagazine(magazine) == false)
+        {
+            // only contended if more threads than magazines use the pool at the same time
+            while (magazine.IsLocked.load(std::memory_order_relaxed))
+                std::this_thread::yield();
+        }
+
+        return magazine;
+    }
+
+    bool PoolAllocator::TryLockMagazine(Magazine& magazine)
+    {
+        return magazine.IsLocked.exchange(true, std::memory_order_acquire) == false;
+    }
+
+    void PoolAllocator::UnlockMagazine(Magazine& magazine)
+    {
+        magazine.IsLocked.store(false, std::memory_order_release);
+    }
+
+    bool PoolAllocator::RefillMagazine(Magazine& magazine)
+    {
+        std::lock_guard lock(m_DepotMutex);
+        if (m_FreeIndices.empty() && (AddChunk() == false))
+        {
+            // the pool is full but other threads might still cache free indices
+            StealFromMagazines(magazine);
+            if (m_FreeIndices.empty())
+                return false;
+        }
+
+        const onyxU32 count = std::min(MAGAZINE_SIZE / 2, static_cast<onyxU32>(m_FreeIndices.size()));
+        // keep the depot order so the magazine hands out the lowest indices first as well
+        for (onyxU32 i = count; i > 0; --i)
+        {
+            magazine.Indices[magazine.Count + i - 1] = m_FreeIndices.back();
+            m_FreeIndices.pop_back();
+        }
+
+        magazine.Count += count;
+        return true;
+    }
+
+    void PoolAllocator::FlushMagazine(Magazine& magazine, onyxU32 count)
+    {
+        std::lock_guard lock(m_DepotMutex);
+        for (onyxU32 i = 0; i < count; ++i)
+            m_FreeIndices.push_back(magazine.Indices[--magazine.Count]);
+    }
+
+    bool PoolAllocator::AddChunk()
+    {
+        const onyxU32 chunkIndex = m_ChunkCount.load(std::memory_order_relaxed);
+        if (chunkIndex == m_MaxChunkCount)
+            return false;
+
+        Chunk& chunk = m_Chunks[chunkIndex];
+        chunk.Objects = static_cast<onyxU8*>(::operator new(static_cast<size_t>(m_ObjectSize) * m_ChunkCapacity, std::align_val_t(m_ObjectAlignment)));
+        chunk.Generations = MakeUnique<Atomic<onyxU32>[]>(m_ChunkCapacity);
+
+        // push in reverse so the lowest indices are handed out first
+        const onyxU32 firstIndex = chunkIndex * m_ChunkCapacity;
+        for (onyxU32 i = m_ChunkCapacity; i > 0; --i)
+            m_FreeIndices.push_back(firstIndex + i - 1);
+
+        m_ChunkCount.store(chunkIndex + 1, std::memory_order_release);
+        return true;
+    }
+
+    void PoolAllocator::StealFromMagazines(const Magazine& ownMagazine)
+    {
+        for (Magazine& magazine : m_Magazines)
+        {
+            // only try locking to not deadlock with a thread that holds its magazine while waiting for the depot
+            if ((&magazine == &ownMagazine) || (TryLockMagazine(magazine) == false))
+                continue;
+
+            while (magazine.Count > 0)
+                m_FreeIndices.push_back(magazine.Indices[--magazine.Count]);
+
+            UnlockMagazine(magazine);
+        }
+    }
+
+    Atomic<onyxU32>& PoolAllocator::GetGeneration(onyxU32 index) const
+    {
+        return m_Chunks[index >> m_ChunkShift].Generations[index & (m_ChunkCapacity - 1)];
+    }
+}
@@ -0,0 +1,212 @@
+#include <onyx/morton.h>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define ONYX_HAS_BMI2_PATH 1
+#include <immintrin.h>
+#if ONYX_IS_MSVC
+#include <intrin.h>
+#endif
+#else
+#define ONYX_HAS_BMI2_PATH 0
+#endif
+
+// the functions using pdep / pext are compiled for BMI2 and only called after the runtime check
+#if ONYX_HAS_BMI2_PATH && (ONYX_IS_GCC || ONYX_IS_CLANG)
+#define ONYX_TARGET_BMI2 __attribute__((target("bmi2")))
+#else
+#define ONYX_TARGET_BMI2
+#endif
+
+namespace Onyx::Morton
+{
+    namespace
+    {
+        constexpr onyxU64 MASK_2D_X = MortonCode2D_U64::Encode(onyxMax_U32, 0);
+        constexpr onyxU64 MASK_2D_Y = MortonCode2D_U64::Encode(0, onyxMax_U32);
+
+        constexpr onyxU64 MASK_3D_X = MortonCode3D_U64::Encode(onyxMax_U32, 0, 0);
+        constexpr onyxU64 MASK_3D_Y = MortonCode3D_U64::Encode(0, onyxMax_U32, 0);
+        constexpr onyxU64 MASK_3D_Z = MortonCode3D_U64::Encode(0, 0, onyxMax_U32);
+
+        static_assert(MASK_2D_X == 0x5555555555555555ull);
+        static_assert(MASK_3D_X == 0x1249249249249249ull);
+
+        bool DetectBMI2()
+        {
+#if ONYX_HAS_BMI2_PATH && ONYX_IS_MSVC
+            int cpuInfo[4] = {};
+            __cpuid(cpuInfo, 0);
+            if (cpuInfo[0] < 7)
+                return false;
+
+            __cpuidex(cpuInfo, 7, 0);
+            return (cpuInfo[1] & (1 << 8)) != 0;
+#elif ONYX_HAS_BMI2_PATH
+            return __builtin_cpu_supports("bmi2");
+#else
+            return false;
+#endif
+        }
+
+#if ONYX_HAS_BMI2_PATH
+        ONYX_TARGET_BMI2 onyxU64 Encode2D_BMI2(onyxU32 x, onyxU32 y)
+        {
+            return _pdep_u64(x, MASK_2D_X) | _pdep_u64(y, MASK_2D_Y);
+        }
+
+        ONYX_TARGET_BMI2 void Decode2D_BMI2(onyxU64 code, onyxU32& outX, onyxU32& outY)
+        {
+            outX = static_cast<onyxU32>(_pext_u64(code, MASK_2D_X));
+            outY = static_cast<onyxU32>(_pext_u64(code, MASK_2D_Y));
+        }
+
+        ONYX_TARGET_BMI2 onyxU64 Encode3D_BMI2(onyxU32 x, onyxU32 y, onyxU32 z)
+        {
+            return _pdep_u64(x, MASK_3D_X) | _pdep_u64(y, MASK_3D_Y) | _pdep_u64(z, MASK_3D_Z);
+        }
+
+        ONYX_TARGET_BMI2 void Decode3D_BMI2(onyxU64 code, onyxU32& outX, onyxU32& outY, onyxU32& outZ)
+        {
+            outX = static_cast<onyxU32>(_pext_u64(code, MASK_3D_X));
+            outY = static_cast<onyxU32>(_pext_u64(code, MASK_3D_Y));
+            outZ = static_cast<onyxU32>(_pext_u64(code, MASK_3D_Z));
+        }
+
+        // the loops live in BMI2 functions as well so the intrinsics get inlined
+        ONYX_TARGET_BMI2 void Encode2D_BMI2(Span<const onyxU32> x, Span<const onyxU32> y, Span<onyxU64> outCodes)
+        {
+            for (onyxU64 i = 0; i < outCodes.size(); ++i)
+                outCodes[i] = _pdep_u64(x[i], MASK_2D_X) | _pdep_u64(y[i], MASK_2D_Y);
+        }
+
+        ONYX_TARGET_BMI2 void Decode2D_BMI2(Span<const onyxU64> codes, Span<onyxU32> outX, Span<onyxU32> outY)
+        {
+            for (onyxU64 i = 0; i < codes.size(); ++i)
+            {
+                outX[i] = static_cast<onyxU32>(_pext_u64(codes[i], MASK_2D_X));
+                outY[i] = static_cast<onyxU32>(_pext_u64(codes[i], MASK_2D_Y));
+            }
+        }
+
+        ONYX_TARGET_BMI2 void Encode3D_BMI2(Span<const onyxU32> x, Span<const onyxU32> y, Span<const onyxU32> z, Span<onyxU64> outCodes)
+        {
+            for (onyxU64 i = 0; i < outCodes.size(); ++i)
+                outCodes[i] = _pdep_u64(x[i], MASK_3D_X) | _pdep_u64(y[i], MASK_3D_Y) | _pdep_u64(z[i], MASK_3D_Z);
+        }
+
+        ONYX_TARGET_BMI2 void Decode3D_BMI2(Span<const onyxU64> codes, Span<onyxU32> outX, Span<onyxU32> outY, Span<onyxU32> outZ)
+        {
+            for (onyxU64 i = 0; i < codes.size(); ++i)
+            {
+                outX[i] = static_cast<onyxU32>(_pext_u64(codes[i], MASK_3D_X));
+                outY[i] = static_cast<onyxU32>(_pext_u64(codes[i], MASK_3D_Y));
+                outZ[i] = static_cast<onyxU32>(_pext_u64(codes[i], MASK_3D_Z));
+            }
+        }
+#endif
+    }
+
+    bool IsBMI2Supported()
+    {
+        static const bool isSupported = DetectBMI2();
+        return isSupported;
+    }
+
+    onyxU64 Encode2D(onyxU32 x, onyxU32 y)
+    {
+#if ONYX_HAS_BMI2_PATH
+        if (IsBMI2Supported())
+            return Encode2D_BMI2(x, y);
+#endif
+        return MortonCode2D_U64::Encode(x, y);
+    }
+
+    void Decode2D(onyxU64 code, onyxU32& outX, onyxU32& outY)
+    {
+#if ONYX_HAS_BMI2_PATH
+        if (IsBMI2Supported())
+        {
+            Decode2D_BMI2(code, outX, outY);
+            return;
+        }
+#endif
+        MortonCode2D_U64::Decode(code, outX, outY);
+    }
+
+    onyxU64 Encode3D(onyxU32 x, onyxU32 y, onyxU32 z)
+    {
+#if ONYX_HAS_BMI2_PATH
+        if (IsBMI2Supported())
+            return Encode3D_BMI2(x, y, z);
+#endif
+        return MortonCode3D_U64::Encode(x, y, z);
+    }
+
+    void Decode3D(onyxU64 code, onyxU32& outX, onyxU32& outY, onyxU32& outZ)
+    {
+#if ONYX_HAS_BMI2_PATH
+        if (IsBMI2Supported())
+        {
+            Decode3D_BMI2(code, outX, outY, outZ);
+            return;
+        }
+#endif
+        MortonCode3D_U64::Decode(code, outX, outY, outZ);
+    }
+
+    void Encode2D(Span<const onyxU32> x, Span<const onyxU32> y, Span<onyxU64> outCodes)
+    {
+        ONYX_ASSERT((x.size() == outCodes.size()) && (y.size() == outCodes.size()), "Morton encode spans differ in size");
+#if ONYX_HAS_BMI2_PATH
+        if (IsBMI2Supported())
+        {
+            Encode2D_BMI2(x, y, outCodes);
+            return;
+        }
+#endif
+        for (onyxU64 i = 0; i < outCodes.size(); ++i)
+            outCodes[i] = MortonCode2D_U64::Encode(x[i], y[i]);
+    }
+
+    void Decode2D(Span<const onyxU64> codes, Span<onyxU32> outX, Span<onyxU32> outY)
+    {
+        ONYX_ASSERT((outX.size() == codes.size()) && (outY.size() == codes.size()), "Morton decode spans differ in size");
+#if ONYX_HAS_BMI2_PATH
+        if (IsBMI2Supported())
+        {
+            Decode2D_BMI2(codes, outX, outY);
+            return;
+        }
+#endif
+        for (onyxU64 i = 0; i < codes.size(); ++i)
+            MortonCode2D_U64::Decode(codes[i], outX[i], outY[i]);
+    }
+
+    void Encode3D(Span<const onyxU32> x, Span<const onyxU32> y, Span<const onyxU32> z, Span<onyxU64> outCodes)
+    {
+        ONYX_ASSERT((x.size() == outCodes.size()) && (y.size() == outCodes.size()) && (z.size() == outCodes.size()), "Morton encode spans differ in size");
+#if ONYX_HAS_BMI2_PATH
+        if (IsBMI2Supported())
+        {
+            Encode3D_BMI2(x, y, z, outCodes);
+            return;
+        }
+#endif
+        for (onyxU64 i = 0; i < outCodes.size(); ++i)
+            outCodes[i] = MortonCode3D_U64::Encode(x[i], y[i], z[i]);
+    }
+
+    void Decode3D(Span<const onyxU64> codes, Span<onyxU32> outX, Span<onyxU32> outY, Span<onyxU32> outZ)
+    {
+        ONYX_ASSERT((outX.size() == codes.size()) && (outY.size() == codes.size()) && (outZ.size() == codes.size()), "Morton decode spans differ in size");
+#if ONYX_HAS_BMI2_PATH
+        if (IsBMI2Supported())
+        {
+            Decode3D_BMI2(codes, outX, outY, outZ);
+            return;
+        }
+#endif
+        for (onyxU64 i = 0; i < codes.size(); ++i)
+            MortonCode3D_U64::Decode(codes[i], outX[i], outY[i], outZ[i]);
+    }
+}
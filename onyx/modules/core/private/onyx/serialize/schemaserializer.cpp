@@ -0,0 +1,20 @@
+#include <onyx/serialize/schemaserializer.h>
+
+namespace Onyx
+{
+    SchemaSerializer::SchemaSerializer(onyxU64 seed)
+        : m_Hasher(seed)
+    {
+    }
+
+    void SchemaSerializer::AddToken(Token token, onyxU8 typeTag, StringView name)
+    {
+        const onyxU8 header[2] = { static_cast<onyxU8>(token), typeTag };
+        m_Hasher.Update(header, sizeof(header));
+
+        // the length separates consecutive names
+        const onyxU32 nameLength = static_cast<onyxU32>(name.size());
+        m_Hasher.Update(&nameLength, sizeof(nameLength));
+        m_Hasher.Update(name);
+    }
+}
@@ -0,0 +1,34 @@
+#include <onyx/stream/memorystream.h>
+
+namespace Onyx
+{
+    MemoryStream::MemoryStream(const char* data, onyxU64 size)
+        : m_ReadOnlyData(data)
+        , m_ReadOnlySize(size)
+    {
+    }
+
+    MemoryStream::MemoryStream(StringView data)
+        : MemoryStream(data.data(), static_cast<onyxU64>(data.size()))
+    {
+    }
+
+    void MemoryStream::DoRead(char* destination, onyxU64 size) const
+    {
+        ONYX_ASSERT(m_CurrentDataPosition + size <= GetLength(), "Reading past the end of the memory stream.");
+        std::memcpy(destination, GetData() + m_CurrentDataPosition, size);
+        m_CurrentDataPosition += size;
+    }
+
+    void MemoryStream::DoWrite(const char* data, onyxU64 size)
+    {
+        ONYX_ASSERT(IsReadOnly() == false, "Writing to a read-only memory stream.");
+
+        const onyxU64 endPosition = m_CurrentDataPosition + size;
+        if (endPosition > m_Buffer.size())
+            m_Buffer.resize(endPosition);
+
+        std::memcpy(m_Buffer.data() + m_CurrentDataPosition, data, size);
+        m_CurrentDataPosition = endPosition;
+    }
+}
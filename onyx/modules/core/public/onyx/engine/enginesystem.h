@@ -68,6 +68,7 @@ namespace Onyx
         IEngine& Engine;
         DeltaGameTime Delta;
         GameTime Time;
+        FixedGameTime FixedTime;
 
         template <typename T> requires std::is_base_of_v<IEngine, T>
         T& Get() const { return static_cast<T&>(Engine); }
@@ -80,5 +81,8 @@ namespace Onyx
 
         template <typename T> requires std::is_same_v<GameTime, T>
         GameTime Get() const { return Time; }
+
+        template <typename T> requires std::is_same_v<FixedGameTime, T>
+        const FixedGameTime& Get() const { return FixedTime; }
     };
 }
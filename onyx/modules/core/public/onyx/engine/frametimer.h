@@ -0,0 +1,71 @@
+#pragma once
+
+#include <onyx/engine/gametime.h>
+#include <onyx/serialize/serialization.h>
+
+namespace Onyx
+{
+    struct FrameTimerSettings
+    {
+        // fixed steps per second, 0 disables the fixed step
+        onyxU32 FixedUpdateRate = 60;
+
+        // time that would need more steps in a single frame is dropped, so a long frame does not make the following frames even longer
+        onyxU32 MaxFixedStepsPerFrame = 5;
+
+        // frames per second, 0 disables the frame limiter
+        onyxU32 FrameRateLimit = 0;
+
+        // sleeping is too coarse to hit the frame limit, the end of the wait is spent spinning
+        onyxU32 SpinMicroseconds = 2000;
+    };
+
+    // Measures the frame time with nanosecond precision, accumulates it into fixed steps and optionally limits the frame rate.
+    class FrameTimer
+    {
+    public:
+        FrameTimer(const FrameTimerSettings& settings = FrameTimerSettings());
+
+        const FrameTimerSettings& GetSettings() const { return m_Settings; }
+        void SetSettings(const FrameTimerSettings& settings);
+
+        // starts the next frame, the first frame has a delta of 0
+        void BeginFrame();
+        void BeginFrame(onyxU64 currentNanoseconds);
+
+        // advances by the given delta instead of the measured one, e.g.: to replay input recordings with a fixed delta
+        void BeginFrame(onyxU64 currentNanoseconds, DeltaGameTime delta);
+
+        // waits until the next frame may start, does nothing without a frame rate limit
+        void LimitFrameRate();
+
+        DeltaGameTime GetDelta() const { return m_Delta; }
+        GameTime GetTime() const { return m_Time; }
+        const FixedGameTime& GetFixedTime() const { return m_FixedTime; }
+
+        // nanoseconds until the next frame may start
+        onyxU64 GetRemainingFrameTime(onyxU64 currentNanoseconds) const;
+
+    private:
+        FrameTimerSettings m_Settings;
+
+        onyxU64 m_FixedStepNanoseconds = 0;
+        onyxU64 m_FrameLimitNanoseconds = 0;
+
+        bool m_HasStarted = false;
+        onyxU64 m_LastFrameStart = 0;
+        onyxU64 m_NextFrameStart = 0;
+        onyxU64 m_Accumulator = 0;
+
+        DeltaGameTime m_Delta = 0;
+        GameTime m_Time = 0;
+        FixedGameTime m_FixedTime;
+    };
+
+    template <>
+    struct Serialization<FrameTimerSettings>
+    {
+        static bool Serialize(Serializer& serializer, const FrameTimerSettings& settings);
+        static bool Deserialize(const Deserializer& deserializer, FrameTimerSettings& outSettings);
+    };
+}
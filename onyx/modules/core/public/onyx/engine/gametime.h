@@ -4,27 +4,42 @@ namespace Onyx
 {
     struct DeltaGameTime
     {
-        DeltaGameTime(onyxU64 milliseconds)
-            : DeltaMilliseconds(milliseconds)
+        DeltaGameTime(onyxU64 nanoseconds)
+            : DeltaNanoseconds(nanoseconds)
         {
         }
 
-        DeltaGameTime operator+(DeltaGameTime other) const { return DeltaMilliseconds + other.DeltaMilliseconds; }
-        DeltaGameTime operator-(DeltaGameTime other) const { return DeltaMilliseconds - other.DeltaMilliseconds; }
+        DeltaGameTime operator+(DeltaGameTime other) const { return DeltaNanoseconds + other.DeltaNanoseconds; }
+        DeltaGameTime operator-(DeltaGameTime other) const { return DeltaNanoseconds - other.DeltaNanoseconds; }
 
-        onyxU64 DeltaMilliseconds;
+        onyxF32 GetMilliseconds() const { return static_cast<onyxF32>(static_cast<onyxF64>(DeltaNanoseconds) * 1e-6); }
+        onyxF32 GetSeconds() const { return static_cast<onyxF32>(static_cast<onyxF64>(DeltaNanoseconds) * 1e-9); }
+
+        onyxU64 DeltaNanoseconds;
     };
 
     struct GameTime
     {
-        GameTime(onyxU64 milliseconds)
-            : Milliseconds(milliseconds)
+        GameTime(onyxU64 nanoseconds)
+            : Nanoseconds(nanoseconds)
         {
         }
 
-        GameTime operator+(GameTime other) const { return Milliseconds + other.Milliseconds; }
-        GameTime operator-(GameTime other) const { return Milliseconds - other.Milliseconds; }
+        GameTime operator+(GameTime other) const { return Nanoseconds + other.Nanoseconds; }
+        GameTime operator-(GameTime other) const { return Nanoseconds - other.Nanoseconds; }
+
+        onyxF64 GetSeconds() const { return static_cast<onyxF64>(Nanoseconds) * 1e-9; }
+
+        onyxU64 Nanoseconds;
+    };
+
+    // fixed steps to simulate this frame
+    struct FixedGameTime
+    {
+        onyxU32 StepCount = 0;
+        DeltaGameTime StepDelta = 0;
 
-        onyxU64 Milliseconds;
+        // time left in the accumulator as fraction of a step, to interpolate between the last two fixed steps when rendering
+        onyxF32 Interpolation = 0.0f;
     };
-}
\ No newline at end of file
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <onyx/function/callback.h>
+#include <onyx/thread/container/lockfreempscboundedqueue.h>
+
+#include <tuple>
+
+namespace Onyx
+{
+    /**
+     * @brief Signal with deferred delivery.
+     *
+     * Publish can be called from any thread and only appends the arguments to a
+     * bounded lock-free queue. Listeners are invoked in batch when the owner calls
+     * Dispatch, on the thread and at the point in the frame it chooses.
+     * Listeners are connected and disconnected from the dispatching thread, also
+     * from within a listener, publishers never touch them.
+     *
+     * @tparam Type A valid function type returning void.
+     * @tparam QueueSize Maximum amount of queued events, has to be a power of 2.
+     */
+    template <typename Type, onyxU32 QueueSize = 256>
+    class QueuedSignal;
+
+    template <typename... Args, onyxU32 QueueSize>
+    class QueuedSignal<void(Args...), QueueSize>
+    {
+        using delegate_type = Callback<void(Args...)>;
+        using event_type = std::tuple<std::decay_t<Args>...>;
+
+    public:
+        QueuedSignal() = default;
+
+        QueuedSignal(const QueuedSignal&) = delete;
+        QueuedSignal& operator=(const QueuedSignal&) = delete;
+
+        /**
+         * @brief Queues an event, thread safe.
+         * @return False if the queue is full and the event got dropped.
+         */
+        bool Publish(Args... args)
+        {
+            if (m_Queue.Push(event_type{ std::forward<Args>(args)... }))
+                return true;
+
+            m_DroppedCount.fetch_add(1, std::memory_order::relaxed);
+            return false;
+        }
+
+        /**
+         * @brief Invokes the listeners for all queued events, in publish order.
+         * Must only be called from one thread at a time.
+         * @return Number of dispatched events.
+         */
+        onyxU32 Dispatch()
+        {
+            m_IsDispatching = true;
+
+            onyxU32 dispatchedCount = 0;
+            event_type event;
+            while (m_Queue.Pop(event))
+            {
+                // listeners connected while dispatching only receive the next events
+                const size_t listenerCount = m_Callbacks.size();
+                for (size_t i = 0; i < listenerCount; ++i)
+                {
+                    if (m_Callbacks[i])
+                        std::apply(m_Callbacks[i], event);
+                }
+
+                ++dispatchedCount;
+            }
+
+            m_IsDispatching = false;
+            if (m_HasDisconnectedListeners)
+            {
+                std::erase_if(m_Callbacks, [](const delegate_type& callback) { return static_cast<bool>(callback) == false; });
+                m_HasDisconnectedListeners = false;
+            }
+
+            return dispatchedCount;
+        }
+
+        // events that got dropped as the queue was full, the queue is too small or not dispatched often enough
+        ONYX_NO_DISCARD onyxU32 GetDroppedCount() const { return m_DroppedCount.load(std::memory_order::relaxed); }
+
+        ONYX_NO_DISCARD bool HasListeners() const
+        {
+            return std::ranges::any_of(m_Callbacks, [](const delegate_type& callback) { return static_cast<bool>(callback); });
+        }
+
+        template <auto Candidate, typename... Type>
+        void Connect(Type&&... value_or_instance)
+        {
+            Disconnect<Candidate>(value_or_instance...);
+
+            delegate_type call{};
+            call.template Connect<Candidate>(std::forward<Type>(value_or_instance)...);
+            m_Callbacks.push_back(std::move(call));
+        }
+
+        template <auto Candidate, typename... Type>
+        void Disconnect(Type&&... value_or_instance)
+        {
+            delegate_type call{};
+            call.template Connect<Candidate>(std::forward<Type>(value_or_instance)...);
+            DisconnectIf([&call](const delegate_type& callback) { return callback == call; });
+        }
+
+        // disconnects all listeners bound to the instance
+        void Disconnect(const void* value_or_instance)
+        {
+            if (value_or_instance == nullptr)
+                return;
+
+            DisconnectIf([value_or_instance](const delegate_type& callback) { return callback && (callback.Data() == value_or_instance); });
+        }
+
+    private:
+        template <typename Func>
+        void DisconnectIf(Func predicate)
+        {
+            if (m_IsDispatching)
+            {
+                // keep the indices stable while dispatching, the holes are removed once the dispatch finished
+                for (delegate_type& callback : m_Callbacks)
+                {
+                    if (predicate(callback))
+                    {
+                        callback.Reset();
+                        m_HasDisconnectedListeners = true;
+                    }
+                }
+                return;
+            }
+
+            std::erase_if(m_Callbacks, predicate);
+        }
+
+    private:
+        LockFreeMPSCBoundedQueue<event_type, QueueSize> m_Queue;
+        Atomic<onyxU32> m_DroppedCount = 0;
+
+        DynamicArray<delegate_type> m_Callbacks;
+        bool m_IsDispatching = false;
+        bool m_HasDisconnectedListeners = false;
+    };
+}
@@ -163,6 +163,57 @@ namespace Onyx::Hash
         return FNV1aHash<T, U>(obj, T{ 0 });
     }
 
+    // FNV-1a above is byte at a time but constexpr, use it for compile time ids and anything that gets persisted (e.g. AssetId).
+    // The hashes below are wyhash style, they consume 8 bytes per 64x64->128 bit multiply across 3 independent lanes.
+    // Results differ between platforms with different endianness so they should not be persisted across machines.
+    struct Hash128
+    {
+        onyxU64 Low = 0;
+        onyxU64 High = 0;
+
+        bool operator==(const Hash128& other) const = default;
+    };
+
+    // raw byte versions have their own name so string literal arguments can not end up in them with the seed as length
+    ONYX_NO_DISCARD onyxU64 FastHash64Bytes(const void* data, onyxU64 length, onyxU64 seed = 0);
+    ONYX_NO_DISCARD Hash128 FastHash128Bytes(const void* data, onyxU64 length, onyxU64 seed = 0);
+
+    ONYX_NO_DISCARD inline onyxU64 FastHash64(StringView string, onyxU64 seed = 0)
+    {
+        return FastHash64Bytes(string.data(), static_cast<onyxU64>(string.size()), seed);
+    }
+
+    ONYX_NO_DISCARD inline Hash128 FastHash128(StringView string, onyxU64 seed = 0)
+    {
+        return FastHash128Bytes(string.data(), static_cast<onyxU64>(string.size()), seed);
+    }
+
+    // Incremental version of FastHash64/FastHash128, splitting the input into any number of updates gives the same hash
+    class FastHasher
+    {
+    public:
+        explicit FastHasher(onyxU64 seed = 0);
+
+        void Reset(onyxU64 seed = 0);
+        void Update(const void* data, onyxU64 length);
+        void Update(StringView string) { Update(string.data(), static_cast<onyxU64>(string.size())); }
+
+        ONYX_NO_DISCARD onyxU64 Finalize64() const;
+        ONYX_NO_DISCARD Hash128 Finalize128() const;
+
+        static constexpr onyxU64 BLOCK_SIZE = 48;
+        // blocks are only consumed once more than BUFFER_SIZE bytes are pending so the tail is never shorter than 16 bytes
+        static constexpr onyxU64 BUFFER_SIZE = 64;
+
+    private:
+        onyxU64 m_Lanes[3] = {};
+        onyxU64 m_Seed = 0;
+        onyxU64 m_Length = 0;
+
+        onyxU8 m_Buffer[BUFFER_SIZE] = {};
+        onyxU64 m_BufferSize = 0;
+    };
+
     ONYX_NO_DISCARD constexpr onyxU32 CRC32(const char* data, onyxU64 len, onyxU32 crc = 0);
     ONYX_NO_DISCARD constexpr onyxU32 CRC32(StringView str, onyxU32 crc = 0);
 }
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <mutex>
+#include <thread>
+
+namespace Onyx
+{
+    // Bump allocator, memory is only freed all at once on Reset.
+    // Grows by adding blocks, on Reset the blocks are merged into one so a steady workload ends up with a single block.
+    class LinearAllocator
+    {
+    public:
+        static constexpr onyxU32 DEFAULT_BLOCK_SIZE = 256 * 1024;
+
+        explicit LinearAllocator(onyxU32 blockSize = DEFAULT_BLOCK_SIZE);
+
+        LinearAllocator(const LinearAllocator&) = delete;
+        LinearAllocator& operator=(const LinearAllocator&) = delete;
+
+        void* Allocate(size_t size, size_t alignment);
+        void Reset();
+
+        size_t GetUsedBytes() const { return m_UsedBytes; }
+        size_t GetHighWaterMark() const { return m_HighWaterMark; }
+        size_t GetCapacity() const;
+
+    private:
+        struct Block
+        {
+            UniquePtr<onyxU8[]> Data;
+            size_t Size = 0;
+        };
+
+        void AddBlock(size_t minSize);
+
+    private:
+        DynamicArray<Block> m_Blocks;
+        onyxU32 m_CurrentBlock = 0;
+        size_t m_Offset = 0;
+
+        size_t m_UsedBytes = 0;
+        size_t m_HighWaterMark = 0;
+        size_t m_BlockSize = 0;
+    };
+
+    struct FrameAllocatorStats
+    {
+        // summed over all threads for the last frame that got reset
+        size_t UsedBytes = 0;
+        size_t CapacityBytes = 0;
+        // highest usage of a single frame over all threads since startup
+        size_t HighWaterMark = 0;
+        onyxU32 ThreadCount = 0;
+    };
+
+    // Per thread linear allocators for transient data of a frame.
+    // Every thread allocates from its own allocator without locking, BeginFrame resets the allocators of the frame index
+    // for all threads. Memory therefore stays valid until the same frame index begins again, which matches the lifetime
+    // of the per frame context when using MAX_FRAMES_IN_FLIGHT as frame count.
+    class FrameAllocator
+    {
+    public:
+        static constexpr onyxU8 MAX_FRAME_COUNT = 4;
+        static constexpr onyxU8 DEFAULT_FRAME_COUNT = 2;
+
+        explicit FrameAllocator(onyxU8 frameCount = DEFAULT_FRAME_COUNT, onyxU32 blockSize = LinearAllocator::DEFAULT_BLOCK_SIZE);
+        ~FrameAllocator();
+
+        FrameAllocator(const FrameAllocator&) = delete;
+        FrameAllocator& operator=(const FrameAllocator&) = delete;
+
+        // call once per frame before any allocation for that frame, no thread may still use memory of this frame index
+        void BeginFrame(onyxU8 frameIndex);
+
+        // allocations of the calling thread go to the frame index instead of the current frame until UnbindThreadFrame,
+        // a pipelined render thread binds the frame it renders so its memory is not reset by the simulation beginning the next frame
+        void BindThreadFrame(onyxU8 frameIndex);
+        void UnbindThreadFrame();
+
+        void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+        template <typename T>
+        T* AllocateArray(size_t count)
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "Frame memory is never destructed");
+            return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+        }
+
+        onyxU8 GetFrameCount() const { return m_FrameCount; }
+        FrameAllocatorStats GetStats() const;
+
+    private:
+        struct ThreadAllocator
+        {
+            ThreadAllocator(onyxU8 frameCount, onyxU32 blockSize);
+
+            std::thread::id ThreadId;
+            DynamicArray<UniquePtr<LinearAllocator>> Frames;
+            // only accessed by the owning thread
+            onyxU8 BoundFrame = NO_BOUND_FRAME;
+        };
+
+        static constexpr onyxU8 NO_BOUND_FRAME = onyxMax_U8;
+
+        ThreadAllocator& GetThreadAllocatorEntry();
+        LinearAllocator& GetThreadAllocator();
+
+    private:
+        mutable std::mutex m_Mutex;
+        DynamicArray<UniquePtr<ThreadAllocator>> m_ThreadAllocators;
+        FrameAllocatorStats m_Stats;
+
+        Atomic<onyxU8> m_CurrentFrame = 0;
+        onyxU8 m_FrameCount = 0;
+        onyxU32 m_BlockSize = 0;
+        onyxU32 m_Id = 0;
+    };
+
+    inline FrameAllocator DefaultFrameAllocator;
+
+    // std compatible allocator so containers can opt in to frame memory, deallocate does nothing.
+    // Containers using it must not outlive the frame they got filled in.
+    template <typename T>
+    class FrameStdAllocator
+    {
+    public:
+        using value_type = T;
+
+        FrameStdAllocator() noexcept = default;
+        explicit FrameStdAllocator(FrameAllocator& allocator) noexcept
+            : m_Allocator(&allocator)
+        {
+        }
+
+        template <typename U>
+        FrameStdAllocator(const FrameStdAllocator<U>& other) noexcept
+            : m_Allocator(&other.GetFrameAllocator())
+        {
+        }
+
+        T* allocate(size_t count) { return static_cast<T*>(m_Allocator->Allocate(count * sizeof(T), alignof(T))); }
+        void deallocate(T*, size_t) noexcept {}
+
+        FrameAllocator& GetFrameAllocator() const { return *m_Allocator; }
+
+        template <typename U>
+        bool operator==(const FrameStdAllocator<U>& other) const { return m_Allocator == &other.GetFrameAllocator(); }
+
+    private:
+        FrameAllocator* m_Allocator = &DefaultFrameAllocator;
+    };
+
+    template <typename T>
+    using FrameArray = std::vector<T, FrameStdAllocator<T>>;
+}
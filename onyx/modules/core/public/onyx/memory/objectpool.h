@@ -1,101 +1,163 @@
 #pragma once
 
+#include <mutex>
+
 namespace Onyx
 {
-    template <typename ValueT, onyxU32 PoolSize>
-    class StaticObjectPool
+    // Index into an object pool, the generation is bumped on every release so stale handles can be detected
+    struct PoolHandle
+    {
+        static constexpr onyxU32 INVALID_INDEX = onyxMax_U32;
+
+        onyxU32 Index = INVALID_INDEX;
+        onyxU32 Generation = 0;
+
+        bool IsValid() const { return Index != INVALID_INDEX; }
+        bool operator==(const PoolHandle& other) const = default;
+    };
+
+    // Untyped slab allocator for objects of one size.
+    // Slots are allocated in chunks of chunkCapacity objects, addresses and indices stay stable until the slot is released.
+    // Freed indices are cached in per thread magazines so acquire and release usually only touch an uncontended lock,
+    // the shared depot is only locked to refill or flush half a magazine at a time.
+    class PoolAllocator
     {
     public:
-        StaticObjectPool()
+        static constexpr onyxU32 MAGAZINE_SIZE = 32;
+        static constexpr onyxU32 MAGAZINE_COUNT = 8;
+
+        // a maxChunkCount of 1 creates a fixed size pool which allocates its memory upfront
+        PoolAllocator(onyxU32 objectSize, onyxU32 objectAlignment, onyxU32 chunkCapacity, onyxU32 maxChunkCount);
+        ~PoolAllocator();
+
+        PoolAllocator(const PoolAllocator&) = delete;
+        PoolAllocator& operator=(const PoolAllocator&) = delete;
+        PoolAllocator(PoolAllocator&&) = delete;
+        PoolAllocator& operator=(PoolAllocator&&) = delete;
+
+        // returns false if the pool is exhausted
+        bool Acquire(PoolHandle& outHandle);
+        void Release(const PoolHandle& handle);
+
+        bool IsValid(const PoolHandle& handle) const;
+
+        void* Get(onyxU32 index);
+        const void* Get(onyxU32 index) const;
+
+        onyxU32 GetAcquiredCount() const { return m_AcquiredCount.load(std::memory_order_relaxed); }
+        onyxU32 GetCapacity() const { return m_ChunkCount.load(std::memory_order_acquire) * m_ChunkCapacity; }
+        onyxU32 GetMaxCapacity() const { return m_MaxChunkCount * m_ChunkCapacity; }
+
+    private:
+        struct Chunk
         {
-            m_Objects = static_cast<ValueT*>(new char[sizeof(ValueT) * PoolSize]);
+            onyxU8* Objects = nullptr;
+            UniquePtr<Atomic<onyxU32>[]> Generations;
+        };
+
+        struct alignas(64) Magazine
+        {
+            Atomic<bool> IsLocked = false;
+            onyxU32 Count = 0;
+            onyxU32 Indices[MAGAZINE_SIZE];
+        };
+
+        Magazine& LockMagazine();
+        static bool TryLockMagazine(Magazine& magazine);
+        static void UnlockMagazine(Magazine& magazine);
+
+        // both expect the magazine to be locked by the caller
+        bool RefillMagazine(Magazine& magazine);
+        void FlushMagazine(Magazine& magazine, onyxU32 count);
+
+        // expects m_DepotMutex to be held
+        bool AddChunk();
+        void StealFromMagazines(const Magazine& ownMagazine);
+
+        Atomic<onyxU32>& GetGeneration(onyxU32 index) const;
+
+    private:
+        Magazine m_Magazines[MAGAZINE_COUNT];
 
-            for (onyxU32 i = 0; i < PoolSize; ++i)
-                m_FreeIndices[i] = i;
+        std::mutex m_DepotMutex;
+        DynamicArray<onyxU32> m_FreeIndices;
+
+        UniquePtr<Chunk[]> m_Chunks;
+        Atomic<onyxU32> m_ChunkCount = 0;
+        Atomic<onyxU32> m_AcquiredCount = 0;
+
+        onyxU32 m_ObjectSize = 0;
+        onyxU32 m_ObjectAlignment = 0;
+        onyxU32 m_ChunkCapacity = 0;
+        onyxU32 m_ChunkShift = 0;
+        onyxU32 m_MaxChunkCount = 0;
+    };
+
+    // Typed pool on top of the PoolAllocator, objects are constructed in place and destroyed on release.
+    // Objects that are still alive when the pool is destroyed are not destructed.
+    template <typename T>
+    class ObjectPool
+    {
+    public:
+        ObjectPool(onyxU32 chunkCapacity, onyxU32 maxChunkCount)
+            : m_Allocator(sizeof(T), alignof(T), chunkCapacity, maxChunkCount)
+        {
         }
 
-        ~StaticObjectPool()
+        // returns nullptr if the pool is exhausted
+        template <typename... Args>
+        T* Emplace(PoolHandle& outHandle, Args&&... args)
         {
-            ONYX_ASSERT(static_cast<onyxU32>(m_FreeIndices.size()) == PoolSize, "Objects are still held. Desctruction of the pool will invalidate the memory.");
-            delete[] m_Objects;
+            if (m_Allocator.Acquire(outHandle) == false)
+                return nullptr;
+
+            return new (m_Allocator.Get(outHandle.Index)) T(std::forward<Args>(args)...);
         }
 
-        onyxU32 AcquireObject()
+        void Destroy(const PoolHandle& handle)
         {
-            ONYX_ASSERT(m_FreeIndices < PoolSize, "No free object available");
+            ONYX_ASSERT(m_Allocator.IsValid(handle), "Handle is stale or not from this pool");
 
-            const onyxU32 freeIndex = m_FreeIndices[m_FreeIndicesHead++];
-            return freeIndex;
+            // destruct before releasing the slot, the destructor is allowed to release other objects of this pool
+            static_cast<T*>(m_Allocator.Get(handle.Index))->~T();
+            m_Allocator.Release(handle);
         }
 
+        bool IsValid(const PoolHandle& handle) const { return m_Allocator.IsValid(handle); }
+
+        // returns nullptr if the object of the handle got released
+        T* Get(const PoolHandle& handle) { return m_Allocator.IsValid(handle) ? static_cast<T*>(m_Allocator.Get(handle.Index)) : nullptr; }
+        const T* Get(const PoolHandle& handle) const { return m_Allocator.IsValid(handle) ? static_cast<const T*>(m_Allocator.Get(handle.Index)) : nullptr; }
+
+        T& operator[](onyxU32 index) { return *static_cast<T*>(m_Allocator.Get(index)); }
+        const T& operator[](onyxU32 index) const { return *static_cast<const T*>(m_Allocator.Get(index)); }
+
+        onyxU32 GetAcquiredCount() const { return m_Allocator.GetAcquiredCount(); }
+        onyxU32 GetCapacity() const { return m_Allocator.GetCapacity(); }
+
     private:
-        ValueT* m_Objects;
+        PoolAllocator m_Allocator;
+    };
 
-        onyxU32 m_FreeIndicesHead = 0;
-        std::array<onyxU32, PoolSize> m_FreeIndices;
+    // Fixed size pool, indices are in the range [0, PoolSize) which makes them usable as bindless indices
+    template <typename T, onyxU32 PoolSize>
+    class StaticObjectPool : public ObjectPool<T>
+    {
+    public:
+        StaticObjectPool()
+            : ObjectPool<T>(PoolSize, 1)
+        {
+        }
     };
 
-    //// Simple fixed size object pool for contiguous memory of objects
-    //template <typename ObjectType, onyxS32 PoolSize, typename HandleType = onyxS32>
-    //class StaticObjectPool
-    //{
-    //public:
-    //    static_assert(std::is_integral_v<HandleType>, "HandleType must be an integral type.");
-    //    static_assert(std::numeric_limits<HandleType>::max() >= PoolSize, "HandleType is not covering the full range for the chosen PoolSize.");
-
-    //    StaticObjectPool() = default;
-    //    ~StaticObjectPool()
-    //    {
-    //        ONYX_ASSERT(m_FreeIndicesHead == 0, "Object pool has still objects acquired.");
-    //    }
-
-    //    void Init()
-    //    {
-    //        m_Objects = (ObjectType*)malloc(sizeof(ObjectType) * PoolSize);
-    //        /*m_FreeIndices = { } [PoolSize] ;*/
-
-    //        for (HandleType i = 0; i < PoolSize; ++i)
-    //        {
-    //            m_FreeIndices[i] = i;
-    //        }
-    //    }
-
-    //    void Clear()
-    //    {
-    //        //m_Objects.clear();
-    //    }
-
-    //    HandleType AcquireObject()
-    //    {
-    //        ONYX_ASSERT(m_FreeIndicesHead < PoolSize, "No free object available");
-
-    //        const onyxU32 freeIndex = m_FreeIndices[m_FreeIndicesHead++];
-    //        return freeIndex;
-    //    }
-
-    //    void ReleaseObject(HandleType handle)
-    //    {
-    //        ONYX_ASSERT(handle < PoolSize, "Handle is outside of the pool");
-    //        m_Objects[handle] = nullptr; // TODO: should we only do this in debug?
-    //        m_FreeIndices[--m_FreeIndicesHead] = handle;
-    //    }
-
-    //    ObjectType* operator[](HandleType handle)
-    //    {
-    //        ONYX_ASSERT(handle < PoolSize, "Handle is outside of the pool");
-    //        return &m_Objects[handle];
-    //    }
-
-    //    const ObjectType* operator[](HandleType handle) const
-    //    {
-    //        ONYX_ASSERT(handle < PoolSize, "Handle is outside of the pool");
-    //        return &m_Objects[handle];
-    //    }
-
-    //private:
-    //    onyxU32 m_FreeIndicesHead = 0;
-
-    //    ObjectType* m_Objects;
-    //    std::array<HandleType, PoolSize> m_FreeIndices;
-    //};
-}
\ No newline at end of file
+    // Growable pool, chunks are allocated on demand and never moved
+    template <typename T, onyxU32 ChunkSize = 256, onyxU32 MaxChunkCount = 4096>
+    class ChunkedObjectPool : public ObjectPool<T>
+    {
+    public:
+        ChunkedObjectPool()
+            : ObjectPool<T>(ChunkSize, MaxChunkCount)
+        {
+        }
+    };
+}
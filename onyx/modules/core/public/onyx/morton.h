@@ -10,3 +10,24 @@ namespace Onyx
     using MortonCode3D_U32 = MortonCode3D<onyxU32, onyxU16>;
     using MortonCode3D_U64 = MortonCode3D<onyxU64, onyxU32>;
 }
+
+namespace Onyx::Morton
+{
+    // Runtime encoding for 64 bit codes, uses pdep / pext if the cpu supports BMI2 and the constexpr bit twiddling otherwise.
+    // The result is identical to MortonCode2D_U64 / MortonCode3D_U64.
+    bool IsBMI2Supported();
+
+    onyxU64 Encode2D(onyxU32 x, onyxU32 y);
+    void Decode2D(onyxU64 code, onyxU32& outX, onyxU32& outY);
+
+    onyxU64 Encode3D(onyxU32 x, onyxU32 y, onyxU32 z);
+    void Decode3D(onyxU64 code, onyxU32& outX, onyxU32& outY, onyxU32& outZ);
+
+    // batched versions, the instruction set is only checked once per batch
+    // all spans have to be of the same size
+    void Encode2D(Span<const onyxU32> x, Span<const onyxU32> y, Span<onyxU64> outCodes);
+    void Decode2D(Span<const onyxU64> codes, Span<onyxU32> outX, Span<onyxU32> outY);
+
+    void Encode3D(Span<const onyxU32> x, Span<const onyxU32> y, Span<const onyxU32> z, Span<onyxU64> outCodes);
+    void Decode3D(Span<const onyxU64> codes, Span<onyxU32> outX, Span<onyxU32> outY, Span<onyxU32> outZ);
+}
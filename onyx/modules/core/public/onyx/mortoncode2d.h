@@ -83,7 +83,7 @@ namespace Onyx
         {
         }
 
-        operator MortonT() const { return m_MortonCode; } // implicit conversion to MortonT
+        constexpr operator MortonT() const { return m_MortonCode; } // implicit conversion to MortonT
 
         static constexpr MortonCode2D Encode(CoordT x, CoordT y)
         {
@@ -184,6 +184,32 @@ namespace Onyx
             }
         }
 
+        // Neighbor at any distance without decoding, the offsets are in cells of the given level (0 is the finest level).
+        // Works on the dilated coordinates directly: filling the other axis with ones lets the carry skip over it.
+        constexpr MortonCode2D GetNeighbor(SignedCoordinateT dX, SignedCoordinateT dY, onyxU8 level = 0) const
+        {
+            using namespace MortonCode2D_Internal;
+            const MortonT offset = EncodeCoordinate<MortonT, CoordT>(static_cast<CoordT>(static_cast<CoordT>(dX) << level)) |
+                (EncodeCoordinate<MortonT, CoordT>(static_cast<CoordT>(static_cast<CoordT>(dY) << level)) << 1);
+
+            return Add(MortonCode2D(offset));
+        }
+
+        // per axis addition and subtraction, wraps around like the coordinates
+        constexpr MortonCode2D Add(MortonCode2D other) const
+        {
+            return MortonCode2D(
+                (((m_MortonCode | ~X_MASK) + (other.m_MortonCode & X_MASK)) & X_MASK) |
+                (((m_MortonCode | ~Y_MASK) + (other.m_MortonCode & Y_MASK)) & Y_MASK));
+        }
+
+        constexpr MortonCode2D Subtract(MortonCode2D other) const
+        {
+            return MortonCode2D(
+                (((m_MortonCode & X_MASK) - (other.m_MortonCode & X_MASK)) & X_MASK) |
+                (((m_MortonCode & Y_MASK) - (other.m_MortonCode & Y_MASK)) & Y_MASK));
+        }
+
     private:
         MortonT m_MortonCode = 0;
     };
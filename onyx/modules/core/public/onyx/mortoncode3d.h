@@ -83,7 +83,7 @@ namespace Onyx
             : m_MortonCode(mortonCode)
         {}
 
-        operator MortonT() const { return m_MortonCode; } // implicit conversion to MortonT
+        constexpr operator MortonT() const { return m_MortonCode; } // implicit conversion to MortonT
 
         static constexpr MortonCode3D Encode(CoordT x, CoordT y, CoordT z)
         {
@@ -335,6 +335,35 @@ namespace Onyx
             }
         }
 
+        // Neighbor at any distance without decoding, the offsets are in cells of the given level (0 is the finest level).
+        // Works on the dilated coordinates directly: filling the other axes with ones lets the carry skip over them.
+        constexpr MortonCode3D GetNeighbor(SignedCoordinateT dX, SignedCoordinateT dY, SignedCoordinateT dZ, onyxU8 level = 0) const
+        {
+            using namespace MortonCode3D_Internal;
+            const MortonT offset = EncodeCoordinate<MortonT, CoordT>(static_cast<CoordT>(static_cast<CoordT>(dX) << level)) |
+                (EncodeCoordinate<MortonT, CoordT>(static_cast<CoordT>(static_cast<CoordT>(dY) << level)) << 1) |
+                (EncodeCoordinate<MortonT, CoordT>(static_cast<CoordT>(static_cast<CoordT>(dZ) << level)) << 2);
+
+            return Add(MortonCode3D(offset));
+        }
+
+        // per axis addition and subtraction, wraps around like the coordinates
+        constexpr MortonCode3D Add(MortonCode3D other) const
+        {
+            return MortonCode3D(
+                (((m_MortonCode | ~X_MASK) + (other.m_MortonCode & X_MASK)) & X_MASK) |
+                (((m_MortonCode | ~Y_MASK) + (other.m_MortonCode & Y_MASK)) & Y_MASK) |
+                (((m_MortonCode | ~Z_MASK) + (other.m_MortonCode & Z_MASK)) & Z_MASK));
+        }
+
+        constexpr MortonCode3D Subtract(MortonCode3D other) const
+        {
+            return MortonCode3D(
+                (((m_MortonCode & X_MASK) - (other.m_MortonCode & X_MASK)) & X_MASK) |
+                (((m_MortonCode & Y_MASK) - (other.m_MortonCode & Y_MASK)) & Y_MASK) |
+                (((m_MortonCode & Z_MASK) - (other.m_MortonCode & Z_MASK)) & Z_MASK));
+        }
+
     private:
         MortonT m_MortonCode = 0;
     };
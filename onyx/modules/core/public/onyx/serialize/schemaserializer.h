@@ -0,0 +1,127 @@
+#pragma once
+
+#include <onyx/hash.h>
+#include <onyx/serialize/serializer.h>
+
+namespace Onyx
+{
+    // Serializer that only records the structure that is written (names, value types and scopes) into a hash.
+    // Serializing a default constructed object results in an id for its schema, which changes whenever fields are renamed, added, removed or change their type.
+    class SchemaSerializer : public Serializer
+    {
+    public:
+        explicit SchemaSerializer(onyxU64 seed = 0);
+
+        onyxU64 GetSchemaId() const { return m_Hasher.Finalize64(); }
+
+    private:
+        enum class Token : onyxU8
+        {
+            Value,
+            NamedValue,
+            Scope,
+            IndexScope,
+            EndScope,
+            ItemsCount,
+        };
+
+        void AddToken(Token token, onyxU8 typeTag = 0, StringView name = {});
+
+        template <typename T>
+        bool DoGenericWrite(const T&)
+        {
+            AddToken(Token::Value, GetTypeTag<T>());
+            return true;
+        }
+
+        template <typename T>
+        bool DoGenericWrite(StringView name, const T&)
+        {
+            AddToken(Token::NamedValue, GetTypeTag<T>(), name);
+            return true;
+        }
+
+        // distinguishes float / signed / unsigned values of the same size
+        template <typename T>
+        static constexpr onyxU8 GetTypeTag()
+        {
+            if constexpr (std::is_same_v<T, StringView>)
+                return 0xFF;
+            else if constexpr (std::is_floating_point_v<T>)
+                return 0x80 | sizeof(T);
+            else if constexpr (std::is_signed_v<T>)
+                return 0x40 | sizeof(T);
+            else
+                return sizeof(T);
+        }
+
+        bool DoWrite(bool value) override { return DoGenericWrite(value); }
+        bool DoWrite(StringView name, bool value) override { return DoGenericWrite(name, value); }
+
+        bool DoWrite(onyxS8 value) override { return DoGenericWrite(value); }
+        bool DoWrite(onyxS16 value) override { return DoGenericWrite(value); }
+        bool DoWrite(onyxS32 value) override { return DoGenericWrite(value); }
+        bool DoWrite(onyxS64 value) override { return DoGenericWrite(value); }
+        bool DoWrite(onyxU8 value) override { return DoGenericWrite(value); }
+        bool DoWrite(onyxU16 value) override { return DoGenericWrite(value); }
+        bool DoWrite(onyxU32 value) override { return DoGenericWrite(value); }
+        bool DoWrite(onyxU64 value) override { return DoGenericWrite(value); }
+        bool DoWrite(onyxS8 value, onyxU8 /*base*/) override { return DoGenericWrite(value); }
+        bool DoWrite(onyxS16 value, onyxU8 /*base*/) override { return DoGenericWrite(value); }
+        bool DoWrite(onyxS32 value, onyxU8 /*base*/) override { return DoGenericWrite(value); }
+        bool DoWrite(onyxS64 value, onyxU8 /*base*/) override { return DoGenericWrite(value); }
+        bool DoWrite(onyxU8 value, onyxU8 /*base*/) override { return DoGenericWrite(value); }
+        bool DoWrite(onyxU16 value, onyxU8 /*base*/) override { return DoGenericWrite(value); }
+        bool DoWrite(onyxU32 value, onyxU8 /*base*/) override { return DoGenericWrite(value); }
+        bool DoWrite(onyxU64 value, onyxU8 /*base*/) override { return DoGenericWrite(value); }
+
+        bool DoWrite(StringView name, onyxS8 value) override { return DoGenericWrite(name, value); }
+        bool DoWrite(StringView name, onyxS16 value) override { return DoGenericWrite(name, value); }
+        bool DoWrite(StringView name, onyxS32 value) override { return DoGenericWrite(name, value); }
+        bool DoWrite(StringView name, onyxS64 value) override { return DoGenericWrite(name, value); }
+        bool DoWrite(StringView name, onyxU8 value) override { return DoGenericWrite(name, value); }
+        bool DoWrite(StringView name, onyxU16 value) override { return DoGenericWrite(name, value); }
+        bool DoWrite(StringView name, onyxU32 value) override { return DoGenericWrite(name, value); }
+        bool DoWrite(StringView name, onyxU64 value) override { return DoGenericWrite(name, value); }
+        bool DoWrite(StringView name, onyxS8 value, onyxU8 /*base*/) override { return DoGenericWrite(name, value); }
+        bool DoWrite(StringView name, onyxS16 value, onyxU8 /*base*/) override { return DoGenericWrite(name, value); }
+        bool DoWrite(StringView name, onyxS32 value, onyxU8 /*base*/) override { return DoGenericWrite(name, value); }
+        bool DoWrite(StringView name, onyxS64 value, onyxU8 /*base*/) override { return DoGenericWrite(name, value); }
+        bool DoWrite(StringView name, onyxU8 value, onyxU8 /*base*/) override { return DoGenericWrite(name, value); }
+        bool DoWrite(StringView name, onyxU16 value, onyxU8 /*base*/) override { return DoGenericWrite(name, value); }
+        bool DoWrite(StringView name, onyxU32 value, onyxU8 /*base*/) override { return DoGenericWrite(name, value); }
+        bool DoWrite(StringView name, onyxU64 value, onyxU8 /*base*/) override { return DoGenericWrite(name, value); }
+
+        bool DoWrite(onyxF32 value) override { return DoGenericWrite(value); }
+        bool DoWrite(onyxF64 value) override { return DoGenericWrite(value); }
+        bool DoWrite(StringView name, onyxF32 value) override { return DoGenericWrite(name, value); }
+        bool DoWrite(StringView name, onyxF64 value) override { return DoGenericWrite(name, value); }
+
+        bool DoWrite(StringView value) override { return DoGenericWrite(value); }
+        bool DoWrite(StringView name, StringView value) override { return DoGenericWrite(name, value); }
+
+        bool CreateScope(onyxU32 /*index*/) override { AddToken(Token::IndexScope); return true; }
+        bool CreateScope(onyxU64 /*index*/) override { AddToken(Token::IndexScope); return true; }
+        bool CreateScope(StringView name) override { AddToken(Token::Scope, 0, name); return true; }
+        bool EndScope() override { AddToken(Token::EndScope); return true; }
+
+        // counts depend on the values, only the presence of a collection is part of the schema
+        bool WriteItemsCount(onyxU8 /*count*/) override { AddToken(Token::ItemsCount); return true; }
+        bool WriteItemsCount(onyxU16 /*count*/) override { AddToken(Token::ItemsCount); return true; }
+        bool WriteItemsCount(onyxU32 /*count*/) override { AddToken(Token::ItemsCount); return true; }
+        bool WriteItemsCount(onyxU64 /*count*/) override { AddToken(Token::ItemsCount); return true; }
+
+        bool IsSupportingIntegralScopes() const override { return false; }
+
+    private:
+        Hash::FastHasher m_Hasher;
+    };
+
+    template <typename T> requires Serializable<T> && std::is_default_constructible_v<T>
+    onyxU64 ComputeSchemaId(onyxU64 seed = 0)
+    {
+        SchemaSerializer serializer(seed);
+        Serialization<T>::Serialize(serializer, T{});
+        return serializer.GetSchemaId();
+    }
+}
@@ -4,6 +4,7 @@ namespace Onyx
 {
     class Serializer;
     class Deserializer;
+    class Stream;
 
     template <typename T>
     struct Serialization
@@ -24,6 +25,24 @@ namespace Onyx
         { Serialization<T>::Deserialize(deserializer, obj) } -> std::same_as<bool>;
     };
 
+    // Versioned binary serialization for hot paths (e.g.: scene sectors), the schema id identifies the layout the data was written with.
+    // Data with a different schema id has to be rejected by the caller and loaded through the Serializer / Deserializer path instead.
+    template <typename T>
+    struct BinarySerialization
+    {
+        static constexpr onyxU64 SchemaId = 0;
+        static bool Serialize(Stream&, const T&) = delete;
+        static bool Deserialize(const Stream&, T&) = delete;
+    };
+
+    template<typename T>
+    concept BinarySerializable = requires(const T& obj, T& outObj, Stream& outStream, const Stream& inStream)
+    {
+        { BinarySerialization<T>::SchemaId } -> std::convertible_to<onyxU64>;
+        { BinarySerialization<T>::Serialize(outStream, obj) } -> std::same_as<bool>;
+        { BinarySerialization<T>::Deserialize(inStream, outObj) } -> std::same_as<bool>;
+    };
+
     struct SerializationScope
     {
         SerializationScope(Serializer& serializer, StringView scopeName);
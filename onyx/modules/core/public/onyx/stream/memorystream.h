@@ -0,0 +1,45 @@
+#pragma once
+
+#include <onyx/stream/stream.h>
+
+namespace Onyx
+{
+    // Binary stream over memory.
+    // Default constructed streams own a growable buffer and are writable,
+    // streams constructed from existing data (e.g.: a memory mapped file) are read-only views.
+    class MemoryStream : public Stream
+    {
+    public:
+        MemoryStream() = default;
+        MemoryStream(const char* data, onyxU64 size);
+        explicit MemoryStream(StringView data);
+
+        bool IsValid() const override { return m_CurrentDataPosition <= GetLength(); }
+        bool IsEof() const override { return m_CurrentDataPosition >= GetLength(); }
+        onyxU64 GetPosition() override { return m_CurrentDataPosition; }
+        onyxU64 GetPosition() const override { return m_CurrentDataPosition; }
+        void SetPosition(onyxU64 position) override { m_CurrentDataPosition = position; }
+        onyxU64 GetLength() const override { return IsReadOnly() ? m_ReadOnlySize : static_cast<onyxU64>(m_Buffer.size()); }
+
+        bool IsReadOnly() const { return m_ReadOnlyData != nullptr; }
+
+        const char* GetData() const { return IsReadOnly() ? m_ReadOnlyData : m_Buffer.data(); }
+        // Pointer to the current read position, used to reference data in place without copying it
+        const char* GetCurrentData() const { return GetData() + m_CurrentDataPosition; }
+
+        const DynamicArray<char>& GetBuffer() const { return m_Buffer; }
+        void Reserve(onyxU64 size) { m_Buffer.reserve(size); }
+
+    private:
+        void DoRead(char* destination, onyxU64 size) const override;
+        void DoWrite(const char* data, onyxU64 size) override;
+
+    private:
+        DynamicArray<char> m_Buffer;
+
+        const char* m_ReadOnlyData = nullptr;
+        onyxU64 m_ReadOnlySize = 0;
+
+        mutable onyxU64 m_CurrentDataPosition = 0;
+    };
+}
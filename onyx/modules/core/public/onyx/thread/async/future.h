@@ -3,9 +3,11 @@
 #include <onyx/inplacefunction.h>
 #include <onyx/onyx_types.h>
 
+#include <coroutine>
 #include <variant>
 #include <utility>
 #include <future>
+#include <thread>
 #include <stop_token>
 
 #define REQUIRES(...) typename std::enable_if<(__VA_ARGS__)>::type* = nullptr
@@ -40,6 +42,20 @@ namespace details
         {
         }
 
+        ~future_shared_state()
+        {
+            ContinuationNode* node = m_Continuations.load(std::memory_order::acquire);
+            if (node == &s_ClosedList)
+                return;
+
+            while (node != nullptr)
+            {
+                ContinuationNode* next = node->Next;
+                delete node;
+                node = next;
+            }
+        }
+
     private:
         enum class State : onyxU8
         {
@@ -49,14 +65,27 @@ namespace details
             Failure,
         };
 
+        struct ContinuationNode
+        {
+            InplaceFunction<void()> Callback;
+            ContinuationNode* Next = nullptr;
+            // awaiters have to be resumed on cancellation as well, Then continuations only run on completion
+            bool RunOnCancel = false;
+        };
+
+        // marks the list as closed once the state is settled, continuations added after that run inline
+        static inline ContinuationNode s_ClosedList;
+
     public:
 
         void Wait() const
         {
-            if (m_State != State::Pending)
-                return;
-
-            std::atomic_wait(&m_State, State::Pending);
+            while (m_IsSettled.load(std::memory_order::acquire) == false)
+            {
+                // the state only settles once all continuations returned
+                ONYX_ASSERT(m_SettlingThread.load(std::memory_order::acquire) != std::this_thread::get_id(), "Waiting on a future from one of its own continuations never returns.");
+                m_IsSettled.wait(false, std::memory_order::acquire);
+            }
         }
 
         T Get() const
@@ -68,7 +97,7 @@ namespace details
 
             if constexpr (std::is_same_v<T, void> == false)
             {
-                if (m_State.load(std::memory_order::relaxed) == State::Completed)
+                if (m_State.load(std::memory_order::acquire) == State::Completed)
                 {
                     return std::get<1>(m_Value);
                 }
@@ -79,62 +108,45 @@ namespace details
 
         bool IsPending() const
         {
-            return m_State.load(std::memory_order::relaxed) == State::Pending;
+            return m_State.load(std::memory_order::acquire) == State::Pending;
         }
 
         bool IsCompleted() const
         {
-            return m_State.load(std::memory_order::relaxed) == State::Completed;
+            return m_State.load(std::memory_order::acquire) == State::Completed;
         }
 
         bool IsCancelled() const
         {
-            return m_State.load(std::memory_order::relaxed) == State::Cancelled;
+            return m_State.load(std::memory_order::acquire) == State::Cancelled;
         }
 
         template <typename U = T, REQUIRES(std::is_void<U>::value)>
         void SetValue()
         {
-            if (UpdateState(State::Completed))
+            if (TryClaim())
             {
-                if (m_Continuation != nullptr)
-                {
-                    m_Continuation();
-                }
-
-                std::atomic_notify_all(&m_State);
+                Settle(State::Completed);
             }
         }
 
         template <typename U = T, REQUIRES(!std::is_void<U>::value)>
         void SetValue(U&& val)
         {
-            if (UpdateState(State::Completed))
+            if (TryClaim())
             {
                 m_Value = std::forward<U>(val);
-
-                if (m_Continuation != nullptr)
-                {
-                    m_Continuation();
-                }
-
-                std::atomic_notify_all(&m_State);
+                Settle(State::Completed);
             }
         }
 
         void Cancel()
         {
-            if (UpdateState(State::Cancelled))
+            if (TryClaim())
             {
                 m_StopSource.request_stop();
-                if (m_CancelCallback != nullptr)
-                {
-                    m_CancelCallback();
-                }
-
-                std::atomic_notify_all(&m_State);
+                Settle(State::Cancelled);
             }
-
         }
 
         void Cancel(bool waitForCancel)
@@ -147,10 +159,29 @@ namespace details
             }
         }
 
+        // any number of continuations can be added, also from multiple threads and after the state completed
         template <typename Callable>
         void Then(Callable&& c)
         {
-            m_Continuation = std::move(c);
+            AddContinuation(std::forward<Callable>(c), false);
+        }
+
+        // runs on completion and on cancellation
+        template <typename Callable>
+        void Finally(Callable&& c)
+        {
+            AddContinuation(std::forward<Callable>(c), true);
+        }
+
+        // returns false if the state is already settled and the coroutine should not suspend
+        bool AddWaiter(std::coroutine_handle<> handle)
+        {
+            ContinuationNode* node = new ContinuationNode{ [handle]() { handle.resume(); }, nullptr, true };
+            if (TryPushContinuation(node))
+                return true;
+
+            delete node;
+            return false;
         }
 
         template <typename Callable>
@@ -162,32 +193,108 @@ namespace details
         std::stop_token GetStopToken() { return m_StopSource.get_token(); }
 
     private:
+        // only the first SetValue or Cancel gets to write the result
+        bool TryClaim()
+        {
+            bool isClaimed = m_IsClaimed.load(std::memory_order::acquire);
+            return (isClaimed == false) && m_IsClaimed.compare_exchange_strong(isClaimed, true, std::memory_order::acq_rel);
+        }
 
-        bool UpdateState(State desired)
+        void Settle(State state)
         {
-            State currentState = m_State.load(std::memory_order::relaxed);
-            do
+            m_SettlingThread.store(std::this_thread::get_id(), std::memory_order::release);
+            m_State.store(state, std::memory_order::release);
+
+            if ((state == State::Cancelled) && (m_CancelCallback != nullptr))
+            {
+                m_CancelCallback();
+            }
+
+            RunContinuations(state == State::Cancelled);
+
+            m_IsSettled.store(true, std::memory_order::release);
+            m_IsSettled.notify_all();
+        }
+
+        template <typename Callable>
+        void AddContinuation(Callable&& c, bool runOnCancel)
+        {
+            ContinuationNode* node = new ContinuationNode{ std::forward<Callable>(c), nullptr, runOnCancel };
+            if (TryPushContinuation(node) == false)
             {
-                if ((currentState == desired) ||
-                    (currentState == State::Failure) ||
-                    (currentState == State::Cancelled))
+                if (runOnCancel || IsCompleted())
                 {
-                    return false;
+                    node->Callback();
                 }
 
-            } while (m_State.compare_exchange_weak(currentState, desired) == false);
+                delete node;
+            }
+        }
+
+        bool TryPushContinuation(ContinuationNode* node)
+        {
+            ContinuationNode* head = m_Continuations.load(std::memory_order::acquire);
+            do
+            {
+                if (head == &s_ClosedList)
+                    return false;
+
+                node->Next = head;
+            } while (m_Continuations.compare_exchange_weak(head, node, std::memory_order::acq_rel, std::memory_order::acquire) == false);
 
             return true;
         }
+
+        void RunContinuations(bool isCancelled)
+        {
+            ContinuationNode* node = m_Continuations.exchange(&s_ClosedList, std::memory_order::acq_rel);
+
+            // the list is pushed at the front, reverse it to run continuations in the order they got added
+            ContinuationNode* reversed = nullptr;
+            while (node != nullptr)
+            {
+                ContinuationNode* next = node->Next;
+                node->Next = reversed;
+                reversed = node;
+                node = next;
+            }
+
+            while (reversed != nullptr)
+            {
+                ContinuationNode* next = reversed->Next;
+                if ((isCancelled == false) || reversed->RunOnCancel)
+                {
+                    reversed->Callback();
+                }
+
+                delete reversed;
+                reversed = next;
+            }
+        }
+
     private:
         Atomic<State> m_State { State::Pending };
+        Atomic<bool> m_IsClaimed { false };
+        // set once all continuations ran, Wait returns after that
+        Atomic<bool> m_IsSettled { false };
+        Atomic<std::thread::id> m_SettlingThread;
 
         std::variant<std::monostate, typename return_value_type<T>::type, std::exception_ptr> m_Value;
         std::stop_source m_StopSource;
 
-        InplaceFunction<void()> m_Continuation = nullptr;
+        Atomic<ContinuationNode*> m_Continuations { nullptr };
         InplaceFunction<void()> m_CancelCallback = nullptr;
     };
+
+    template <typename T>
+    struct future_awaiter
+    {
+        SharedPtr<future_shared_state<T>> m_FutureState;
+
+        bool await_ready() const { return m_FutureState->IsPending() == false; }
+        bool await_suspend(std::coroutine_handle<> handle) { return m_FutureState->AddWaiter(handle); }
+        T await_resume() const { return m_FutureState->Get(); }
+    };
 }
 
 template <typename T>
@@ -272,6 +379,13 @@ public:
         m_FutureState->Then(std::forward<Callable>(c));
     }
 
+    template <typename Callable>
+    void Finally(Callable&& c)
+    {
+        ONYX_ASSERT(m_FutureState != nullptr);
+        m_FutureState->Finally(std::forward<Callable>(c));
+    }
+
     template <typename Callable>
     void OnCancel(Callable&& c)
     {
@@ -279,6 +393,13 @@ public:
         m_FutureState->OnCancel(std::forward<Callable>(c));
     }
 
+    // resumes the awaiting coroutine on the thread that completes or cancels the future
+    details::future_awaiter<T> operator co_await() const
+    {
+        ONYX_ASSERT(m_FutureState != nullptr);
+        return { m_FutureState };
+    }
+
 private:
     SharedPtr<details::future_shared_state<T>> m_FutureState;
 };
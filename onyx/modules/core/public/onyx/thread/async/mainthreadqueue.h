@@ -0,0 +1,65 @@
+#pragma once
+
+#include <onyx/inplacefunction.h>
+#include <onyx/thread/thread.h>
+#include <onyx/thread/container/lockfreempscboundedqueue.h>
+
+#include <mutex>
+
+namespace Onyx::Threading
+{
+    // Callbacks posted from any thread that get executed on the main thread once per frame.
+    class MainThreadQueue
+    {
+    public:
+        using Callback = InplaceFunction<void()>;
+        static constexpr onyxU32 QUEUE_SIZE = 1024;
+
+        void Post(Callback&& callback)
+        {
+            if (m_Queue.Push(std::move(callback)))
+                return;
+
+            // rare case of more than QUEUE_SIZE posts in a single frame, fall back to a locked array
+            std::scoped_lock lock(m_OverflowMutex);
+            m_Overflow.push_back(std::move(callback));
+            m_HasOverflow.store(true, std::memory_order::release);
+        }
+
+        // runs everything that got posted so far, has to be called from the main thread
+        void Dispatch()
+        {
+            ONYX_ASSERT(Thread::MAIN_THREAD_ID == std::this_thread::get_id(), "Main thread queue dispatched from a different thread.");
+
+            Callback callback;
+            while (m_Queue.Pop(callback))
+            {
+                callback();
+            }
+
+            if (m_HasOverflow.load(std::memory_order::acquire) == false)
+                return;
+
+            DynamicArray<Callback> overflow;
+            {
+                std::scoped_lock lock(m_OverflowMutex);
+                std::swap(overflow, m_Overflow);
+                m_HasOverflow.store(false, std::memory_order::release);
+            }
+
+            for (Callback& overflowCallback : overflow)
+            {
+                overflowCallback();
+            }
+        }
+
+    private:
+        LockFreeMPSCBoundedQueue<Callback, QUEUE_SIZE> m_Queue;
+
+        std::mutex m_OverflowMutex;
+        DynamicArray<Callback> m_Overflow;
+        Atomic<bool> m_HasOverflow { false };
+    };
+
+    inline MainThreadQueue DefaultMainThreadQueue;
+}
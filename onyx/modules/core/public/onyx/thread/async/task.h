@@ -0,0 +1,194 @@
+#pragma once
+
+#include <onyx/thread/async/future.h>
+#include <onyx/thread/async/mainthreadqueue.h>
+#include <onyx/thread/threadpool/threadpool.h>
+
+#include <coroutine>
+
+namespace Onyx::Threading
+{
+template <typename T>
+class Task;
+
+namespace details
+{
+    template <typename T>
+    struct task_promise_base
+    {
+        // tasks start eagerly on the calling thread, the frame gets destroyed once the body returned
+        // the result lives in the shared state so it outlives the frame
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+
+        void unhandled_exception()
+        {
+            ONYX_ASSERT(false, "Unhandled exception in task.");
+            m_FutureState->Cancel();
+        }
+
+        SharedPtr<future_shared_state<T>> m_FutureState = std::make_shared<future_shared_state<T>>();
+    };
+
+    template <typename T>
+    struct task_promise : task_promise_base<T>
+    {
+        Task<T> get_return_object() { return Task<T>{ this->m_FutureState }; }
+
+        template <typename U>
+        void return_value(U&& value)
+        {
+            this->m_FutureState->SetValue(std::forward<U>(value));
+        }
+    };
+
+    template <>
+    struct task_promise<void> : task_promise_base<void>
+    {
+        Task<void> get_return_object();
+
+        void return_void()
+        {
+            m_FutureState->SetValue();
+        }
+    };
+
+    struct thread_pool_awaiter
+    {
+        ThreadPool& m_ThreadPool;
+
+        bool await_ready() const noexcept { return false; }
+
+        bool await_suspend(std::coroutine_handle<> handle)
+        {
+            // a worker of the pool is already on the requested pool, it continues inline if the queues are full
+            if (m_ThreadPool.IsWorkerThread())
+                return m_ThreadPool.TryPost([handle]() { handle.resume(); });
+
+            m_ThreadPool.PostOrWait([handle]() { handle.resume(); });
+            return true;
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    struct main_thread_awaiter
+    {
+        MainThreadQueue& m_Queue;
+
+        bool await_ready() const noexcept { return Thread::MAIN_THREAD_ID == std::this_thread::get_id(); }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            m_Queue.Post([handle]() { handle.resume(); });
+        }
+
+        void await_resume() const noexcept {}
+    };
+}
+
+// Coroutine that shares its result state with Future so it can be awaited by any number of coroutines,
+// converted to a Future for blocking code and combined with WhenAll/WhenAny.
+template <typename T>
+class Task
+{
+public:
+    using promise_type = details::task_promise<T>;
+
+    Task() = default;
+    explicit Task(SharedPtr<details::future_shared_state<T>> futureState)
+        : m_FutureState(std::move(futureState))
+    {
+    }
+
+    bool IsValid() const { return m_FutureState != nullptr; }
+    bool IsPending() const { ONYX_ASSERT(m_FutureState != nullptr); return m_FutureState->IsPending(); }
+    bool IsCompleted() const { ONYX_ASSERT(m_FutureState != nullptr); return m_FutureState->IsCompleted(); }
+    bool IsCancelled() const { ONYX_ASSERT(m_FutureState != nullptr); return m_FutureState->IsCancelled(); }
+
+    Future<T> GetFuture() const { return Future<T>{ m_FutureState }; }
+
+    // blocks, avoid calling this from a pool thread the task itself depends on
+    T Get() const
+    {
+        ONYX_ASSERT(m_FutureState != nullptr);
+        return m_FutureState->Get();
+    }
+
+    details::future_awaiter<T> operator co_await() const
+    {
+        ONYX_ASSERT(m_FutureState != nullptr);
+        return { m_FutureState };
+    }
+
+private:
+    SharedPtr<details::future_shared_state<T>> m_FutureState;
+};
+
+inline Task<void> details::task_promise<void>::get_return_object()
+{
+    return Task<void>{ m_FutureState };
+}
+
+// co_await ResumeOn(pool) continues the coroutine on a thread of the pool
+inline details::thread_pool_awaiter ResumeOn(ThreadPool& threadPool)
+{
+    return { threadPool };
+}
+
+// co_await ResumeOnMainThread() continues the coroutine the next time the main thread dispatches its queue
+inline details::main_thread_awaiter ResumeOnMainThread(MainThreadQueue& queue = DefaultMainThreadQueue)
+{
+    return { queue };
+}
+
+// completes once all futures are completed or cancelled
+template <typename T>
+Future<void> WhenAll(const DynamicArray<Future<T>>& futures)
+{
+    struct WhenAllState
+    {
+        Promise<void> Result;
+        Atomic<onyxU64> RemainingCount;
+    };
+
+    SharedPtr<WhenAllState> state = std::make_shared<WhenAllState>();
+    state->RemainingCount = futures.size();
+
+    Future<void> result = state->Result.GetFuture();
+    if (futures.empty())
+    {
+        state->Result.SetValue();
+        return result;
+    }
+
+    for (Future<T> future : futures)
+    {
+        future.Finally([state]()
+        {
+            if (state->RemainingCount.fetch_sub(1, std::memory_order::acq_rel) == 1)
+                state->Result.SetValue();
+        });
+    }
+
+    return result;
+}
+
+// completes with the index of the first future that completed or got cancelled
+template <typename T>
+Future<onyxU32> WhenAny(const DynamicArray<Future<T>>& futures)
+{
+    ONYX_ASSERT(futures.empty() == false, "WhenAny needs at least one future.");
+
+    SharedPtr<Promise<onyxU32>> result = std::make_shared<Promise<onyxU32>>();
+    for (onyxU32 i = 0; i < futures.size(); ++i)
+    {
+        // only the first SetValue is accepted by the shared state
+        Future<T> future = futures[i];
+        future.Finally([result, i]() { result->SetValue(onyxU32(i)); });
+    }
+
+    return result->GetFuture();
+}
+
+} // namespace Onyx::Threading
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <onyx/thread/threadpool/threadpool.h>
+#include <onyx/thread/synchronization/atomic_latch.h>
+
+namespace Onyx::Threading
+{
+    namespace Internal
+    {
+        struct ParallelForState
+        {
+            Atomic<onyxU32> NextJob = 0;
+            AtomicLatch RemainingJobs;
+        };
+
+        template <typename Job>
+        void RunParallelForJobs(ParallelForState& state, onyxU32 jobCount, Job* job)
+        {
+            // the job is only touched for claimed indices, the caller waits for those so it is still alive
+            for (onyxU32 index = state.NextJob.fetch_add(1); index < jobCount; index = state.NextJob.fetch_add(1))
+            {
+                (*job)(index);
+                state.RemainingJobs.Decrement();
+            }
+        }
+    }
+
+    // Runs job(index) for every index in [0, jobCount) on the thread pool and the calling thread.
+    // The calling thread claims jobs as well and only waits for jobs that are already running on another thread,
+    // so it never waits for queued tasks, which would deadlock when it is called from a worker of the same pool.
+    template <typename Job>
+    void ParallelFor(ThreadPool& threadPool, onyxU32 jobCount, Job&& job)
+    {
+        if (jobCount == 0)
+            return;
+
+        if (jobCount == 1)
+        {
+            job(0u);
+            return;
+        }
+
+        // queued tasks can still start after all jobs are done, so they share ownership of the state
+        SharedPtr<Internal::ParallelForState> state = std::make_shared<Internal::ParallelForState>();
+        state->RemainingJobs.SetCounter(static_cast<onyxS32>(jobCount));
+
+        using JobT = std::remove_reference_t<Job>;
+        JobT* jobPtr = &job;
+        for (onyxU32 i = 1; i < jobCount; ++i)
+        {
+            // a full queue is fine, the calling thread runs the jobs that were not picked up
+            if (threadPool.TryPost([state, jobPtr, jobCount]() { Internal::RunParallelForJobs(*state, jobCount, jobPtr); }) == false)
+                break;
+        }
+
+        Internal::RunParallelForJobs(*state, jobCount, jobPtr);
+        state->RemainingJobs.Wait();
+    }
+}
@@ -28,10 +28,11 @@ namespace Onyx::Threading
         explicit ThreadPoolImpl(const ThreadPoolOptions& options, const char* profilerName);
 #endif
 
-        ThreadPoolImpl(ThreadPoolImpl&& rhs) noexcept;
-        ~ThreadPoolImpl();
+        // workers keep pointers to the pool signal and their siblings
+        ThreadPoolImpl(ThreadPoolImpl&& rhs) = delete;
+        ThreadPoolImpl& operator=(ThreadPoolImpl&& rhs) = delete;
 
-        ThreadPoolImpl& operator=(ThreadPoolImpl&& rhs) noexcept;
+        ~ThreadPoolImpl();
 
         //template <typename Callable>
         //auto Emplace(Callable&& functor) -> Future<std::invoke_result_t<Callable>>
@@ -51,13 +52,20 @@ namespace Onyx::Threading
         template <typename Handler>
         void Post(Handler&& handler);
 
+        // parks the calling thread while the queues are full, must not be called from a worker of this pool
+        template <typename Handler>
+        void PostOrWait(Handler&& handler);
+
+        bool IsWorkerThread() const { return *detail::thread_signal() == &m_Signal; }
+
     private:
         Worker<Task, Queue>& GetWorker();
 
+        // declared before the workers so it outlives their threads
+        WorkerSignal m_Signal;
         DynamicArray<UniquePtr<Worker<Task, Queue>>> m_Workers;
         Atomic<onyxU32> m_NextWorker;
         std::stop_source m_StopSource;
-        std::condition_variable m_WaitForTasks;
     };
 
     /// Implementation
@@ -69,14 +77,13 @@ namespace Onyx::Threading
     {
         for (UniquePtr<Worker<Task, Queue>>& workerPtr : m_Workers)
         {
-            workerPtr.reset(new Worker<Task, Queue>(options.GetQueueSize(), m_WaitForTasks));
+            workerPtr.reset(new Worker<Task, Queue>(options.GetQueueSize(), m_Signal));
         }
 
+        const Span<const UniquePtr<Worker<Task, Queue>>> siblings(m_Workers.data(), m_Workers.size());
         for (onyxU32 i = 0; i < m_Workers.size(); ++i)
         {
-            Worker<Task, Queue>* stealDonor = m_Workers[(i + 1) % m_Workers.size()].get();
-
-            m_Workers[i]->Start(i, stealDonor, m_StopSource.get_token(), Format::Format("{}_{}", profilerName, i));
+            m_Workers[i]->Start(i, siblings, m_StopSource.get_token(), Format::Format("{}_{}", profilerName, i));
         }
     }
 #endif
@@ -89,52 +96,36 @@ namespace Onyx::Threading
     {
         for (UniquePtr<Worker<Task, Queue>>& workerPtr : m_Workers)
         {
-            workerPtr.reset(new Worker<Task, Queue>(options.GetQueueSize(), m_WaitForTasks));
+            workerPtr.reset(new Worker<Task, Queue>(options.GetQueueSize(), m_Signal));
         }
 
+        const Span<const UniquePtr<Worker<Task, Queue>>> siblings(m_Workers.data(), m_Workers.size());
         for (onyxU32 i = 0; i < m_Workers.size(); ++i)
         {
-            Worker<Task, Queue>* stealDonor = m_Workers[(i + 1) % m_Workers.size()].get();
 #if ONYX_PROFILER_ENABLED
-            m_Workers[i]->Start(i, stealDonor, m_StopSource.get_token(), "");
+            m_Workers[i]->Start(i, siblings, m_StopSource.get_token(), "");
 #else
-            m_Workers[i]->Start(i, stealDonor, m_StopSource.get_token());
+            m_Workers[i]->Start(i, siblings, m_StopSource.get_token());
 #endif
         }
     }
 
-    template <typename Task, template<typename> class Queue>
-    inline ThreadPoolImpl<Task, Queue>::ThreadPoolImpl(ThreadPoolImpl<Task, Queue>&& rhs) noexcept
-    {
-        *this = rhs;
-    }
-
     template <typename Task, template<typename> class Queue>
     inline ThreadPoolImpl<Task, Queue>::~ThreadPoolImpl()
     {
         m_StopSource.request_stop();
-        m_WaitForTasks.notify_all();
-        // wait for join
-    }
-
-    template <typename Task, template<typename> class Queue>
-    inline ThreadPoolImpl<Task, Queue>&
-        ThreadPoolImpl<Task, Queue>::operator=(ThreadPoolImpl<Task, Queue>&& rhs) noexcept
-    {
-        if (this != &rhs)
-        {
-            m_Workers = std::move(rhs.m_Workers);
-            m_NextWorker = rhs.m_NextWorker.load();
-        }
-        return *this;
+        m_Signal.NotifyStop();
+        // workers join in their destructor
     }
 
     template <typename Task, template<typename> class Queue>
     template <typename Handler>
     inline bool ThreadPoolImpl<Task, Queue>::TryPost(Handler&& handler)
     {
-        bool success = GetWorker().Post(std::forward<Handler>(handler));
-        m_WaitForTasks.notify_all();
+        const bool success = GetWorker().Post(std::forward<Handler>(handler));
+        if (success)
+            m_Signal.NotifyTaskPosted();
+
         return success;
     }
 
@@ -149,6 +140,14 @@ namespace Onyx::Threading
         }
     }
 
+    template <typename Task, template<typename> class Queue>
+    template <typename Handler>
+    inline void ThreadPoolImpl<Task, Queue>::PostOrWait(Handler&& handler)
+    {
+        ONYX_ASSERT(IsWorkerThread() == false, "Workers waiting for a free slot could leave no worker to free one.");
+        m_Signal.ParkUntilPosted([this, &handler]() { return TryPost(handler); });
+    }
+
     template <typename Task, template<typename> class Queue>
     inline Worker<Task, Queue>& ThreadPoolImpl<Task, Queue>::GetWorker()
     {
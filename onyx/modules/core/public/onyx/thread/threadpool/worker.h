@@ -7,11 +7,84 @@ namespace Onyx
 {
     namespace Threading
     {
+        /**
+         * @brief Shared by all workers of a pool, counts the queued tasks so idle workers
+         * can wait on it with a predicate instead of relying on a single notify.
+         */
+        struct WorkerSignal
+        {
+            std::mutex Mutex;
+            std::condition_variable WaitForWork;
+            Atomic<onyxS32> PendingTasks = 0;
+
+            // posters waiting for a free queue slot, the generation is bumped whenever a task got taken while one is parked
+            std::condition_variable WaitForSlot;
+            Atomic<onyxS32> ParkedPosters = 0;
+            onyxU64 SlotGeneration = 0;
+
+            void NotifyTaskPosted()
+            {
+                {
+                    // incremented under the lock so a worker can not miss it between checking the predicate and waiting
+                    std::lock_guard lock(Mutex);
+                    PendingTasks.fetch_add(1, std::memory_order_release);
+                }
+                WaitForWork.notify_one();
+            }
+
+            void NotifyTaskTaken()
+            {
+                PendingTasks.fetch_sub(1, std::memory_order_acq_rel);
+
+                // pairs with the fence in ParkUntilPosted, either the poster sees the free slot or we see the parked poster
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (ParkedPosters.load(std::memory_order_relaxed) > 0)
+                {
+                    {
+                        std::lock_guard lock(Mutex);
+                        ++SlotGeneration;
+                    }
+                    WaitForSlot.notify_all();
+                }
+            }
+
+            // calls tryPost until it succeeds, sleeping until a worker took a task in between
+            template <typename TryPost>
+            void ParkUntilPosted(TryPost&& tryPost)
+            {
+                ParkedPosters.fetch_add(1, std::memory_order_relaxed);
+                while (true)
+                {
+                    onyxU64 generation;
+                    {
+                        std::lock_guard lock(Mutex);
+                        generation = SlotGeneration;
+                    }
+
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    if (tryPost())
+                        break;
+
+                    std::unique_lock lock(Mutex);
+                    WaitForSlot.wait(lock, [this, generation]() { return SlotGeneration != generation; });
+                }
+                ParkedPosters.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            void NotifyStop()
+            {
+                {
+                    std::lock_guard lock(Mutex);
+                }
+                WaitForWork.notify_all();
+            }
+        };
+
         /**
          * @brief The Worker class owns task queue and executing thread.
          * In thread it tries to pop task from queue. If queue is empty then it tries
-         * to steal task from the sibling worker. If steal was unsuccessful then spins
-         * with one millisecond delay.
+         * to steal task from the sibling workers. If steal was unsuccessful it waits
+         * until a task is posted to any worker of the pool.
          */
         template <typename Task, template<typename> class Queue>
         class Worker
@@ -21,7 +94,7 @@ namespace Onyx
              * @brief Worker Constructor.
              * @param queue_size Length of underlying task queue.
              */
-            explicit Worker(onyxS32 queue_size, std::condition_variable& waitForWork);
+            explicit Worker(onyxS32 queue_size, WorkerSignal& signal);
 
             /**
              * @brief Move ctor implementation.
@@ -38,12 +111,12 @@ namespace Onyx
             /**
              * @brief start Create the executing thread and start tasks execution.
              * @param id Worker ID.
-             * @param steal_donor Sibling worker to steal task from it.
+             * @param siblings All workers of the pool to steal tasks from.
              */
 #if ONYX_PROFILER_ENABLED
-            void Start(onyxS64 id, Worker* steal_donor, std::stop_token token, StringView profilerName);
+            void Start(onyxS64 id, Span<const UniquePtr<Worker>> siblings, std::stop_token token, StringView profilerName);
 #else
-            void Start(onyxS64 id, Worker* steal_donor, std::stop_token token);
+            void Start(onyxS64 id, Span<const UniquePtr<Worker>> siblings, std::stop_token token);
 #endif
             /**
              * @brief stop Stop all worker's thread and stealing activity.
@@ -77,14 +150,16 @@ namespace Onyx
             /**
              * @brief doWork Executing thread function.
              * @param id Worker ID to be associated with this thread.
-             * @param steal_donor Sibling worker to steal task from it.
+             * @param siblings All workers of the pool to steal tasks from.
              */
-            void doWork(onyxS64 id, Worker* steal_donor);
+            void doWork(onyxS64 id, Span<const UniquePtr<Worker>> siblings);
+
+            bool TryGetTask(onyxS64 id, Span<const UniquePtr<Worker>> siblings, Task& task);
 
             Queue<Task> m_Queue;
             std::thread m_Thread;
             std::stop_token m_StopToken;
-            std::condition_variable* m_WaitForWork;
+            WorkerSignal* m_Signal;
 
 #if ONYX_PROFILER_ENABLED
             String m_ProfilerName;
@@ -100,12 +175,19 @@ namespace Onyx
                 static thread_local onyxS64 tss_id = -1;
                 return &tss_id;
             }
+
+            // signal of the pool the current thread is a worker of
+            inline const WorkerSignal** thread_signal()
+            {
+                static thread_local const WorkerSignal* tss_signal = nullptr;
+                return &tss_signal;
+            }
         }
 
         template <typename Task, template<typename> class Queue>
-        inline Worker<Task, Queue>::Worker(onyxS32 queueSize, std::condition_variable& waitForWork)
+        inline Worker<Task, Queue>::Worker(onyxS32 queueSize, WorkerSignal& signal)
             : m_Queue(queueSize)
-            , m_WaitForWork(&waitForWork)
+            , m_Signal(&signal)
         {
         }
 
@@ -136,16 +218,16 @@ namespace Onyx
 
         template <typename Task, template<typename> class Queue>
 #if ONYX_PROFILER_ENABLED
-        inline void Worker<Task, Queue>::Start(onyxS64 id, Worker* steal_donor, std::stop_token token, StringView profilerName)
+        inline void Worker<Task, Queue>::Start(onyxS64 id, Span<const UniquePtr<Worker>> siblings, std::stop_token token, StringView profilerName)
 #else
-        inline void Worker<Task, Queue>::Start(onyxS64 id, Worker* steal_donor, std::stop_token token)
+        inline void Worker<Task, Queue>::Start(onyxS64 id, Span<const UniquePtr<Worker>> siblings, std::stop_token token)
 #endif
         {
 #if ONYX_PROFILER_ENABLED
             m_ProfilerName = String(profilerName);
 #endif
             m_StopToken = std::move(token);
-            m_Thread = std::thread(&Worker<Task, Queue>::doWork, this, id, steal_donor);
+            m_Thread = std::thread(&Worker<Task, Queue>::doWork, this, id, siblings);
         }
 
 
@@ -170,9 +252,26 @@ namespace Onyx
         }
 
         template <typename Task, template<typename> class Queue>
-        inline void Worker<Task, Queue>::doWork(onyxS64 id, Worker* steal_donor)
+        inline bool Worker<Task, Queue>::TryGetTask(onyxS64 id, Span<const UniquePtr<Worker>> siblings, Task& task)
+        {
+            if (m_Queue.Pop(task))
+                return true;
+
+            const onyxS64 workerCount = static_cast<onyxS64>(siblings.size());
+            for (onyxS64 i = 1; i < workerCount; ++i)
+            {
+                if (siblings[(id + i) % workerCount]->Steal(task))
+                    return true;
+            }
+
+            return false;
+        }
+
+        template <typename Task, template<typename> class Queue>
+        inline void Worker<Task, Queue>::doWork(onyxS64 id, Span<const UniquePtr<Worker>> siblings)
         {
             *detail::thread_id() = id;
+            *detail::thread_signal() = m_Signal;
 #if ONYX_PROFILER_ENABLED
             if (m_ProfilerName.empty() == false)
             {
@@ -184,8 +283,9 @@ namespace Onyx
 
             while (m_StopToken.stop_requested() == false)
             {
-                if (m_Queue.Pop(handler) || steal_donor->Steal(handler))
+                if (TryGetTask(id, siblings, handler))
                 {
+                    m_Signal->NotifyTaskTaken();
                     //try
                     {
                         handler();
@@ -195,11 +295,18 @@ namespace Onyx
                         // suppress all exceptions
                     //}
                 }
+                else if (m_Signal->PendingTasks.load(std::memory_order_acquire) > 0)
+                {
+                    // a task was counted but is not visible in the queues yet or was just taken by another worker
+                    std::this_thread::yield();
+                }
                 else
                 {
-                    std::mutex waitMutex;
-                    std::unique_lock lock(waitMutex);
-                    m_WaitForWork->wait(lock);
+                    std::unique_lock lock(m_Signal->Mutex);
+                    m_Signal->WaitForWork.wait(lock, [this]()
+                    {
+                        return m_StopToken.stop_requested() || (m_Signal->PendingTasks.load(std::memory_order_acquire) > 0);
+                    });
                 }
             }
         }
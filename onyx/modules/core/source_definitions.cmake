@@ -31,8 +31,10 @@ set(onyx_TARGET_PUBLIC_SOURCES
     container/typelist.h
     engine/enginesystem.h
     engine/enginesystemfactory.h
+    engine/frametimer.h
     engine/gametime.h
     function/callback.h
+    function/queuedsignal.h
     function/signal.h
     geometry/common.h
     geometry/matrix2.h
@@ -53,12 +55,14 @@ set(onyx_TARGET_PUBLIC_SOURCES
     log/logger.h
     log/loglevel.h
     log/logmessage.h
+    memory/frameallocator.h
     memory/objectpool.h
     platforms/platform.h
     platforms/windows/platform.h
     profiler/profiletimer.h
     serialize/serialization.h
     serialize/deserializer.h
+    serialize/schemaserializer.h
     serialize/serializer.h
     stream/memorystream.h
     stream/stream.h
@@ -70,11 +74,14 @@ set(onyx_TARGET_PUBLIC_SOURCES
     thread/thread.h
     thread/async/asynctask.h
     thread/async/future.h
+    thread/async/mainthreadqueue.h
+    thread/async/task.h
     thread/container/lockfreempmcboundedqueue.h
     thread/container/lockfreempmcboundedqueue.hpp
     thread/container/lockfreempscboundedqueue.h
     thread/container/lockfreempscboundedqueue.hpp
     thread/synchronization/atomic_latch.h
+    thread/threadpool/parallelfor.h
     thread/threadpool/threadpool.h
     thread/threadpool/threadpooloptions.h
     thread/threadpool/worker.h
@@ -88,6 +95,10 @@ set(onyx_TARGET_PRIVATE_SOURCES
     debugging.cpp
     guid.cpp
     hash.cpp
+    morton.cpp
+    engine/frametimer.cpp
+    memory/frameallocator.cpp
+    memory/objectpool.cpp
     stringid.cpp
     geometry/rectserialization.cpp
     geometry/vectorserialization.cpp
@@ -95,6 +106,7 @@ set(onyx_TARGET_PRIVATE_SOURCES
     log/backends/stdoutlogger.cpp
     log/backends/visualstudiolog.cpp
     platforms/windows/platform.cpp
+    serialize/schemaserializer.cpp
     serialize/serialization.cpp
     stream/memorystream.cpp
     stream/stream.cpp
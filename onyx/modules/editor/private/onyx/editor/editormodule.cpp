@@ -11,10 +11,26 @@
 
 #include <onyx/localization/localizationmodule.h>
 #include <onyx/localization/assets/gettextlocalizationdatabase.h>
+#include <onyx/localization/localizationcatalog.h>
 #include <onyx/ui/imguisystem.h>
 
 namespace Onyx::Editor
 {
+    namespace
+    {
+        // the compiled catalog is mapped without parsing, the po file is only loaded until it got cooked into a catalog next to it
+        void AddSecondaryDatabase(Assets::AssetSystem& assetSystem, Localization::LocalizationModule& localizationModule, StringView databaseName)
+        {
+            Assets::AssetId databaseId(FilePath(Format::Format("engine:/localization/{}{}", databaseName, Localization::LocalizationCatalog::FILE_EXTENSION)));
+            if (assetSystem.TryGetAssetMeta(databaseId).has_value() == false)
+                databaseId = Assets::AssetId(FilePath(Format::Format("engine:/localization/{}.po", databaseName)));
+
+            Assets::AssetHandle<Localization::GetTextLocalizationDatabase> database;
+            if (assetSystem.GetAsset(databaseId, database))
+                localizationModule.AddSecondaryDatabase(database);
+        }
+    }
+
     EditorSystem::EditorSystem(GameCore::GameCoreSystem& gameCore,
         Ui::ImGuiSystem& imguiSystem,
         Assets::AssetSystem& assetSystem,
@@ -25,29 +41,12 @@ namespace Onyx::Editor
     {
         Localization::Editor::InitLocalization(localizationModule);
 
-        Assets::AssetHandle<Localization::GetTextLocalizationDatabase> secondaryDb;
-
         // TODO: Move to app config?
-        assetSystem.GetAsset("engine:/localization/assets.po", secondaryDb);
-        localizationModule.AddSecondaryDatabase(secondaryDb);
-
-        assetSystem.GetAsset("engine:/localization/editor.po", secondaryDb);
-        localizationModule.AddSecondaryDatabase(secondaryDb);
-
-        assetSystem.GetAsset("engine:/localization/components.po", secondaryDb);
-        localizationModule.AddSecondaryDatabase(secondaryDb);
-
-        assetSystem.GetAsset("engine:/localization/nodegraph.po", secondaryDb);
-        localizationModule.AddSecondaryDatabase(secondaryDb);
-
-        assetSystem.GetAsset("engine:/localization/shadergraphnodes.po", secondaryDb);
-        localizationModule.AddSecondaryDatabase(secondaryDb);
-
-        assetSystem.GetAsset("engine:/localization/rendergraphnodes.po", secondaryDb);
-        localizationModule.AddSecondaryDatabase(secondaryDb);
-
-        assetSystem.GetAsset("engine:/localization/volumeshadergraphnodes.po", secondaryDb);
-        localizationModule.AddSecondaryDatabase(secondaryDb);
+        constexpr StringView secondaryDatabases[] = { "assets", "editor", "components", "nodegraph", "shadergraphnodes", "rendergraphnodes", "volumeshadergraphnodes" };
+        for (StringView databaseName : secondaryDatabases)
+        {
+            AddSecondaryDatabase(assetSystem, localizationModule, databaseName);
+        }
 
         imguiSystem.OpenWindow<EditorMainWindow>();
         imguiSystem.OpenWindow<StartupWindow>();
@@ -883,7 +883,7 @@ namespace Onyx::Editor::SceneEditor
 
         constants.MousePosition[0] = ((mousePos.x - sceneViewport.Position[0]) / sceneViewport.Extents[0]) * 2.0f - 1.0f;
         constants.MousePosition[1] = (((mousePos.y - sceneViewport.Position[1]) / sceneViewport.Extents[1]) * -2.0f + 1.0f);
-        constants.ViewConstantsAddress = m_GraphicsSystem.GetViewConstantsBuffer().GetGpuAddress();
+        constants.ViewConstantsAddress = m_GraphicsSystem.GetViewConstantsBuffer(m_GraphicsSystem.GetFrameIndex()).GetGpuAddress();
         constants.HitBufferAddress = m_HitBuffer.GetGpuAddress();
         constants.VolumeSourcesList = terrainOctree.VolumeObjects.GetGpuAddress();
         constants.VolumeSourcesData = terrainOctree.VolumeObjectsData.GetGpuAddress();
@@ -14,6 +14,7 @@
 #include <onyx/volume/components/csg/cubecomponent.gen.h>
 #include <onyx/volume/components/csg/spherecomponent.gen.h>
 #include <onyx/volume/graphics/previewterrainedit.h>
+#include <onyx/volume/source/volumeeditjournal.h>
 
 #include <imgui.h>
 #include <imgui_stacklayout.h>
@@ -70,7 +71,7 @@ namespace Onyx::Editor
             onyxU32 BrushOperation;
 
             Vector3f32 BrushSize;
-            onyxF32 Padding;
+            onyxU32 MaxSourceCount;
         };
 
         CreateVolumeSourcePushConstants createVolumeSourceConstants;
@@ -81,6 +82,7 @@ namespace Onyx::Editor
         createVolumeSourceConstants.BrushSize = m_BrushSize;
         createVolumeSourceConstants.BrushType = Enums::ToIntegral(m_Type);
         createVolumeSourceConstants.BrushOperation = Enums::ToIntegral(m_Operation);
+        createVolumeSourceConstants.MaxSourceCount = terrainOctree.VolumeObjectsCapacity;
 
         commandBuffer.BindShaderEffect(m_CreateVolumeSourceShader);
         commandBuffer.Barrier(terrainOctree.VolumeObjects, Graphics::Context::Compute, Graphics::Access::ShaderWrite);
@@ -119,6 +121,20 @@ namespace Onyx::Editor
         }
 
         componentFactory.TryCreateComponent<GameCore::NameComponent>(registry, newEntity, name);
+
+        const Volume::VolumeEditOperation operation = m_Operation == Operation::Subtract ? Volume::VolumeEditOperation::Difference : Volume::VolumeEditOperation::Union;
+        switch (m_Type)
+        {
+        case Primitives::Sphere:
+            AddTerrainEdit(scene, Volume::VolumeEdit::CreateSphere(operation, hitPosition, m_BrushSize.X));
+            break;
+        case Primitives::Cube:
+            AddTerrainEdit(scene, Volume::VolumeEdit::CreateCube(operation, hitPosition, m_BrushSize));
+            break;
+        case Primitives::Ellipsoid:
+            AddTerrainEdit(scene, Volume::VolumeEdit::CreateEllipsoid(operation, hitPosition, m_BrushSize));
+            break;
+        }
     }
 
     void PrimitivesTerrainTool::OnBrushSizeInput(onyxF32 value)
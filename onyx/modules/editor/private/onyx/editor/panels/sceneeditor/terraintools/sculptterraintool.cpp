@@ -5,6 +5,7 @@
 #include <onyx/ui/propertygrid.h>
 #include <onyx/volume/components/volumeterraincomponent.gen.h>
 #include <onyx/volume/graphics/previewterrainedit.h>
+#include <onyx/volume/source/volumeeditjournal.h>
 
 #include <imgui_extra_math.h>
 
@@ -604,6 +605,9 @@ namespace Onyx::Editor
 
             Vector3f32 BrushSize;
             onyxF32 Smoothness;
+
+            onyxU32 MaxSourceCount;
+            onyxF32 Padding;
         };
 
         CreateVolumeSourcePushConstants createVolumeSourceConstants;
@@ -616,6 +620,8 @@ namespace Onyx::Editor
         createVolumeSourceConstants.BrushType = 5;
         createVolumeSourceConstants.BrushOperation = m_Type == SculptType::Lower ? 1 :  0;
         createVolumeSourceConstants.Smoothness = m_Smoothness;
+        createVolumeSourceConstants.MaxSourceCount = terrainOctree.VolumeObjectsCapacity;
+        createVolumeSourceConstants.Padding = 0.0f;
         commandBuffer.BindShaderEffect(m_CreateVolumeSourceShader);
         commandBuffer.BindPushConstants(Graphics::ShaderStage::Compute, 0, createVolumeSourceConstants);
         commandBuffer.Dispatch(1, 1, 1);
@@ -624,9 +630,11 @@ namespace Onyx::Editor
         commandBuffer.Barrier(terrainOctree.VolumeObjectsData, Graphics::Context::Compute, Graphics::Access::ShaderRead);
     }
 
-    void SculptTerrainTool::OnHitPositionReadback(GameCore::Scene& /*scene*/, const Entity::ComponentFactory& /*componentFactory*/, const Vector3f32& /*hitPosition*/)
+    void SculptTerrainTool::OnHitPositionReadback(GameCore::Scene& scene, const Entity::ComponentFactory& /*componentFactory*/, const Vector3f32& hitPosition)
     {
-        // Nothing to do for sculpting as we do not create entities;
+        // no entities are created for sculpting, the brush only lives in the terrain edits
+        const Volume::VolumeEditOperation operation = m_Type == SculptType::Lower ? Volume::VolumeEditOperation::Difference : Volume::VolumeEditOperation::Union;
+        AddTerrainEdit(scene, Volume::VolumeEdit::CreateSphereBrush(operation, hitPosition, m_BrushSize.X, m_Smoothness));
     }
 
     void SculptTerrainTool::OnBrushSizeInput(onyxF32 value)
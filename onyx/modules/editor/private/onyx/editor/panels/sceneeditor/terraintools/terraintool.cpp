@@ -0,0 +1,19 @@
+#include <onyx/editor/panels/sceneeditor/terraintools/terraintool.h>
+
+#include <onyx/entity/entityregistry.h>
+#include <onyx/gamecore/scene/scene.h>
+#include <onyx/volume/components/volumeterraincomponent.gen.h>
+#include <onyx/volume/source/volumeeditjournal.h>
+
+namespace Onyx::Editor
+{
+    void TerrainTool::AddTerrainEdit(GameCore::Scene& scene, const Volume::VolumeEdit& edit)
+    {
+        auto terrainEditsView = scene.GetRegistry().GetView<Volume::TerrainEditsComponent>();
+        for (Entity::EntityId terrainEntity : terrainEditsView)
+        {
+            Volume::TerrainEditsComponent& terrainEdits = terrainEditsView.get<Volume::TerrainEditsComponent>(terrainEntity);
+            terrainEdits.Journal.Add(edit);
+        }
+    }
+}
@@ -5,6 +5,7 @@
 namespace Onyx::Volume
 {
     struct TerrainWorldOctreeComponent;
+    struct VolumeEdit;
 }
 
 namespace Onyx::GameCore
@@ -31,6 +32,10 @@ namespace Onyx::Editor
 
         virtual onyxF32 GetBounds() = 0;
         virtual void OnBrushSizeInput(onyxF32 value) = 0;
+
+    protected:
+        // records the edit in the journal of the terrain so it is kept with the scene
+        static void AddTerrainEdit(GameCore::Scene& scene, const Volume::VolumeEdit& edit);
     };
 
 }
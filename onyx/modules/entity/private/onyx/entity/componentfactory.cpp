@@ -22,6 +22,15 @@ namespace Onyx::Entity
         return false;
     }
 
+    bool ComponentFactory::TryCreateComponentFromBinary(EntityRegistry& registry, EntityId entity, StringId32 componentTypeId, const Stream& inStream) const
+    {
+        const IComponentMeta* componentMeta = GetComponentMeta(componentTypeId).value_or(nullptr);
+        if ((componentMeta == nullptr) || (componentMeta->GetBinarySchemaId() == 0))
+            return false;
+
+        return componentMeta->CreateFromBinary(registry, entity, inStream);
+    }
+
     bool ComponentFactory::TryCopyComponent(EntityRegistry& registry, EntityId entityId, StringId32 componentTypeId, void* fromComponentPtr) const
     {
         const IComponentMeta* componentMeta = GetComponentMeta(componentTypeId).value_or(nullptr);
@@ -95,6 +95,7 @@ namespace Onyx::Entity
 
         bool TryCreateComponent(EntityRegistry& registry, EntityId entityId, StringId32 componentTypeId) const;
         bool TryCreateComponent(EntityRegistry& registry, EntityId entityId, StringId32 componentTypeId, const Deserializer& deserializer) const;
+        bool TryCreateComponentFromBinary(EntityRegistry& registry, EntityId entityId, StringId32 componentTypeId, const Stream& inStream) const;
         bool TryCopyComponent(EntityRegistry& registry, EntityId entityId, StringId32 componentTypeId, void* fromComponentPtr) const;
 
     private:
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <onyx/entity/entityregistry.h>
+#include <onyx/serialize/schemaserializer.h>
+#include <onyx/stream/stream.h>
 
 namespace Onyx::Editor
 {
@@ -24,6 +26,13 @@ namespace Onyx::Entity
         template <typename T>
         concept IsFlagComponent = std::is_empty_v<T>;
 
+        // components that are copied as a whole in binary form, fields that are not serialized are copied as well so they have to be derived data
+        template <typename T>
+        concept IsPodComponent = std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T> && std::is_default_constructible_v<T> &&
+            (IsFlagComponent<T> == false) && Serializable<T> && Deserializable<T>;
+
+        template <typename T>
+        concept IsBinaryComponent = BinarySerializable<T> || IsPodComponent<T>;
     }
 
     class EntityRegistry;
@@ -41,6 +50,11 @@ namespace Onyx::Entity
         virtual bool Serialize(const void* componentAny, Serializer&) const = 0;
         virtual bool Deserialize(void* componentAny, const Deserializer&) const = 0;
 
+        // the schema id is 0 for components without a binary representation
+        virtual onyxU64 GetBinarySchemaId() const = 0;
+        virtual bool SerializeBinary(const void* componentAny, Stream& outStream) const = 0;
+        virtual bool CreateFromBinary(EntityRegistry& registry, EntityId entity, const Stream& inStream) const = 0;
+
 #if !ONYX_IS_RETAIL
         //virtual bool DrawPropertyGridEditor(void* componentAny) const = 0;
 #endif
@@ -220,8 +234,85 @@ namespace Onyx::Entity
             }
         }
 
+        onyxU64 GetBinarySchemaId() const override { return m_BinarySchemaId; }
+
+        bool SerializeBinary(const void* componentAny, Stream& outStream) const override
+        {
+            const T* component = static_cast<const T*>(componentAny);
+            if constexpr (BinarySerializable<T>)
+            {
+                return BinarySerialization<T>::Serialize(outStream, *component);
+            }
+            else if constexpr (Details::IsPodComponent<T>)
+            {
+                outStream.WriteRaw(*component);
+                return true;
+            }
+            else
+            {
+                ONYX_UNUSED(component);
+                ONYX_ASSERT(false, "Component has no binary serialization");
+                return false;
+            }
+        }
+
+        bool CreateFromBinary(EntityRegistry& registry, EntityId entity, const Stream& inStream) const override
+        {
+            if constexpr (Details::IsBinaryComponent<T>)
+            {
+                T component{};
+                if constexpr (BinarySerializable<T>)
+                {
+                    if (BinarySerialization<T>::Deserialize(inStream, component) == false)
+                        return false;
+                }
+                else
+                {
+                    if (inStream.GetRemainingLength() < sizeof(T))
+                        return false;
+
+                    inStream.ReadRaw(component);
+                }
+
+                if (m_Factory)
+                {
+                    m_Factory(registry, entity, std::move(component));
+                }
+                else
+                {
+                    registry.AddComponent<T>(entity, component);
+                }
+
+                return true;
+            }
+            else
+            {
+                ONYX_ASSERT(false, "Component has no binary serialization");
+                return false;
+            }
+        }
+
+    private:
+        static onyxU64 ComputeBinarySchemaId()
+        {
+            if constexpr (BinarySerializable<T>)
+            {
+                return BinarySerialization<T>::SchemaId;
+            }
+            else if constexpr (Details::IsPodComponent<T>)
+            {
+                // the raw copy also depends on the memory layout
+                return ComputeSchemaId<T>(sizeof(T) | (static_cast<onyxU64>(alignof(T)) << 32));
+            }
+            else
+            {
+                return 0;
+            }
+        }
+
     private:
         StringId32 m_TypeId;
         InplaceFunction<void(EntityRegistry&, EntityId, T&&)> m_Factory;
+        onyxU64 m_BinarySchemaId = ComputeBinarySchemaId();
     };
 }
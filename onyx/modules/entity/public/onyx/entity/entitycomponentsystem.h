@@ -1,6 +1,7 @@
 #pragma once
 
 #include <onyx/entity/entityregistry.h>
+#include <onyx/memory/frameallocator.h>
 
 namespace Onyx
 {
@@ -71,6 +72,7 @@ namespace Onyx::Entity
     struct ECSExecutionContext
     {
         DeltaGameTime DeltaTime;
+        FixedGameTime FixedTime;
         EntityRegistry& Registry;
         IEngine& Engine;
     };
@@ -111,7 +113,8 @@ namespace Onyx::Entity
 
     private:
         EntityRegistry* m_Registry = nullptr;
-        DynamicArray<InplaceFunction<void()>> m_QueuedCommands;
+        // only lives for one system call, so the commands can use frame memory
+        FrameArray<InplaceFunction<void()>> m_QueuedCommands;
     };
 
     template <typename T>
@@ -155,6 +158,19 @@ namespace Onyx::Entity
         }
     };
 
+    // systems that have to run at a fixed rate step StepCount times with StepDelta instead of using the frame delta
+    template <>
+    class DependentFunctionArg<const FixedGameTime&> : public IDependentFunctionArg
+    {
+    public:
+        ~DependentFunctionArg() override = default;
+
+        static const FixedGameTime& Get(const ECSExecutionContext& context)
+        {
+            return context.FixedTime;
+        }
+    };
+
     template <>
     class DependentFunctionArg<EntityCommandBuffer> : public IDependentFunctionArg
     {
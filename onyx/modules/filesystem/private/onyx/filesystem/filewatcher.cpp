@@ -24,28 +24,28 @@ namespace Onyx::FileSystem
                     case efsw::Action::Moved: fileAction = FileWatcher::FileAction::Moved; break;
                 }
 
-                if (OnFileChanged)
-                    OnFileChanged(fullpath, fileAction);
+                m_OnFileChanged(fullpath, fileAction);
             }
 
-            Callback<void(const FilePath&, FileWatcher::FileAction)> OnFileChanged;
-
+            Callback<void(const FilePath&, FileWatcher::FileAction)> m_OnFileChanged;
         };
     }
 
-    FileWatchListener listener;
-
     FileWatcher::FileWatcher()
-        : m_Watcher(MakeUnique<efsw::FileWatcher>())
     {
-        listener.OnFileChanged.Connect<&FileWatcher::OnFileAction>(this);
+        // every watcher needs its own listener, a shared one only forwarded changes to the last created watcher
+        UniquePtr<FileWatchListener> listener = MakeUnique<FileWatchListener>();
+        listener->m_OnFileChanged.Connect<&FileWatcher::OnFileAction>(this);
+        m_Listener = std::move(listener);
+
+        m_Watcher = MakeUnique<efsw::FileWatcher>();
         m_Watcher->watch();
     }
 
     FileWatcher::FileWatcher(const FilePath& path, bool recursive)
         : FileWatcher()
     {
-        m_Watcher->addWatch(path.string(), &listener, recursive);
+        m_Watcher->addWatch(path.string(), m_Listener.get(), recursive);
     }
 
     FileWatcher::FileWatcher(const FilePath& path)
@@ -55,17 +55,17 @@ namespace Onyx::FileSystem
 
     FileWatcher::~FileWatcher()
     {
-        listener.OnFileChanged.Reset();
+        // stop the watcher thread before the listener goes away
+        m_Watcher.reset();
     }
 
     void FileWatcher::AddPath(const FilePath& path, bool recursive)
     {
-        m_Watcher->addWatch(path.string(), &listener, recursive);
+        m_Watcher->addWatch(path.string(), m_Listener.get(), recursive);
     }
 
     void FileWatcher::OnFileAction(const FilePath& path, FileAction action)
     {
-        if (OnFileChanged)
-            OnFileChanged(path, action);
+        OnFileChanged.Publish(path, action);
     }
 }
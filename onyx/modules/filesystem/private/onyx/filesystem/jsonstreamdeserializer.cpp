@@ -0,0 +1,948 @@
+#include <onyx/filesystem/jsonstreamdeserializer.h>
+
+#include <onyx/filesystem/onyxfile.h>
+
+namespace Onyx::FileSystem
+{
+    namespace
+    {
+        constexpr onyxU32 MAX_DEPTH = 512;
+
+        bool IsWhitespace(char c)
+        {
+            return (c == ' ') || (c == '\n') || (c == '\r') || (c == '\t');
+        }
+
+        bool IsDigit(char c)
+        {
+            return (c >= '0') && (c <= '9');
+        }
+
+        onyxS32 GetHexValue(char c)
+        {
+            if ((c >= '0') && (c <= '9'))
+                return c - '0';
+            if ((c >= 'a') && (c <= 'f'))
+                return c - 'a' + 10;
+            if ((c >= 'A') && (c <= 'F'))
+                return c - 'A' + 10;
+
+            return -1;
+        }
+
+        void AppendUtf8(String& outString, onyxU32 codePoint)
+        {
+            if (codePoint < 0x80)
+            {
+                outString += static_cast<char>(codePoint);
+            }
+            else if (codePoint < 0x800)
+            {
+                outString += static_cast<char>(0xC0 | (codePoint >> 6));
+                outString += static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+            else if (codePoint < 0x10000)
+            {
+                outString += static_cast<char>(0xE0 | (codePoint >> 12));
+                outString += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                outString += static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+            else
+            {
+                outString += static_cast<char>(0xF0 | (codePoint >> 18));
+                outString += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+                outString += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                outString += static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+        }
+
+        template <typename T>
+        bool ParseNumber(StringView text, T& outValue)
+        {
+            const char* begin = text.data();
+            const char* end = begin + text.size();
+
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                return std::from_chars(begin, end, outValue).ec == std::errc{};
+            }
+            else
+            {
+                auto [ptr, errorCode] = std::from_chars(begin, end, outValue);
+                if ((errorCode == std::errc{}) && (ptr == end))
+                    return true;
+
+                // written as floating point (e.g.: 1.0 or 1e3)
+                onyxF64 value = 0.0;
+                if (std::from_chars(begin, end, value).ec != std::errc{})
+                    return false;
+
+                if ((value < static_cast<onyxF64>(std::numeric_limits<T>::lowest())) || (value > static_cast<onyxF64>(std::numeric_limits<T>::max())))
+                    return false;
+
+                outValue = static_cast<T>(value);
+                return true;
+            }
+        }
+    }
+
+    // Recursive descent over the json text that only validates and records nodes, values get converted when they are read.
+    class JsonStreamDeserializer::Tokenizer
+    {
+    public:
+        Tokenizer(StringView json, DynamicArray<Node>& outNodes, String& outUnescaped)
+            : m_Json(json)
+            , m_Nodes(outNodes)
+            , m_Unescaped(outUnescaped)
+        {
+        }
+
+        bool Run()
+        {
+            // skip utf-8 byte order mark
+            if (m_Json.starts_with("\xEF\xBB\xBF"))
+                m_Position = 3;
+
+            // rough guess to avoid most reallocations, a node is at least a few characters of json
+            m_Nodes.reserve(m_Json.size() / 16);
+
+            onyxU32 rootIndex = 0;
+            if (ParseValue(0, rootIndex) == false)
+                return false;
+
+            SkipWhitespace();
+            if (m_Position != m_Json.size())
+                return Fail("Unexpected characters after the root value");
+
+            return true;
+        }
+
+        onyxU64 GetErrorPosition() const { return m_Position; }
+        StringView GetError() const { return m_Error; }
+
+    private:
+        bool ParseValue(onyxU32 depth, onyxU32& outNodeIndex)
+        {
+            if (depth > MAX_DEPTH)
+                return Fail("Maximum nesting depth exceeded");
+
+            SkipWhitespace();
+            if (m_Position >= m_Json.size())
+                return Fail("Unexpected end of input");
+
+            outNodeIndex = static_cast<onyxU32>(m_Nodes.size());
+            m_Nodes.emplace_back();
+
+            bool success = false;
+            const char c = m_Json[m_Position];
+            switch (c)
+            {
+                case '{':
+                    m_Nodes[outNodeIndex].Type = NodeType::Object;
+                    success = ParseObject(outNodeIndex, depth);
+                    break;
+                case '[':
+                    m_Nodes[outNodeIndex].Type = NodeType::Array;
+                    success = ParseArray(outNodeIndex, depth);
+                    break;
+                case '"':
+                {
+                    Node& node = m_Nodes[outNodeIndex];
+                    node.Type = NodeType::String;
+                    success = ParseString(node.Offset, node.Length, node.IsValueEscaped);
+                    break;
+                }
+                case 't':
+                    m_Nodes[outNodeIndex].Type = NodeType::Bool;
+                    success = ParseLiteral(outNodeIndex, "true");
+                    break;
+                case 'f':
+                    m_Nodes[outNodeIndex].Type = NodeType::Bool;
+                    success = ParseLiteral(outNodeIndex, "false");
+                    break;
+                case 'n':
+                    m_Nodes[outNodeIndex].Type = NodeType::Null;
+                    success = ParseLiteral(outNodeIndex, "null");
+                    break;
+                default:
+                    if ((c == '-') || IsDigit(c))
+                    {
+                        m_Nodes[outNodeIndex].Type = NodeType::Number;
+                        success = ParseNumber(outNodeIndex);
+                    }
+                    else
+                    {
+                        success = Fail("Unexpected character");
+                    }
+                    break;
+            }
+
+            m_Nodes[outNodeIndex].End = static_cast<onyxU32>(m_Nodes.size());
+            return success;
+        }
+
+        bool ParseObject(onyxU32 nodeIndex, onyxU32 depth)
+        {
+            ++m_Position;
+            SkipWhitespace();
+            if (Consume('}'))
+                return true;
+
+            onyxU32 childCount = 0;
+            while (true)
+            {
+                SkipWhitespace();
+                if ((m_Position >= m_Json.size()) || (m_Json[m_Position] != '"'))
+                    return Fail("Expected a member name");
+
+                onyxU32 keyOffset = 0;
+                onyxU32 keyLength = 0;
+                bool isKeyEscaped = false;
+                if (ParseString(keyOffset, keyLength, isKeyEscaped) == false)
+                    return false;
+
+                SkipWhitespace();
+                if (Consume(':') == false)
+                    return Fail("Expected ':' after the member name");
+
+                onyxU32 valueIndex = 0;
+                if (ParseValue(depth + 1, valueIndex) == false)
+                    return false;
+
+                Node& value = m_Nodes[valueIndex];
+                value.KeyOffset = keyOffset;
+                value.KeyLength = keyLength;
+                value.IsKeyEscaped = isKeyEscaped;
+                ++childCount;
+
+                SkipWhitespace();
+                if (Consume(','))
+                    continue;
+
+                if (Consume('}'))
+                    break;
+
+                return Fail("Expected ',' or '}' in object");
+            }
+
+            m_Nodes[nodeIndex].ChildCount = childCount;
+            return true;
+        }
+
+        bool ParseArray(onyxU32 nodeIndex, onyxU32 depth)
+        {
+            ++m_Position;
+            SkipWhitespace();
+            if (Consume(']'))
+                return true;
+
+            onyxU32 childCount = 0;
+            while (true)
+            {
+                onyxU32 valueIndex = 0;
+                if (ParseValue(depth + 1, valueIndex) == false)
+                    return false;
+
+                ++childCount;
+
+                SkipWhitespace();
+                if (Consume(','))
+                    continue;
+
+                if (Consume(']'))
+                    break;
+
+                return Fail("Expected ',' or ']' in array");
+            }
+
+            m_Nodes[nodeIndex].ChildCount = childCount;
+            return true;
+        }
+
+        bool ParseString(onyxU32& outOffset, onyxU32& outLength, bool& outIsEscaped)
+        {
+            // skip opening quote
+            const onyxU64 start = ++m_Position;
+
+            // fast path, most strings do not contain escapes and are referenced in place
+            while ((m_Position < m_Json.size()) && (m_Json[m_Position] != '"') && (m_Json[m_Position] != '\\'))
+            {
+                if (static_cast<unsigned char>(m_Json[m_Position]) < 0x20)
+                    return Fail("Control character in string");
+
+                ++m_Position;
+            }
+
+            if (m_Position >= m_Json.size())
+                return Fail("Unterminated string");
+
+            if (m_Json[m_Position] == '"')
+            {
+                outOffset = static_cast<onyxU32>(start);
+                outLength = static_cast<onyxU32>(m_Position - start);
+                outIsEscaped = false;
+                ++m_Position;
+                return true;
+            }
+
+            outOffset = static_cast<onyxU32>(m_Unescaped.size());
+            outIsEscaped = true;
+            m_Unescaped.append(m_Json.substr(start, m_Position - start));
+
+            while (m_Position < m_Json.size())
+            {
+                const char c = m_Json[m_Position++];
+                if (c == '"')
+                {
+                    outLength = static_cast<onyxU32>(m_Unescaped.size() - outOffset);
+                    return true;
+                }
+
+                if (static_cast<unsigned char>(c) < 0x20)
+                    return Fail("Control character in string");
+
+                if (c != '\\')
+                {
+                    m_Unescaped += c;
+                    continue;
+                }
+
+                if (m_Position >= m_Json.size())
+                    break;
+
+                const char escaped = m_Json[m_Position++];
+                switch (escaped)
+                {
+                    case '"': m_Unescaped += '"'; break;
+                    case '\\': m_Unescaped += '\\'; break;
+                    case '/': m_Unescaped += '/'; break;
+                    case 'b': m_Unescaped += '\b'; break;
+                    case 'f': m_Unescaped += '\f'; break;
+                    case 'n': m_Unescaped += '\n'; break;
+                    case 'r': m_Unescaped += '\r'; break;
+                    case 't': m_Unescaped += '\t'; break;
+                    case 'u':
+                    {
+                        onyxU32 codePoint = 0;
+                        if (ParseCodeUnit(codePoint) == false)
+                            return false;
+
+                        // surrogate pair for code points outside of the basic multilingual plane
+                        if ((codePoint >= 0xD800) && (codePoint <= 0xDBFF))
+                        {
+                            onyxU32 lowSurrogate = 0;
+                            if ((Consume('\\') == false) || (Consume('u') == false) || (ParseCodeUnit(lowSurrogate) == false) ||
+                                (lowSurrogate < 0xDC00) || (lowSurrogate > 0xDFFF))
+                            {
+                                return Fail("Invalid surrogate pair");
+                            }
+
+                            codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+                        }
+                        else if ((codePoint >= 0xDC00) && (codePoint <= 0xDFFF))
+                        {
+                            return Fail("Invalid surrogate pair");
+                        }
+
+                        AppendUtf8(m_Unescaped, codePoint);
+                        break;
+                    }
+                    default:
+                        return Fail("Invalid escape sequence");
+                }
+            }
+
+            return Fail("Unterminated string");
+        }
+
+        bool ParseCodeUnit(onyxU32& outCodeUnit)
+        {
+            if ((m_Position + 4) > m_Json.size())
+                return Fail("Invalid unicode escape");
+
+            outCodeUnit = 0;
+            for (onyxU32 i = 0; i < 4; ++i)
+            {
+                const onyxS32 value = GetHexValue(m_Json[m_Position++]);
+                if (value < 0)
+                    return Fail("Invalid unicode escape");
+
+                outCodeUnit = (outCodeUnit << 4) | static_cast<onyxU32>(value);
+            }
+
+            return true;
+        }
+
+        bool ParseNumber(onyxU32 nodeIndex)
+        {
+            const onyxU64 start = m_Position;
+
+            Consume('-');
+            if (Consume('0') == false)
+            {
+                if ((m_Position >= m_Json.size()) || (IsDigit(m_Json[m_Position]) == false))
+                    return Fail("Invalid number");
+
+                SkipDigits();
+            }
+
+            if (Consume('.'))
+            {
+                if ((m_Position >= m_Json.size()) || (IsDigit(m_Json[m_Position]) == false))
+                    return Fail("Invalid number");
+
+                SkipDigits();
+            }
+
+            if (Consume('e') || Consume('E'))
+            {
+                if (Consume('+') == false)
+                    Consume('-');
+
+                if ((m_Position >= m_Json.size()) || (IsDigit(m_Json[m_Position]) == false))
+                    return Fail("Invalid number");
+
+                SkipDigits();
+            }
+
+            Node& node = m_Nodes[nodeIndex];
+            node.Offset = static_cast<onyxU32>(start);
+            node.Length = static_cast<onyxU32>(m_Position - start);
+            return true;
+        }
+
+        bool ParseLiteral(onyxU32 nodeIndex, StringView literal)
+        {
+            if (m_Json.substr(m_Position, literal.size()) != literal)
+                return Fail("Invalid literal");
+
+            Node& node = m_Nodes[nodeIndex];
+            node.Offset = static_cast<onyxU32>(m_Position);
+            node.Length = static_cast<onyxU32>(literal.size());
+            m_Position += literal.size();
+            return true;
+        }
+
+        void SkipWhitespace()
+        {
+            while ((m_Position < m_Json.size()) && IsWhitespace(m_Json[m_Position]))
+                ++m_Position;
+        }
+
+        void SkipDigits()
+        {
+            while ((m_Position < m_Json.size()) && IsDigit(m_Json[m_Position]))
+                ++m_Position;
+        }
+
+        bool Consume(char c)
+        {
+            if ((m_Position < m_Json.size()) && (m_Json[m_Position] == c))
+            {
+                ++m_Position;
+                return true;
+            }
+
+            return false;
+        }
+
+        bool Fail(StringView error)
+        {
+            // keep the first error, callers unwind with false
+            if (m_Error.empty())
+                m_Error = error;
+
+            return false;
+        }
+
+    private:
+        StringView m_Json;
+        onyxU64 m_Position = 0;
+        StringView m_Error;
+
+        DynamicArray<Node>& m_Nodes;
+        String& m_Unescaped;
+    };
+
+    JsonStreamDeserializer::JsonStreamDeserializer()
+    {
+        Reset();
+    }
+
+    JsonStreamDeserializer::~JsonStreamDeserializer() = default;
+
+    bool JsonStreamDeserializer::Parse(StringView json)
+    {
+        m_MappedFile.Close();
+        return Parse(json, "<memory>");
+    }
+
+    bool JsonStreamDeserializer::Load(const OnyxFile& file)
+    {
+        m_MappedFile = file.Map();
+        if (m_MappedFile.IsValid() == false)
+        {
+            ONYX_LOG_ERROR("Failed opening json file {}", file.GetPath().string());
+            Reset();
+            return false;
+        }
+
+        return Parse(m_MappedFile.GetView(), file.GetPath().string());
+    }
+
+    bool JsonStreamDeserializer::Parse(StringView json, StringView sourceName)
+    {
+        Reset();
+
+        // node offsets are 32 bit
+        if (json.size() >= onyxMax_U32)
+        {
+            ONYX_LOG_ERROR("Failed parsing json {}, file is too large", sourceName);
+            return false;
+        }
+
+        m_Nodes.clear();
+        m_Json = json;
+
+        Tokenizer tokenizer(json, m_Nodes, m_Unescaped);
+        if (tokenizer.Run() == false)
+        {
+            const onyxU64 errorPosition = std::min<onyxU64>(tokenizer.GetErrorPosition(), json.size());
+            const StringView parsedJson = json.substr(0, errorPosition);
+            const onyxU64 line = std::ranges::count(parsedJson, '\n') + 1;
+            const onyxU64 lineStart = parsedJson.rfind('\n');
+            const onyxU64 column = (lineStart == StringView::npos) ? (errorPosition + 1) : (errorPosition - lineStart);
+            ONYX_LOG_ERROR("Failed parsing json {} at line {}, column {}: {}", sourceName, line, column, tokenizer.GetError());
+
+            Reset();
+            return false;
+        }
+
+        m_IsValid = true;
+        return true;
+    }
+
+    void JsonStreamDeserializer::Reset()
+    {
+        m_Json = {};
+        m_Unescaped.clear();
+        m_IsValid = false;
+        m_CurrentScopeName = {};
+
+        // a null root so reading from an invalid document fails instead of accessing nothing
+        m_Nodes.assign(1, Node{ .End = 1 });
+        m_Scopes.assign(1, Scope{ 0, 0, 1 });
+    }
+
+    StringView JsonStreamDeserializer::GetValue(const Node& node) const
+    {
+        return node.IsValueEscaped ? StringView(m_Unescaped).substr(node.Offset, node.Length) : m_Json.substr(node.Offset, node.Length);
+    }
+
+    StringView JsonStreamDeserializer::GetKey(const Node& node) const
+    {
+        return node.IsKeyEscaped ? StringView(m_Unescaped).substr(node.KeyOffset, node.KeyLength) : m_Json.substr(node.KeyOffset, node.KeyLength);
+    }
+
+    const JsonStreamDeserializer::Node* JsonStreamDeserializer::FindChild(onyxU32 index) const
+    {
+        Scope& scope = m_Scopes.back();
+        const Node& parent = m_Nodes[scope.NodeIndex];
+        if (((parent.Type != NodeType::Array) && (parent.Type != NodeType::Object)) || (index >= parent.ChildCount))
+            return nullptr;
+
+        // iterating items continues from the last visited item
+        onyxU32 childIndex = 0;
+        onyxU32 nodeIndex = scope.NodeIndex + 1;
+        if (index >= scope.CursorIndex)
+        {
+            childIndex = scope.CursorIndex;
+            nodeIndex = scope.CursorNode;
+        }
+
+        for (; childIndex < index; ++childIndex)
+            nodeIndex = m_Nodes[nodeIndex].End;
+
+        scope.CursorIndex = index;
+        scope.CursorNode = nodeIndex;
+        return &m_Nodes[nodeIndex];
+    }
+
+    const JsonStreamDeserializer::Node* JsonStreamDeserializer::FindMember(StringView name, bool ignoreCase) const
+    {
+        Scope& scope = m_Scopes.back();
+        const Node& parent = m_Nodes[scope.NodeIndex];
+        if (parent.Type != NodeType::Object)
+            return nullptr;
+
+        // members are usually read in the order they got written, so start at the last visited member and wrap around
+        onyxU32 childIndex = scope.CursorIndex;
+        onyxU32 nodeIndex = scope.CursorNode;
+        for (onyxU32 i = 0; i < parent.ChildCount; ++i)
+        {
+            const Node& node = m_Nodes[nodeIndex];
+            const StringView key = GetKey(node);
+            if (ignoreCase ? IgnoreCaseEqual(key, name) : (key == name))
+            {
+                scope.CursorIndex = childIndex;
+                scope.CursorNode = nodeIndex;
+                return &node;
+            }
+
+            ++childIndex;
+            nodeIndex = node.End;
+            if (childIndex == parent.ChildCount)
+            {
+                childIndex = 0;
+                nodeIndex = scope.NodeIndex + 1;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void JsonStreamDeserializer::PushScope(const Node& node) const
+    {
+        const onyxU32 nodeIndex = static_cast<onyxU32>(&node - m_Nodes.data());
+        m_Scopes.push_back({ nodeIndex, 0, nodeIndex + 1 });
+    }
+
+    template <typename T>
+    bool JsonStreamDeserializer::DoGenericRead(const Node& node, T& outValue) const
+    {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            if (node.Type != NodeType::Bool)
+                return false;
+
+            outValue = GetValue(node) == "true";
+            return true;
+        }
+        else if constexpr (std::is_same_v<T, StringView>)
+        {
+            if (node.Type != NodeType::String)
+                return false;
+
+            outValue = GetValue(node);
+            return true;
+        }
+        else
+        {
+            if (node.Type != NodeType::Number)
+                return false;
+
+            return ParseNumber(GetValue(node), outValue);
+        }
+    }
+
+    template <std::integral T>
+    bool JsonStreamDeserializer::DoGenericRead(const Node& node, T& outValue, onyxU8 base) const
+    {
+        if (node.Type != NodeType::String)
+            return false;
+
+        StringView valueAsBaseString = GetValue(node);
+        return std::from_chars(valueAsBaseString.data(), valueAsBaseString.data() + valueAsBaseString.size(), outValue, base).ec == std::errc{};
+    }
+
+    template <typename T>
+    bool JsonStreamDeserializer::DoGenericRead(StringView name, T& outValue) const
+    {
+        const Node* node = FindMember(name, false);
+        if (node == nullptr)
+            return false;
+
+        return DoGenericRead(*node, outValue);
+    }
+
+    template <std::integral T>
+    bool JsonStreamDeserializer::DoGenericRead(StringView name, T& outValue, onyxU8 base) const
+    {
+        const Node* node = FindMember(name, false);
+        if (node == nullptr)
+            return false;
+
+        return DoGenericRead(*node, outValue, base);
+    }
+
+    bool JsonStreamDeserializer::DoRead(bool& outValue) const
+    {
+        return DoGenericRead(GetCurrent(), outValue);
+    }
+
+    bool JsonStreamDeserializer::DoRead(StringView name, bool& outValue) const
+    {
+        return DoGenericRead(name, outValue);
+    }
+
+    bool JsonStreamDeserializer::DoRead(onyxS8& outValue) const
+    {
+        return DoGenericRead(GetCurrent(), outValue);
+    }
+
+    bool JsonStreamDeserializer::DoRead(onyxS16& outValue) const
+    {
+        return DoGenericRead(GetCurrent(), outValue);
+    }
+
+    bool JsonStreamDeserializer::DoRead(onyxS32& outValue) const
+    {
+        return DoGenericRead(GetCurrent(), outValue);
+    }
+
+    bool JsonStreamDeserializer::DoRead(onyxS64& outValue) const
+    {
+        return DoGenericRead(GetCurrent(), outValue);
+    }
+
+    bool JsonStreamDeserializer::DoRead(onyxU8& outValue) const
+    {
+        return DoGenericRead(GetCurrent(), outValue);
+    }
+
+    bool JsonStreamDeserializer::DoRead(onyxU16& outValue) const
+    {
+        return DoGenericRead(GetCurrent(), outValue);
+    }
+
+    bool JsonStreamDeserializer::DoRead(onyxU32& outValue) const
+    {
+        return DoGenericRead(GetCurrent(), outValue);
+    }
+
+    bool JsonStreamDeserializer::DoRead(onyxU64& outValue) const
+    {
+        return DoGenericRead(GetCurrent(), outValue);
+    }
+
+    bool JsonStreamDeserializer::DoRead(onyxF32& outValue) const
+    {
+        return DoGenericRead(GetCurrent(), outValue);
+    }
+
+    bool JsonStreamDeserializer::DoRead(onyxF64& outValue) const
+    {
+        return DoGenericRead(GetCurrent(), outValue);
+    }
+
+    bool JsonStreamDeserializer::DoRead(onyxS8& outValue, onyxU8 base) const
+    {
+        return DoGenericRead(GetCurrent(), outValue, base);
+    }
+
+    bool JsonStreamDeserializer::DoRead(onyxS16& outValue, onyxU8 base) const
+    {
+        return DoGenericRead(GetCurrent(), outValue, base);
+    }
+
+    bool JsonStreamDeserializer::DoRead(onyxS32& outValue, onyxU8 base) const
+    {
+        return DoGenericRead(GetCurrent(), outValue, base);
+    }
+
+    bool JsonStreamDeserializer::DoRead(onyxS64& outValue, onyxU8 base) const
+    {
+        return DoGenericRead(GetCurrent(), outValue, base);
+    }
+
+    bool JsonStreamDeserializer::DoRead(onyxU8& outValue, onyxU8 base) const
+    {
+        return DoGenericRead(GetCurrent(), outValue, base);
+    }
+
+    bool JsonStreamDeserializer::DoRead(onyxU16& outValue, onyxU8 base) const
+    {
+        return DoGenericRead(GetCurrent(), outValue, base);
+    }
+
+    bool JsonStreamDeserializer::DoRead(onyxU32& outValue, onyxU8 base) const
+    {
+        return DoGenericRead(GetCurrent(), outValue, base);
+    }
+
+    bool JsonStreamDeserializer::DoRead(onyxU64& outValue, onyxU8 base) const
+    {
+        return DoGenericRead(GetCurrent(), outValue, base);
+    }
+
+    bool JsonStreamDeserializer::DoRead(StringView name, onyxS8& outValue) const
+    {
+        return DoGenericRead(name, outValue);
+    }
+
+    bool JsonStreamDeserializer::DoRead(StringView name, onyxS16& outValue) const
+    {
+        return DoGenericRead(name, outValue);
+    }
+
+    bool JsonStreamDeserializer::DoRead(StringView name, onyxS32& outValue) const
+    {
+        return DoGenericRead(name, outValue);
+    }
+
+    bool JsonStreamDeserializer::DoRead(StringView name, onyxS64& outValue) const
+    {
+        return DoGenericRead(name, outValue);
+    }
+
+    bool JsonStreamDeserializer::DoRead(StringView name, onyxU8& outValue) const
+    {
+        return DoGenericRead(name, outValue);
+    }
+
+    bool JsonStreamDeserializer::DoRead(StringView name, onyxU16& outValue) const
+    {
+        return DoGenericRead(name, outValue);
+    }
+
+    bool JsonStreamDeserializer::DoRead(StringView name, onyxU32& outValue) const
+    {
+        return DoGenericRead(name, outValue);
+    }
+
+    bool JsonStreamDeserializer::DoRead(StringView name, onyxU64& outValue) const
+    {
+        return DoGenericRead(name, outValue);
+    }
+
+    bool JsonStreamDeserializer::DoRead(StringView name, onyxF32& outValue) const
+    {
+        return DoGenericRead(name, outValue);
+    }
+
+    bool JsonStreamDeserializer::DoRead(StringView name, onyxF64& outValue) const
+    {
+        return DoGenericRead(name, outValue);
+    }
+
+    bool JsonStreamDeserializer::DoRead(StringView name, onyxS8& outValue, onyxU8 base) const
+    {
+        return DoGenericRead(name, outValue, base);
+    }
+
+    bool JsonStreamDeserializer::DoRead(StringView name, onyxS16& outValue, onyxU8 base) const
+    {
+        return DoGenericRead(name, outValue, base);
+    }
+
+    bool JsonStreamDeserializer::DoRead(StringView name, onyxS32& outValue, onyxU8 base) const
+    {
+        return DoGenericRead(name, outValue, base);
+    }
+
+    bool JsonStreamDeserializer::DoRead(StringView name, onyxS64& outValue, onyxU8 base) const
+    {
+        return DoGenericRead(name, outValue, base);
+    }
+
+    bool JsonStreamDeserializer::DoRead(StringView name, onyxU8& outValue, onyxU8 base) const
+    {
+        return DoGenericRead(name, outValue, base);
+    }
+
+    bool JsonStreamDeserializer::DoRead(StringView name, onyxU16& outValue, onyxU8 base) const
+    {
+        return DoGenericRead(name, outValue, base);
+    }
+
+    bool JsonStreamDeserializer::DoRead(StringView name, onyxU32& outValue, onyxU8 base) const
+    {
+        return DoGenericRead(name, outValue, base);
+    }
+
+    bool JsonStreamDeserializer::DoRead(StringView name, onyxU64& outValue, onyxU8 base) const
+    {
+        return DoGenericRead(name, outValue, base);
+    }
+
+    bool JsonStreamDeserializer::DoRead(StringView& outValue) const
+    {
+        return DoGenericRead(GetCurrent(), outValue);
+    }
+
+    bool JsonStreamDeserializer::DoRead(StringView name, StringView& outValue) const
+    {
+        return DoGenericRead(name, outValue);
+    }
+
+    bool JsonStreamDeserializer::CreateScope(onyxU32 index) const
+    {
+        const bool isObject = GetCurrent().Type == NodeType::Object;
+        const Node* child = FindChild(index);
+        if (child == nullptr)
+            return false;
+
+        if (isObject)
+            m_CurrentScopeName = GetKey(*child);
+
+        PushScope(*child);
+        return true;
+    }
+
+    bool JsonStreamDeserializer::CreateScope(onyxU64 index) const
+    {
+        if (index >= onyxMax_U32)
+            return false;
+
+        return CreateScope(static_cast<onyxU32>(index));
+    }
+
+    bool JsonStreamDeserializer::CreateScope(StringView name) const
+    {
+        const Node* member = FindMember(name, true);
+        if (member == nullptr)
+            return false;
+
+        m_CurrentScopeName = name;
+        PushScope(*member);
+        return true;
+    }
+
+    bool JsonStreamDeserializer::EndScope() const
+    {
+        ONYX_ASSERT(m_Scopes.size() > 1, "Ending a scope that was never created");
+        m_Scopes.pop_back();
+        return true;
+    }
+
+    onyxU32 JsonStreamDeserializer::GetItemsCount() const
+    {
+        const Node& current = GetCurrent();
+        switch (current.Type)
+        {
+            case NodeType::Null:
+                return 0;
+            case NodeType::Array:
+            case NodeType::Object:
+                return current.ChildCount;
+            default:
+                return 1;
+        }
+    }
+
+    bool JsonStreamDeserializer::GetScopeIdentifier(onyxU32& /*outKey*/) const
+    {
+        ONYX_ASSERT(false, "Integral scope identifiers not supported in json");
+        return false;
+    }
+
+    bool JsonStreamDeserializer::GetScopeIdentifier(onyxU64& /*outKey*/) const
+    {
+        ONYX_ASSERT(false, "Integral scope identifiers not supported in json");
+        return false;
+    }
+
+    bool JsonStreamDeserializer::GetScopeIdentifier(Guid64& outKey) const
+    {
+        onyxU64 guid64 = 0;
+        bool success = std::from_chars(m_CurrentScopeName.data(), m_CurrentScopeName.data() + m_CurrentScopeName.size(), guid64, 16).ec == std::errc{};
+        outKey = Guid64(guid64);
+        return success;
+    }
+
+    bool JsonStreamDeserializer::GetScopeIdentifier(StringView& outKey) const
+    {
+        outKey = m_CurrentScopeName;
+        return true;
+    }
+}
@@ -0,0 +1,146 @@
+#include <onyx/filesystem/memorymappedfile.h>
+
+#if ONYX_IS_WINDOWS
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Onyx::FileSystem
+{
+    MemoryMappedFile::MemoryMappedFile(const FilePath& filePath)
+    {
+        Open(filePath);
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        Close();
+    }
+
+    MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& other) noexcept
+    {
+        if (this == &other)
+            return *this;
+
+        Close();
+
+        m_Data = std::exchange(other.m_Data, nullptr);
+        m_Size = std::exchange(other.m_Size, 0);
+#if ONYX_IS_WINDOWS
+        m_FileHandle = std::exchange(other.m_FileHandle, nullptr);
+        m_MappingHandle = std::exchange(other.m_MappingHandle, nullptr);
+#else
+        m_FileDescriptor = std::exchange(other.m_FileDescriptor, -1);
+#endif
+        return *this;
+    }
+
+#if ONYX_IS_WINDOWS
+    bool MemoryMappedFile::Open(const FilePath& filePath)
+    {
+        Close();
+
+        HANDLE fileHandle = ::CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER fileSize;
+        if ((::GetFileSizeEx(fileHandle, &fileSize) == false) || (fileSize.QuadPart == 0))
+        {
+            ::CloseHandle(fileHandle);
+            return false;
+        }
+
+        HANDLE mappingHandle = ::CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mappingHandle == nullptr)
+        {
+            ::CloseHandle(fileHandle);
+            return false;
+        }
+
+        void* data = ::MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+        if (data == nullptr)
+        {
+            ::CloseHandle(mappingHandle);
+            ::CloseHandle(fileHandle);
+            return false;
+        }
+
+        m_FileHandle = fileHandle;
+        m_MappingHandle = mappingHandle;
+        m_Data = static_cast<const char*>(data);
+        m_Size = static_cast<onyxU64>(fileSize.QuadPart);
+        return true;
+    }
+
+    void MemoryMappedFile::Close()
+    {
+        if (m_Data != nullptr)
+            ::UnmapViewOfFile(m_Data);
+
+        if (m_MappingHandle != nullptr)
+            ::CloseHandle(m_MappingHandle);
+
+        if (m_FileHandle != nullptr)
+            ::CloseHandle(m_FileHandle);
+
+        m_Data = nullptr;
+        m_Size = 0;
+        m_MappingHandle = nullptr;
+        m_FileHandle = nullptr;
+    }
+#else
+    bool MemoryMappedFile::Open(const FilePath& filePath)
+    {
+        Close();
+
+        const onyxS32 fileDescriptor = ::open(filePath.c_str(), O_RDONLY);
+        if (fileDescriptor == -1)
+            return false;
+
+        struct stat fileStat;
+        if ((::fstat(fileDescriptor, &fileStat) != 0) || (fileStat.st_size == 0))
+        {
+            ::close(fileDescriptor);
+            return false;
+        }
+
+        void* data = ::mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        if (data == MAP_FAILED)
+        {
+            ::close(fileDescriptor);
+            return false;
+        }
+
+        // importers scan the file front to back
+        ::madvise(data, static_cast<size_t>(fileStat.st_size), MADV_SEQUENTIAL);
+
+        m_FileDescriptor = fileDescriptor;
+        m_Data = static_cast<const char*>(data);
+        m_Size = static_cast<onyxU64>(fileStat.st_size);
+        return true;
+    }
+
+    void MemoryMappedFile::Close()
+    {
+        if (m_Data != nullptr)
+            ::munmap(const_cast<char*>(m_Data), m_Size);
+
+        if (m_FileDescriptor != -1)
+            ::close(m_FileDescriptor);
+
+        m_Data = nullptr;
+        m_Size = 0;
+        m_FileDescriptor = -1;
+    }
+#endif
+}
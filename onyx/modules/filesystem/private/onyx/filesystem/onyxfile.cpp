@@ -8,13 +8,13 @@ namespace Onyx::FileSystem
 {
     OnyxFile::OnyxFile(const FilePath& filePath)
         : m_FilePath(filePath)
-        , m_FileId(Hash::FNV1aHash<onyxU64>(filePath.string()))
+        , m_FileId(Hash::FastHash64(filePath.string()))
     {
     }
 
     OnyxFile::OnyxFile(StringView mountPath)
         : m_FilePath(Path::GetFullPath(mountPath))
-        , m_FileId(Hash::FNV1aHash<onyxU64>(m_FilePath.string()))
+        , m_FileId(Hash::FastHash64(m_FilePath.string()))
     {
     }
 
@@ -37,18 +37,49 @@ namespace Onyx::FileSystem
         return true;
     }
 
+    bool OnyxFile::HashContent(const FilePath& filePath, onyxU64 seed, onyxU64& outHash)
+    {
+        FileStream fileStream(filePath, OpenMode::Read | OpenMode::Binary);
+        if (fileStream.IsValid() == false)
+            return false;
+
+        constexpr onyxU64 CHUNK_SIZE = 64 * 1024;
+        DynamicArray<char> chunk(CHUNK_SIZE);
+
+        Hash::FastHasher hasher(seed);
+        onyxU64 remaining = fileStream.GetLength();
+        while (remaining > 0)
+        {
+            const onyxU64 readSize = std::min(remaining, CHUNK_SIZE);
+            fileStream.ReadRaw(chunk.data(), readSize);
+            if (fileStream.IsValid() == false)
+                return false;
+
+            hasher.Update(chunk.data(), readSize);
+            remaining -= readSize;
+        }
+
+        outHash = hasher.Finalize64();
+        return true;
+    }
+
     FileStream OnyxFile::OpenStream(OpenMode mode) const
     {
         return { Path::GetWorkingDirectory() / m_FilePath, mode };
     }
 
+    MemoryMappedFile OnyxFile::Map() const
+    {
+        return MemoryMappedFile(Path::GetWorkingDirectory() / m_FilePath);
+    }
+
     JsonValue OnyxFile::LoadJson() const
     {
         // for convenience
         using json = nlohmann::ordered_json;
         FileStream stream = OpenStream(OpenMode::Read);
 
-        //TODO: use a SAX parser to get proper errors
+        // builds a DOM for code that edits the json, use JsonStreamDeserializer for loading
         json data = json::parse(stream.get(), nullptr, false);
         return { data };
     }
@@ -144,6 +144,18 @@ namespace Onyx::FileSystem::Path
         return exists(GetTempDirectory().append(path.generic_string()));
     }
 
+    bool IsNewerThan(const FilePath& path, const FilePath& otherPath)
+    {
+        using namespace std::filesystem;
+        std::error_code errorCode;
+        const file_time_type otherWriteTime = last_write_time(otherPath, errorCode);
+        if (errorCode)
+            return true;
+
+        const file_time_type writeTime = last_write_time(path, errorCode);
+        return (static_cast<bool>(errorCode) == false) && (writeTime > otherWriteTime);
+    }
+
     void SetMountPoints(const HashMap<StringId32, MountPoint>& dataRoots)
     {
         // ensure data directories exist
@@ -1,10 +1,12 @@
 #pragma once
 
 #include <onyx/filesystem/path.h>
+#include <onyx/function/queuedsignal.h>
 
 namespace efsw
 {
     class FileWatcher;
+    class FileWatchListener;
 }
 
 namespace Onyx::FileSystem
@@ -28,12 +30,14 @@ namespace Onyx::FileSystem
 
         void AddPath(const FilePath& path, bool recursive);
 
-        Callback<void(const FilePath&, FileAction)> OnFileChanged;
+        // changes are published from the watcher thread, listeners get called when the owner dispatches the signal
+        QueuedSignal<void(const FilePath&, FileAction)> OnFileChanged;
 
     private:
         void OnFileAction(const FilePath& path, FileAction action);
 
     private:
+        UniquePtr<efsw::FileWatchListener> m_Listener;
         UniquePtr<efsw::FileWatcher> m_Watcher;
     };
 }
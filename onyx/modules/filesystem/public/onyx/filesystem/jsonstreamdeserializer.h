@@ -0,0 +1,156 @@
+#pragma once
+
+#include <onyx/filesystem/memorymappedfile.h>
+#include <onyx/serialize/deserializer.h>
+
+namespace Onyx::FileSystem
+{
+    class OnyxFile;
+
+    // Deserializer that reads json straight from a (memory mapped) buffer without building a DOM.
+    // The text is tokenized in a single pass into a flat array of nodes that reference the buffer, strings are only copied if they contain escapes.
+    // Every scope remembers the last visited member, so reading fields in document order does not search the object.
+    class JsonStreamDeserializer : public Deserializer
+    {
+    public:
+        JsonStreamDeserializer();
+        ~JsonStreamDeserializer() override;
+
+        // the json text has to outlive the deserializer
+        bool Parse(StringView json);
+        bool Load(const OnyxFile& file);
+
+        bool IsValid() const { return m_IsValid; }
+
+    private:
+        enum class NodeType : onyxU8
+        {
+            Null,
+            Bool,
+            Number,
+            String,
+            Array,
+            Object,
+        };
+
+        struct Node
+        {
+            // value and key text, offsets are into m_Unescaped instead of the json text if the string contained escapes
+            onyxU32 Offset = 0;
+            onyxU32 Length = 0;
+            onyxU32 KeyOffset = 0;
+            onyxU32 KeyLength = 0;
+            // index of the node after this subtree, which is the next sibling
+            onyxU32 End = 0;
+            onyxU32 ChildCount = 0;
+            NodeType Type = NodeType::Null;
+            bool IsValueEscaped = false;
+            bool IsKeyEscaped = false;
+        };
+
+        struct Scope
+        {
+            onyxU32 NodeIndex = 0;
+            // last visited child, lookups start here
+            onyxU32 CursorIndex = 0;
+            onyxU32 CursorNode = 0;
+        };
+
+        class Tokenizer;
+
+        bool Parse(StringView json, StringView sourceName);
+        void Reset();
+
+        StringView GetValue(const Node& node) const;
+        StringView GetKey(const Node& node) const;
+
+        const Node& GetCurrent() const { return m_Nodes[m_Scopes.back().NodeIndex]; }
+        const Node* FindChild(onyxU32 index) const;
+        const Node* FindMember(StringView name, bool ignoreCase) const;
+        void PushScope(const Node& node) const;
+
+        template <typename T>
+        bool DoGenericRead(const Node& node, T& outValue) const;
+
+        template <std::integral T>
+        bool DoGenericRead(const Node& node, T& outValue, onyxU8 base) const;
+
+        template <typename T>
+        bool DoGenericRead(StringView name, T& outValue) const;
+
+        template <std::integral T>
+        bool DoGenericRead(StringView name, T& outValue, onyxU8 base) const;
+
+    private:
+        // Deserializer interface
+        bool DoRead(bool& outValue) const override;
+        bool DoRead(StringView name, bool& outValue) const override;
+
+        bool DoRead(onyxS8& outValue) const override;
+        bool DoRead(onyxS16& outValue) const override;
+        bool DoRead(onyxS32& outValue) const override;
+        bool DoRead(onyxS64& outValue) const override;
+        bool DoRead(onyxU8& outValue) const override;
+        bool DoRead(onyxU16& outValue) const override;
+        bool DoRead(onyxU32& outValue) const override;
+        bool DoRead(onyxU64& outValue) const override;
+        bool DoRead(onyxS8& outValue, onyxU8 base) const override;
+        bool DoRead(onyxS16& outValue, onyxU8 base) const override;
+        bool DoRead(onyxS32& outValue, onyxU8 base) const override;
+        bool DoRead(onyxS64& outValue, onyxU8 base) const override;
+        bool DoRead(onyxU8& outValue, onyxU8 base) const override;
+        bool DoRead(onyxU16& outValue, onyxU8 base) const override;
+        bool DoRead(onyxU32& outValue, onyxU8 base) const override;
+        bool DoRead(onyxU64& outValue, onyxU8 base) const override;
+
+        bool DoRead(StringView name, onyxS8& outValue) const override;
+        bool DoRead(StringView name, onyxS16& outValue) const override;
+        bool DoRead(StringView name, onyxS32& outValue) const override;
+        bool DoRead(StringView name, onyxS64& outValue) const override;
+        bool DoRead(StringView name, onyxU8& outValue) const override;
+        bool DoRead(StringView name, onyxU16& outValue) const override;
+        bool DoRead(StringView name, onyxU32& outValue) const override;
+        bool DoRead(StringView name, onyxU64& outValue) const override;
+        bool DoRead(StringView name, onyxS8& outValue, onyxU8 base) const override;
+        bool DoRead(StringView name, onyxS16& outValue, onyxU8 base) const override;
+        bool DoRead(StringView name, onyxS32& outValue, onyxU8 base) const override;
+        bool DoRead(StringView name, onyxS64& outValue, onyxU8 base) const override;
+        bool DoRead(StringView name, onyxU8& outValue, onyxU8 base) const override;
+        bool DoRead(StringView name, onyxU16& outValue, onyxU8 base) const override;
+        bool DoRead(StringView name, onyxU32& outValue, onyxU8 base) const override;
+        bool DoRead(StringView name, onyxU64& outValue, onyxU8 base) const override;
+
+        bool DoRead(onyxF32& outValue) const override;
+        bool DoRead(onyxF64& outValue) const override;
+        bool DoRead(StringView name, onyxF32& outValue) const override;
+        bool DoRead(StringView name, onyxF64& outValue) const override;
+
+        bool DoRead(StringView& outValue) const override;
+        bool DoRead(StringView name, StringView& outValue) const override;
+
+        bool CreateScope(onyxU32 index) const override;
+        bool CreateScope(onyxU64 index) const override;
+        bool CreateScope(StringView name) const override;
+        bool EndScope() const override;
+
+        onyxU32 GetItemsCount() const override;
+
+        bool GetScopeIdentifier(onyxU32& outKey) const override;
+        bool GetScopeIdentifier(onyxU64& outKey) const override;
+        bool GetScopeIdentifier(Guid64& outKey) const override;
+        bool GetScopeIdentifier(StringView& outKey) const override;
+
+        bool IsSupportingIntegralScopes() const override { return false; }
+
+    private:
+        MemoryMappedFile m_MappedFile;
+        StringView m_Json;
+
+        DynamicArray<Node> m_Nodes;
+        String m_Unescaped;
+        bool m_IsValid = false;
+
+        mutable DynamicArray<Scope> m_Scopes;
+        mutable StringView m_CurrentScopeName;
+    };
+}
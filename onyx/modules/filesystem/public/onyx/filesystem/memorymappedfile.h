@@ -0,0 +1,40 @@
+#pragma once
+
+#include <onyx/filesystem/path.h>
+#include <onyx/noncopyable.h>
+
+namespace Onyx::FileSystem
+{
+    // Read-only view of a whole file mapped into the address space.
+    // The data stays valid until the file is closed or the object is destroyed.
+    class MemoryMappedFile : public NonCopyable
+    {
+    public:
+        MemoryMappedFile() = default;
+        MemoryMappedFile(const FilePath& filePath);
+        ~MemoryMappedFile() override;
+
+        MemoryMappedFile(MemoryMappedFile&& other) noexcept;
+        MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept;
+
+        bool Open(const FilePath& filePath);
+        void Close();
+
+        bool IsValid() const { return m_Data != nullptr; }
+
+        const char* GetData() const { return m_Data; }
+        onyxU64 GetSize() const { return m_Size; }
+        StringView GetView() const { return { m_Data, m_Size }; }
+
+    private:
+        const char* m_Data = nullptr;
+        onyxU64 m_Size = 0;
+
+#if ONYX_IS_WINDOWS
+        void* m_FileHandle = nullptr;
+        void* m_MappingHandle = nullptr;
+#else
+        onyxS32 m_FileDescriptor = -1;
+#endif
+    };
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <onyx/filesystem/filestream.h>
+#include <onyx/filesystem/memorymappedfile.h>
 
 #include <onyx/string/format.h>
 #include <onyx/serialize/serializer.h>
@@ -174,7 +175,10 @@ namespace Onyx::FileSystem
 
         ONYX_NO_DISCARD static bool ReadAll(const FilePath& filePath, String& outFileContent);
         ONYX_NO_DISCARD static bool ReadAll(const FilePath& filePath, String& outFileContent, bool shouldSkipBOM);
+        // hashes the file in chunks while reading without keeping the whole content in memory
+        ONYX_NO_DISCARD static bool HashContent(const FilePath& filePath, onyxU64 seed, onyxU64& outHash);
         ONYX_NO_DISCARD FileStream OpenStream(OpenMode mode) const; // todo make base stream class?
+        ONYX_NO_DISCARD MemoryMappedFile Map() const;
 
         ONYX_NO_DISCARD const FilePath& GetPath() const { return m_FilePath; }
         
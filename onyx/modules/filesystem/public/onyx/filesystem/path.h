@@ -45,6 +45,9 @@ namespace Onyx::FileSystem
         bool Exists(const FilePath& path);
         bool TempFileExists(const FilePath& path);
 
+        // true if path was written after otherPath, also if otherPath does not exist
+        bool IsNewerThan(const FilePath& path, const FilePath& otherPath);
+
         void SetMountPoints(const HashMap<StringId32, MountPoint>& mountPoints);
         
         bool CreateDirectory(const FilePath& directoryPath);
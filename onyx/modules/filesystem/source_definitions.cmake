@@ -3,11 +3,13 @@ set(onyx_TARGET_PUBLIC_SOURCES
     filestream.h
     filewatcher.h
     imagefile.h
+    memorymappedfile.h
     onyx_filesystem_pch.h
     onyxfile.h
     path.h
     jsonserializer.h
     jsondeserializer.h
+    jsonstreamdeserializer.h
 )
 
 set(onyx_TARGET_PRIVATE_SOURCES
@@ -15,9 +17,11 @@ set(onyx_TARGET_PRIVATE_SOURCES
     filestream.cpp
     filewatcher.cpp
     imagefile.cpp
+    memorymappedfile.cpp
     onyx_filesystem.cpp
     onyxfile.cpp
     path.cpp
     jsonserializer.cpp
     jsondeserializer.cpp
+    jsonstreamdeserializer.cpp
 )
\ No newline at end of file
@@ -7,13 +7,16 @@
 #include <onyx/gamecore/components/graphics/directionallightcomponent.gen.h>
 #include <onyx/gamecore/components/graphics/pointlightcomponent.gen.h>
 #include <onyx/gamecore/components/graphics/spotlightcomponent.gen.h>
+#include <onyx/gamecore/components/graphics/staticmeshcomponent.gen.h>
 #include <onyx/gamecore/components/graphics/materialcomponent.gen.h>
 #include <onyx/gamecore/components/graphics/textcomponent.gen.h>
 #include <onyx/graphics/font/sdffont.h>
 #include <onyx/gamecore/scene/scene.h>
 #include <onyx/gamecore/serialize/sceneserializer.h>
 #include <onyx/gamecore/systems/lightingsystem.h>
+#include <onyx/gamecore/systems/staticmeshsystem.h>
 #include <onyx/gamecore/systems/camerasystem.h>
+#include <onyx/gamecore/components/hierarchycomponent.gen.h>
 #include <onyx/gamecore/components/idcomponent.gen.h>
 #include <onyx/gamecore/components/namecomponent.gen.h>
 #include <onyx/gamecore/components/transformcomponent.gen.h>
@@ -22,6 +25,7 @@
 #include <onyx/gamecore/rendertasks/textrendertask.h>
 #include <onyx/gamecore/scene/sceneframedata.h>
 #include <onyx/gamecore/systems/freecamerasystem.h>
+#include <onyx/gamecore/systems/transformsystem.h>
 #include <onyx/rhi/graphicssystem.h>
 #include <onyx/graphics/rendergraph/rendergraphnodefactory.h>
 
@@ -33,6 +37,7 @@ namespace Onyx::GameCore
         {
             ecsBuilder.RegisterComponent<IdComponent>();
             ecsBuilder.RegisterComponent<TransformComponent>();
+            ecsBuilder.RegisterComponent<HierarchyComponent>();
 
 #if !ONYX_IS_RETAIL || ONYX_IS_EDITOR
             ecsBuilder.RegisterComponent<NameComponent>();
@@ -42,6 +47,7 @@ namespace Onyx::GameCore
             ecsBuilder.RegisterComponent<PointLightComponent>();
             ecsBuilder.RegisterComponent<SpotLightComponent>();
             ecsBuilder.RegisterComponent<MaterialComponent>();
+            ecsBuilder.RegisterComponent<StaticMeshComponent>();
             ecsBuilder.RegisterComponent<TextComponent>([](Entity::EntityRegistry& registry, Entity::EntityId entity, TextComponent&& textComponent)
                 
             {
@@ -60,7 +66,10 @@ namespace Onyx::GameCore
             FreeCamera::registerSystems(ecsBuilder);
             Camera::registerSystems(ecsBuilder);
 
+            Transforms::registerSystems(ecsBuilder);
+
             Lighting::registerSystems(ecsBuilder);
+            StaticMeshes::registerSystems(ecsBuilder);
         }
     }
 
@@ -71,23 +80,27 @@ namespace Onyx::GameCore
         GameCoreInit::RegisterEntitySystems(ecsBuilder);
     }
 
-    void GameCoreSystem::Update(DeltaGameTime deltaTime, Graphics::GraphicsSystem& graphicsSystem, IEngine& engine)
+    void GameCoreSystem::Update(DeltaGameTime deltaTime, const FixedGameTime& fixedTime, Graphics::GraphicsSystem& graphicsSystem, IEngine& engine)
     {
         if (m_Scene.IsLoaded() == false)
         {
             return;
         }
 
-        if (m_Scene->GetRenderGraphRef().HasAssetId())
+        Assets::AssetHandle<Graphics::RenderGraph>& sceneRenderGraph = m_Scene->GetRenderGraphRef();
+        if (sceneRenderGraph.HasAssetId() && sceneRenderGraph.IsLoaded() && (m_QueuedRenderGraph != sceneRenderGraph.GetHandle().Raw()))
         {
-            Graphics::RenderGraph& sceneRenderGraph = m_Scene->GetRenderGraph();
-            if (sceneRenderGraph.IsLoaded() && sceneRenderGraph.IsInitialized() == false)
+            // the render graph connects to the frame signals and creates its resources, so it is initialized on the render side
+            m_QueuedRenderGraph = sceneRenderGraph.GetHandle().Raw();
+            graphicsSystem.QueueRenderCommand([renderGraph = sceneRenderGraph.GetHandle()](Graphics::GraphicsSystem& graphics) mutable
             {
-                sceneRenderGraph.Init(graphicsSystem);
-            }
+                if (renderGraph->IsInitialized() == false)
+                    renderGraph->Init(graphics);
+            });
         }
 
         // TODO: Can we find a cleaner / better solution for this?
+        // every frame context owns its frame data, the render side only reads the one of the frame it renders
         Graphics::FrameContext& frameContext = graphicsSystem.GetFrameContext();
         if (frameContext.FrameData == nullptr)
             frameContext.FrameData = MakeUnique<SceneFrameData>();
@@ -97,8 +110,10 @@ namespace Onyx::GameCore
         sceneFrameData.m_StaticMeshIndirectDrawCalls.clear();
         sceneFrameData.m_VoxelChunksToInit.clear();
 
-        Entity::ECSExecutionContext context { deltaTime, m_Scene->GetRegistry(), engine };
+        Entity::ECSExecutionContext context { deltaTime, fixedTime, m_Scene->GetRegistry(), engine };
         m_ECSGraph.Update(context);
+
+        sceneFrameData.UpdateStaticMeshVisibility(frameContext.ViewConstants);
     }
 }
 
@@ -117,3 +132,13 @@ Onyx::Graphics::FrameContext& Onyx::Entity::DependentFunctionArg<Onyx::Graphics:
     Graphics::GraphicsSystem& graphicsSystem = context.Engine.GetSystem<Graphics::GraphicsSystem>();
     return graphicsSystem.GetFrameContext();
 }
+
+Onyx::GameCore::TransformHierarchy& Onyx::Entity::DependentFunctionArg<Onyx::GameCore::TransformHierarchy&>::Get(const ECSExecutionContext& context)
+{
+    return context.Engine.GetSystem<GameCore::GameCoreSystem>().GetTransformHierarchy();
+}
+
+const Onyx::GameCore::TransformHierarchy& Onyx::Entity::DependentFunctionArg<const Onyx::GameCore::TransformHierarchy&>::Get(const ECSExecutionContext& context)
+{
+    return context.Engine.GetSystem<GameCore::GameCoreSystem>().GetTransformHierarchy();
+}
@@ -16,14 +16,14 @@ namespace Onyx::GameCore
         resourceInfo.Format = api.GetDepthTextureFormat();
         resourceInfo.LoadOp = Graphics::RenderPassSettings::LoadOp::Clear;
 
-        resourceCache[GetOutputPin().GetGlobalId()].Handle = api.GetDepthImage();
+        resourceCache[GetOutputPin().GetGlobalId()].Handle = api.GetDepthImage(api.GetFrameIndex());
     }
 
     void DepthPrePassRenderGraphNode::OnBeginFrame(const Graphics::RenderGraphContext& context)
     {
         ONYX_PROFILE_FUNCTION;
 
-        context.Graph.GetResourceCache()[GetOutputPin().GetGlobalId()].Handle = context.FrameContext.Api->GetDepthImage();
+        context.Graph.GetResourceCache()[GetOutputPin().GetGlobalId()].Handle = context.FrameContext.Api->GetDepthImage(context.FrameContext.FrameIndex);
     }
 
     void DepthPrePassRenderGraphNode::OnRender(Graphics::RenderGraphContext& context, Graphics::CommandBuffer& commandBuffer)
@@ -39,24 +39,24 @@ namespace Onyx::GameCore
 
         commandBuffer.SetScissor();
 
-        onyxU32 instanceOffset = 0;
-        for (const StaticMeshDrawCall& drawCall : sceneFrameData.m_StaticMeshDrawCalls)
+        // visible instances sorted front to back per mesh, the vertex and index buffers only change between batches
+        const Graphics::MeshVisibility& visibility = sceneFrameData.m_StaticMeshVisibility;
+        for (const Graphics::MeshDrawBatch& batch : visibility.GetBatches())
         {
-            ONYX_UNUSED(drawCall);
-            // TODO: Batch instances per mesh/material and send transforms via SBO
-            //const onyxU32 instanceCount = static_cast<onyxU32>(drawCall.m_Transforms.size());
-            const onyxU32 instanceCount = 1;
+            const StaticMeshDrawCall& batchDrawCall = sceneFrameData.m_StaticMeshDrawCalls[sceneFrameData.m_StaticMeshInstances[visibility.GetVisibleDraws()[batch.FirstDraw]].DrawCallIndex];
 
-            commandBuffer.BindVertexBuffer(drawCall.VertexData, 0, 0);
-            commandBuffer.BindIndexBuffer(drawCall.Indices, 0, Graphics::IndexType::uint32);
+            commandBuffer.BindVertexBuffer(batchDrawCall.VertexData, 0, 0);
+            commandBuffer.BindIndexBuffer(batchDrawCall.Indices, 0, Graphics::IndexType::uint32);
 
-            Matrix4<onyxF32> transformMatrix;
-            //for (Matrix4<onyxF32> transformMatrix : drawCall.m_Transforms)
+            const onyxU32 indexCount = static_cast<onyxU32>(batchDrawCall.Indices.Buffer->GetProperties().m_Size / 4);
+
+            for (onyxU32 i = batch.FirstDraw; i < (batch.FirstDraw + batch.DrawCount); ++i)
             {
-                commandBuffer.BindPushConstants(Graphics::ShaderStage::Vertex, 0, transformMatrix);
-                commandBuffer.DrawIndexed(Graphics::PrimitiveTopology::Triangle, static_cast<onyxU32>(drawCall.Indices.Buffer->GetProperties().m_Size / 4), instanceCount, 0, 0, instanceOffset);
+                const StaticMeshInstance& instance = sceneFrameData.m_StaticMeshInstances[visibility.GetVisibleDraws()[i]];
+                const StaticMeshDrawCall& drawCall = sceneFrameData.m_StaticMeshDrawCalls[instance.DrawCallIndex];
 
-                instanceOffset += instanceCount;
+                commandBuffer.BindPushConstants(Graphics::ShaderStage::Vertex, 0, drawCall.Transforms[instance.TransformIndex]);
+                commandBuffer.DrawIndexed(Graphics::PrimitiveTopology::Triangle, indexCount, 1, 0, 0, 0);
             }
         }
 
@@ -54,12 +54,22 @@ namespace Onyx::GameCore
             return;
 
         const SceneFrameData& sceneFrameData = static_cast<const SceneFrameData&>(*frameContext.FrameData);
-        for (const StaticMeshDrawCall& drawCall : sceneFrameData.m_StaticMeshDrawCalls)
+
+        // batches are sorted by pipeline first, so every shader only gets bound once
+        const Graphics::MeshVisibility& visibility = sceneFrameData.m_StaticMeshVisibility;
+        const Graphics::ShaderInstance* boundShader = nullptr;
+        for (const Graphics::MeshDrawBatch& batch : visibility.GetBatches())
         {
+            const StaticMeshInstance& instance = sceneFrameData.m_StaticMeshInstances[visibility.GetVisibleDraws()[batch.FirstDraw]];
+            const StaticMeshDrawCall& drawCall = sceneFrameData.m_StaticMeshDrawCalls[instance.DrawCallIndex];
+
             const Graphics::MaterialShaderGraph& shaderGraph = *drawCall.Material;
             const Graphics::ShaderInstanceHandle& shaderInstance = shaderGraph.GetShader();
+            if (shaderInstance.Raw() == boundShader)
+                continue;
 
             BindResources(shaderInstance, context.Graph.GetResourceCache(), context.FrameContext);
+            boundShader = shaderInstance.Raw();
             hasBegun = true;
         }
 
@@ -87,21 +97,32 @@ namespace Onyx::GameCore
 
         const SceneFrameData& sceneFrameData = static_cast<const SceneFrameData&>(*frameContext.FrameData);
 
-        for (const StaticMeshDrawCall& drawCall : sceneFrameData.m_StaticMeshDrawCalls)
+        // batches share pipeline, material and mesh, so state only changes between batches
+        const Graphics::MeshVisibility& visibility = sceneFrameData.m_StaticMeshVisibility;
+        const Graphics::MaterialShaderGraph* preparedMaterial = nullptr;
+        for (const Graphics::MeshDrawBatch& batch : visibility.GetBatches())
         {
-            PrepareShaderGraph(commandBuffer, context.FrameContext, *drawCall.Material);
+            const StaticMeshDrawCall& batchDrawCall = sceneFrameData.m_StaticMeshDrawCalls[sceneFrameData.m_StaticMeshInstances[visibility.GetVisibleDraws()[batch.FirstDraw]].DrawCallIndex];
 
-            const onyxU32 instanceCount = 1;
+            const Graphics::MaterialShaderGraph& material = *batchDrawCall.Material;
+            if (&material != preparedMaterial)
+            {
+                PrepareShaderGraph(commandBuffer, context.FrameContext, material);
+                preparedMaterial = &material;
+            }
 
-            commandBuffer.BindVertexBuffer(drawCall.VertexData, 0, 0);
-            commandBuffer.BindIndexBuffer(drawCall.Indices, 0, Graphics::IndexType::uint32);
+            commandBuffer.BindVertexBuffer(batchDrawCall.VertexData, 0, 0);
+            commandBuffer.BindIndexBuffer(batchDrawCall.Indices, 0, Graphics::IndexType::uint32);
 
-            onyxU32 instanceOffset = 0;
+            const onyxU32 indexCount = static_cast<onyxU32>(batchDrawCall.Indices.Buffer->GetProperties().m_Size / 4);
 
-            //for (Matrix4<onyxF32> transformMatrix : drawCall.m_Transforms)
+            for (onyxU32 i = batch.FirstDraw; i < (batch.FirstDraw + batch.DrawCount); ++i)
             {
-                commandBuffer.DrawIndexed(Graphics::PrimitiveTopology::Triangle, static_cast<onyxU32>(drawCall.Indices.Buffer->GetProperties().m_Size / 4), instanceCount, 0, 0, instanceOffset);
-                //instanceOffset += instanceCount;
+                const StaticMeshInstance& instance = sceneFrameData.m_StaticMeshInstances[visibility.GetVisibleDraws()[i]];
+                const StaticMeshDrawCall& drawCall = sceneFrameData.m_StaticMeshDrawCalls[instance.DrawCallIndex];
+
+                commandBuffer.BindPushConstants(Graphics::ShaderStage::Vertex, 0, drawCall.Transforms[instance.TransformIndex]);
+                commandBuffer.DrawIndexed(Graphics::PrimitiveTopology::Triangle, indexCount, 1, 0, 0, 0);
             }
         }
 
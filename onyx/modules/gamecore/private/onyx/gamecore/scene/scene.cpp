@@ -1,6 +1,8 @@
 #include <onyx/gamecore/scene/scene.h>
 
 #include <onyx/filesystem/onyxfile.h>
+#include <onyx/gamecore/components/hierarchycomponent.gen.h>
+#include <onyx/gamecore/components/idcomponent.gen.h>
 #include <onyx/gamecore/components/transformcomponent.gen.h>
 #include <onyx/gamecore/components/namecomponent.gen.h>
 #include <onyx/graphics/rendergraph/rendergraph.h>
@@ -12,6 +14,12 @@ namespace Onyx::GameCore
     {
         m_Registry.GetRegistry().on_construct<TransformComponent>().connect<&Scene::OnTransformComponentConstructed>(this);
         m_Registry.GetRegistry().on_destroy<TransformComponent>().connect<&Scene::OnTransformComponentDestroyed>(this);
+
+        // parents are resolved through the persistent id
+        m_Registry.GetRegistry().on_construct<HierarchyComponent>().connect<&Scene::OnHierarchyChanged>(this);
+        m_Registry.GetRegistry().on_destroy<HierarchyComponent>().connect<&Scene::OnHierarchyChanged>(this);
+        m_Registry.GetRegistry().on_construct<IdComponent>().connect<&Scene::OnHierarchyChanged>(this);
+        m_Registry.GetRegistry().on_destroy<IdComponent>().connect<&Scene::OnHierarchyChanged>(this);
     }
 
     void Scene::SetLoadCenter(const Vector3f32& loadCenter)
@@ -98,6 +106,7 @@ namespace Onyx::GameCore
         //}
 
         m_SectorStreamer.AddEntity(entity);
+        m_TransformHierarchy.MarkStructureDirty();
     }
 
     void Scene::OnTransformComponentDestroyed(Entity::EntityRegistry::EntityRegistryT& /*registry*/, Entity::EntityId entity)
@@ -108,5 +117,11 @@ namespace Onyx::GameCore
        // }
 
         m_SectorStreamer.RemoveEntity(entity);
+        m_TransformHierarchy.MarkStructureDirty();
+    }
+
+    void Scene::OnHierarchyChanged(Entity::EntityRegistry::EntityRegistryT& /*registry*/, Entity::EntityId /*entity*/)
+    {
+        m_TransformHierarchy.MarkStructureDirty();
     }
 }
@@ -2,9 +2,61 @@
 
 // included for constructor of Reference<MaterialShaderGraph>
 #include <onyx/graphics/shadergraph/materialshadergraph.h>
+#include <onyx/profiler/profiler.h>
 
 namespace Onyx::GameCore
 {
+    namespace
+    {
+        // dense ids per frame, so they fit into the sort key of the visibility
+        template <typename KeyT, typename HasherT>
+        onyxU32 GetFrameId(HashMap<KeyT, onyxU32, HasherT>& ids, const KeyT& key)
+        {
+            return ids.try_emplace(key, static_cast<onyxU32>(ids.size())).first->second;
+        }
+    }
+
     StaticMeshIndirectDrawCall::~StaticMeshIndirectDrawCall() = default;
     StaticMeshDrawCall::StaticMeshDrawCall() = default;
-    SceneFrameData::~SceneFrameData() = default;}
+
+    void StaticMeshDrawCall::AddInstance(const Matrix4<onyxF32>& worldMatrix)
+    {
+        Transforms.push_back(worldMatrix);
+        WorldBounds.push_back(Bounds.Transform(worldMatrix));
+    }
+
+    SceneFrameData::~SceneFrameData() = default;
+
+    void SceneFrameData::UpdateStaticMeshVisibility(const Graphics::ViewConstants& viewConstants)
+    {
+        ONYX_PROFILE_FUNCTION;
+
+        m_StaticMeshVisibility.Clear();
+        m_StaticMeshInstances.clear();
+
+        HashMap<const void*, onyxU32> pipelineIds;
+        HashMap<const void*, onyxU32> materialIds;
+        HashMap<StaticMeshKey, onyxU32, StaticMeshKeyHasher> meshIds;
+
+        for (onyxU32 drawCallIndex = 0; drawCallIndex < m_StaticMeshDrawCalls.size(); ++drawCallIndex)
+        {
+            const StaticMeshDrawCall& drawCall = m_StaticMeshDrawCalls[drawCallIndex];
+            if (drawCall.Material.IsValid() == false)
+                continue;
+
+            const Graphics::MaterialShaderGraph& shaderGraph = *drawCall.Material;
+            const onyxU32 pipelineId = GetFrameId(pipelineIds, static_cast<const void*>(shaderGraph.GetShader().Raw()));
+            const onyxU32 materialId = GetFrameId(materialIds, static_cast<const void*>(&shaderGraph));
+            const onyxU32 meshId = GetFrameId(meshIds, drawCall.GetMeshKey());
+
+            ONYX_ASSERT(drawCall.WorldBounds.size() == drawCall.Transforms.size(), "Static mesh instances have to be added with AddInstance");
+            for (onyxU32 transformIndex = 0; transformIndex < drawCall.Transforms.size(); ++transformIndex)
+            {
+                m_StaticMeshVisibility.AddDraw(drawCall.WorldBounds[transformIndex], pipelineId, materialId, meshId);
+                m_StaticMeshInstances.push_back({ drawCallIndex, transformIndex });
+            }
+        }
+
+        m_StaticMeshVisibility.Build(viewConstants);
+    }
+}
@@ -0,0 +1,240 @@
+#include <onyx/gamecore/scene/transformhierarchy.h>
+
+#include <onyx/entity/entityregistry.h>
+#include <onyx/gamecore/components/hierarchycomponent.gen.h>
+#include <onyx/gamecore/components/idcomponent.gen.h>
+#include <onyx/gamecore/components/transformcomponent.h>
+#include <onyx/gamecore/components/transformcomponent.gen.h>
+#include <onyx/thread/threadpool/parallelfor.h>
+
+#include <onyx/profiler/profiler.h>
+
+namespace Onyx::GameCore
+{
+    namespace
+    {
+        // smaller hierarchies are not worth the overhead of the thread pool
+        constexpr onyxU32 MIN_ENTITIES_PER_JOB = 1024;
+
+        // bit exact, operator== of the vectors is approximate and would miss small movements
+        template <typename T>
+        bool HasChanged(const T& cached, const T& current)
+        {
+            return std::memcmp(&cached, &current, sizeof(T)) != 0;
+        }
+    }
+
+    onyxS32 TransformHierarchy::GetIndex(Entity::EntityId entity) const
+    {
+        auto it = m_EntityIndices.find(entity);
+        if (it == m_EntityIndices.end())
+            return INVALID_INDEX_32;
+
+        return static_cast<onyxS32>(it->second);
+    }
+
+    Matrix4<onyxF32> TransformHierarchy::GetWorldMatrix(Entity::EntityId entity) const
+    {
+        const onyxS32 index = GetIndex(entity);
+        if (index == INVALID_INDEX_32)
+            return Matrix4<onyxF32>();
+
+        return m_WorldMatrices[index];
+    }
+
+    void TransformHierarchy::Update(const Entity::EntityRegistry& registry)
+    {
+        ONYX_PROFILE_FUNCTION;
+
+        const bool hasRebuiltOrder = m_IsStructureDirty || HasParentChanged(registry);
+        if (hasRebuiltOrder)
+            RebuildOrder(registry);
+
+        if (UpdateLocalTransforms(registry, hasRebuiltOrder) == false)
+            return;
+
+        // the calling thread works on the jobs as well, so it never waits for a job that is still queued behind other pool work
+        Threading::ParallelFor(Threading::DefaultThreadPool, static_cast<onyxU32>(m_SubtreeRanges.size()), [this](onyxU32 job)
+        {
+            UpdateWorldMatrices(m_SubtreeRanges[job].First, m_SubtreeRanges[job].Count);
+        });
+    }
+
+    bool TransformHierarchy::HasParentChanged(const Entity::EntityRegistry& registry) const
+    {
+        auto hierarchyView = registry.GetView<const HierarchyComponent>();
+        for (Entity::EntityId entity : hierarchyView)
+        {
+            const onyxS32 index = GetIndex(entity);
+            if ((index != INVALID_INDEX_32) && (m_ParentIds[index] != hierarchyView.get<const HierarchyComponent>(entity).ParentId))
+                return true;
+        }
+
+        return false;
+    }
+
+    void TransformHierarchy::RebuildOrder(const Entity::EntityRegistry& registry)
+    {
+        ONYX_PROFILE_FUNCTION;
+
+        m_IsStructureDirty = false;
+
+        HashMap<onyxU64, Entity::EntityId> persistentIds;
+        auto idView = registry.GetView<const IdComponent>();
+        for (Entity::EntityId entity : idView)
+            persistentIds[idView.get<const IdComponent>(entity).Id] = entity;
+
+        // children per entity, entities without a valid parent are roots
+        auto transformView = registry.GetView<const TransformComponent>();
+        HashMap<Entity::EntityId, DynamicArray<Entity::EntityId>> children;
+        DynamicArray<Entity::EntityId> roots;
+        HashMap<Entity::EntityId, onyxU64> parentIds;
+        for (Entity::EntityId entity : transformView)
+        {
+            const HierarchyComponent* hierarchy = registry.GetRegistry().try_get<HierarchyComponent>(entity);
+            const onyxU64 parentId = (hierarchy != nullptr) ? hierarchy->ParentId : 0;
+            parentIds[entity] = parentId;
+
+            auto parentIt = (parentId != 0) ? persistentIds.find(parentId) : persistentIds.end();
+            if ((parentIt != persistentIds.end()) && (parentIt->second != entity) && transformView.contains(parentIt->second))
+                children[parentIt->second].push_back(entity);
+            else
+                roots.push_back(entity);
+        }
+
+        const onyxU64 entityCount = transformView.size();
+        m_EntityIndices.clear();
+        m_Entities.clear();
+        m_Parents.clear();
+        m_ParentIds.clear();
+        m_Entities.reserve(entityCount);
+        m_Parents.reserve(entityCount);
+        m_ParentIds.reserve(entityCount);
+
+        // depth first, so every subtree ends up as a contiguous range behind its root
+        DynamicArray<Entity::EntityId> openList;
+        const auto addSubtree = [&](Entity::EntityId root)
+        {
+            openList.push_back(root);
+            while (openList.empty() == false)
+            {
+                const Entity::EntityId entity = openList.back();
+                openList.pop_back();
+
+                if (m_EntityIndices.contains(entity))
+                    continue;
+
+                const onyxU32 index = static_cast<onyxU32>(m_Entities.size());
+                m_EntityIndices[entity] = index;
+                m_Entities.push_back(entity);
+                m_ParentIds.push_back(parentIds[entity]);
+
+                auto parentIt = persistentIds.find(parentIds[entity]);
+                const bool isRoot = (entity == root) || (parentIt == persistentIds.end());
+                m_Parents.push_back(isRoot ? INVALID_INDEX_32 : static_cast<onyxS32>(m_EntityIndices.at(parentIt->second)));
+
+                auto childrenIt = children.find(entity);
+                if (childrenIt != children.end())
+                    openList.insert(openList.end(), childrenIt->second.rbegin(), childrenIt->second.rend());
+            }
+        };
+
+        DynamicArray<onyxU32> rootIndices;
+        for (Entity::EntityId root : roots)
+        {
+            rootIndices.push_back(static_cast<onyxU32>(m_Entities.size()));
+            addSubtree(root);
+        }
+
+        // entities in a parent cycle are not reachable from a root, they become roots of their own subtree
+        if (m_Entities.size() != entityCount)
+        {
+            ONYX_LOG_WARNING("Transform hierarchy contains a parent cycle, the cycle is broken up.");
+            for (Entity::EntityId entity : transformView)
+            {
+                if (m_EntityIndices.contains(entity))
+                    continue;
+
+                rootIndices.push_back(static_cast<onyxU32>(m_Entities.size()));
+                addSubtree(entity);
+            }
+        }
+
+        const onyxU32 count = static_cast<onyxU32>(m_Entities.size());
+        m_SubtreeSizes.assign(count, 1);
+        for (onyxU32 i = count; i-- > 0;)
+        {
+            if (m_Parents[i] != INVALID_INDEX_32)
+                m_SubtreeSizes[m_Parents[i]] += m_SubtreeSizes[i];
+        }
+
+        m_LocalTransforms.resize(count);
+        m_LocalMatrices.resize(count);
+        m_WorldMatrices.resize(count);
+        m_IsDirty.resize(count);
+
+        // consecutive root subtrees are grouped into jobs of at least MIN_ENTITIES_PER_JOB entities
+        m_SubtreeRanges.clear();
+        SubtreeRange range;
+        for (onyxU32 rootIndex : rootIndices)
+        {
+            if (range.Count >= MIN_ENTITIES_PER_JOB)
+            {
+                m_SubtreeRanges.push_back(range);
+                range = { rootIndex, 0 };
+            }
+
+            range.Count += m_SubtreeSizes[rootIndex];
+        }
+
+        m_SubtreeRanges.push_back(range);
+    }
+
+    bool TransformHierarchy::UpdateLocalTransforms(const Entity::EntityRegistry& registry, bool forceUpdate)
+    {
+        ONYX_PROFILE_FUNCTION;
+
+        bool hasChanges = false;
+        for (onyxU32 i = 0; i < m_Entities.size(); ++i)
+        {
+            const TransformComponent& transform = registry.GetComponent<TransformComponent>(m_Entities[i]);
+            LocalTransform& local = m_LocalTransforms[i];
+
+            const bool hasChanged = forceUpdate || HasChanged(local.Translation, transform.Translation) ||
+                HasChanged(local.Rotation, transform.Rotation) || HasChanged(local.Scale, transform.Scale);
+
+            m_IsDirty[i] = hasChanged;
+            if (hasChanged == false)
+                continue;
+
+            local.Translation = transform.Translation;
+            local.Rotation = transform.Rotation;
+            local.Scale = transform.Scale;
+            m_LocalMatrices[i] = WorldTransform::GetTransform(transform);
+            hasChanges = true;
+        }
+
+        return hasChanges;
+    }
+
+    void TransformHierarchy::UpdateWorldMatrices(onyxU32 first, onyxU32 count)
+    {
+        // parents come first, so their dirty flag and world matrix are final when the children get updated
+        const onyxU32 end = first + count;
+        for (onyxU32 i = first; i < end; ++i)
+        {
+            const onyxS32 parent = m_Parents[i];
+            if (parent == INVALID_INDEX_32)
+            {
+                if (m_IsDirty[i])
+                    m_WorldMatrices[i] = m_LocalMatrices[i];
+
+                continue;
+            }
+
+            m_IsDirty[i] |= m_IsDirty[parent];
+            if (m_IsDirty[i])
+                m_WorldMatrices[i] = m_WorldMatrices[parent] * m_LocalMatrices[i];
+        }
+    }
+}
@@ -0,0 +1,237 @@
+#include <onyx/gamecore/serialize/binarysector.h>
+
+#include <onyx/entity/componentfactory.h>
+#include <onyx/filesystem/jsonserializer.h>
+#include <onyx/filesystem/jsonstreamdeserializer.h>
+#include <onyx/gamecore/components/transientcomponent.gen.h>
+#include <onyx/gamecore/scene/scenesector.h>
+#include <onyx/hash.h>
+#include <onyx/stream/memorystream.h>
+
+namespace Onyx::GameCore::BinarySector
+{
+    namespace
+    {
+        enum class ComponentEncoding : onyxU8
+        {
+            Flag,
+            Binary,
+            Json,
+        };
+
+        // checks every component record before any entity is created, so a changed schema can still fall back to the json sector
+        bool ValidateEntities(MemoryStream& stream, const Entity::ComponentFactory& componentFactory)
+        {
+            onyxU32 entityCount = 0;
+            if (stream.GetRemainingLength() < sizeof(entityCount))
+                return false;
+
+            stream.Read(entityCount);
+            for (onyxU32 i = 0; i < entityCount; ++i)
+            {
+                onyxU32 componentCount = 0;
+                if (stream.GetRemainingLength() < (sizeof(Vector3f32) + sizeof(onyxF64) + sizeof(componentCount)))
+                    return false;
+
+                stream.Skip(static_cast<onyxU32>(sizeof(Vector3f32) + sizeof(onyxF64)));
+                stream.Read(componentCount);
+
+                for (onyxU32 j = 0; j < componentCount; ++j)
+                {
+                    onyxU32 typeId = 0;
+                    ComponentEncoding encoding = ComponentEncoding::Flag;
+                    onyxU64 schemaId = 0;
+                    onyxU32 payloadSize = 0;
+                    if (stream.GetRemainingLength() < (sizeof(typeId) + sizeof(encoding) + sizeof(schemaId) + sizeof(payloadSize)))
+                        return false;
+
+                    stream.Read(typeId);
+                    stream.Read(encoding);
+                    stream.Read(schemaId);
+                    stream.Read(payloadSize);
+
+                    const Entity::IComponentMeta* meta = componentFactory.GetComponentMeta(StringId32(typeId)).value_or(nullptr);
+                    if ((meta == nullptr) || (stream.GetRemainingLength() < payloadSize))
+                        return false;
+
+                    if ((encoding == ComponentEncoding::Binary) && (meta->GetBinarySchemaId() != schemaId))
+                        return false;
+
+                    stream.Skip(payloadSize);
+                }
+            }
+
+            return stream.IsEof();
+        }
+    }
+
+    onyxU64 GetSourceHash(StringView jsonSource)
+    {
+        return Hash::FastHash64(jsonSource);
+    }
+
+    bool Serialize(const Entity::EntityRegistry& registry, const Entity::ComponentFactory& componentFactory, const DynamicArray<SectorEntity>& entities, onyxU64 sourceHash, MemoryStream& outStream)
+    {
+        outStream.Write(MAGIC);
+        outStream.Write(VERSION);
+        outStream.Write(sourceHash);
+
+        const onyxU64 entityCountPosition = outStream.GetPosition();
+        onyxU32 entityCount = 0;
+        outStream.Write(entityCount);
+
+        bool hasSucceeded = true;
+        for (const SectorEntity& sectorEntity : entities)
+        {
+            if ((sectorEntity.Entity == entt::null) || registry.HasComponents<TransientComponent>(sectorEntity.Entity))
+                continue;
+
+            ++entityCount;
+            outStream.WriteRaw(sectorEntity.Position);
+            outStream.Write(sectorEntity.BoundsRadius);
+
+            const onyxU64 componentCountPosition = outStream.GetPosition();
+            onyxU32 componentCount = 0;
+            outStream.Write(componentCount);
+
+            for (auto componentStorageIt : registry.GetStorage())
+            {
+                const entt::basic_sparse_set<Entity::EntityId>& componentStorage = componentStorageIt.second;
+                if (componentStorage.contains(sectorEntity.Entity) == false)
+                    continue;
+
+                const Entity::IComponentMeta* meta = componentFactory.GetComponentMeta(componentStorageIt.first).value_or(nullptr);
+                if ((meta == nullptr) || meta->IsTransient())
+                    continue;
+
+                const onyxU64 schemaId = meta->GetBinarySchemaId();
+                const ComponentEncoding encoding = meta->IsFlag() ? ComponentEncoding::Flag : ((schemaId != 0) ? ComponentEncoding::Binary : ComponentEncoding::Json);
+
+                ++componentCount;
+                outStream.Write(meta->GetTypeId().GetId());
+                outStream.Write(encoding);
+                outStream.Write(schemaId);
+
+                const onyxU64 payloadSizePosition = outStream.GetPosition();
+                onyxU32 payloadSize = 0;
+                outStream.Write(payloadSize);
+
+                const onyxU64 payloadPosition = outStream.GetPosition();
+                if (encoding == ComponentEncoding::Binary)
+                {
+                    hasSucceeded &= meta->SerializeBinary(componentStorage.value(sectorEntity.Entity), outStream);
+                }
+                else if (encoding == ComponentEncoding::Json)
+                {
+                    FileSystem::JsonSerializer componentSerializer;
+                    hasSucceeded &= meta->Serialize(componentStorage.value(sectorEntity.Entity), componentSerializer);
+
+                    const String& json = componentSerializer.JsonRoot.dump();
+                    outStream.WriteRaw(json.data(), json.size());
+                }
+
+                const onyxU64 endPosition = outStream.GetPosition();
+                payloadSize = static_cast<onyxU32>(endPosition - payloadPosition);
+                outStream.SetPosition(payloadSizePosition);
+                outStream.Write(payloadSize);
+                outStream.SetPosition(endPosition);
+            }
+
+            const onyxU64 endPosition = outStream.GetPosition();
+            outStream.SetPosition(componentCountPosition);
+            outStream.Write(componentCount);
+            outStream.SetPosition(endPosition);
+        }
+
+        const onyxU64 endPosition = outStream.GetPosition();
+        outStream.SetPosition(entityCountPosition);
+        outStream.Write(entityCount);
+        outStream.SetPosition(endPosition);
+
+        return hasSucceeded;
+    }
+
+    bool Deserialize(Entity::EntityRegistry& registry, const Entity::ComponentFactory& componentFactory, onyxU64 sourceHash, MemoryStream& inStream, DynamicArray<SectorEntity>& outEntities)
+    {
+        onyxU32 magic = 0;
+        onyxU32 version = 0;
+        onyxU64 storedSourceHash = 0;
+        if (inStream.GetRemainingLength() < (sizeof(magic) + sizeof(version) + sizeof(storedSourceHash)))
+            return false;
+
+        inStream.Read(magic);
+        inStream.Read(version);
+        if ((magic != MAGIC) || (version != VERSION))
+            return false;
+
+        inStream.Read(storedSourceHash);
+        if (storedSourceHash != sourceHash)
+            return false;
+
+        const onyxU64 entitiesPosition = inStream.GetPosition();
+        if (ValidateEntities(inStream, componentFactory) == false)
+            return false;
+
+        inStream.SetPosition(entitiesPosition);
+
+        onyxU32 entityCount = 0;
+        inStream.Read(entityCount);
+        outEntities.reserve(outEntities.size() + entityCount);
+
+        for (onyxU32 i = 0; i < entityCount; ++i)
+        {
+            SectorEntity& outEntity = outEntities.emplace_back();
+            inStream.ReadRaw(outEntity.Position);
+            inStream.Read(outEntity.BoundsRadius);
+            outEntity.BoundsRadiusSquared = outEntity.BoundsRadius * outEntity.BoundsRadius;
+            outEntity.Entity = registry.CreateEntity();
+
+            onyxU32 componentCount = 0;
+            inStream.Read(componentCount);
+            for (onyxU32 j = 0; j < componentCount; ++j)
+            {
+                onyxU32 typeId = 0;
+                ComponentEncoding encoding = ComponentEncoding::Flag;
+                onyxU64 schemaId = 0;
+                onyxU32 payloadSize = 0;
+                inStream.Read(typeId);
+                inStream.Read(encoding);
+                inStream.Read(schemaId);
+                inStream.Read(payloadSize);
+
+                const StringId32 componentTypeId(typeId);
+                const onyxU64 payloadEnd = inStream.GetPosition() + payloadSize;
+
+                bool hasCreated = false;
+                switch (encoding)
+                {
+                case ComponentEncoding::Flag:
+                    hasCreated = componentFactory.TryCreateComponent(registry, outEntity.Entity, componentTypeId);
+                    break;
+                case ComponentEncoding::Binary:
+                {
+                    MemoryStream payloadStream(inStream.GetCurrentData(), payloadSize);
+                    hasCreated = componentFactory.TryCreateComponentFromBinary(registry, outEntity.Entity, componentTypeId, payloadStream);
+                    break;
+                }
+                case ComponentEncoding::Json:
+                {
+                    FileSystem::JsonStreamDeserializer componentDeserializer;
+                    hasCreated = componentDeserializer.Parse(StringView(inStream.GetCurrentData(), payloadSize)) &&
+                        componentFactory.TryCreateComponent(registry, outEntity.Entity, componentTypeId, componentDeserializer);
+                    break;
+                }
+                }
+
+                if (hasCreated == false)
+                {
+                    ONYX_LOG_WARNING("Failed deserializing component {} from binary sector.", componentTypeId);
+                }
+
+                inStream.SetPosition(payloadEnd);
+            }
+        }
+
+        return true;
+    }
+}
@@ -3,18 +3,32 @@
 
 #include <onyx/entity/entity.h>
 #include <onyx/entity/componentmeta.hpp>
-#include <onyx/filesystem/jsondeserializer.h>
+#include <onyx/filesystem/jsonstreamdeserializer.h>
 #include <onyx/filesystem/jsonserializer.h>
+#include <onyx/filesystem/memorymappedfile.h>
 #include <onyx/gamecore/gamecore.h>
 #include <onyx/gamecore/scene/scene.h>
+#include <onyx/gamecore/serialize/binarysector.h>
 #include <onyx/gamecore/components/transientcomponent.gen.h>
 #include <onyx/graphics/rendergraph/rendergraph.h>
 
 #include <onyx/serialize/serializer.h>
 #include <onyx/serialize/deserializer.h>
+#include <onyx/stream/memorystream.h>
 
 namespace Onyx::GameCore
 {
+    namespace
+    {
+        FilePath GetSectorFilePath(const FilePath& sectorDirectoryPath, const SceneSector& sector, StringView extension)
+        {
+            FilePath sectorFilePath = sectorDirectoryPath;
+            sectorFilePath.append(Format::Format("{}_{}_{}", sector.Position[0], sector.Position[1], sector.Position[2]));
+            sectorFilePath.replace_extension(extension);
+            return sectorFilePath;
+        }
+    }
+
     bool SceneSerializer::Serialize(const Assets::AssetHandle<Assets::AssetInterface>& asset, const Assets::AssetMetaData& meta, Serializer& serializer, const IEngine& engine) const
     {
         const Scene& scene = asset.As<Scene>();
@@ -39,13 +53,15 @@ namespace Onyx::GameCore
 
         for (const SceneSector& sceneSector : sectors)
         {
-            hasSucceeded &= SerializeSectorToJson(registry, componentFactory, sceneSector, sectorDirectoryPath);
+            onyxU64 sourceHash = 0;
+            hasSucceeded &= SerializeSectorToJson(registry, componentFactory, sceneSector, sectorDirectoryPath, sourceHash);
+            hasSucceeded &= SerializeSectorToBinary(registry, componentFactory, sceneSector, sourceHash, GetSectorFilePath(sectorDirectoryPath, sceneSector, BinarySector::FILE_EXTENSION));
         }
 
         return hasSucceeded;
     }
 
-    bool SceneSerializer::SerializeSectorToJson(const Entity::EntityRegistry& registry, const Entity::ComponentFactory& componentFactory, const SceneSector& sector, const FilePath& sectorDirectoryPath) const
+    bool SceneSerializer::SerializeSectorToJson(const Entity::EntityRegistry& registry, const Entity::ComponentFactory& componentFactory, const SceneSector& sector, const FilePath& sectorDirectoryPath, onyxU64& outSourceHash) const
     {
         FileSystem::JsonSerializer serializer;
         serializer.WriteForEach(sector.Entities, [&](Serializer& scopeSerializer, const SectorEntity& sectorEntity)
@@ -61,16 +77,16 @@ namespace Onyx::GameCore
                 return true;
             });
 
-        FilePath sectorFilePath = sectorDirectoryPath;
-        sectorFilePath.append(Format::Format("{}_{}_{}", sector.Position[0], sector.Position[1], sector.Position[2]));
-        sectorFilePath.replace_extension("osector");
+        const FilePath sectorFilePath = GetSectorFilePath(sectorDirectoryPath, sector, "osector");
 
         using namespace FileSystem;
         OnyxFile sceneFile(sectorFilePath);
-        FileStream outStream = sceneFile.OpenStream(OpenMode::Write | OpenMode::Text);
+        // binary mode keeps the file content identical to the hashed string
+        FileStream outStream = sceneFile.OpenStream(OpenMode::Write | OpenMode::Binary);
 
         const String& jsonString = serializer.JsonRoot.dump(4);
         outStream.WriteRaw(jsonString.data(), jsonString.size());
+        outSourceHash = BinarySector::GetSourceHash(jsonString);
 
         return true;
     }
@@ -108,8 +124,20 @@ namespace Onyx::GameCore
                 if (isSector)
                 {
                     SceneSector& sector = sectors.emplace_back();
+
+                    FilePath binarySectorPath = entry.path();
+                    binarySectorPath.replace_extension(BinarySector::FILE_EXTENSION);
+
+                    FileSystem::MemoryMappedFile jsonSectorFile;
+                    const bool hasSourceHash = jsonSectorFile.Open(entry.path());
+                    const onyxU64 sourceHash = hasSourceHash ? BinarySector::GetSourceHash(jsonSectorFile.GetView()) : 0;
+                    jsonSectorFile.Close();
+
                     // TODO: Parse sector position
                     // This should not load entities
+                    if (hasSourceHash && DeserializeSectorFromBinary(scene, componentFactory, sector, sourceHash, binarySectorPath))
+                        continue;
+
                     DeserializeSectorFromJson(scene, componentFactory, sector, entry.path());
                 }
             }
@@ -123,8 +151,9 @@ namespace Onyx::GameCore
         bool hasSucceeded = true;
 
         FileSystem::OnyxFile sectorFile(sectorFilePath);
-        const FileSystem::JsonValue& sectorJson = sectorFile.LoadJson();
-        FileSystem::JsonDeserializer deserializer(sectorJson.Json);
+        FileSystem::JsonStreamDeserializer deserializer;
+        if (deserializer.Load(sectorFile) == false)
+            return false;
 
         deserializer.ReadForEach(outSector.Entities, [&](const Deserializer& scopeDeserializer, SectorEntity& outEntity)
         {
@@ -139,6 +168,34 @@ namespace Onyx::GameCore
         return hasSucceeded;
     }
 
+    bool SceneSerializer::SerializeSectorToBinary(const Entity::EntityRegistry& registry, const Entity::ComponentFactory& componentFactory, const SceneSector& sector, onyxU64 sourceHash, const FilePath& sectorFilePath) const
+    {
+        MemoryStream stream;
+        if (BinarySector::Serialize(registry, componentFactory, sector.Entities, sourceHash, stream) == false)
+        {
+            ONYX_LOG_ERROR("Failed serializing binary sector {}, the json sector is loaded instead.", sectorFilePath.string());
+            return false;
+        }
+
+        FileSystem::FileStream fileStream(sectorFilePath, FileSystem::OpenMode::Write | FileSystem::OpenMode::Binary);
+        if (fileStream.IsValid() == false)
+            return false;
+
+        const DynamicArray<char>& buffer = stream.GetBuffer();
+        fileStream.WriteRaw(buffer.data(), buffer.size());
+        return fileStream.IsValid();
+    }
+
+    bool SceneSerializer::DeserializeSectorFromBinary(Scene& scene, const Entity::ComponentFactory& componentFactory, SceneSector& outSector, onyxU64 sourceHash, const FilePath& sectorFilePath) const
+    {
+        FileSystem::MemoryMappedFile mappedFile;
+        if (mappedFile.Open(sectorFilePath) == false)
+            return false;
+
+        MemoryStream stream(mappedFile.GetData(), mappedFile.GetSize());
+        return BinarySector::Deserialize(scene.GetRegistry(), componentFactory, sourceHash, stream, outSector.Entities);
+    }
+
     bool SceneSerializer::SerializeEntity(Serializer& serializer, const Entity::EntityRegistry& registry, const Entity::ComponentFactory& componentFactory, Entity::EntityId entityId) const
     {
         // iterate all component storages and save out the components for the entity
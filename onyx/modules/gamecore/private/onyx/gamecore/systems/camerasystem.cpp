@@ -2,8 +2,10 @@
 
 #include <onyx/entity/ecsbuilder.h>
 #include <onyx/entity/entitycomponentsystem.h>
+#include <onyx/gamecore/gamecore.h>
 #include <onyx/gamecore/components/cameracomponent.gen.h>
 #include <onyx/gamecore/components/transformcomponent.gen.h>
+#include <onyx/gamecore/scene/transformhierarchy.h>
 
 #include <onyx/serialize/serializer.h>
 #include <onyx/serialize/deserializer.h>
@@ -17,18 +19,24 @@ namespace GameCore
 
     namespace UpdatePositions
     {
-        void system(EntityQuery query)
+        // world transform, so cameras attached to other entities follow their parents
+        void system(EntityQuery query, const TransformHierarchy& transformHierarchy)
         {
             auto cameraEntitiesView = query.GetView();
             for (Entity::EntityId entity : cameraEntitiesView)
             {
-                auto&& [transform, cameraComponent] = cameraEntitiesView.get<TransformComponent, CameraComponent>(entity);
+                CameraComponent& cameraComponent = cameraEntitiesView.get<CameraComponent>(entity);
 
-                const Rotor3f32& worldRotation = transform.Rotation;
-                Vector3f32 forwardDirection = worldRotation.rotate(-Vector3f32::Z_Unit());
-                Vector3f32 upDirection = worldRotation.rotate(Vector3f32::Y_Unit());
+                const onyxS32 transformIndex = transformHierarchy.GetIndex(entity);
+                if (transformIndex == INVALID_INDEX_32)
+                    continue;
 
-                cameraComponent.Camera.LookAt(transform.Translation, transform.Translation + forwardDirection, upDirection);
+                const Matrix4<onyxF32>& worldMatrix = transformHierarchy.GetWorldMatrix(static_cast<onyxU32>(transformIndex));
+                const Vector3f32 position(worldMatrix[3]);
+                const Vector3f32 forwardDirection = (Vector3f32(worldMatrix[2]) * -1.0f).Normalized();
+                const Vector3f32 upDirection = Vector3f32(worldMatrix[1]).Normalized();
+
+                cameraComponent.Camera.LookAt(position, position + forwardDirection, upDirection);
             }
         }
     }
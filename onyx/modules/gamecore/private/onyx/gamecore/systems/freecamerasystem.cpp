@@ -19,7 +19,8 @@ namespace Onyx::GameCore
     {
         using CameraEntityAccess = Entity::Entity<const FreeCameraControllerComponent, TransformComponent, FreeCameraRuntimeComponent>;
 
-        void system(CameraEntityAccess cameraEntity, DeltaGameTime deltaTime)
+        // runs with the fixed step, so movement and the damping of the rotation are independent of the frame rate and replay deterministically
+        void system(CameraEntityAccess cameraEntity, const FixedGameTime& fixedTime)
         {
             auto&& [ freeCameraController, transformComponent, freeCameraRuntime ] = cameraEntity.Get();
             freeCameraRuntime.Velocity = std::clamp(freeCameraRuntime.Velocity, freeCameraController.MinVelocity, freeCameraController.MaxVelocity);
@@ -38,7 +39,8 @@ namespace Onyx::GameCore
 
                 constexpr onyxF32 MAX_ROTATION_SPEED = 0.12f;
 
-                onyxF32 dt = static_cast<onyxF32>(deltaTime.DeltaMilliseconds);
+                // time simulated by the fixed steps of this frame
+                const onyxF32 dt = fixedTime.StepDelta.GetMilliseconds() * static_cast<onyxF32>(fixedTime.StepCount);
 
                 const onyxF32 yawSign = upDirection[1] < 0 ? -1.0f : 1.0f;
                 const Vector3f32 globalUp(0.0f, yawSign, 0.0f);
@@ -53,12 +55,16 @@ namespace Onyx::GameCore
                 freeCameraRuntime.YawDelta += std::clamp(yawSign * freeCameraRuntime.InputRotation[0] * freeCameraController.RotationVelocity, -MAX_ROTATION_SPEED, MAX_ROTATION_SPEED);
                 freeCameraRuntime.PitchDelta += std::clamp(freeCameraRuntime.InputRotation[1] * freeCameraController.RotationVelocity, -MAX_ROTATION_SPEED, MAX_ROTATION_SPEED);
             }
-            
-            freeCameraRuntime.Yaw += freeCameraRuntime.YawDelta;
-            freeCameraRuntime.Pitch += freeCameraRuntime.PitchDelta;
 
-            freeCameraRuntime.YawDelta *= 0.6f;
-            freeCameraRuntime.PitchDelta *= 0.6f;
+            // the rotation input is added once per frame and decays per step, frames without a step keep it for the next one
+            for (onyxU32 step = 0; step < fixedTime.StepCount; ++step)
+            {
+                freeCameraRuntime.Yaw += freeCameraRuntime.YawDelta;
+                freeCameraRuntime.Pitch += freeCameraRuntime.PitchDelta;
+
+                freeCameraRuntime.YawDelta *= 0.6f;
+                freeCameraRuntime.PitchDelta *= 0.6f;
+            }
 
             if ((IsZero(freeCameraRuntime.YawDelta) == false) ||
                 (IsZero(freeCameraRuntime.PitchDelta) == false))
@@ -10,28 +10,42 @@
 #include <onyx/gamecore/components/transformcomponent.gen.h>
 
 #include <onyx/gamecore/scene/scene.h>
+#include <onyx/gamecore/scene/transformhierarchy.h>
 
 namespace Onyx::GameCore::Lighting
 {
+    namespace
+    {
+        Vector3f32 GetWorldPosition(const Matrix4<onyxF32>& worldMatrix)
+        {
+            return Vector3f32(worldMatrix[3]);
+        }
+
+        // lights point along -z
+        Vector3f32 GetWorldDirection(const Matrix4<onyxF32>& worldMatrix)
+        {
+            return (Vector3f32(worldMatrix[2]) * -1.0f).Normalized();
+        }
+    }
+
     namespace DirectionalLights
     {
         using EntityQuery = Entity::EntityQuery<const DirectionalLightComponent, const TransformComponent>;
 
-        void system(EntityQuery entities, Graphics::FrameContext& frameContext)
+        void system(EntityQuery entities, Graphics::FrameContext& frameContext, const TransformHierarchy& transformHierarchy)
         {
             // Directional lights
             onyxU32 directionalLightIndex = 0;
             auto lightEntities = entities.GetView();
             for (Entity::EntityId lightEntity : lightEntities)
             {
-                auto tuple = lightEntities.get<const DirectionalLightComponent, const TransformComponent>(lightEntity);
-                auto&& [lightComponent, transformComponent] = tuple;
+                const DirectionalLightComponent& lightComponent = lightEntities.get<const DirectionalLightComponent>(lightEntity);
                 Graphics::DirectionalLight& light = frameContext.Lighting.DirectionalLights[directionalLightIndex++];
                 light.Color = lightComponent.Color;
                 light.Intensity = lightComponent.Intensity;
                 light.ShadowAmount = lightComponent.ShadowAmount;
                 light.IsShadowCasting = lightComponent.IsShadowCasting;
-                light.Direction = transformComponent.Rotation.ToMatrix3() * -Vector3f32::Z_Unit();
+                light.Direction = GetWorldDirection(transformHierarchy.GetWorldMatrix(lightEntity));
             }
 
             frameContext.Lighting.DirectionalLightsCount = directionalLightIndex;
@@ -41,28 +55,21 @@ namespace Onyx::GameCore::Lighting
     namespace PointLights
     {
         using EntityQuery = Entity::EntityQuery<const PointLightComponent, const TransformComponent>;
-        void system(EntityQuery entities, Graphics::FrameContext& frameContext)
+        void system(EntityQuery entities, Graphics::FrameContext& frameContext, const TransformHierarchy& transformHierarchy)
         {
             onyxU32 pointLightIndex = 0;
             auto pointLightEntities = entities.GetView(/*entt::get<TransformComponent>*/);
             for (Entity::EntityId lightEntity : pointLightEntities)
             {
-                const TransformComponent& transformComponent = pointLightEntities.get<TransformComponent>(lightEntity);
                 const PointLightComponent& lightComponent = pointLightEntities.get<PointLightComponent>(lightEntity);
 
                 Graphics::PointLight& light = frameContext.Lighting.PointLights[pointLightIndex++];
-                light.Position = transformComponent.Translation;
+                light.Position = GetWorldPosition(transformHierarchy.GetWorldMatrix(lightEntity));
                 light.Color = lightComponent.Color;
                 light.Intensity = lightComponent.Intensity;
                 light.Radius = lightComponent.Radius;
                 light.IsEnabled = lightComponent.IsEnabled;
                 light.IsShadowCasting = lightComponent.IsShadowCasting;
-
-                auto viewSpacePos = frameContext.ViewConstants.ViewMatrix * Vector4f32(light.Position, 1.0f);
-                auto distance = (Vector3f32(viewSpacePos) - frameContext.ViewConstants.CameraPosition).Length();
-
-                ONYX_UNUSED(viewSpacePos);
-                ONYX_UNUSED(distance);
             }
 
             frameContext.Lighting.PointLightsCount = pointLightIndex;
@@ -72,19 +79,19 @@ namespace Onyx::GameCore::Lighting
     namespace SpotLights
     {
         using EntityQuery = Entity::EntityQuery<const SpotLightComponent, const TransformComponent>;
-        void system(EntityQuery entities, Graphics::FrameContext& frameContext)
+        void system(EntityQuery entities, Graphics::FrameContext& frameContext, const TransformHierarchy& transformHierarchy)
         {
             {
                 onyxU32 spotLightIndex = 0;
                 auto spotLightEntities = entities.GetView();
                 for (Entity::EntityId lightEntity : spotLightEntities)
                 {
-                    const TransformComponent& transformComponent = spotLightEntities.get<TransformComponent>(lightEntity);
                     const SpotLightComponent& lightComponent = spotLightEntities.get<SpotLightComponent>(lightEntity);
+                    const Matrix4<onyxF32> worldMatrix = transformHierarchy.GetWorldMatrix(lightEntity);
 
                     Graphics::SpotLight& light = frameContext.Lighting.SpotLights[spotLightIndex++];
-                    light.Position = transformComponent.Translation;
-                    light.Direction = transformComponent.Rotation.ToMatrix3() * -Vector3f32::Z_Unit();
+                    light.Position = GetWorldPosition(worldMatrix);
+                    light.Direction = GetWorldDirection(worldMatrix);
                     light.Color = lightComponent.Color;
                     light.Intensity = lightComponent.Intensity;
                     light.Falloff = lightComponent.Falloff;
@@ -0,0 +1,69 @@
+#include <onyx/gamecore/systems/staticmeshsystem.h>
+
+#include <onyx/assets/assetsystem.h>
+#include <onyx/entity/ecsbuilder.h>
+#include <onyx/entity/entitycomponentsystem.h>
+#include <onyx/gamecore/gamecore.h>
+#include <onyx/gamecore/components/graphics/materialcomponent.gen.h>
+#include <onyx/gamecore/components/graphics/staticmeshcomponent.gen.h>
+#include <onyx/gamecore/components/transformcomponent.gen.h>
+#include <onyx/gamecore/scene/sceneframedata.h>
+#include <onyx/gamecore/scene/transformhierarchy.h>
+#include <onyx/graphics/shadergraph/materialshadergraph.h>
+
+namespace Onyx::GameCore::StaticMeshes
+{
+    namespace DrawCalls
+    {
+        // TODO: Material component should be read access
+        using EntityQuery = Entity::EntityQuery<const StaticMeshComponent, MaterialComponent, const TransformComponent>;
+
+        void system(EntityQuery entities, Graphics::FrameContext& frameContext, Assets::AssetSystem& assetSystem, const TransformHierarchy& transformHierarchy)
+        {
+            SceneFrameData& sceneFrameData = static_cast<SceneFrameData&>(*frameContext.FrameData);
+
+            // one draw call per material and mesh, every entity adds an instance to it
+            HashMap<const void*, HashMap<StaticMeshKey, onyxU32, StaticMeshKeyHasher>> drawCallIndices;
+
+            auto meshEntities = entities.GetView();
+            for (Entity::EntityId meshEntity : meshEntities)
+            {
+                const StaticMeshComponent& meshComponent = meshEntities.get<const StaticMeshComponent>(meshEntity);
+                MaterialComponent& materialComponent = meshEntities.get<MaterialComponent>(meshEntity);
+
+                if ((meshComponent.VertexData == false) || (meshComponent.Indices == false))
+                    continue;
+
+                if (materialComponent.Material.IsValid() == false)
+                {
+                    // this should be moved to the component create
+                    assetSystem.GetAsset(materialComponent.Material.GetId(), materialComponent.Material);
+                    continue;
+                }
+
+                const onyxS32 transformIndex = transformHierarchy.GetIndex(meshEntity);
+                if (transformIndex == INVALID_INDEX_32)
+                    continue;
+
+                HashMap<StaticMeshKey, onyxU32, StaticMeshKeyHasher>& materialDrawCalls = drawCallIndices[&*materialComponent.Material];
+                const StaticMeshKey meshKey{ meshComponent.VertexData.Buffer.Raw(), meshComponent.Indices.Buffer.Raw() };
+                auto [it, isNewDrawCall] = materialDrawCalls.try_emplace(meshKey, static_cast<onyxU32>(sceneFrameData.m_StaticMeshDrawCalls.size()));
+                if (isNewDrawCall)
+                {
+                    StaticMeshDrawCall& drawCall = sceneFrameData.m_StaticMeshDrawCalls.emplace_back();
+                    drawCall.Material = materialComponent.Material;
+                    drawCall.VertexData = meshComponent.VertexData;
+                    drawCall.Indices = meshComponent.Indices;
+                    drawCall.Bounds = meshComponent.Bounds;
+                }
+
+                sceneFrameData.m_StaticMeshDrawCalls[it->second].AddInstance(transformHierarchy.GetWorldMatrix(static_cast<onyxU32>(transformIndex)));
+            }
+        }
+    }
+
+    void registerSystems(Entity::EcsBuilder& ecsBuilder)
+    {
+        ecsBuilder.RegisterSystem(DrawCalls::system);
+    }
+}
@@ -0,0 +1,25 @@
+#include <onyx/gamecore/systems/transformsystem.h>
+
+#include <onyx/entity/ecsbuilder.h>
+#include <onyx/entity/entitycomponentsystem.h>
+#include <onyx/gamecore/gamecore.h>
+#include <onyx/gamecore/components/transformcomponent.gen.h>
+#include <onyx/gamecore/scene/transformhierarchy.h>
+
+namespace Onyx::GameCore::Transforms
+{
+    namespace UpdateWorldMatrices
+    {
+        using EntityQuery = Entity::EntityQuery<const TransformComponent>;
+
+        void system(EntityQuery /*entities*/, const Entity::EntityRegistry& registry, TransformHierarchy& transformHierarchy)
+        {
+            transformHierarchy.Update(registry);
+        }
+    }
+
+    void registerSystems(Entity::EcsBuilder& ecsBuilder)
+    {
+        ecsBuilder.RegisterSystem(UpdateWorldMatrices::system);
+    }
+}
@@ -16,6 +16,11 @@ namespace Onyx::Assets
     class AssetSystem;
 }
 
+namespace Onyx::GameCore
+{
+    class TransformHierarchy;
+}
+
 namespace Onyx::Entity
 {
     template <>
@@ -44,6 +49,24 @@ namespace Onyx::Entity
 
         static Graphics::FrameContext& Get(const ECSExecutionContext& context);
     };
+
+    template <>
+    class DependentFunctionArg<GameCore::TransformHierarchy&> : public IDependentFunctionArg
+    {
+    public:
+        ~DependentFunctionArg() override = default;
+
+        static GameCore::TransformHierarchy& Get(const ECSExecutionContext& context);
+    };
+
+    template <>
+    class DependentFunctionArg<const GameCore::TransformHierarchy&> : public IDependentFunctionArg
+    {
+    public:
+        ~DependentFunctionArg() override = default;
+
+        static const GameCore::TransformHierarchy& Get(const ECSExecutionContext& context);
+    };
 }
 
 namespace Onyx::GameCore
@@ -56,7 +79,7 @@ namespace Onyx::GameCore
 
         GameCoreSystem();
         
-        void Update(DeltaGameTime deltaTime, Graphics::GraphicsSystem& graphicsSystem, IEngine& engine);
+        void Update(DeltaGameTime deltaTime, const FixedGameTime& fixedTime, Graphics::GraphicsSystem& graphicsSystem, IEngine& engine);
 
         void SetScene(Assets::AssetHandle<Scene>& scene) { m_Scene = scene; }
 
@@ -64,9 +87,14 @@ namespace Onyx::GameCore
 
         Entity::EcsBuilder GetEcsBuilder() { return { m_ComponentFactory, m_ECSGraph }; }
 
+        TransformHierarchy& GetTransformHierarchy() { return m_Scene->GetTransformHierarchy(); }
+
     private:
         Assets::AssetHandle<Scene> m_Scene;
         Entity::ComponentFactory m_ComponentFactory;
         Entity::EntityComponentSystemsGraph m_ECSGraph;
+
+        // render graph that got queued for initialization on the render side, only used to queue it once
+        const Graphics::RenderGraph* m_QueuedRenderGraph = nullptr;
     };
 }
@@ -1,6 +1,7 @@
 #pragma once
 #include <onyx/assets/asset.h>
 #include <onyx/gamecore/scene/scenesectorstreamer.h>
+#include <onyx/gamecore/scene/transformhierarchy.h>
 #include <onyx/entity/entityregistry.h>
 
 #include <onyx/graphics/rendergraph/rendergraph.h>
@@ -27,6 +28,9 @@ namespace Onyx::GameCore
 
         const SceneSectorStreamer& GetSectorStreamer() const { return m_SectorStreamer; }
 
+        TransformHierarchy& GetTransformHierarchy() { return m_TransformHierarchy; }
+        const TransformHierarchy& GetTransformHierarchy() const { return m_TransformHierarchy; }
+
         void SetLoadCenter(const Vector3f32& loadCenter);
         void SetStreamInDistance(onyxF64 distance);
         void SetStreamOutDistance(onyxF64 distance);
@@ -49,12 +53,14 @@ namespace Onyx::GameCore
         // only needed in editor most likely 
         void OnTransformComponentConstructed(Entity::EntityRegistry::EntityRegistryT& registry, Entity::EntityId entity);
         void OnTransformComponentDestroyed(Entity::EntityRegistry::EntityRegistryT& registry, Entity::EntityId entity);
+        void OnHierarchyChanged(Entity::EntityRegistry::EntityRegistryT& registry, Entity::EntityId entity);
 
     private:
         Vector3f32 m_LoadCenter; // center position of the streaming
 
         SceneSectorStreamer m_SectorStreamer { *this };
         Entity::EntityRegistry m_Registry;
+        TransformHierarchy m_TransformHierarchy;
 
         Assets::AssetHandle<Graphics::RenderGraph> m_SceneRenderGraph;
     };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <onyx/graphics/culling/meshvisibility.h>
 #include <onyx/rhi/framecontext.h>
 #include <onyx/rhi/graphicshandles.h>
 
@@ -39,10 +40,30 @@ namespace Onyx::GameCore
         DynamicArray<Matrix4<onyxF32>> Transforms;
     };
 
+    // meshes can share a vertex buffer and differ in their index buffer, so both identify the mesh of a draw call
+    struct StaticMeshKey
+    {
+        const void* VertexBuffer = nullptr;
+        const void* IndexBuffer = nullptr;
+
+        bool operator==(const StaticMeshKey& other) const = default;
+    };
+
+    struct StaticMeshKeyHasher
+    {
+        onyxU64 operator()(const StaticMeshKey& key) const
+        {
+            return std::hash<const void*>()(key.VertexBuffer) ^ (std::hash<const void*>()(key.IndexBuffer) * 31);
+        }
+    };
+
     struct StaticMeshDrawCall
     {
         StaticMeshDrawCall();
 
+        void AddInstance(const Matrix4<onyxF32>& worldMatrix);
+        StaticMeshKey GetMeshKey() const { return { VertexData.Buffer.Raw(), Indices.Buffer.Raw() }; }
+
         // TODO: Change this to a struct / StaticMesh class
         // TODO: Should not link a MaterialShaderGraph but rather a MaterialInstance which links to MaterialShaderGraph
         Assets::AssetHandle<Graphics::MaterialShaderGraph> Material;
@@ -50,7 +71,18 @@ namespace Onyx::GameCore
         Graphics::BufferHandle Indices;
         Graphics::BufferHandle DrawCommandBuffer;
 
+        // local space bounds of the mesh
+        Graphics::MeshBounds Bounds;
         DynamicArray<Matrix4<onyxF32>> Transforms;
+        // world space bounds per transform
+        DynamicArray<Graphics::MeshBounds> WorldBounds;
+    };
+
+    // instance of a static mesh draw call that passed the visibility
+    struct StaticMeshInstance
+    {
+        onyxU32 DrawCallIndex = 0;
+        onyxU32 TransformIndex = 0;
     };
 
     //struct TextDrawCall
@@ -78,11 +110,19 @@ namespace Onyx::GameCore
     {
         ~SceneFrameData();
 
+        // culls the instances of the static mesh draw calls and sorts the visible ones by pipeline, material and mesh
+        void UpdateStaticMeshVisibility(const Graphics::ViewConstants& viewConstants);
+
         DynamicArray<StaticSpriteDrawCall> m_StaticDrawCalls;
 
         // group static mesh draw and indirect draw based on the material
         DynamicArray<StaticMeshDrawCall> m_StaticMeshDrawCalls;
         DynamicArray<StaticMeshIndirectDrawCall> m_StaticMeshIndirectDrawCalls;
+
+        // all instances of m_StaticMeshDrawCalls indexed by the draws of m_StaticMeshVisibility, render in the order of its batches
+        DynamicArray<StaticMeshInstance> m_StaticMeshInstances;
+        Graphics::MeshVisibility m_StaticMeshVisibility;
+
         //DynamicArray<TextDrawCall> m_TextDrawCalls;
         DynamicArray<VoxelChunk> m_VoxelChunksToInit;
 
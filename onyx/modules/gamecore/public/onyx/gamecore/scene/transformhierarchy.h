@@ -0,0 +1,80 @@
+#pragma once
+
+#include <onyx/entity/entity.h>
+
+namespace Onyx::Entity
+{
+    class EntityRegistry;
+}
+
+namespace Onyx::GameCore
+{
+    struct TransformComponent;
+
+    // World matrices of all entities with a TransformComponent.
+    // Entities are stored depth first so parents come before their children and every subtree is a contiguous range,
+    // the parent is the entity with the IdComponent id in the HierarchyComponent.
+    // Only subtrees with a changed local transform get their world matrices updated, independent root subtrees are updated in parallel.
+    class TransformHierarchy
+    {
+    public:
+        // entities got added, removed or reparented, the order gets rebuilt on the next update
+        void MarkStructureDirty() { m_IsStructureDirty = true; }
+
+        void Update(const Entity::EntityRegistry& registry);
+
+        onyxU32 GetEntityCount() const { return static_cast<onyxU32>(m_Entities.size()); }
+
+        // index into the arrays below, INVALID_INDEX_32 if the entity has no transform
+        onyxS32 GetIndex(Entity::EntityId entity) const;
+
+        const DynamicArray<Entity::EntityId>& GetEntities() const { return m_Entities; }
+
+        // index of the parent, INVALID_INDEX_32 for roots
+        const DynamicArray<onyxS32>& GetParents() const { return m_Parents; }
+        const DynamicArray<Matrix4<onyxF32>>& GetWorldMatrices() const { return m_WorldMatrices; }
+
+        // world matrix changed in the last update
+        bool HasChanged(onyxU32 index) const { return m_IsDirty[index] != 0; }
+
+        const Matrix4<onyxF32>& GetWorldMatrix(onyxU32 index) const { return m_WorldMatrices[index]; }
+        Matrix4<onyxF32> GetWorldMatrix(Entity::EntityId entity) const;
+
+    private:
+        struct LocalTransform
+        {
+            Vector3f32 Translation;
+            Rotor3f32 Rotation;
+            Vector3f32 Scale;
+        };
+
+        // root subtrees that get updated by the same job
+        struct SubtreeRange
+        {
+            onyxU32 First = 0;
+            onyxU32 Count = 0;
+        };
+
+        bool HasParentChanged(const Entity::EntityRegistry& registry) const;
+        void RebuildOrder(const Entity::EntityRegistry& registry);
+        bool UpdateLocalTransforms(const Entity::EntityRegistry& registry, bool forceUpdate);
+        void UpdateWorldMatrices(onyxU32 first, onyxU32 count);
+
+    private:
+        bool m_IsStructureDirty = true;
+
+        HashMap<Entity::EntityId, onyxU32> m_EntityIndices;
+
+        DynamicArray<Entity::EntityId> m_Entities;
+        DynamicArray<onyxS32> m_Parents;
+        DynamicArray<onyxU64> m_ParentIds;
+        DynamicArray<onyxU32> m_SubtreeSizes;
+
+        DynamicArray<LocalTransform> m_LocalTransforms;
+        DynamicArray<Matrix4<onyxF32>> m_LocalMatrices;
+        DynamicArray<Matrix4<onyxF32>> m_WorldMatrices;
+        DynamicArray<onyxU8> m_IsDirty;
+
+        DynamicArray<SubtreeRange> m_SubtreeRanges;
+    };
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+namespace Onyx
+{
+    class MemoryStream;
+}
+
+namespace Onyx::Entity
+{
+    class ComponentFactory;
+    class EntityRegistry;
+}
+
+namespace Onyx::GameCore
+{
+    struct SectorEntity;
+
+    // Binary copy of a json sector that is written next to it, components with a binary schema are stored raw and the others as embedded json.
+    // The header stores a hash of the json source, so a binary sector is only loaded for the exact json it was written from.
+    namespace BinarySector
+    {
+        static constexpr onyxU32 MAGIC = 0x4345534F; // "OSEC"
+        static constexpr onyxU32 VERSION = 2;
+        static constexpr StringView FILE_EXTENSION = "osectorbin";
+
+        onyxU64 GetSourceHash(StringView jsonSource);
+
+        // Returns false if any component failed to serialize, the stream must not be written out in that case
+        bool Serialize(const Entity::EntityRegistry& registry, const Entity::ComponentFactory& componentFactory, const DynamicArray<SectorEntity>& entities, onyxU64 sourceHash, MemoryStream& outStream);
+
+        // Returns false without creating any entity if the source hash or the format do not match or a component schema changed since it was written
+        bool Deserialize(Entity::EntityRegistry& registry, const Entity::ComponentFactory& componentFactory, onyxU64 sourceHash, MemoryStream& inStream, DynamicArray<SectorEntity>& outEntities);
+    }
+}
@@ -39,9 +39,13 @@ namespace Onyx::GameCore
         bool DeserializeEntity(const Deserializer& deserializer, Entity::EntityRegistry& registry, const Entity::ComponentFactory& componentFactory, Entity::EntityId entityId) const;
 
         bool SerializeSectorsToJson(const Entity::EntityRegistry& registry, const Entity::ComponentFactory& componentFactory, const DynamicArray<SceneSector>& sectors, const FilePath& sectorDirectoryPath) const;
-        bool SerializeSectorToJson(const Entity::EntityRegistry& registry, const Entity::ComponentFactory& componentFactory, const SceneSector& sector, const FilePath& sectorDirectoryPath) const;
+        bool SerializeSectorToJson(const Entity::EntityRegistry& registry, const Entity::ComponentFactory& componentFactory, const SceneSector& sector, const FilePath& sectorDirectoryPath, onyxU64& outSourceHash) const;
 
         bool DeserializeSectorsFromJson(Scene& scene, const Entity::ComponentFactory& componentFactory, DynamicArray<SceneSector>& sectors, const FilePath& sectorDirectoryPath) const;
         bool DeserializeSectorFromJson(Scene& scene, const Entity::ComponentFactory& componentFactory, SceneSector& outSector, const FilePath& sectorFilePath) const;
+
+        // Loading falls back to the json if the binary sector was written from a different json or any component schema changed since (see BinarySector).
+        bool SerializeSectorToBinary(const Entity::EntityRegistry& registry, const Entity::ComponentFactory& componentFactory, const SceneSector& sector, onyxU64 sourceHash, const FilePath& sectorFilePath) const;
+        bool DeserializeSectorFromBinary(Scene& scene, const Entity::ComponentFactory& componentFactory, SceneSector& outSector, onyxU64 sourceHash, const FilePath& sectorFilePath) const;
     };
 }
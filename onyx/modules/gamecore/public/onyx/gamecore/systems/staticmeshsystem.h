@@ -0,0 +1,12 @@
+#pragma once
+
+namespace Onyx::Entity
+{
+    class EcsBuilder;
+}
+
+namespace Onyx::GameCore::StaticMeshes
+{
+    // adds a draw call instance with world space bounds for every static mesh entity
+    void registerSystems(Entity::EcsBuilder& ecsBuilder);
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+namespace Onyx
+{
+    namespace Entity
+    {
+        class EcsBuilder;
+    };
+}
+
+namespace Onyx::GameCore
+{
+    namespace Transforms
+    {
+        // updates the world matrices of the scene, systems that move entities have to be registered before
+        void registerSystems(Entity::EcsBuilder& ecsBuilder);
+    }
+}
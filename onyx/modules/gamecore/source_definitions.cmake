@@ -4,9 +4,11 @@ set(onyx_TARGET_PUBLIC_SOURCES
     components/graphics/materialcomponent.ocd
     components/graphics/pointlightcomponent.ocd
     components/graphics/spotlightcomponent.ocd
+    components/graphics/staticmeshcomponent.ocd
     components/graphics/textcomponent.ocd
     components/cameracomponent.ocd
     components/freecameracomponent.ocd
+    components/hierarchycomponent.ocd
     components/idcomponent.ocd
     components/namecomponent.ocd
     components/transformcomponent.h
@@ -19,10 +21,14 @@ set(onyx_TARGET_PUBLIC_SOURCES
     scene/scene.h
     scene/scenesector.h
     scene/scenesectorstreamer.h
+    scene/transformhierarchy.h
+    serialize/binarysector.h
     serialize/sceneserializer.h
     systems/camerasystem.h
     systems/freecamerasystem.h
     systems/lightingsystem.h
+    systems/staticmeshsystem.h
+    systems/transformsystem.h
 )
 
 set(onyx_TARGET_PRIVATE_SOURCES
@@ -34,8 +40,12 @@ set(onyx_TARGET_PRIVATE_SOURCES
     scene/sceneframedata.cpp
     scene/scene.cpp
     scene/scenesectorstreamer.cpp
+    scene/transformhierarchy.cpp
+    serialize/binarysector.cpp
     serialize/sceneserializer.cpp
     systems/camerasystem.cpp
     systems/freecamerasystem.cpp
     systems/lightingsystem.cpp
+    systems/staticmeshsystem.cpp
+    systems/transformsystem.cpp
 )
\ No newline at end of file
@@ -0,0 +1,319 @@
+#include <onyx/graphics/culling/meshvisibility.h>
+
+#include <onyx/rhi/viewconstants.h>
+
+#include <onyx/profiler/profiler.h>
+
+// SSE2 is part of every x64 target, other targets use the scalar version of the culling
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define ONYX_MESH_VISIBILITY_SSE 1
+#include <emmintrin.h>
+#else
+#define ONYX_MESH_VISIBILITY_SSE 0
+#endif
+
+namespace Onyx::Graphics
+{
+    namespace
+    {
+        // draws per SIMD test, the bounds are padded to a multiple of it
+        constexpr onyxU32 DRAW_BATCH_SIZE = 4;
+
+        constexpr onyxU32 RADIX_BITS = 8;
+        constexpr onyxU32 RADIX_SIZE = 1 << RADIX_BITS;
+        constexpr onyxU32 RADIX_PASSES = 64 / RADIX_BITS;
+
+        constexpr onyxU32 FRUSTUM_PLANE_COUNT = 6;
+
+        Vector4f32 GetRow(const Matrix4<onyxF32>& matrix, onyxU32 row)
+        {
+            return Vector4f32(matrix[0][row], matrix[1][row], matrix[2][row], matrix[3][row]);
+        }
+
+        // planes of the clip space volume (-w <= x, y <= w, 0 <= z <= w) in world space, facing inwards
+        Array<Vector4f32, FRUSTUM_PLANE_COUNT> GetFrustumPlanes(const Matrix4<onyxF32>& viewProjection)
+        {
+            const Vector4f32 rowX = GetRow(viewProjection, 0);
+            const Vector4f32 rowY = GetRow(viewProjection, 1);
+            const Vector4f32 rowZ = GetRow(viewProjection, 2);
+            const Vector4f32 rowW = GetRow(viewProjection, 3);
+
+            return { rowW + rowX, rowW - rowX, rowW + rowY, rowW - rowY, rowZ, rowW - rowZ };
+        }
+    }
+
+    bool MeshBounds::IsInfinite() const
+    {
+        for (onyxU32 i = 0; i < 3; ++i)
+        {
+            if ((Min[i] <= std::numeric_limits<onyxF32>::lowest()) || (Max[i] >= std::numeric_limits<onyxF32>::max()))
+                return true;
+        }
+
+        return false;
+    }
+
+    MeshBounds MeshBounds::Transform(const Matrix4<onyxF32>& transform) const
+    {
+        if (IsInfinite())
+            return {};
+
+        const Vector3f32 center = (Min + Max) * 0.5f;
+        const Vector3f32 extent = (Max - Min) * 0.5f;
+
+        Vector3f32 transformedCenter(transform * Vector4f32(center, 1.0f));
+        Vector3f32 transformedExtent;
+        for (onyxU32 row = 0; row < 3; ++row)
+        {
+            transformedExtent[row] = std::abs(transform[0][row]) * extent[0] +
+                std::abs(transform[1][row]) * extent[1] +
+                std::abs(transform[2][row]) * extent[2];
+        }
+
+        return { transformedCenter - transformedExtent, transformedCenter + transformedExtent };
+    }
+
+    void MeshVisibility::DrawBoundsSoA::Clear()
+    {
+        for (DynamicArray<onyxF32>* component : { &CenterX, &CenterY, &CenterZ, &ExtentX, &ExtentY, &ExtentZ })
+            component->clear();
+    }
+
+    void MeshVisibility::DrawBoundsSoA::Resize(onyxU64 size)
+    {
+        for (DynamicArray<onyxF32>* component : { &CenterX, &CenterY, &CenterZ, &ExtentX, &ExtentY, &ExtentZ })
+            component->resize(size, 0.0f);
+    }
+
+    onyxU64 MeshVisibility::MakeSortKey(onyxU32 pipelineId, onyxU32 materialId, onyxU32 meshId, onyxU32 depth)
+    {
+        constexpr onyxU64 PIPELINE_MASK = (1ull << PIPELINE_BITS) - 1;
+        constexpr onyxU64 MATERIAL_MASK = (1ull << MATERIAL_BITS) - 1;
+        constexpr onyxU64 MESH_MASK = (1ull << MESH_BITS) - 1;
+        constexpr onyxU64 DEPTH_MASK = (1ull << DEPTH_BITS) - 1;
+        static_assert(PIPELINE_BITS + MATERIAL_BITS + MESH_BITS + DEPTH_BITS == 64);
+
+        // ids that do not fit only make the sorting worse, batches compare the full ids
+        return ((pipelineId & PIPELINE_MASK) << (MATERIAL_BITS + MESH_BITS + DEPTH_BITS)) |
+            ((materialId & MATERIAL_MASK) << (MESH_BITS + DEPTH_BITS)) |
+            ((meshId & MESH_MASK) << DEPTH_BITS) |
+            (depth & DEPTH_MASK);
+    }
+
+    void MeshVisibility::Clear()
+    {
+        m_DrawCount = 0;
+        m_Bounds.Clear();
+        m_PipelineIds.clear();
+        m_MaterialIds.clear();
+        m_MeshIds.clear();
+
+        m_VisibleDraws.clear();
+        m_SortKeys.clear();
+        m_Batches.clear();
+    }
+
+    onyxU32 MeshVisibility::AddDraw(const MeshBounds& worldBounds, onyxU32 pipelineId, onyxU32 materialId, onyxU32 meshId)
+    {
+        Vector3f32 center;
+        Vector3f32 extent(std::numeric_limits<onyxF32>::max());
+        if (worldBounds.IsInfinite() == false)
+        {
+            center = (worldBounds.Min + worldBounds.Max) * 0.5f;
+            extent = (worldBounds.Max - worldBounds.Min) * 0.5f;
+        }
+
+        m_Bounds.CenterX.push_back(center[0]);
+        m_Bounds.CenterY.push_back(center[1]);
+        m_Bounds.CenterZ.push_back(center[2]);
+        m_Bounds.ExtentX.push_back(extent[0]);
+        m_Bounds.ExtentY.push_back(extent[1]);
+        m_Bounds.ExtentZ.push_back(extent[2]);
+
+        m_PipelineIds.push_back(pipelineId);
+        m_MaterialIds.push_back(materialId);
+        m_MeshIds.push_back(meshId);
+
+        return m_DrawCount++;
+    }
+
+    void MeshVisibility::Build(const ViewConstants& viewConstants)
+    {
+        ONYX_PROFILE_FUNCTION;
+
+        m_VisibleDraws.clear();
+        m_SortKeys.clear();
+        m_Batches.clear();
+
+        if (m_DrawCount == 0)
+            return;
+
+        CullDraws(viewConstants);
+        if (m_VisibleDraws.empty())
+            return;
+
+        ComputeSortKeys(viewConstants);
+        SortVisibleDraws();
+        BuildBatches();
+    }
+
+    void MeshVisibility::CullDraws(const ViewConstants& viewConstants)
+    {
+        ONYX_PROFILE_FUNCTION;
+
+        const Array<Vector4f32, FRUSTUM_PLANE_COUNT> planes = GetFrustumPlanes(viewConstants.ViewProjectionMatrix);
+
+        const onyxU32 paddedCount = (m_DrawCount + DRAW_BATCH_SIZE - 1) & ~(DRAW_BATCH_SIZE - 1);
+        m_Bounds.Resize(paddedCount);
+
+        // a box is outside if it is completely behind one of the planes, the planes do not have to be normalized for that
+#if ONYX_MESH_VISIBILITY_SSE
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+
+        for (onyxU32 first = 0; first < paddedCount; first += DRAW_BATCH_SIZE)
+        {
+            const __m128 centerX = _mm_loadu_ps(m_Bounds.CenterX.data() + first);
+            const __m128 centerY = _mm_loadu_ps(m_Bounds.CenterY.data() + first);
+            const __m128 centerZ = _mm_loadu_ps(m_Bounds.CenterZ.data() + first);
+            const __m128 extentX = _mm_loadu_ps(m_Bounds.ExtentX.data() + first);
+            const __m128 extentY = _mm_loadu_ps(m_Bounds.ExtentY.data() + first);
+            const __m128 extentZ = _mm_loadu_ps(m_Bounds.ExtentZ.data() + first);
+
+            __m128 outside = _mm_setzero_ps();
+            for (const Vector4f32& plane : planes)
+            {
+                const __m128 normalX = _mm_set1_ps(plane[0]);
+                const __m128 normalY = _mm_set1_ps(plane[1]);
+                const __m128 normalZ = _mm_set1_ps(plane[2]);
+
+                __m128 distance = _mm_add_ps(_mm_mul_ps(normalX, centerX), _mm_set1_ps(plane[3]));
+                distance = _mm_add_ps(distance, _mm_mul_ps(normalY, centerY));
+                distance = _mm_add_ps(distance, _mm_mul_ps(normalZ, centerZ));
+
+                __m128 radius = _mm_mul_ps(_mm_and_ps(normalX, absMask), extentX);
+                radius = _mm_add_ps(radius, _mm_mul_ps(_mm_and_ps(normalY, absMask), extentY));
+                radius = _mm_add_ps(radius, _mm_mul_ps(_mm_and_ps(normalZ, absMask), extentZ));
+
+                outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(distance, radius), zero));
+            }
+
+            onyxU32 visibleMask = ~static_cast<onyxU32>(_mm_movemask_ps(outside)) & 0xF;
+            while (visibleMask != 0)
+            {
+                const onyxU32 draw = first + std::countr_zero(visibleMask);
+                visibleMask &= visibleMask - 1;
+
+                if (draw < m_DrawCount)
+                    m_VisibleDraws.push_back(draw);
+            }
+        }
+#else
+        for (onyxU32 draw = 0; draw < m_DrawCount; ++draw)
+        {
+            bool isOutside = false;
+            for (const Vector4f32& plane : planes)
+            {
+                const onyxF32 distance = plane[0] * m_Bounds.CenterX[draw] + plane[1] * m_Bounds.CenterY[draw] + plane[2] * m_Bounds.CenterZ[draw] + plane[3];
+                const onyxF32 radius = std::abs(plane[0]) * m_Bounds.ExtentX[draw] + std::abs(plane[1]) * m_Bounds.ExtentY[draw] + std::abs(plane[2]) * m_Bounds.ExtentZ[draw];
+                isOutside |= (distance + radius) < 0.0f;
+            }
+
+            if (isOutside == false)
+                m_VisibleDraws.push_back(draw);
+        }
+#endif
+    }
+
+    void MeshVisibility::ComputeSortKeys(const ViewConstants& viewConstants)
+    {
+        ONYX_PROFILE_FUNCTION;
+
+        // view space depth of the box center, linear between the near and far plane
+        const Vector4f32 viewRowZ = GetRow(viewConstants.ViewMatrix, 2);
+        const onyxF32 depthRange = std::max(viewConstants.Far - viewConstants.Near, 1e-6f);
+        const onyxF32 maxDepth = static_cast<onyxF32>((1u << DEPTH_BITS) - 1);
+
+        m_SortKeys.resize(m_VisibleDraws.size());
+        for (onyxU64 i = 0; i < m_VisibleDraws.size(); ++i)
+        {
+            const onyxU32 draw = m_VisibleDraws[i];
+            const onyxF32 viewDepth = -(viewRowZ[0] * m_Bounds.CenterX[draw] + viewRowZ[1] * m_Bounds.CenterY[draw] + viewRowZ[2] * m_Bounds.CenterZ[draw] + viewRowZ[3]);
+            const onyxF32 normalizedDepth = std::clamp((viewDepth - viewConstants.Near) / depthRange, 0.0f, 1.0f);
+
+            const onyxU32 depth = static_cast<onyxU32>(normalizedDepth * maxDepth);
+            m_SortKeys[i] = MakeSortKey(m_PipelineIds[draw], m_MaterialIds[draw], m_MeshIds[draw], depth);
+        }
+    }
+
+    void MeshVisibility::SortVisibleDraws()
+    {
+        ONYX_PROFILE_FUNCTION;
+
+        // LSD radix sort, stable so draws with equal keys keep the order they got added in
+        const onyxU64 count = m_SortKeys.size();
+        m_SortScratchKeys.resize(count);
+        m_SortScratchDraws.resize(count);
+
+        // histograms of all passes in a single read of the keys
+        Array<Array<onyxU32, RADIX_SIZE>, RADIX_PASSES> histograms{};
+        for (const onyxU64 key : m_SortKeys)
+        {
+            for (onyxU32 pass = 0; pass < RADIX_PASSES; ++pass)
+                ++histograms[pass][(key >> (pass * RADIX_BITS)) & (RADIX_SIZE - 1)];
+        }
+
+        for (onyxU32 pass = 0; pass < RADIX_PASSES; ++pass)
+        {
+            const onyxU32 shift = pass * RADIX_BITS;
+            Array<onyxU32, RADIX_SIZE>& histogram = histograms[pass];
+
+            // every key has the same digit, the pass would not change the order
+            if (histogram[(m_SortKeys[0] >> shift) & (RADIX_SIZE - 1)] == count)
+                continue;
+
+            onyxU32 offset = 0;
+            for (onyxU32& bucket : histogram)
+            {
+                const onyxU32 bucketCount = bucket;
+                bucket = offset;
+                offset += bucketCount;
+            }
+
+            for (onyxU64 i = 0; i < count; ++i)
+            {
+                const onyxU32 target = histogram[(m_SortKeys[i] >> shift) & (RADIX_SIZE - 1)]++;
+                m_SortScratchKeys[target] = m_SortKeys[i];
+                m_SortScratchDraws[target] = m_VisibleDraws[i];
+            }
+
+            std::swap(m_SortKeys, m_SortScratchKeys);
+            std::swap(m_VisibleDraws, m_SortScratchDraws);
+        }
+    }
+
+    void MeshVisibility::BuildBatches()
+    {
+        MeshDrawBatch batch;
+        for (onyxU32 i = 0; i < m_VisibleDraws.size(); ++i)
+        {
+            if ((batch.DrawCount != 0) && (IsSameBatch(m_VisibleDraws[batch.FirstDraw], m_VisibleDraws[i]) == false))
+            {
+                m_Batches.push_back(batch);
+                batch.FirstDraw = i;
+                batch.DrawCount = 0;
+            }
+
+            ++batch.DrawCount;
+        }
+
+        m_Batches.push_back(batch);
+    }
+
+    bool MeshVisibility::IsSameBatch(onyxU32 lhsDraw, onyxU32 rhsDraw) const
+    {
+        return (m_PipelineIds[lhsDraw] == m_PipelineIds[rhsDraw]) &&
+            (m_MaterialIds[lhsDraw] == m_MaterialIds[rhsDraw]) &&
+            (m_MeshIds[lhsDraw] == m_MeshIds[rhsDraw]);
+    }
+}
@@ -0,0 +1,463 @@
+#include <onyx/graphics/lighting/lightclusterbuilder.h>
+
+#include <onyx/rhi/viewconstants.h>
+#include <onyx/thread/threadpool/parallelfor.h>
+
+#include <onyx/profiler/profiler.h>
+
+// SSE2 is part of every x64 target, other targets use the scalar version of the cluster tests
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define ONYX_LIGHT_CLUSTER_SSE 1
+#include <emmintrin.h>
+#else
+#define ONYX_LIGHT_CLUSTER_SSE 0
+#endif
+
+namespace Onyx::Graphics
+{
+    namespace
+    {
+        // clusters per SIMD test, slices are padded to a multiple of it
+        constexpr onyxU32 CLUSTER_BATCH_SIZE = 4;
+
+        Vector3f32 ScreenToView(const Matrix4<onyxF32>& inverseProjection, const Vector2f32& viewport, onyxF32 screenX, onyxF32 screenY)
+        {
+            const onyxF32 texCoordX = screenX / viewport[0];
+            const onyxF32 texCoordY = screenY / viewport[1];
+
+            const Vector4f32 clipPosition(texCoordX * 2.0f - 1.0f, (1.0f - texCoordY) * 2.0f - 1.0f, 0.0f, 1.0f);
+            const Vector4f32 viewPosition = inverseProjection * clipPosition;
+            return Vector3f32(viewPosition) / viewPosition[3];
+        }
+
+        // intersection of the ray from the camera through the point with the z plane
+        Vector3f32 IntersectZPlane(const Vector3f32& point, onyxF32 z)
+        {
+            return point * (z / point[2]);
+        }
+
+        // plane through the camera containing both directions, facing the inside direction
+        Vector4f32 MakeFrustumPlane(const Vector3f32& a, const Vector3f32& b, const Vector3f32& inside)
+        {
+            Vector3f32 normal = a.Cross(b).Normalized();
+            if (normal.Dot(inside) < 0.0f)
+                normal = normal * -1.0f;
+
+            return Vector4f32(normal, 0.0f);
+        }
+    }
+
+    void LightClusterBuilder::ClusterBoundsSoA::Resize(onyxU64 size)
+    {
+        for (DynamicArray<onyxF32>* component : { &MinX, &MinY, &MinZ, &MaxX, &MaxY, &MaxZ, &CenterX, &CenterY, &CenterZ, &Radius })
+            component->assign(size, 0.0f);
+    }
+
+    LightClusterBuilder::LightClusterBuilder(const LightClusterSettings& settings)
+        : m_Settings(settings)
+    {
+        ONYX_ASSERT((settings.ClustersX != 0) && (settings.ClustersY != 0) && (settings.ClustersZ != 0), "Light cluster grid can not be empty.");
+
+        const onyxU32 sliceClusterCount = m_Settings.ClustersX * m_Settings.ClustersY;
+        m_SliceStride = (sliceClusterCount + CLUSTER_BATCH_SIZE - 1) & ~(CLUSTER_BATCH_SIZE - 1);
+        m_MaskWordsPerSlice = (m_SliceStride + 63) / 64;
+
+        m_Bounds.Resize(static_cast<onyxU64>(m_SliceStride) * m_Settings.ClustersZ);
+        m_ClusterBounds.resize(GetClusterCount());
+        m_LightGrid.resize(GetClusterCount());
+        m_Slices.resize(m_Settings.ClustersZ);
+    }
+
+    void LightClusterBuilder::Build(const ViewConstants& viewConstants, const Lighting& lighting)
+    {
+        const onyxU32 pointLightCount = std::min<onyxU32>(lighting.PointLightsCount, static_cast<onyxU32>(lighting.PointLights.size()));
+        const onyxU32 spotLightCount = std::min<onyxU32>(lighting.SpotLightsCount, static_cast<onyxU32>(lighting.SpotLights.size()));
+        Build(viewConstants, Span<const PointLight>(lighting.PointLights.data(), pointLightCount), Span<const SpotLight>(lighting.SpotLights.data(), spotLightCount));
+    }
+
+    void LightClusterBuilder::Build(const ViewConstants& viewConstants, Span<const PointLight> pointLights, Span<const SpotLight> spotLights)
+    {
+        ONYX_PROFILE_FUNCTION;
+
+        std::ranges::fill(m_LightGrid, LightGridCell());
+        m_LightIndices.clear();
+
+        const bool hasValidView = (viewConstants.Viewport[0] > 0.0f) && (viewConstants.Viewport[1] > 0.0f) && (viewConstants.Near > 0.0f) && (viewConstants.Far > viewConstants.Near);
+        if (hasValidView == false)
+        {
+            m_PointLights.clear();
+            m_SpotLights.clear();
+            return;
+        }
+
+        UpdateClusterBounds(viewConstants);
+        CullLights(viewConstants, pointLights, spotLights);
+
+        if (m_PointLights.empty() && m_SpotLights.empty())
+            return;
+
+        ForEachSlice([this](onyxU32 slice) { TestSlice(slice); });
+
+        // offsets in cluster order, so the result does not depend on the order the slices finished in
+        onyxU32 pointLightOffset = 0;
+        onyxU32 spotLightOffset = 0;
+        for (LightGridCell& cell : m_LightGrid)
+        {
+            cell.PointLightOffset = pointLightOffset;
+            cell.SpotLightOffset = spotLightOffset;
+            pointLightOffset += cell.PointLightCount;
+            spotLightOffset += cell.SpotLightCount;
+        }
+
+        m_LightIndices.resize(std::max(pointLightOffset, spotLightOffset));
+
+        ForEachSlice([this](onyxU32 slice) { WriteSlice(slice); });
+    }
+
+    void LightClusterBuilder::UpdateClusterBounds(const ViewConstants& viewConstants)
+    {
+        const bool isUpToDate = (m_Viewport == viewConstants.Viewport) && (m_Near == viewConstants.Near) && (m_Far == viewConstants.Far) &&
+            (m_InverseProjection[0] == viewConstants.InverseProjectionMatrix[0]) && (m_InverseProjection[1] == viewConstants.InverseProjectionMatrix[1]) &&
+            (m_InverseProjection[2] == viewConstants.InverseProjectionMatrix[2]) && (m_InverseProjection[3] == viewConstants.InverseProjectionMatrix[3]);
+
+        if (isUpToDate)
+            return;
+
+        ONYX_PROFILE_FUNCTION;
+
+        m_InverseProjection = viewConstants.InverseProjectionMatrix;
+        m_Viewport = viewConstants.Viewport;
+        m_Near = viewConstants.Near;
+        m_Far = viewConstants.Far;
+
+        const onyxU32 clustersX = m_Settings.ClustersX;
+        const onyxU32 clustersY = m_Settings.ClustersY;
+        const onyxU32 clustersZ = m_Settings.ClustersZ;
+
+        // same layout as the CreateLightClusters compute pass, the last tiles can reach past the viewport
+        const onyxF32 clusterWidth = std::ceil(m_Viewport[0] / static_cast<onyxF32>(clustersX));
+        const onyxF32 clusterHeight = std::ceil(m_Viewport[1] / static_cast<onyxF32>(clustersY));
+
+        // tile corners only depend on the screen position
+        DynamicArray<Vector3f32> tileCorners((clustersX + 1) * (clustersY + 1));
+        for (onyxU32 y = 0; y <= clustersY; ++y)
+        {
+            for (onyxU32 x = 0; x <= clustersX; ++x)
+                tileCorners[x + y * (clustersX + 1)] = ScreenToView(m_InverseProjection, m_Viewport, static_cast<onyxF32>(x) * clusterWidth, static_cast<onyxF32>(y) * clusterHeight);
+        }
+
+        const onyxF32 depthRatio = m_Far / m_Near;
+        for (onyxU32 z = 0; z < clustersZ; ++z)
+        {
+            const onyxF32 tileNear = -m_Near * std::pow(depthRatio, static_cast<onyxF32>(z) / static_cast<onyxF32>(clustersZ));
+            const onyxF32 tileFar = -m_Near * std::pow(depthRatio, static_cast<onyxF32>(z + 1) / static_cast<onyxF32>(clustersZ));
+
+            for (onyxU32 y = 0; y < clustersY; ++y)
+            {
+                for (onyxU32 x = 0; x < clustersX; ++x)
+                {
+                    const Vector3f32& minPoint = tileCorners[x + y * (clustersX + 1)];
+                    const Vector3f32& maxPoint = tileCorners[(x + 1) + (y + 1) * (clustersX + 1)];
+
+                    const Vector3f32 minPointNear = IntersectZPlane(minPoint, tileNear);
+                    const Vector3f32 minPointFar = IntersectZPlane(minPoint, tileFar);
+                    const Vector3f32 maxPointNear = IntersectZPlane(maxPoint, tileNear);
+                    const Vector3f32 maxPointFar = IntersectZPlane(maxPoint, tileFar);
+
+                    Vector3f32 aabbMin;
+                    Vector3f32 aabbMax;
+                    for (onyxU32 axis = 0; axis < 3; ++axis)
+                    {
+                        aabbMin[axis] = std::min({ minPointNear[axis], minPointFar[axis], maxPointNear[axis], maxPointFar[axis] });
+                        aabbMax[axis] = std::max({ minPointNear[axis], minPointFar[axis], maxPointNear[axis], maxPointFar[axis] });
+                    }
+
+                    const onyxU32 clusterIndex = GetClusterIndex(x, y, z);
+                    m_ClusterBounds[clusterIndex] = { Vector4f32(aabbMin, 0.0f), Vector4f32(aabbMax, 0.0f) };
+
+                    const onyxU64 soaIndex = static_cast<onyxU64>(z) * m_SliceStride + x + y * clustersX;
+                    const Vector3f32 center = (aabbMin + aabbMax) * 0.5f;
+                    m_Bounds.MinX[soaIndex] = aabbMin[0];
+                    m_Bounds.MinY[soaIndex] = aabbMin[1];
+                    m_Bounds.MinZ[soaIndex] = aabbMin[2];
+                    m_Bounds.MaxX[soaIndex] = aabbMax[0];
+                    m_Bounds.MaxY[soaIndex] = aabbMax[1];
+                    m_Bounds.MaxZ[soaIndex] = aabbMax[2];
+                    m_Bounds.CenterX[soaIndex] = center[0];
+                    m_Bounds.CenterY[soaIndex] = center[1];
+                    m_Bounds.CenterZ[soaIndex] = center[2];
+                    m_Bounds.Radius[soaIndex] = static_cast<onyxF32>((aabbMax - center).Length());
+                }
+            }
+        }
+
+        // side planes of the cluster grid, near and far are tested against the depth range
+        const Vector3f32& topLeft = tileCorners[0];
+        const Vector3f32& topRight = tileCorners[clustersX];
+        const Vector3f32& bottomLeft = tileCorners[clustersY * (clustersX + 1)];
+        const Vector3f32& bottomRight = tileCorners[clustersX + clustersY * (clustersX + 1)];
+        const Vector3f32 inside = topLeft + topRight + bottomLeft + bottomRight;
+
+        m_FrustumPlanes[0] = MakeFrustumPlane(topLeft, bottomLeft, inside);
+        m_FrustumPlanes[1] = MakeFrustumPlane(topRight, bottomRight, inside);
+        m_FrustumPlanes[2] = MakeFrustumPlane(topLeft, topRight, inside);
+        m_FrustumPlanes[3] = MakeFrustumPlane(bottomLeft, bottomRight, inside);
+    }
+
+    void LightClusterBuilder::CullLights(const ViewConstants& viewConstants, Span<const PointLight> pointLights, Span<const SpotLight> spotLights)
+    {
+        ONYX_PROFILE_FUNCTION;
+
+        const Matrix4<onyxF32>& viewMatrix = viewConstants.ViewMatrix;
+        const auto isInFrustum = [&](CulledLight& light)
+        {
+            for (const Vector4f32& plane : m_FrustumPlanes)
+            {
+                if (Vector3f32(plane).Dot(light.Position) < -light.Radius)
+                    return false;
+            }
+
+            return GetSliceRange(-light.Position[2], light.Radius, light.FirstSlice, light.LastSlice);
+        };
+
+        m_PointLights.clear();
+        for (onyxU32 i = 0; i < pointLights.size(); ++i)
+        {
+            const PointLight& pointLight = pointLights[i];
+            if (pointLight.IsEnabled == 0)
+                continue;
+
+            CulledLight light;
+            light.Index = i;
+            light.Position = Vector3f32(viewMatrix * Vector4f32(pointLight.Position, 1.0f));
+            light.Radius = pointLight.Radius;
+
+            if (isInFrustum(light))
+                m_PointLights.push_back(light);
+        }
+
+        m_SpotLights.clear();
+        for (onyxU32 i = 0; i < spotLights.size(); ++i)
+        {
+            const SpotLight& spotLight = spotLights[i];
+
+            // the range sphere around the light bounds the cone
+            CulledLight light;
+            light.Index = i;
+            light.Position = Vector3f32(viewMatrix * Vector4f32(spotLight.Position, 1.0f));
+            light.Radius = spotLight.Range;
+
+            if (isInFrustum(light) == false)
+                continue;
+
+            // Angle is the full cone angle in degrees
+            const onyxF32 halfAngle = std::clamp(spotLight.Angle * 0.5f, 0.0f, 90.0f) * (std::numbers::pi_v<onyxF32> / 180.0f);
+            light.Direction = Vector3f32(viewMatrix * Vector4f32(spotLight.Direction, 0.0f)).Normalized();
+            light.CosAngle = std::cos(halfAngle);
+            light.SinAngle = std::sin(halfAngle);
+            m_SpotLights.push_back(light);
+        }
+    }
+
+    bool LightClusterBuilder::GetSliceRange(onyxF32 depth, onyxF32 radius, onyxU32& outFirstSlice, onyxU32& outLastSlice) const
+    {
+        const onyxF32 minDepth = std::max(depth - radius, m_Near);
+        const onyxF32 maxDepth = std::min(depth + radius, m_Far);
+        if (minDepth > maxDepth)
+            return false;
+
+        // inverse of the exponential slice distribution, slightly widened so a sphere touching a slice border is not lost to rounding
+        const onyxF32 sliceScale = static_cast<onyxF32>(m_Settings.ClustersZ) / std::log(m_Far / m_Near);
+        const auto getSlice = [&](onyxF32 sliceDepth)
+        {
+            const onyxF32 slice = std::floor(std::log(std::max(sliceDepth, m_Near) / m_Near) * sliceScale);
+            return static_cast<onyxU32>(std::clamp(slice, 0.0f, static_cast<onyxF32>(m_Settings.ClustersZ - 1)));
+        };
+
+        outFirstSlice = getSlice(minDepth * 0.999f);
+        outLastSlice = getSlice(maxDepth * 1.001f);
+        return true;
+    }
+
+    void LightClusterBuilder::TestSpheres(const ClusterBoundsSoA& bounds, onyxU64 first, onyxU32 count, const CulledLight& light, onyxU64* outMask)
+    {
+#if ONYX_LIGHT_CLUSTER_SSE
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 centerX = _mm_set1_ps(light.Position[0]);
+        const __m128 centerY = _mm_set1_ps(light.Position[1]);
+        const __m128 centerZ = _mm_set1_ps(light.Position[2]);
+        const __m128 radiusSquared = _mm_set1_ps(light.Radius * light.Radius);
+
+        for (onyxU32 i = 0; i < count; i += CLUSTER_BATCH_SIZE)
+        {
+            const onyxU64 index = first + i;
+
+            // distance to the box per axis, only one of the two terms can be positive
+            const __m128 distanceX = _mm_add_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&bounds.MinX[index]), centerX), zero), _mm_max_ps(_mm_sub_ps(centerX, _mm_loadu_ps(&bounds.MaxX[index])), zero));
+            const __m128 distanceY = _mm_add_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&bounds.MinY[index]), centerY), zero), _mm_max_ps(_mm_sub_ps(centerY, _mm_loadu_ps(&bounds.MaxY[index])), zero));
+            const __m128 distanceZ = _mm_add_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&bounds.MinZ[index]), centerZ), zero), _mm_max_ps(_mm_sub_ps(centerZ, _mm_loadu_ps(&bounds.MaxZ[index])), zero));
+
+            const __m128 distanceSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(distanceX, distanceX), _mm_mul_ps(distanceY, distanceY)), _mm_mul_ps(distanceZ, distanceZ));
+            const onyxU64 overlapBits = static_cast<onyxU64>(_mm_movemask_ps(_mm_cmple_ps(distanceSquared, radiusSquared)));
+            outMask[i / 64] |= overlapBits << (i % 64);
+        }
+#else
+        const onyxF32 radiusSquared = light.Radius * light.Radius;
+        for (onyxU32 i = 0; i < count; ++i)
+        {
+            const onyxU64 index = first + i;
+            const onyxF32 distanceX = std::max(bounds.MinX[index] - light.Position[0], 0.0f) + std::max(light.Position[0] - bounds.MaxX[index], 0.0f);
+            const onyxF32 distanceY = std::max(bounds.MinY[index] - light.Position[1], 0.0f) + std::max(light.Position[1] - bounds.MaxY[index], 0.0f);
+            const onyxF32 distanceZ = std::max(bounds.MinZ[index] - light.Position[2], 0.0f) + std::max(light.Position[2] - bounds.MaxZ[index], 0.0f);
+
+            if ((distanceX * distanceX + distanceY * distanceY + distanceZ * distanceZ) <= radiusSquared)
+                outMask[i / 64] |= 1ull << (i % 64);
+        }
+#endif
+    }
+
+    void LightClusterBuilder::TestCones(const ClusterBoundsSoA& bounds, onyxU64 first, onyxU32 count, const CulledLight& light, onyxU64* outMask)
+    {
+        // cone against the bounding sphere of the cluster, see https://bartwronski.com/2017/04/13/cull-that-cone/
+#if ONYX_LIGHT_CLUSTER_SSE
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 positionX = _mm_set1_ps(light.Position[0]);
+        const __m128 positionY = _mm_set1_ps(light.Position[1]);
+        const __m128 positionZ = _mm_set1_ps(light.Position[2]);
+        const __m128 directionX = _mm_set1_ps(light.Direction[0]);
+        const __m128 directionY = _mm_set1_ps(light.Direction[1]);
+        const __m128 directionZ = _mm_set1_ps(light.Direction[2]);
+        const __m128 cosAngle = _mm_set1_ps(light.CosAngle);
+        const __m128 sinAngle = _mm_set1_ps(light.SinAngle);
+        const __m128 range = _mm_set1_ps(light.Radius);
+
+        for (onyxU32 i = 0; i < count; i += CLUSTER_BATCH_SIZE)
+        {
+            const onyxU64 index = first + i;
+            const __m128 sphereRadius = _mm_loadu_ps(&bounds.Radius[index]);
+
+            const __m128 toClusterX = _mm_sub_ps(_mm_loadu_ps(&bounds.CenterX[index]), positionX);
+            const __m128 toClusterY = _mm_sub_ps(_mm_loadu_ps(&bounds.CenterY[index]), positionY);
+            const __m128 toClusterZ = _mm_sub_ps(_mm_loadu_ps(&bounds.CenterZ[index]), positionZ);
+
+            const __m128 lengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(toClusterX, toClusterX), _mm_mul_ps(toClusterY, toClusterY)), _mm_mul_ps(toClusterZ, toClusterZ));
+            const __m128 axisDistance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(toClusterX, directionX), _mm_mul_ps(toClusterY, directionY)), _mm_mul_ps(toClusterZ, directionZ));
+            const __m128 axisOffset = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(lengthSquared, _mm_mul_ps(axisDistance, axisDistance)), zero));
+            const __m128 closestDistance = _mm_sub_ps(_mm_mul_ps(cosAngle, axisOffset), _mm_mul_ps(axisDistance, sinAngle));
+
+            const __m128 angleCull = _mm_cmpgt_ps(closestDistance, sphereRadius);
+            const __m128 frontCull = _mm_cmpgt_ps(axisDistance, _mm_add_ps(sphereRadius, range));
+            const __m128 backCull = _mm_cmplt_ps(axisDistance, _mm_sub_ps(zero, sphereRadius));
+
+            const onyxU64 culledBits = static_cast<onyxU64>(_mm_movemask_ps(_mm_or_ps(_mm_or_ps(angleCull, frontCull), backCull)));
+            outMask[i / 64] |= (~culledBits & 0xF) << (i % 64);
+        }
+#else
+        for (onyxU32 i = 0; i < count; ++i)
+        {
+            const onyxU64 index = first + i;
+            const onyxF32 sphereRadius = bounds.Radius[index];
+
+            const onyxF32 toClusterX = bounds.CenterX[index] - light.Position[0];
+            const onyxF32 toClusterY = bounds.CenterY[index] - light.Position[1];
+            const onyxF32 toClusterZ = bounds.CenterZ[index] - light.Position[2];
+
+            const onyxF32 lengthSquared = toClusterX * toClusterX + toClusterY * toClusterY + toClusterZ * toClusterZ;
+            const onyxF32 axisDistance = toClusterX * light.Direction[0] + toClusterY * light.Direction[1] + toClusterZ * light.Direction[2];
+            const onyxF32 axisOffset = std::sqrt(std::max(lengthSquared - axisDistance * axisDistance, 0.0f));
+            const onyxF32 closestDistance = light.CosAngle * axisOffset - axisDistance * light.SinAngle;
+
+            const bool isCulled = (closestDistance > sphereRadius) || (axisDistance > sphereRadius + light.Radius) || (axisDistance < -sphereRadius);
+            if (isCulled == false)
+                outMask[i / 64] |= 1ull << (i % 64);
+        }
+#endif
+    }
+
+    void LightClusterBuilder::TestSlice(onyxU32 slice)
+    {
+        SliceAssignment& assignment = m_Slices[slice];
+        const onyxU64 first = static_cast<onyxU64>(slice) * m_SliceStride;
+
+        const auto testLights = [&](const DynamicArray<CulledLight>& lights, DynamicArray<onyxU32>& outLights, DynamicArray<onyxU64>& outMasks, auto&& testFunctor)
+        {
+            outLights.clear();
+            outMasks.clear();
+            for (const CulledLight& light : lights)
+            {
+                if ((slice < light.FirstSlice) || (slice > light.LastSlice))
+                    continue;
+
+                outLights.push_back(light.Index);
+                outMasks.resize(outMasks.size() + m_MaskWordsPerSlice, 0);
+                testFunctor(m_Bounds, first, m_SliceStride, light, outMasks.data() + (outMasks.size() - m_MaskWordsPerSlice));
+            }
+        };
+
+        testLights(m_PointLights, assignment.PointLights, assignment.PointLightMasks, &LightClusterBuilder::TestSpheres);
+        testLights(m_SpotLights, assignment.SpotLights, assignment.SpotLightMasks, &LightClusterBuilder::TestCones);
+
+        // the padding at the end of a slice is never counted
+        const onyxU32 sliceClusterCount = m_Settings.ClustersX * m_Settings.ClustersY;
+        const auto countLights = [&](onyxU32 cluster, onyxU64 lightCount, const DynamicArray<onyxU64>& masks)
+        {
+            onyxU32 count = 0;
+            for (onyxU64 i = 0; i < lightCount; ++i)
+                count += static_cast<onyxU32>((masks[i * m_MaskWordsPerSlice + cluster / 64] >> (cluster % 64)) & 1);
+
+            return std::min(count, m_Settings.MaxLightsPerCluster);
+        };
+
+        for (onyxU32 cluster = 0; cluster < sliceClusterCount; ++cluster)
+        {
+            LightGridCell& cell = m_LightGrid[slice * sliceClusterCount + cluster];
+            cell.PointLightCount = countLights(cluster, assignment.PointLights.size(), assignment.PointLightMasks);
+            cell.SpotLightCount = countLights(cluster, assignment.SpotLights.size(), assignment.SpotLightMasks);
+        }
+    }
+
+    void LightClusterBuilder::WriteSlice(onyxU32 slice)
+    {
+        const SliceAssignment& assignment = m_Slices[slice];
+        const onyxU32 sliceClusterCount = m_Settings.ClustersX * m_Settings.ClustersY;
+
+        for (onyxU32 cluster = 0; cluster < sliceClusterCount; ++cluster)
+        {
+            const LightGridCell& cell = m_LightGrid[slice * sliceClusterCount + cluster];
+            const onyxU64 word = cluster / 64;
+            const onyxU64 bit = 1ull << (cluster % 64);
+
+            // lights are stored in index order, which keeps the list deterministic
+            onyxU32 written = 0;
+            for (onyxU64 i = 0; (i < assignment.PointLights.size()) && (written < cell.PointLightCount); ++i)
+            {
+                if (assignment.PointLightMasks[i * m_MaskWordsPerSlice + word] & bit)
+                    m_LightIndices[cell.PointLightOffset + written++].PointLightIndex = assignment.PointLights[i];
+            }
+
+            written = 0;
+            for (onyxU64 i = 0; (i < assignment.SpotLights.size()) && (written < cell.SpotLightCount); ++i)
+            {
+                if (assignment.SpotLightMasks[i * m_MaskWordsPerSlice + word] & bit)
+                    m_LightIndices[cell.SpotLightOffset + written++].SpotLightIndex = assignment.SpotLights[i];
+            }
+        }
+    }
+
+    template <typename Functor>
+    void LightClusterBuilder::ForEachSlice(Functor&& functor)
+    {
+        const onyxU32 sliceCount = m_Settings.ClustersZ;
+        const onyxU64 lightCount = m_PointLights.size() + m_SpotLights.size();
+        if ((m_Settings.UseWorkerThreads == false) || (lightCount < m_Settings.MinLightsForWorkerThreads))
+        {
+            for (onyxU32 slice = 0; slice < sliceCount; ++slice)
+                functor(slice);
+
+            return;
+        }
+
+        // the render thread works on the slices as well and only waits for slices that are already being processed
+        Threading::ParallelFor(Threading::DefaultThreadPool, sliceCount, functor);
+    }
+}
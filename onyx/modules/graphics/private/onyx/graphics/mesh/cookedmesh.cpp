@@ -0,0 +1,132 @@
+#include <onyx/graphics/mesh/cookedmesh.h>
+
+#include <onyx/graphics/mesh/objmeshimporter.h>
+#include <onyx/filesystem/filestream.h>
+#include <onyx/filesystem/memorymappedfile.h>
+#include <onyx/stream/memorystream.h>
+
+namespace Onyx::Graphics
+{
+    namespace
+    {
+        template <typename T>
+        bool ReadArray(const Stream& inStream, DynamicArray<T>& outArray)
+        {
+            onyxU64 count = 0;
+            if (inStream.GetRemainingLength() < sizeof(count))
+                return false;
+
+            inStream.Read(count);
+            if (count > (inStream.GetRemainingLength() / sizeof(T)))
+                return false;
+
+            outArray.clear();
+            if (count != 0)
+                inStream.Read(outArray, count);
+
+            return true;
+        }
+
+        // cooked files are untrusted input, every index has to stay inside the arrays it points into
+        bool HasValidIndices(const CookedMesh& mesh)
+        {
+            const onyxU64 vertexCount = mesh.Vertices.size();
+            for (onyxU32 index : mesh.Indices)
+            {
+                if (index >= vertexCount)
+                    return false;
+            }
+
+            for (onyxU32 index : mesh.Meshlets.MeshletVertices)
+            {
+                if (index >= vertexCount)
+                    return false;
+            }
+
+            for (const Meshlet& meshlet : mesh.Meshlets.Meshlets)
+            {
+                if ((static_cast<onyxU64>(meshlet.VertexOffset) + meshlet.VertexCount) > mesh.Meshlets.MeshletVertices.size())
+                    return false;
+
+                const onyxU64 triangleIndexCount = static_cast<onyxU64>(meshlet.TriangleCount) * 3;
+                if ((static_cast<onyxU64>(meshlet.TriangleOffset) + triangleIndexCount) > mesh.Meshlets.MeshletTriangles.size())
+                    return false;
+
+                for (onyxU64 i = 0; i < triangleIndexCount; ++i)
+                {
+                    if (mesh.Meshlets.MeshletTriangles[meshlet.TriangleOffset + i] >= meshlet.VertexCount)
+                        return false;
+                }
+            }
+
+            return true;
+        }
+    }
+
+    void CookedMesh::Cook(IndexedMesh&& mesh, CookedMesh& outCookedMesh)
+    {
+        MeshOptimizer::OptimizeVertexCache(mesh.Indices, static_cast<onyxU32>(mesh.Vertices.size()));
+        MeshOptimizer::OptimizeVertexFetch(mesh.Vertices, mesh.Indices);
+
+        outCookedMesh.Vertices = std::move(mesh.Vertices);
+        outCookedMesh.Indices = std::move(mesh.Indices);
+        MeshOptimizer::BuildMeshlets(outCookedMesh.Vertices, outCookedMesh.Indices, outCookedMesh.Meshlets);
+    }
+
+    bool CookedMesh::Load(const FilePath& path)
+    {
+        FileSystem::MemoryMappedFile mappedFile(path);
+        if (mappedFile.IsValid() == false)
+            return false;
+
+        MemoryStream stream(mappedFile.GetData(), mappedFile.GetSize());
+        return Deserialize(stream);
+    }
+
+    bool CookedMesh::Save(const FilePath& path) const
+    {
+        MemoryStream stream;
+        Serialize(stream);
+
+        FileSystem::FileStream fileStream(path, FileSystem::OpenMode::Write | FileSystem::OpenMode::Binary);
+        if (fileStream.IsValid() == false)
+            return false;
+
+        const DynamicArray<char>& buffer = stream.GetBuffer();
+        fileStream.WriteRaw(buffer.data(), buffer.size());
+        return fileStream.IsValid();
+    }
+
+    void CookedMesh::Serialize(Stream& outStream) const
+    {
+        outStream.Write(MAGIC);
+        outStream.Write(VERSION);
+
+        outStream.WriteRaw(Vertices);
+        outStream.WriteRaw(Indices);
+        outStream.WriteRaw(Meshlets.Meshlets);
+        outStream.WriteRaw(Meshlets.MeshletVertices);
+        outStream.WriteRaw(Meshlets.MeshletTriangles);
+    }
+
+    bool CookedMesh::Deserialize(const Stream& inStream)
+    {
+        onyxU32 magic = 0;
+        onyxU32 version = 0;
+        if (inStream.GetRemainingLength() < (sizeof(magic) + sizeof(version)))
+            return false;
+
+        inStream.Read(magic);
+        inStream.Read(version);
+        if ((magic != MAGIC) || (version != VERSION))
+            return false;
+
+        const bool hasReadArrays = ReadArray(inStream, Vertices) &&
+                                   ReadArray(inStream, Indices) &&
+                                   ReadArray(inStream, Meshlets.Meshlets) &&
+                                   ReadArray(inStream, Meshlets.MeshletVertices) &&
+                                   ReadArray(inStream, Meshlets.MeshletTriangles);
+
+        return hasReadArrays && HasValidIndices(*this);
+    }
+}
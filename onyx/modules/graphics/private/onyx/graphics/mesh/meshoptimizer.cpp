@@ -0,0 +1,324 @@
+#include <onyx/graphics/mesh/meshoptimizer.h>
+
+namespace Onyx::Graphics::MeshOptimizer
+{
+    namespace
+    {
+        constexpr onyxF32 CACHE_DECAY_POWER = 1.5f;
+        constexpr onyxF32 LAST_TRIANGLE_SCORE = 0.75f;
+        constexpr onyxF32 VALENCE_BOOST_SCALE = 2.0f;
+        constexpr onyxF32 VALENCE_BOOST_POWER = 0.5f;
+        constexpr onyxU32 MAX_PRECOMPUTED_VALENCE = 32;
+
+        constexpr onyxU32 INVALID_TRIANGLE = onyxMax_U32;
+        constexpr onyxU8 INVALID_LOCAL_INDEX = onyxMax_U8;
+
+        struct VertexScoreTables
+        {
+            VertexScoreTables()
+            {
+                for (onyxU32 i = 0; i < VERTEX_CACHE_SIZE; ++i)
+                {
+                    // the vertices of the last triangle get a fixed score so the next triangle does not reuse all of them
+                    if (i < 3)
+                    {
+                        CacheScores[i] = LAST_TRIANGLE_SCORE;
+                    }
+                    else
+                    {
+                        const onyxF32 scaler = 1.0f / static_cast<onyxF32>(VERTEX_CACHE_SIZE - 3);
+                        CacheScores[i] = std::pow(1.0f - static_cast<onyxF32>(i - 3) * scaler, CACHE_DECAY_POWER);
+                    }
+                }
+
+                ValenceScores[0] = 0.0f;
+                for (onyxU32 i = 1; i < MAX_PRECOMPUTED_VALENCE; ++i)
+                {
+                    // boost vertices with few remaining triangles to get rid of lone triangles
+                    ValenceScores[i] = VALENCE_BOOST_SCALE * std::pow(static_cast<onyxF32>(i), -VALENCE_BOOST_POWER);
+                }
+            }
+
+            onyxF32 GetScore(onyxS32 cachePosition, onyxU32 remainingValence) const
+            {
+                if (remainingValence == 0)
+                    return -1.0f;
+
+                onyxF32 score = (cachePosition < 0) ? 0.0f : CacheScores[cachePosition];
+                score += ValenceScores[std::min(remainingValence, MAX_PRECOMPUTED_VALENCE - 1)];
+                return score;
+            }
+
+            Array<onyxF32, VERTEX_CACHE_SIZE> CacheScores;
+            Array<onyxF32, MAX_PRECOMPUTED_VALENCE> ValenceScores;
+        };
+
+        const VertexScoreTables& GetScoreTables()
+        {
+            static const VertexScoreTables tables;
+            return tables;
+        }
+    }
+
+    void OptimizeVertexCache(DynamicArray<onyxU32>& indices, onyxU32 vertexCount)
+    {
+        const onyxU32 triangleCount = static_cast<onyxU32>(indices.size() / 3);
+        if (triangleCount == 0)
+            return;
+
+        const VertexScoreTables& scoreTables = GetScoreTables();
+
+        // build vertex to triangle adjacency
+        DynamicArray<onyxU32> remainingValence(vertexCount, 0);
+        for (onyxU32 index : indices)
+            ++remainingValence[index];
+
+        DynamicArray<onyxU32> adjacencyOffsets(vertexCount + 1, 0);
+        for (onyxU32 i = 0; i < vertexCount; ++i)
+            adjacencyOffsets[i + 1] = adjacencyOffsets[i] + remainingValence[i];
+
+        DynamicArray<onyxU32> adjacency(indices.size());
+        {
+            DynamicArray<onyxU32> writeCursor(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+            for (onyxU32 triangle = 0; triangle < triangleCount; ++triangle)
+            {
+                for (onyxU32 corner = 0; corner < 3; ++corner)
+                    adjacency[writeCursor[indices[triangle * 3 + corner]]++] = triangle;
+            }
+        }
+
+        DynamicArray<onyxS32> cachePositions(vertexCount, -1);
+        DynamicArray<onyxF32> vertexScores(vertexCount);
+        for (onyxU32 i = 0; i < vertexCount; ++i)
+            vertexScores[i] = scoreTables.GetScore(-1, remainingValence[i]);
+
+        DynamicArray<onyxF32> triangleScores(triangleCount);
+        DynamicArray<bool> isTriangleEmitted(triangleCount, false);
+        onyxU32 bestTriangle = 0;
+        for (onyxU32 triangle = 0; triangle < triangleCount; ++triangle)
+        {
+            triangleScores[triangle] = vertexScores[indices[triangle * 3]] + vertexScores[indices[triangle * 3 + 1]] + vertexScores[indices[triangle * 3 + 2]];
+            if (triangleScores[triangle] > triangleScores[bestTriangle])
+                bestTriangle = triangle;
+        }
+
+        DynamicArray<onyxU32> optimizedIndices;
+        optimizedIndices.reserve(indices.size());
+
+        Array<onyxU32, VERTEX_CACHE_SIZE + 3> cache;
+        Array<onyxU32, VERTEX_CACHE_SIZE + 3> newCache;
+        onyxU32 cacheCount = 0;
+        onyxU32 scanCursor = 0;
+
+        for (onyxU32 emittedCount = 0; emittedCount < triangleCount; ++emittedCount)
+        {
+            if (bestTriangle == INVALID_TRIANGLE)
+            {
+                // nothing in the cache references a remaining triangle, continue with the next unemitted one
+                while (isTriangleEmitted[scanCursor])
+                    ++scanCursor;
+
+                bestTriangle = scanCursor;
+            }
+
+            const onyxU32* triangleIndices = &indices[bestTriangle * 3];
+            optimizedIndices.insert(optimizedIndices.end(), triangleIndices, triangleIndices + 3);
+            isTriangleEmitted[bestTriangle] = true;
+
+            // remove the emitted triangle from the adjacency of its vertices
+            for (onyxU32 corner = 0; corner < 3; ++corner)
+            {
+                const onyxU32 vertex = triangleIndices[corner];
+                onyxU32* adjacencyBegin = &adjacency[adjacencyOffsets[vertex]];
+                onyxU32* adjacencyEnd = adjacencyBegin + remainingValence[vertex];
+                onyxU32* it = std::find(adjacencyBegin, adjacencyEnd, bestTriangle);
+                ONYX_ASSERT(it != adjacencyEnd);
+                std::swap(*it, *(adjacencyEnd - 1));
+                --remainingValence[vertex];
+            }
+
+            // move the triangle vertices to the front of the LRU cache
+            onyxU32 newCacheCount = 0;
+            for (onyxU32 corner = 0; corner < 3; ++corner)
+                newCache[newCacheCount++] = triangleIndices[corner];
+
+            for (onyxU32 i = 0; i < cacheCount; ++i)
+            {
+                const onyxU32 vertex = cache[i];
+                if ((vertex != triangleIndices[0]) && (vertex != triangleIndices[1]) && (vertex != triangleIndices[2]))
+                    newCache[newCacheCount++] = vertex;
+            }
+
+            // update scores of all vertices that were touched, evicted vertices lose their cache score
+            for (onyxU32 i = 0; i < newCacheCount; ++i)
+            {
+                const onyxU32 vertex = newCache[i];
+                cachePositions[vertex] = (i < VERTEX_CACHE_SIZE) ? static_cast<onyxS32>(i) : -1;
+
+                const onyxF32 newScore = scoreTables.GetScore(cachePositions[vertex], remainingValence[vertex]);
+                const onyxF32 scoreDelta = newScore - vertexScores[vertex];
+                vertexScores[vertex] = newScore;
+
+                const onyxU32 adjacencyBegin = adjacencyOffsets[vertex];
+                const onyxU32 adjacencyEnd = adjacencyBegin + remainingValence[vertex];
+                for (onyxU32 j = adjacencyBegin; j < adjacencyEnd; ++j)
+                    triangleScores[adjacency[j]] += scoreDelta;
+            }
+
+            // the next triangle is picked from the ones referencing cached vertices
+            bestTriangle = INVALID_TRIANGLE;
+            onyxF32 bestScore = -1.0f;
+            for (onyxU32 i = 0; i < std::min(newCacheCount, VERTEX_CACHE_SIZE); ++i)
+            {
+                const onyxU32 vertex = newCache[i];
+                const onyxU32 adjacencyBegin = adjacencyOffsets[vertex];
+                const onyxU32 adjacencyEnd = adjacencyBegin + remainingValence[vertex];
+                for (onyxU32 j = adjacencyBegin; j < adjacencyEnd; ++j)
+                {
+                    const onyxU32 triangle = adjacency[j];
+                    if (triangleScores[triangle] > bestScore)
+                    {
+                        bestScore = triangleScores[triangle];
+                        bestTriangle = triangle;
+                    }
+                }
+            }
+
+            cacheCount = std::min(newCacheCount, VERTEX_CACHE_SIZE);
+            std::copy_n(newCache.begin(), cacheCount, cache.begin());
+        }
+
+        indices = std::move(optimizedIndices);
+    }
+
+    void OptimizeVertexFetch(DynamicArray<Vertex>& vertices, DynamicArray<onyxU32>& indices)
+    {
+        DynamicArray<onyxU32> remap(vertices.size(), onyxMax_U32);
+        DynamicArray<Vertex> optimizedVertices;
+        optimizedVertices.reserve(vertices.size());
+
+        for (onyxU32& index : indices)
+        {
+            if (remap[index] == onyxMax_U32)
+            {
+                remap[index] = static_cast<onyxU32>(optimizedVertices.size());
+                optimizedVertices.push_back(vertices[index]);
+            }
+
+            index = remap[index];
+        }
+
+        // unreferenced vertices are dropped
+        vertices = std::move(optimizedVertices);
+    }
+
+    void BuildMeshlets(const DynamicArray<Vertex>& vertices, const DynamicArray<onyxU32>& indices, MeshletBuildResult& outResult, onyxU32 maxVertices, onyxU32 maxTriangles)
+    {
+        ONYX_ASSERT((maxVertices > 0) && (maxVertices < INVALID_LOCAL_INDEX), "Meshlet vertices have to be addressable with 8 bits.");
+        ONYX_ASSERT(maxTriangles > 0);
+
+        outResult.Meshlets.clear();
+        outResult.MeshletVertices.clear();
+        outResult.MeshletTriangles.clear();
+
+        const onyxU64 triangleCount = indices.size() / 3;
+        if (triangleCount == 0)
+            return;
+
+        outResult.MeshletTriangles.reserve(triangleCount * 3);
+        outResult.MeshletVertices.reserve(vertices.size() + vertices.size() / 2);
+
+        DynamicArray<onyxU8> localIndices(vertices.size(), INVALID_LOCAL_INDEX);
+
+        Meshlet meshlet;
+        const auto finishMeshlet = [&]()
+        {
+            if (meshlet.TriangleCount == 0)
+                return;
+
+            Vector3f32 min(std::numeric_limits<onyxF32>::max());
+            Vector3f32 max(std::numeric_limits<onyxF32>::lowest());
+            for (onyxU32 i = 0; i < meshlet.VertexCount; ++i)
+            {
+                const onyxU32 vertexIndex = outResult.MeshletVertices[meshlet.VertexOffset + i];
+                const Vector3f32& position = vertices[vertexIndex].Position;
+                min = Vector3f32(std::min(min.X, position.X), std::min(min.Y, position.Y), std::min(min.Z, position.Z));
+                max = Vector3f32(std::max(max.X, position.X), std::max(max.Y, position.Y), std::max(max.Z, position.Z));
+
+                localIndices[vertexIndex] = INVALID_LOCAL_INDEX;
+            }
+
+            meshlet.BoundsCenter = (min + max) * 0.5f;
+
+            onyxF32 radiusSquared = 0.0f;
+            for (onyxU32 i = 0; i < meshlet.VertexCount; ++i)
+            {
+                const Vector3f32& position = vertices[outResult.MeshletVertices[meshlet.VertexOffset + i]].Position;
+                radiusSquared = std::max(radiusSquared, static_cast<onyxF32>((position - meshlet.BoundsCenter).LengthSquared()));
+            }
+
+            meshlet.BoundsRadius = std::sqrt(radiusSquared);
+            outResult.Meshlets.push_back(meshlet);
+
+            meshlet = {};
+            meshlet.VertexOffset = static_cast<onyxU32>(outResult.MeshletVertices.size());
+            meshlet.TriangleOffset = static_cast<onyxU32>(outResult.MeshletTriangles.size());
+        };
+
+        for (onyxU64 triangle = 0; triangle < triangleCount; ++triangle)
+        {
+            const onyxU32* triangleIndices = &indices[triangle * 3];
+
+            onyxU32 newVertexCount = 0;
+            for (onyxU32 corner = 0; corner < 3; ++corner)
+            {
+                if (localIndices[triangleIndices[corner]] == INVALID_LOCAL_INDEX)
+                    ++newVertexCount;
+            }
+
+            if ((meshlet.VertexCount + newVertexCount > maxVertices) || (meshlet.TriangleCount + 1 > maxTriangles))
+            {
+                finishMeshlet();
+            }
+
+            for (onyxU32 corner = 0; corner < 3; ++corner)
+            {
+                const onyxU32 vertexIndex = triangleIndices[corner];
+                onyxU8& localIndex = localIndices[vertexIndex];
+                if (localIndex == INVALID_LOCAL_INDEX)
+                {
+                    localIndex = static_cast<onyxU8>(meshlet.VertexCount++);
+                    outResult.MeshletVertices.push_back(vertexIndex);
+                }
+
+                outResult.MeshletTriangles.push_back(localIndex);
+            }
+
+            ++meshlet.TriangleCount;
+        }
+
+        finishMeshlet();
+    }
+
+    onyxF32 GetAverageCacheMissRatio(const DynamicArray<onyxU32>& indices, onyxU32 vertexCount, onyxU32 cacheSize)
+    {
+        const onyxU64 triangleCount = indices.size() / 3;
+        if (triangleCount == 0)
+            return 0.0f;
+
+        // FIFO cache simulation, a vertex is a hit if it got inserted less than cacheSize misses ago
+        DynamicArray<onyxU32> insertionTime(vertexCount, 0);
+        onyxU32 time = cacheSize + 1;
+        onyxU32 misses = 0;
+        for (onyxU32 index : indices)
+        {
+            if (time - insertionTime[index] > cacheSize)
+            {
+                insertionTime[index] = time++;
+                ++misses;
+            }
+        }
+
+        return static_cast<onyxF32>(misses) / static_cast<onyxF32>(triangleCount);
+    }
+}
@@ -0,0 +1,470 @@
+#include <onyx/graphics/mesh/objmeshimporter.h>
+
+#include <onyx/filesystem/onyxfile.h>
+#include <onyx/thread/threadpool/parallelfor.h>
+
+#include <charconv>
+
+namespace Onyx::Graphics
+{
+    namespace
+    {
+        constexpr onyxU64 MIN_PARALLEL_CHUNK_SIZE = 1024 * 1024;
+
+        enum ObjAttribute : onyxU8
+        {
+            Position = 0,
+            TexCoord = 1,
+            Normal = 2,
+            Count = 3
+        };
+
+        struct ObjCorner
+        {
+            // Indices as written in the file (1 based, 0 if missing).
+            // Relative (negative) indices are stored relative to the start of the chunk and flagged in RelativeMask.
+            onyxS32 Indices[ObjAttribute::Count] = { 0, 0, 0 };
+            onyxU8 RelativeMask = 0;
+        };
+
+        struct ObjCornerKey
+        {
+            onyxS32 Indices[ObjAttribute::Count];
+
+            bool operator==(const ObjCornerKey& other) const
+            {
+                return (Indices[0] == other.Indices[0]) && (Indices[1] == other.Indices[1]) && (Indices[2] == other.Indices[2]);
+            }
+        };
+
+        struct ObjChunk
+        {
+            StringView Source;
+
+            DynamicArray<Vector3f32> Positions;
+            DynamicArray<Vector2f32> TexCoords;
+            DynamicArray<Vector3f32> Normals;
+
+            // 3 corners per triangle
+            DynamicArray<ObjCorner> Corners;
+
+            onyxU64 FailedLine = 0;
+        };
+
+        bool IsHorizontalWhitespace(char c)
+        {
+            return (c == ' ') || (c == '\t') || (c == '\r');
+        }
+
+        const char* SkipHorizontalWhitespace(const char* cursor, const char* end)
+        {
+            while ((cursor < end) && IsHorizontalWhitespace(*cursor))
+                ++cursor;
+
+            return cursor;
+        }
+
+        bool ParseFloat(const char*& cursor, const char* end, onyxF32& outValue)
+        {
+            cursor = SkipHorizontalWhitespace(cursor, end);
+            if ((cursor < end) && (*cursor == '+'))
+                ++cursor;
+
+            const std::from_chars_result result = std::from_chars(cursor, end, outValue);
+            if (result.ec != std::errc{})
+                return false;
+
+            cursor = result.ptr;
+            return true;
+        }
+
+        bool ParseIndex(const char*& cursor, const char* end, onyxS32& outValue)
+        {
+            if ((cursor < end) && (*cursor == '+'))
+                ++cursor;
+
+            const std::from_chars_result result = std::from_chars(cursor, end, outValue);
+            if ((result.ec != std::errc{}) || (outValue == 0))
+                return false;
+
+            cursor = result.ptr;
+            return true;
+        }
+
+        // Parses one face corner (v, v/vt, v//vn or v/vt/vn)
+        bool ParseCorner(const char*& cursor, const char* end, const Array<onyxS32, ObjAttribute::Count>& elementCounts, ObjCorner& outCorner)
+        {
+            outCorner = {};
+
+            for (onyxU8 attribute = ObjAttribute::Position; attribute < ObjAttribute::Count; ++attribute)
+            {
+                if (attribute != ObjAttribute::Position)
+                {
+                    if ((cursor >= end) || (*cursor != '/'))
+                        break;
+
+                    ++cursor;
+
+                    // empty attribute e.g.: v//vn
+                    if ((cursor < end) && (*cursor == '/'))
+                        continue;
+                }
+
+                onyxS32& index = outCorner.Indices[attribute];
+                if (ParseIndex(cursor, end, index) == false)
+                    return false;
+
+                if (index < 0)
+                {
+                    index += elementCounts[attribute];
+                    outCorner.RelativeMask |= static_cast<onyxU8>(1u << attribute);
+                }
+            }
+
+            return (cursor >= end) || IsHorizontalWhitespace(*cursor);
+        }
+
+        bool ParseFace(const char* cursor, const char* lineEnd, ObjChunk& chunk)
+        {
+            const Array<onyxS32, ObjAttribute::Count> elementCounts
+            {
+                static_cast<onyxS32>(chunk.Positions.size()),
+                static_cast<onyxS32>(chunk.TexCoords.size()),
+                static_cast<onyxS32>(chunk.Normals.size()),
+            };
+
+            ObjCorner first;
+            ObjCorner previous;
+            ObjCorner current;
+            onyxU32 cornerCount = 0;
+
+            while (true)
+            {
+                cursor = SkipHorizontalWhitespace(cursor, lineEnd);
+                if (cursor >= lineEnd)
+                    break;
+
+                if (ParseCorner(cursor, lineEnd, elementCounts, current) == false)
+                    return false;
+
+                // triangulate as fan around the first corner
+                if (cornerCount == 0)
+                {
+                    first = current;
+                }
+                else if (cornerCount >= 2)
+                {
+                    chunk.Corners.push_back(first);
+                    chunk.Corners.push_back(previous);
+                    chunk.Corners.push_back(current);
+                }
+
+                previous = current;
+                ++cornerCount;
+            }
+
+            return cornerCount >= 3;
+        }
+
+        void ParseChunk(ObjChunk& chunk)
+        {
+            const char* cursor = chunk.Source.data();
+            const char* end = cursor + chunk.Source.size();
+
+            onyxU64 lineNumber = 0;
+            while (cursor < end)
+            {
+                ++lineNumber;
+
+                const char* lineEnd = static_cast<const char*>(std::memchr(cursor, '\n', static_cast<size_t>(end - cursor)));
+                if (lineEnd == nullptr)
+                    lineEnd = end;
+
+                cursor = SkipHorizontalWhitespace(cursor, lineEnd);
+
+                bool success = true;
+                const onyxU64 remaining = static_cast<onyxU64>(lineEnd - cursor);
+                if ((remaining >= 2) && (cursor[0] == 'v'))
+                {
+                    if (IsHorizontalWhitespace(cursor[1]))
+                    {
+                        const char* valueCursor = cursor + 1;
+                        Vector3f32& position = chunk.Positions.emplace_back();
+                        success = ParseFloat(valueCursor, lineEnd, position.X) &&
+                                  ParseFloat(valueCursor, lineEnd, position.Y) &&
+                                  ParseFloat(valueCursor, lineEnd, position.Z);
+                    }
+                    else if ((cursor[1] == 't') && (remaining >= 3) && IsHorizontalWhitespace(cursor[2]))
+                    {
+                        // vt u [v] [w], the optional depth of 3d texture coordinates is ignored
+                        const char* valueCursor = cursor + 2;
+                        Vector2f32& texCoord = chunk.TexCoords.emplace_back();
+                        success = ParseFloat(valueCursor, lineEnd, texCoord.X);
+                        if (success && (ParseFloat(valueCursor, lineEnd, texCoord.Y) == false))
+                            texCoord.Y = 0.0f;
+                    }
+                    else if ((cursor[1] == 'n') && (remaining >= 3) && IsHorizontalWhitespace(cursor[2]))
+                    {
+                        const char* valueCursor = cursor + 2;
+                        Vector3f32& normal = chunk.Normals.emplace_back();
+                        success = ParseFloat(valueCursor, lineEnd, normal.X) &&
+                                  ParseFloat(valueCursor, lineEnd, normal.Y) &&
+                                  ParseFloat(valueCursor, lineEnd, normal.Z);
+                    }
+                }
+                else if ((remaining >= 2) && (cursor[0] == 'f') && IsHorizontalWhitespace(cursor[1]))
+                {
+                    success = ParseFace(cursor + 1, lineEnd, chunk);
+                }
+                // comments, groups, smoothing groups and materials are ignored
+
+                if (success == false)
+                {
+                    chunk.FailedLine = lineNumber;
+                    return;
+                }
+
+                cursor = lineEnd + 1;
+            }
+        }
+
+        void SplitIntoChunks(StringView source, const ObjImportOptions& options, DynamicArray<ObjChunk>& outChunks)
+        {
+            onyxU64 chunkCount = 1;
+            if (source.size() >= options.ParallelParseThreshold)
+            {
+                const onyxU64 maxChunks = (options.MaxParseChunks != 0) ? options.MaxParseChunks : std::max(1u, std::thread::hardware_concurrency());
+                chunkCount = std::clamp<onyxU64>(source.size() / MIN_PARALLEL_CHUNK_SIZE, 1, maxChunks);
+            }
+
+            outChunks.resize(chunkCount);
+
+            onyxU64 chunkStart = 0;
+            for (onyxU64 i = 0; i < chunkCount; ++i)
+            {
+                onyxU64 chunkEnd = source.size();
+                if (i + 1 < chunkCount)
+                {
+                    // chunks always end after a line break
+                    chunkEnd = std::max(chunkStart, (source.size() * (i + 1)) / chunkCount);
+                    const onyxU64 lineBreak = source.find('\n', chunkEnd);
+                    chunkEnd = (lineBreak == StringView::npos) ? source.size() : (lineBreak + 1);
+                }
+
+                outChunks[i].Source = source.substr(chunkStart, chunkEnd - chunkStart);
+                chunkStart = chunkEnd;
+            }
+        }
+
+        void ParseChunks(DynamicArray<ObjChunk>& chunks)
+        {
+            // imports run on pool threads as well, the calling thread parses chunks itself instead of waiting for queued tasks
+            Threading::ParallelFor(Threading::DefaultThreadPool, static_cast<onyxU32>(chunks.size()), [&chunks](onyxU32 index)
+            {
+                ParseChunk(chunks[index]);
+            });
+        }
+
+        // Open addressing table mapping unique corners to vertex indices
+        class CornerDeduplicationTable
+        {
+        public:
+            explicit CornerDeduplicationTable(onyxU64 expectedCount)
+            {
+                m_Slots.resize(std::bit_ceil(std::max<onyxU64>(16, expectedCount * 2)), INVALID_SLOT);
+                m_Keys.reserve(expectedCount);
+            }
+
+            // returns the vertex index and whether the corner was inserted
+            std::pair<onyxU32, bool> FindOrInsert(const ObjCornerKey& key)
+            {
+                if ((m_Keys.size() + 1) * 2 > m_Slots.size())
+                    Grow();
+
+                onyxU64 slot = FindSlot(key);
+                if (m_Slots[slot] != INVALID_SLOT)
+                    return { m_Slots[slot], false };
+
+                const onyxU32 index = static_cast<onyxU32>(m_Keys.size());
+                m_Slots[slot] = index;
+                m_Keys.push_back(key);
+                return { index, true };
+            }
+
+        private:
+            static constexpr onyxU32 INVALID_SLOT = onyxMax_U32;
+
+            static onyxU64 Hash(const ObjCornerKey& key)
+            {
+                onyxU64 hash = static_cast<onyxU32>(key.Indices[0]) * 0x9E3779B97F4A7C15ull;
+                hash ^= static_cast<onyxU32>(key.Indices[1]) * 0xC2B2AE3D27D4EB4Full;
+                hash ^= static_cast<onyxU32>(key.Indices[2]) * 0x165667B19E3779F9ull;
+                return hash ^ (hash >> 29);
+            }
+
+            onyxU64 FindSlot(const ObjCornerKey& key) const
+            {
+                const onyxU64 mask = m_Slots.size() - 1;
+                onyxU64 slot = Hash(key) & mask;
+                while ((m_Slots[slot] != INVALID_SLOT) && ((m_Keys[m_Slots[slot]] == key) == false))
+                    slot = (slot + 1) & mask;
+
+                return slot;
+            }
+
+            void Grow()
+            {
+                m_Slots.assign(m_Slots.size() * 2, INVALID_SLOT);
+                for (onyxU32 i = 0; i < m_Keys.size(); ++i)
+                    m_Slots[FindSlot(m_Keys[i])] = i;
+            }
+
+        private:
+            DynamicArray<onyxU32> m_Slots;
+            DynamicArray<ObjCornerKey> m_Keys;
+        };
+
+        void GenerateNormals(IndexedMesh& mesh)
+        {
+            for (Vertex& vertex : mesh.Vertices)
+                vertex.Normal = Vector3f32::Zero();
+
+            for (onyxU64 i = 0; i + 2 < mesh.Indices.size(); i += 3)
+            {
+                Vertex& v0 = mesh.Vertices[mesh.Indices[i]];
+                Vertex& v1 = mesh.Vertices[mesh.Indices[i + 1]];
+                Vertex& v2 = mesh.Vertices[mesh.Indices[i + 2]];
+
+                // not normalized so larger triangles contribute more
+                const Vector3f32 faceNormal = (v1.Position - v0.Position).Cross(v2.Position - v0.Position);
+                v0.Normal += faceNormal;
+                v1.Normal += faceNormal;
+                v2.Normal += faceNormal;
+            }
+
+            for (Vertex& vertex : mesh.Vertices)
+            {
+                if (vertex.Normal.IsZero() == false)
+                    vertex.Normal.Normalize();
+            }
+        }
+    }
+
+    bool ObjMeshImporter::Import(const FilePath& path, IndexedMesh& outMesh, const ObjImportOptions& options)
+    {
+        FileSystem::OnyxFile meshSource(path);
+        FileSystem::MemoryMappedFile mappedFile = meshSource.Map();
+        if (mappedFile.IsValid() == false)
+        {
+            ONYX_LOG_ERROR("Failed to open mesh source {}", path.string());
+            return false;
+        }
+
+        return Import(mappedFile.GetView(), outMesh, options);
+    }
+
+    bool ObjMeshImporter::Import(StringView source, IndexedMesh& outMesh, const ObjImportOptions& options)
+    {
+        outMesh.Vertices.clear();
+        outMesh.Indices.clear();
+
+        DynamicArray<ObjChunk> chunks;
+        SplitIntoChunks(source, options, chunks);
+        ParseChunks(chunks);
+
+        // element offsets of each chunk, used to turn chunk relative indices into absolute ones
+        DynamicArray<Array<onyxS32, ObjAttribute::Count>> chunkOffsets(chunks.size());
+        Array<onyxS32, ObjAttribute::Count> totalCounts { 0, 0, 0 };
+        onyxU64 cornerCount = 0;
+        for (onyxU64 i = 0; i < chunks.size(); ++i)
+        {
+            const ObjChunk& chunk = chunks[i];
+            if (chunk.FailedLine != 0)
+            {
+                ONYX_LOG_ERROR("Failed parsing OBJ line {} of chunk {}", chunk.FailedLine, i);
+                return false;
+            }
+
+            chunkOffsets[i] = totalCounts;
+            totalCounts[ObjAttribute::Position] += static_cast<onyxS32>(chunk.Positions.size());
+            totalCounts[ObjAttribute::TexCoord] += static_cast<onyxS32>(chunk.TexCoords.size());
+            totalCounts[ObjAttribute::Normal] += static_cast<onyxS32>(chunk.Normals.size());
+            cornerCount += chunk.Corners.size();
+        }
+
+        // merge the attributes of all chunks, faces reference them by their absolute index
+        DynamicArray<Vector3f32> positions = std::move(chunks[0].Positions);
+        DynamicArray<Vector2f32> texCoords = std::move(chunks[0].TexCoords);
+        DynamicArray<Vector3f32> normals = std::move(chunks[0].Normals);
+        positions.reserve(totalCounts[ObjAttribute::Position]);
+        texCoords.reserve(totalCounts[ObjAttribute::TexCoord]);
+        normals.reserve(totalCounts[ObjAttribute::Normal]);
+
+        for (onyxU64 i = 1; i < chunks.size(); ++i)
+        {
+            positions.insert(positions.end(), chunks[i].Positions.begin(), chunks[i].Positions.end());
+            texCoords.insert(texCoords.end(), chunks[i].TexCoords.begin(), chunks[i].TexCoords.end());
+            normals.insert(normals.end(), chunks[i].Normals.begin(), chunks[i].Normals.end());
+        }
+
+        const bool hasNormals = normals.empty() == false;
+
+        CornerDeduplicationTable deduplicationTable(totalCounts[ObjAttribute::Position]);
+        outMesh.Indices.reserve(cornerCount);
+        outMesh.Vertices.reserve(totalCounts[ObjAttribute::Position]);
+
+        for (onyxU64 i = 0; i < chunks.size(); ++i)
+        {
+            for (const ObjCorner& corner : chunks[i].Corners)
+            {
+                ObjCornerKey key;
+                for (onyxU8 attribute = ObjAttribute::Position; attribute < ObjAttribute::Count; ++attribute)
+                {
+                    const onyxS32 index = corner.Indices[attribute];
+                    if ((corner.RelativeMask & (1u << attribute)) != 0)
+                        key.Indices[attribute] = chunkOffsets[i][attribute] + index;
+                    else
+                        key.Indices[attribute] = index - 1;
+
+                    // missing attributes are valid (-1), everything else has to be in range
+                    const bool isMissing = (index == 0) && ((corner.RelativeMask & (1u << attribute)) == 0);
+                    if ((isMissing == false) && ((key.Indices[attribute] < 0) || (key.Indices[attribute] >= totalCounts[attribute])))
+                    {
+                        ONYX_LOG_ERROR("OBJ face index {} is out of range.", index);
+                        outMesh.Indices.clear();
+                        outMesh.Vertices.clear();
+                        return false;
+                    }
+                }
+
+                if (key.Indices[ObjAttribute::Position] < 0)
+                {
+                    ONYX_LOG_ERROR("OBJ face is missing a position index.");
+                    outMesh.Indices.clear();
+                    outMesh.Vertices.clear();
+                    return false;
+                }
+
+                const auto [vertexIndex, isNewVertex] = deduplicationTable.FindOrInsert(key);
+                outMesh.Indices.push_back(vertexIndex);
+
+                if (isNewVertex)
+                {
+                    Vertex& vertex = outMesh.Vertices.emplace_back();
+                    vertex.Position = positions[key.Indices[ObjAttribute::Position]];
+
+                    if (key.Indices[ObjAttribute::TexCoord] >= 0)
+                        vertex.UV = texCoords[key.Indices[ObjAttribute::TexCoord]];
+
+                    if (key.Indices[ObjAttribute::Normal] >= 0)
+                        vertex.Normal = normals[key.Indices[ObjAttribute::Normal]];
+                }
+            }
+        }
+
+        if ((hasNormals == false) && options.GenerateMissingNormals)
+            GenerateNormals(outMesh);
+
+        return true;
+    }
+}
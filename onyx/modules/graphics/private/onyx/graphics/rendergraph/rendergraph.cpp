@@ -15,6 +15,26 @@ ONYX_PROFILE_CREATE_TAG(RenderGraph, 0x3ed694);
 
 namespace Onyx::Graphics
 {
+    namespace
+    {
+        TextureStorageProperties GetAttachmentStorageProperties(const Vector2s32& swapChainExtent, const RenderGraphTextureResourceInfo& resourceInfo)
+        {
+            TextureStorageProperties storageProperties;
+            storageProperties.m_Size = resourceInfo.HasSize ? resourceInfo.Size : Vector3s32(swapChainExtent, 1);
+            storageProperties.m_Format = resourceInfo.Format;
+            storageProperties.m_IsFrameBuffer = true;
+            storageProperties.m_IsTexture = true;
+            storageProperties.m_GpuAccess = GPUAccess::Write;
+            return storageProperties;
+        }
+
+        // resources can only alias memory of the same memory type and tiling
+        onyxU32 GetCompatibilityClass(const TextureMemoryRequirements& memoryRequirements)
+        {
+            return (memoryRequirements.MemoryTypeIndex << 1) | (memoryRequirements.IsOptimalTiling ? 1 : 0);
+        }
+    }
+
     void RenderGraph::Init(GraphicsSystem& graphicsSystem)
     {
         ONYX_PROFILE(RenderGraph);
@@ -22,36 +42,21 @@ namespace Onyx::Graphics
 
         // allocate all resources and descriptors?
         m_Graph.Compile();
-        
-        // Allocating resources
-        DynamicArray<RenderGraphResourceId> allocations;
-        DynamicArray<RenderGraphResourceId> deallocations;
 
-        HashMap<RenderGraphResourceId, onyxU32> resourceRefCounts;
+        // Collect the lifetimes of all transient attachments so they can be aliased
+        m_TransientResources.clear();
+        HashMap<RenderGraphResourceId, onyxU32> transientResourceIndices;
 
-        DynamicArray<RenderGraphResourceId> freeList;
+        const Vector2s32& swapChainExtent = graphicsSystem.GetSwapchainExtent();
 
         // Create render, framebuffers & pso's
         const auto topologicalOrder = m_Graph.GetTopologicalOrder();
-        for (const LocalNodeId nodeId : topologicalOrder)
-        {
-            IRenderGraphNode& graphNode = m_Graph.GetNode<IRenderGraphNode>(nodeId);
-            const onyxU32 inputPinCount = graphNode.GetInputPinCount();
-            for (onyxU32 i = 0; i < inputPinCount; ++i)
-            {
-                const NodeGraph::PinBase* inputPin = graphNode.GetInputPin(i);
-                if (inputPin->IsConnected() == false)
-                    continue;
-
-                ++resourceRefCounts[inputPin->GetLinkedPinGlobalId()];
-            }
-        }
-
-        for (const LocalNodeId nodeId : topologicalOrder)
+        const onyxU32 nodeCount = static_cast<onyxU32>(topologicalOrder.size());
+        for (onyxU32 nodeIndex = 0; nodeIndex < nodeCount; ++nodeIndex)
         {
-            const bool isLastNode = nodeId == topologicalOrder[(topologicalOrder.size() - 1)];
+            const bool isLastNode = nodeIndex == (nodeCount - 1);
 
-            IRenderGraphNode& graphNode = m_Graph.GetNode<IRenderGraphNode>(nodeId);
+            IRenderGraphNode& graphNode = m_Graph.GetNode<IRenderGraphNode>(topologicalOrder[nodeIndex]);
             // remove resource cache
             graphNode.Init(graphicsSystem, m_ResourceCache);
 
@@ -86,44 +91,63 @@ namespace Onyx::Graphics
                     continue;
                 }
 
-                if (CreateAttachment(graphicsSystem, output, freeList) == false)
-                {
-                    // TODO: Add info for node / which output resource etc.
-                    ONYX_LOG_WARNING("Failed creating output attachment for graph resource.");
-                    continue;
-                }
+                const TextureStorageProperties storageProperties = GetAttachmentStorageProperties(swapChainExtent, textureInfo);
+
+                TransientResourceLifetime& lifetime = m_TransientResources.emplace_back();
+                lifetime.Id = outputPin->GetGlobalId();
+                lifetime.Name = output.Info.Name;
+                const TextureMemoryRequirements memoryRequirements = graphicsSystem.GetTextureMemoryRequirements(storageProperties);
+                lifetime.Size = memoryRequirements.Size;
+                lifetime.Alignment = memoryRequirements.Alignment;
+                lifetime.CompatibilityClass = GetCompatibilityClass(memoryRequirements);
+                lifetime.FirstUse = nodeIndex;
+                lifetime.LastUse = nodeIndex;
+
+                transientResourceIndices[lifetime.Id] = static_cast<onyxU32>(m_TransientResources.size() - 1);
             }
 
             const onyxU32 inputPinCount = graphNode.GetInputPinCount();
             for (onyxU32 i = 0; i < inputPinCount; ++i)
             {
                 const NodeGraph::PinBase* inputPin = graphNode.GetInputPin(i);
-                // check for invalid ID
                 if (inputPin->IsConnected() == false)
                     continue;
 
-                Guid64 id = inputPin->GetLinkedPinGlobalId();
-                --resourceRefCounts[id];
+                auto it = transientResourceIndices.find(inputPin->GetLinkedPinGlobalId());
+                if (it == transientResourceIndices.end())
+                    continue;
 
-                RenderGraphResource& input = m_ResourceCache[id];
-                if ((input.IsExternal == false) && (resourceRefCounts[input.Info.Id] == 0))
-                {
-                    //deallocations.
-                    // Track deallocations?
-                    //if ((input.Info.Type == RenderGraphResourceType::Attachment) || (input.Info.Type == RenderGraphResourceType::Texture))
-                    //{
-                    //    const TextureHandle textureHandle = std::get<TextureHandle>(input.Handle);
-                    //    ONYX_ASSERT(textureHandle, "Adding invalid graphics handle to free list.");
-                    //    freeList.push_back(input.Info.Id);
-//
-                    //    // TODO: Add debug info to nodes
-                    //    ONYX_LOG_INFO("Deallocated resource in node.");
-                    //}
+                TransientResourceLifetime& lifetime = m_TransientResources[it->second];
+                lifetime.LastUse = std::max(lifetime.LastUse, nodeIndex);
+            }
+        }
 
+        // the final texture is still read after the last node
+        if (auto it = transientResourceIndices.find(m_FinalTextureId); it != transientResourceIndices.end())
+        {
+            m_TransientResources[it->second].LastUse = nodeCount;
+        }
+
+        TransientMemoryPlanner::Plan(m_TransientResources, m_TransientMemoryPlan);
+
+        for (const TransientMemoryHeap& heap : m_TransientMemoryPlan.Heaps)
+        {
+            TextureStorageHandle heapStorage;
+            for (onyxU32 resourceIndex : heap.Resources)
+            {
+                RenderGraphResource& resource = m_ResourceCache[m_TransientResources[resourceIndex].Id];
+                if (CreateAttachment(graphicsSystem, resource, heapStorage) == false)
+                {
+                    // TODO: Add info for node / which output resource etc.
+                    ONYX_LOG_WARNING("Failed creating output attachment for graph resource.");
                 }
             }
         }
 
+        ONYX_LOG_INFO("Render graph transient attachments use {:.2f} MB in {} heaps ({:.2f} MB without aliasing)",
+            static_cast<onyxF64>(m_TransientMemoryPlan.TotalSize) / (1024.0 * 1024.0), m_TransientMemoryPlan.Heaps.size(),
+            static_cast<onyxF64>(m_TransientMemoryPlan.UnaliasedSize) / (1024.0 * 1024.0));
+
         // create renderpass and framebuffer
         for (const LocalNodeId nodeId : topologicalOrder)
         {
@@ -131,6 +155,8 @@ namespace Onyx::Graphics
             graphNode.Compile(graphicsSystem, m_ResourceCache);
         }
 
+        CompileBarriers();
+
         graphicsSystem.OnBeginFrame().Connect<&RenderGraph::OnBeginFrame>(this);
         graphicsSystem.OnRenderFrame().Connect<&RenderGraph::OnRenderFrame>(this);
         graphicsSystem.OnEndFrame().Connect<&RenderGraph::OnEndFrame>(this);
@@ -168,7 +194,7 @@ namespace Onyx::Graphics
         RenderGraphResource& swapchainResource = m_ResourceCache[SWAPCHAIN_RESOURCE_ID];
         swapchainResource.Handle = swapchainTarget;
 
-        const TextureHandle& depthTarget = frameContext.Api->GetDepthImage();
+        const TextureHandle& depthTarget = frameContext.Api->GetDepthImage(frameContext.FrameIndex);
         RenderGraphResource& depthResource = m_ResourceCache[DEPTH_RESOURCE_ID];
         depthResource.Handle = depthTarget;
 
@@ -200,9 +226,13 @@ namespace Onyx::Graphics
         RenderGraphContext graphContext{ context, *this };
         CommandBuffer& commandBuffer = context.Api->GetCommandBuffer(context.FrameIndex, true);
 
-        for (onyxS8 nodeId : m_Graph.GetTopologicalOrder())
+        const auto topologicalOrder = m_Graph.GetTopologicalOrder();
+        for (onyxU32 passIndex = 0; passIndex < topologicalOrder.size(); ++passIndex)
         {
-            IRenderGraphNode& node = m_Graph.GetNode<IRenderGraphNode>(nodeId);
+            // submitted for skipped passes as well so the tracked states match the plan
+            SubmitBarriers(passIndex, commandBuffer);
+
+            IRenderGraphNode& node = m_Graph.GetNode<IRenderGraphNode>(topologicalOrder[passIndex]);
 
             if (node.HasBegunFrame() == false)
             {
@@ -276,21 +306,102 @@ namespace Onyx::Graphics
         return m_ResourceCache.at(id);
     }
 
-    bool RenderGraph::CreateAttachment(GraphicsSystem& graphicsSystem, RenderGraphResource& resource, DynamicArray<RenderGraphResourceId>& freeList)
+    void RenderGraph::CompileBarriers()
     {
         ONYX_PROFILE(RenderGraph);
         ONYX_PROFILE_FUNCTION;
 
-        const RenderGraphTextureResourceInfo& resourceInfo = std::get<RenderGraphTextureResourceInfo>(resource.Properties);
+        m_BarrierPasses.clear();
+        m_BarrierResources.clear();
 
-        const Vector2s32& swapChainExtent = graphicsSystem.GetSwapchainExtent();
+        HashSet<RenderGraphResourceId> transientResourceIds;
+        for (const TransientResourceLifetime& transientResource : m_TransientResources)
+            transientResourceIds.insert(transientResource.Id);
 
-        TextureStorageProperties storageProperties;
-        storageProperties.m_Size = resourceInfo.HasSize ? resourceInfo.Size : Vector3s32(swapChainExtent, 1);
-        storageProperties.m_Format = resourceInfo.Format;
-        storageProperties.m_IsFrameBuffer = true;
-        storageProperties.m_IsTexture = true;
-        storageProperties.m_GpuAccess = GPUAccess::Write;
+        HashSet<RenderGraphResourceId> usedResourceIds;
+        for (const LocalNodeId nodeId : m_Graph.GetTopologicalOrder())
+        {
+            IRenderGraphNode& graphNode = m_Graph.GetNode<IRenderGraphNode>(nodeId);
+
+            RenderGraphPassResourceUses& passUses = m_BarrierPasses.emplace_back();
+            passUses.Name = graphNode.GetTypeId().GetString();
+            graphNode.GetResourceUses(m_ResourceCache, passUses);
+
+            for (const RenderGraphResourceUse& use : passUses.Uses)
+            {
+                if (usedResourceIds.insert(use.ResourceId).second == false)
+                    continue;
+
+                const RenderGraphResource& resource = m_ResourceCache.at(use.ResourceId);
+
+                RenderGraphBarrierResource& barrierResource = m_BarrierResources.emplace_back();
+                barrierResource.Id = use.ResourceId;
+                barrierResource.Name = resource.Info.Name;
+                barrierResource.IsTexture = std::holds_alternative<BufferHandle>(resource.Handle) == false;
+                barrierResource.IsTransient = transientResourceIds.contains(use.ResourceId);
+                if (barrierResource.IsTexture && std::holds_alternative<RenderGraphTextureResourceInfo>(resource.Properties))
+                {
+                    barrierResource.IsDepth = Utils::IsDepthFormat(std::get<RenderGraphTextureResourceInfo>(resource.Properties).Format);
+                }
+            }
+        }
+
+        RenderGraphBarrierPlanner::Plan(m_BarrierResources, m_BarrierPasses, m_BarrierPlan);
+
+        ONYX_LOG_INFO("Render graph submits {} barriers in {} passes per frame ({} redundant transitions elided)",
+            m_BarrierPlan.BarrierCount, m_BarrierPasses.size(), m_BarrierPlan.ElidedCount);
+    }
+
+    void RenderGraph::SubmitBarriers(onyxU32 passIndex, CommandBuffer& commandBuffer)
+    {
+        if ((passIndex >= m_BarrierPlan.PassBarriers.size()) || m_BarrierPlan.PassBarriers[passIndex].empty())
+            return;
+
+        m_TextureBarriers.clear();
+        m_BufferBarriers.clear();
+
+        for (const RenderGraphBarrier& barrier : m_BarrierPlan.PassBarriers[passIndex])
+        {
+            RenderGraphResource& resource = m_ResourceCache[barrier.ResourceId];
+            if (barrier.IsTexture)
+            {
+                const TextureHandle& texture = std::get<TextureHandle>(resource.Handle);
+                if (texture.IsValid() == false)
+                    continue;
+
+                m_TextureBarriers.push_back({ texture, barrier.After.ExecutionContext, barrier.After.AccessMask, barrier.After.Layout, barrier.DiscardContents });
+            }
+            else
+            {
+                const BufferHandle& buffer = std::get<BufferHandle>(resource.Handle);
+                if (buffer == false)
+                    continue;
+
+                m_BufferBarriers.push_back({ buffer, barrier.After.ExecutionContext, barrier.After.AccessMask });
+            }
+        }
+
+        commandBuffer.Barriers(Span<TextureBarrier>(m_TextureBarriers.data(), m_TextureBarriers.size()), Span<BufferBarrier>(m_BufferBarriers.data(), m_BufferBarriers.size()));
+    }
+
+    String RenderGraph::GetBarrierReport() const
+    {
+        return RenderGraphBarrierPlanner::GetReport(m_BarrierResources, m_BarrierPasses, m_BarrierPlan);
+    }
+
+    String RenderGraph::GetTransientMemoryReport() const
+    {
+        return TransientMemoryPlanner::GetReport(m_TransientResources, m_TransientMemoryPlan);
+    }
+
+    bool RenderGraph::CreateAttachment(GraphicsSystem& graphicsSystem, RenderGraphResource& resource, TextureStorageHandle& heapStorage)
+    {
+        ONYX_PROFILE(RenderGraph);
+        ONYX_PROFILE_FUNCTION;
+
+        const RenderGraphTextureResourceInfo& resourceInfo = std::get<RenderGraphTextureResourceInfo>(resource.Properties);
+
+        TextureStorageProperties storageProperties = GetAttachmentStorageProperties(graphicsSystem.GetSwapchainExtent(), resourceInfo);
 #if ONYX_IS_DEBUG
         storageProperties.m_DebugName = resource.Info.Name + " Storage";
 #endif
@@ -300,35 +411,25 @@ namespace Onyx::Graphics
         texProp.m_AllowCubeMapLoads = false;
         texProp.m_MaxMipLevel = storageProperties.m_MaxMipLevel;
         texProp.m_ArraySize = storageProperties.m_ArraySize;
-#if ONYX_IS_DEBUG
-        texProp.m_DebugName = resource.Info.Name + " View";
-#endif
 
-        // first check if we have a resource in the free list that we can use
-        for (onyxU32 freeIndex = 0; freeIndex < freeList.size(); ++freeIndex)
-        {
-            RenderGraphResourceId id = freeList[freeIndex];
-            RenderGraphResource& freeResource = m_ResourceCache[id];
-
-            TextureHandle& freeTexture = std::get<TextureHandle>(freeResource.Handle);
-            const TextureStorageProperties& freeTextureStorageProperties = freeTexture.Storage->GetProperties();
-
-            // wrap in a function to check if its alias-able?
-            if ((storageProperties.m_Size != freeTextureStorageProperties.m_Size) ||
-                (storageProperties.m_Format != freeTextureStorageProperties.m_Format))
-                continue;
-
-            // Add logic for handling already aliased textures?
+        TextureHandle& texture = std::get<TextureHandle>(resource.Handle);
 
+        // the planner guarantees that the first resource in a heap is the largest
+        if (heapStorage)
+        {
 #if ONYX_IS_DEBUG
-            texProp.m_DebugName = resource.Info.Name + " Alias | " + freeTextureStorageProperties.m_DebugName;
+            texProp.m_DebugName = resource.Info.Name + " Alias | " + heapStorage->GetProperties().m_DebugName;
 #endif
-            graphicsSystem.CreateAlias(std::get<TextureHandle>(resource.Handle), freeTexture.Storage, storageProperties, texProp);
-            return true;
+            graphicsSystem.CreateAlias(texture, heapStorage, storageProperties, texProp);
+            return texture.IsValid();
         }
 
-        graphicsSystem.CreateTexture(std::get<TextureHandle>(resource.Handle), storageProperties, texProp);
-        return true;
+#if ONYX_IS_DEBUG
+        texProp.m_DebugName = resource.Info.Name + " View";
+#endif
+        graphicsSystem.CreateTexture(texture, storageProperties, texProp);
+        heapStorage = texture.Storage;
+        return texture.IsValid();
     }
 
     //bool RenderGraph::CreateBuffer(GraphicsSystem& graphicsApi, RenderGraphNode& node, RenderGraphResource& resource)
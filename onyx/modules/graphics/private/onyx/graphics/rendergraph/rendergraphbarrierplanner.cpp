@@ -0,0 +1,166 @@
+#include <onyx/graphics/rendergraph/rendergraphbarrierplanner.h>
+
+namespace Onyx::Graphics
+{
+    namespace
+    {
+        constexpr Access WRITE_ACCESS_MASK = Access::ShaderWrite | Access::ColorAttachmentWrite | Access::DepthStencilWrite | Access::TransferWrite;
+
+        bool HasWriteAccess(Access access)
+        {
+            return Enums::HasAnyFlags(access, WRITE_ACCESS_MASK);
+        }
+
+        struct PassResourceState
+        {
+            onyxU32 ResourceIndex;
+            RenderGraphResourceState State;
+        };
+    }
+
+    RenderGraphResourceState RenderGraphBarrierPlanner::GetRequiredState(RenderGraphResourceUsage usage, Context executionContext, bool isDepth)
+    {
+        RenderGraphResourceState state;
+        state.ExecutionContext = executionContext;
+
+        switch (usage)
+        {
+            case RenderGraphResourceUsage::Sampled:
+                state.AccessMask = Access::ShaderRead;
+                state.Layout = ImageLayout::ReadOptimal;
+                break;
+            case RenderGraphResourceUsage::InputAttachment:
+                state.AccessMask = isDepth ? Access::DepthStencilRead : Access::InputAttachmentRead;
+                state.Layout = ImageLayout::AttachmentOptimal;
+                break;
+            case RenderGraphResourceUsage::ColorAttachment:
+            case RenderGraphResourceUsage::DepthStencilAttachment:
+                state.AccessMask = isDepth ? (Access::DepthStencilRead | Access::DepthStencilWrite) : Access::ColorAttachmentWrite;
+                state.Layout = ImageLayout::AttachmentOptimal;
+                break;
+            case RenderGraphResourceUsage::StorageRead:
+                state.AccessMask = Access::ShaderRead;
+                state.Layout = ImageLayout::General;
+                break;
+            case RenderGraphResourceUsage::StorageWrite:
+                state.AccessMask = Access::ShaderRead | Access::ShaderWrite;
+                state.Layout = ImageLayout::General;
+                break;
+        }
+
+        return state;
+    }
+
+    bool RenderGraphBarrierPlanner::NeedsBarrier(const RenderGraphResourceState& before, const RenderGraphResourceState& after, bool isTexture)
+    {
+        // the pipeline stages of the barrier depend on the context, reads in another context are not synchronized with the earlier ones
+        if (before.ExecutionContext != after.ExecutionContext)
+            return true;
+
+        if (isTexture && (before.Layout != after.Layout))
+            return true;
+
+        // write after write, write after read and read after write
+        if (HasWriteAccess(before.AccessMask) || HasWriteAccess(after.AccessMask))
+            return true;
+
+        // reads with a new access type still need the earlier writes to be made visible to them
+        return Enums::HasAllFlags(before.AccessMask, after.AccessMask) == false;
+    }
+
+    void RenderGraphBarrierPlanner::Plan(const DynamicArray<RenderGraphBarrierResource>& resources, const DynamicArray<RenderGraphPassResourceUses>& passes, RenderGraphBarrierPlan& outPlan)
+    {
+        outPlan = {};
+        outPlan.PassBarriers.resize(passes.size());
+
+        HashMap<onyxU64, onyxU32> resourceIndices;
+        for (onyxU32 i = 0; i < resources.size(); ++i)
+            resourceIndices[resources[i].Id] = i;
+
+        DynamicArray<RenderGraphResourceState> currentStates(resources.size());
+        DynamicArray<bool> isUsedThisFrame(resources.size(), false);
+
+        DynamicArray<PassResourceState> passStates;
+        for (onyxU32 passIndex = 0; passIndex < passes.size(); ++passIndex)
+        {
+            const RenderGraphPassResourceUses& pass = passes[passIndex];
+
+            // a pass can use the same resource through multiple pins, merge them into one state
+            passStates.clear();
+            for (const RenderGraphResourceUse& use : pass.Uses)
+            {
+                auto it = resourceIndices.find(use.ResourceId);
+                if (it == resourceIndices.end())
+                {
+                    ONYX_ASSERT(false, "Resource 0x{:x} used by pass {} is missing.", use.ResourceId, pass.Name);
+                    continue;
+                }
+
+                const onyxU32 resourceIndex = it->second;
+                const RenderGraphResourceState requiredState = GetRequiredState(use.Usage, pass.ExecutionContext, resources[resourceIndex].IsDepth);
+
+                auto passStateIt = std::ranges::find_if(passStates, [&](const PassResourceState& passState) { return passState.ResourceIndex == resourceIndex; });
+                if (passStateIt == passStates.end())
+                {
+                    passStates.push_back({ resourceIndex, requiredState });
+                    continue;
+                }
+
+                RenderGraphResourceState& mergedState = passStateIt->State;
+                mergedState.AccessMask |= requiredState.AccessMask;
+                if (mergedState.Layout != requiredState.Layout)
+                    mergedState.Layout = ImageLayout::General;
+            }
+
+            DynamicArray<RenderGraphBarrier>& barriers = outPlan.PassBarriers[passIndex];
+            for (const PassResourceState& passState : passStates)
+            {
+                const RenderGraphBarrierResource& resource = resources[passState.ResourceIndex];
+                RenderGraphResourceState& currentState = currentStates[passState.ResourceIndex];
+
+                // the state at the start of a frame is unknown, so the first use always gets a barrier
+                const bool isFirstUse = isUsedThisFrame[passState.ResourceIndex] == false;
+                if ((isFirstUse == false) && (NeedsBarrier(currentState, passState.State, resource.IsTexture) == false))
+                {
+                    ++outPlan.ElidedCount;
+                    continue;
+                }
+
+                RenderGraphBarrier& barrier = barriers.emplace_back();
+                barrier.ResourceId = resource.Id;
+                barrier.IsTexture = resource.IsTexture;
+                barrier.DiscardContents = isFirstUse && resource.IsTexture && resource.IsTransient && HasWriteAccess(passState.State.AccessMask);
+                barrier.Before = currentState;
+                barrier.After = passState.State;
+
+                currentState = passState.State;
+                isUsedThisFrame[passState.ResourceIndex] = true;
+                ++outPlan.BarrierCount;
+            }
+        }
+    }
+
+    String RenderGraphBarrierPlanner::GetReport(const DynamicArray<RenderGraphBarrierResource>& resources, const DynamicArray<RenderGraphPassResourceUses>& passes, const RenderGraphBarrierPlan& plan)
+    {
+        HashMap<onyxU64, StringView> resourceNames;
+        for (const RenderGraphBarrierResource& resource : resources)
+            resourceNames[resource.Id] = resource.Name;
+
+        String report = Format::Format("Barriers: {} per frame, {} elided\n", plan.BarrierCount, plan.ElidedCount);
+        for (onyxU32 passIndex = 0; passIndex < plan.PassBarriers.size(); ++passIndex)
+        {
+            const DynamicArray<RenderGraphBarrier>& barriers = plan.PassBarriers[passIndex];
+            report += Format::Format("  {} ({} barriers)\n", passes[passIndex].Name, barriers.size());
+
+            for (const RenderGraphBarrier& barrier : barriers)
+            {
+                report += Format::Format("    {}: {} 0x{:x} -> {} 0x{:x}{}\n", resourceNames[barrier.ResourceId],
+                    Enums::ToString(barrier.Before.Layout), Enums::ToIntegral(barrier.Before.AccessMask),
+                    Enums::ToString(barrier.After.Layout), Enums::ToIntegral(barrier.After.AccessMask),
+                    barrier.DiscardContents ? " (discard)" : "");
+            }
+        }
+
+        return report;
+    }
+}
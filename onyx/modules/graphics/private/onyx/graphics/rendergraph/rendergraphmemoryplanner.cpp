@@ -0,0 +1,144 @@
+#include <onyx/graphics/rendergraph/rendergraphmemoryplanner.h>
+
+#include <numeric>
+
+namespace Onyx::Graphics
+{
+    namespace
+    {
+        onyxF64 ToMegaBytes(onyxU64 bytes)
+        {
+            return static_cast<onyxF64>(bytes) / (1024.0 * 1024.0);
+        }
+
+        onyxU64 GetAlignedSize(onyxU64 size, onyxU64 alignment)
+        {
+            alignment = std::max<onyxU64>(alignment, 1);
+            return ((size + alignment - 1) / alignment) * alignment;
+        }
+
+        void CalculatePeakLiveSize(const DynamicArray<TransientResourceLifetime>& resources, TransientMemoryPlan& outPlan)
+        {
+            onyxU32 lastNodeIndex = 0;
+            for (const TransientResourceLifetime& resource : resources)
+            {
+                lastNodeIndex = std::max(lastNodeIndex, resource.LastUse);
+            }
+
+            // difference array over the node order, +size on first use and -size after the last use
+            DynamicArray<onyxS64> sizeDeltas(lastNodeIndex + 2, 0);
+            for (const TransientResourceLifetime& resource : resources)
+            {
+                sizeDeltas[resource.FirstUse] += static_cast<onyxS64>(resource.Size);
+                sizeDeltas[resource.LastUse + 1] -= static_cast<onyxS64>(resource.Size);
+            }
+
+            onyxS64 liveSize = 0;
+            for (onyxU32 nodeIndex = 0; nodeIndex <= lastNodeIndex; ++nodeIndex)
+            {
+                liveSize += sizeDeltas[nodeIndex];
+                if (static_cast<onyxU64>(liveSize) > outPlan.PeakLiveSize)
+                {
+                    outPlan.PeakLiveSize = static_cast<onyxU64>(liveSize);
+                    outPlan.PeakLiveNodeIndex = nodeIndex;
+                }
+            }
+        }
+    }
+
+    void TransientMemoryPlanner::Plan(const DynamicArray<TransientResourceLifetime>& resources, TransientMemoryPlan& outPlan)
+    {
+        outPlan = {};
+
+        const onyxU32 resourceCount = static_cast<onyxU32>(resources.size());
+        if (resourceCount == 0)
+            return;
+
+        outPlan.ResourceHeaps.resize(resourceCount, onyxMax_U32);
+
+        // largest first so the first resource of a heap is always the one defining its size,
+        // ties are broken by lifetime and id to keep the plan deterministic
+        DynamicArray<onyxU32> placementOrder(resourceCount);
+        std::iota(placementOrder.begin(), placementOrder.end(), 0);
+        std::ranges::sort(placementOrder, [&](onyxU32 lhs, onyxU32 rhs)
+        {
+            const TransientResourceLifetime& left = resources[lhs];
+            const TransientResourceLifetime& right = resources[rhs];
+            if (left.Size != right.Size)
+                return left.Size > right.Size;
+
+            if (left.FirstUse != right.FirstUse)
+                return left.FirstUse < right.FirstUse;
+
+            return left.Id < right.Id;
+        });
+
+        for (onyxU32 resourceIndex : placementOrder)
+        {
+            const TransientResourceLifetime& resource = resources[resourceIndex];
+            ONYX_ASSERT(resource.FirstUse <= resource.LastUse, "Invalid lifetime for transient resource {}", resource.Name);
+
+            onyxU32 bestHeapIndex = onyxMax_U32;
+            const onyxU32 heapCount = static_cast<onyxU32>(outPlan.Heaps.size());
+            for (onyxU32 heapIndex = 0; heapIndex < heapCount; ++heapIndex)
+            {
+                const TransientMemoryHeap& heap = outPlan.Heaps[heapIndex];
+                if (heap.CompatibilityClass != resource.CompatibilityClass)
+                    continue;
+
+                // best fit, every existing heap is at least as big as the resource
+                if ((bestHeapIndex != onyxMax_U32) && (outPlan.Heaps[bestHeapIndex].Size <= heap.Size))
+                    continue;
+
+                const bool hasOverlap = std::ranges::any_of(heap.Resources, [&](onyxU32 residentIndex)
+                {
+                    return resources[residentIndex].Overlaps(resource);
+                });
+
+                if (hasOverlap == false)
+                    bestHeapIndex = heapIndex;
+            }
+
+            if (bestHeapIndex == onyxMax_U32)
+            {
+                bestHeapIndex = heapCount;
+                TransientMemoryHeap& newHeap = outPlan.Heaps.emplace_back();
+                newHeap.CompatibilityClass = resource.CompatibilityClass;
+            }
+
+            TransientMemoryHeap& heap = outPlan.Heaps[bestHeapIndex];
+            heap.Alignment = std::max(heap.Alignment, resource.Alignment);
+
+            const onyxU64 heapSize = GetAlignedSize(std::max(heap.Size, resource.Size), heap.Alignment);
+            outPlan.TotalSize += heapSize - heap.Size;
+            heap.Size = heapSize;
+
+            heap.Resources.push_back(resourceIndex);
+            outPlan.ResourceHeaps[resourceIndex] = bestHeapIndex;
+            outPlan.UnaliasedSize += resource.Size;
+        }
+
+        CalculatePeakLiveSize(resources, outPlan);
+    }
+
+    String TransientMemoryPlanner::GetReport(const DynamicArray<TransientResourceLifetime>& resources, const TransientMemoryPlan& plan)
+    {
+        String report = Format::Format("Transient memory: {:.2f} MB in {} heaps (unaliased {:.2f} MB, peak live {:.2f} MB at node {})\n",
+            ToMegaBytes(plan.TotalSize), plan.Heaps.size(), ToMegaBytes(plan.UnaliasedSize), ToMegaBytes(plan.PeakLiveSize), plan.PeakLiveNodeIndex);
+
+        for (onyxU32 heapIndex = 0; heapIndex < plan.Heaps.size(); ++heapIndex)
+        {
+            const TransientMemoryHeap& heap = plan.Heaps[heapIndex];
+            report += Format::Format("  Heap {} ({:.2f} MB, class {})\n", heapIndex, ToMegaBytes(heap.Size), heap.CompatibilityClass);
+
+            for (onyxU32 resourceIndex : heap.Resources)
+            {
+                const TransientResourceLifetime& resource = resources[resourceIndex];
+                report += Format::Format("    {} [{}, {}] {:.2f} MB{}\n", resource.Name, resource.FirstUse, resource.LastUse,
+                    ToMegaBytes(resource.Size), resourceIndex == heap.Resources[0] ? "" : " (alias)");
+            }
+        }
+
+        return report;
+    }
+}
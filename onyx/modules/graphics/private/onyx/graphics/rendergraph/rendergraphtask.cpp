@@ -144,14 +144,16 @@ namespace Onyx::Graphics
         UpdateFramebuffer(api, resourceCache);
     }
 
-    void RenderGraphShaderNode::PreRender(RenderGraphContext& context, CommandBuffer& commandBuffer)
+    void RenderGraphShaderNode::GetResourceUses(const RenderGraphResourceCache& resourceCache, RenderGraphPassResourceUses& outPassUses)
     {
         ONYX_PROFILE_FUNCTION;
 
-#if ONYX_IS_DEBUG || ONYX_IS_EDITOR
-        commandBuffer.BeginDebugLabel(GetTypeId().GetString(), Vector4f32{ 1.0f });
-#endif
-        //Vulkan::VulkanCommandBuffer& cmdBuffer = static_cast<Vulkan::VulkanCommandBuffer&>(commandBuffer);
+        const bool isCompute = IsComputeTask();
+        outPassUses.ExecutionContext = isCompute ? Context::Compute : Context::Graphics;
+
+        const NodeGraph::PinTypeId bufferPinType = static_cast<NodeGraph::PinTypeId>(TypeHash<BufferHandle>());
+
+        // external resources (e.g.: swapchain, depth image) are included, their handle is resolved when the barriers get submitted
         onyxU32 inputPinCount = GetInputPinCount();
         for (onyxU32 i = 0; i < inputPinCount; ++i)
         {
@@ -159,54 +161,57 @@ namespace Onyx::Graphics
             if (inputPin->IsConnected() == false)
                 continue;
 
-            if (inputPin->GetType() != static_cast<NodeGraph::PinTypeId>(TypeHash<TextureHandle>()))
+            auto it = resourceCache.find(inputPin->GetLinkedPinGlobalId());
+            if (it == resourceCache.end())
                 continue;
 
-            RenderGraphResource& input = context.Graph.GetResource(inputPin->GetLinkedPinGlobalId());
-            
-            if (input.IsExternal)
-            {
-                continue;
-            }
-            
-            TextureHandle& textureHandle = std::get<TextureHandle>(input.Handle);
-            
-            // TODO: Fix barriers
-            const RenderGraphTextureResourceInfo& attachmentInfo = m_InputAttachmentInfos[i];
-            if (attachmentInfo.Type == RenderGraphResourceType::Attachment)
-            {
-                commandBuffer.TransitionLayout(textureHandle, Context::Graphics, Access::InputAttachmentRead, ImageLayout::AttachmentOptimal);
-            }
+            RenderGraphResourceUse& use = outPassUses.Uses.emplace_back();
+            use.ResourceId = it->first;
+
+            if (inputPin->GetType() == bufferPinType)
+                use.Usage = RenderGraphResourceUsage::StorageRead;
+            else if (GetInputResourceInfo(i).Type == RenderGraphResourceType::Attachment)
+                use.Usage = RenderGraphResourceUsage::InputAttachment;
             else
-            {
-                commandBuffer.TransitionLayout(textureHandle, Context::Graphics, Access::ShaderRead, ImageLayout::ReadOptimal);
-                //storage.TransitionLayout(cmdBuffer, Context::Graphics, 5/*VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL*/, 0x00000020ULL/*VK_ACCESS_2_SHADER_READ_BIT_KHR*/, 0, 1);
-            }
+                use.Usage = RenderGraphResourceUsage::Sampled;
         }
 
         onyxU32 outputPinCount = GetOutputPinCount();
         for (onyxU32 i = 0; i < outputPinCount; ++i)
         {
-            RenderGraphResource& output = context.Graph.GetResource(GetOutputPin(i)->GetGlobalId());
+            const NodeGraph::PinBase* outputPin = GetOutputPin(i);
 
-            if (output.Info.Type == RenderGraphResourceType::Attachment)
+            auto it = resourceCache.find(outputPin->GetGlobalId());
+            if (it == resourceCache.end())
+                continue;
+
+            const RenderGraphResource& output = it->second;
+            if (outputPin->GetType() == bufferPinType)
             {
-                TextureHandle& textureHandle = std::get<TextureHandle>(output.Handle);
-                //Vulkan::VulkanTextureStorage& storage = textureHandle.Storage.As<Vulkan::VulkanTextureStorage>();
+                outPassUses.Uses.push_back({ it->first, RenderGraphResourceUsage::StorageWrite });
+                continue;
+            }
 
-                // TODO: Fix barriers
-                const TextureStorageProperties& properties = textureHandle.Storage->GetProperties();
-                if (Utils::IsDepthFormat(properties.m_Format))
-                {
-                    commandBuffer.TransitionLayout(textureHandle, Context::Graphics, Access::DepthStencilWrite | Access::DepthStencilRead, ImageLayout::AttachmentOptimal);
-                }
-                else
-                {
-                    commandBuffer.TransitionLayout(textureHandle, Context::Graphics, Access::ShaderRead | Access::ColorAttachmentWrite, ImageLayout::AttachmentOptimal);
-                }
+            if (output.Info.Type == RenderGraphResourceType::Attachment)
+            {
+                const RenderGraphTextureResourceInfo& properties = std::get<RenderGraphTextureResourceInfo>(output.Properties);
+                const RenderGraphResourceUsage usage = Utils::IsDepthFormat(properties.Format) ? RenderGraphResourceUsage::DepthStencilAttachment : RenderGraphResourceUsage::ColorAttachment;
+                outPassUses.Uses.push_back({ it->first, usage });
+            }
+            else if (output.Info.Type == RenderGraphResourceType::Texture)
+            {
+                outPassUses.Uses.push_back({ it->first, RenderGraphResourceUsage::StorageWrite });
             }
         }
+    }
+
+    void RenderGraphShaderNode::PreRender(RenderGraphContext& context, CommandBuffer& commandBuffer)
+    {
+        ONYX_PROFILE_FUNCTION;
 
+#if ONYX_IS_DEBUG || ONYX_IS_EDITOR
+        commandBuffer.BeginDebugLabel(GetTypeId().GetString(), Vector4f32{ 1.0f });
+#endif
         OnPreRender(context, commandBuffer);
     }
 
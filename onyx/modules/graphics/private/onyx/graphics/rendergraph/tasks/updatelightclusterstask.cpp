@@ -10,6 +10,8 @@
 #include <onyx/profiler/profiler.h>
 
 #define BATCHED 1
+// assign lights to the clusters on the CPU and upload the light grid instead of running the update compute pass
+#define CPU_LIGHT_ASSIGNMENT 1
 
 namespace Onyx::Graphics::RenderGraphNodes
 {
@@ -83,7 +85,11 @@ namespace Onyx::Graphics::RenderGraphNodes
             // * 2 for point and spot lights
             ssboBufferProps.m_DebugName = "Light Index List";
             ssboBufferProps.m_GpuAccess = GPUAccess::Write;
+#if CPU_LIGHT_ASSIGNMENT
+            ssboBufferProps.m_CpuAccess = CPUAccess::Write;
+#else
             ssboBufferProps.m_CpuAccess = CPUAccess::None;
+#endif
             ssboBufferProps.m_Size = static_cast<onyxU32>(totalLightsPerTile * sizeof(onyxU32) * 2);
             api.CreateBuffer(m_LightIndexListSSBO[i], ssboBufferProps);
 
@@ -137,10 +143,27 @@ namespace Onyx::Graphics::RenderGraphNodes
 
         m_LightsStorageBuffers[frameIndex].Buffer->SetData(0, &lighting, sizeof(Lighting));
         context.Graph.GetResource(globalId).Handle = m_LightsStorageBuffers[frameIndex];
+
+#if CPU_LIGHT_ASSIGNMENT
+        m_ClusterBuilder.Build(context.FrameContext.ViewConstants, lighting);
+
+        const DynamicArray<LightGridCell>& lightGrid = m_ClusterBuilder.GetLightGrid();
+        m_LightGridSSBO[frameIndex].Buffer->SetData(0, lightGrid.data(), static_cast<onyxS32>(lightGrid.size() * sizeof(LightGridCell)));
+
+        // at most MAX_LIGHTS_PER_CLUSTER per cluster, which is what the index list is sized for
+        const DynamicArray<LightIndices>& lightIndices = m_ClusterBuilder.GetLightIndices();
+        if (lightIndices.empty() == false)
+            m_LightIndexListSSBO[frameIndex].Buffer->SetData(0, lightIndices.data(), static_cast<onyxS32>(lightIndices.size() * sizeof(LightIndices)));
+#endif
     }
 
     void UpdateLightClustersRenderGraphNode::OnRender(RenderGraphContext& context, CommandBuffer& commandBuffer)
     {
+#if CPU_LIGHT_ASSIGNMENT
+        // the light grid got uploaded in OnBeginFrame
+        ONYX_UNUSED(context);
+        ONYX_UNUSED(commandBuffer);
+#else
         const FrameContext& frameContext = context.FrameContext;
         const onyxU8 frameIndex = frameContext.FrameIndex;
 
@@ -165,5 +188,6 @@ namespace Onyx::Graphics::RenderGraphNodes
 #endif
         //TODO: Fix barrier
         commandBuffer.GlobalBarrier(0x00000040, 0x00000020);
+#endif
     }
 }
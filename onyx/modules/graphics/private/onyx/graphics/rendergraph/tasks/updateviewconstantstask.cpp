@@ -19,7 +19,7 @@ namespace Onyx::Graphics::RenderGraphNodes
         const FrameContext& frameContext = context.FrameContext;
         
         onyxU64 outputGlobalPinId = GetOutputPin(0)->GetGlobalId();
-        context.Graph.GetResource(outputGlobalPinId).Handle = frameContext.Api->GetViewConstantsBuffer();
+        context.Graph.GetResource(outputGlobalPinId).Handle = frameContext.Api->GetViewConstantsBuffer(frameContext.FrameIndex);
     }
 
 }
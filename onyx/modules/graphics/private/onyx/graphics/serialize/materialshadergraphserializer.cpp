@@ -18,8 +18,13 @@ namespace Onyx::Graphics
         if (ShaderGraphSerializer::Serialize(shaderGraph, serializer) == false)
             return false;
 
-        // save shader to file
-        FileSystem::OnyxFile shaderOutFile(FileSystem::Path::GetFullPath(FileSystem::Path::ReplaceExtension(meta.Path, "oshader")));
+        // save shader to file, unchanged shaders are not written so the file watcher does not trigger a reload
+        const FilePath shaderPath = FileSystem::Path::GetFullPath(FileSystem::Path::ReplaceExtension(meta.Path, "oshader"));
+        String existingShaderCode;
+        if (FileSystem::OnyxFile::ReadAll(shaderPath, existingShaderCode) && (existingShaderCode == shaderGraph.GetShaderCode()))
+            return true;
+
+        FileSystem::OnyxFile shaderOutFile(shaderPath);
         FileSystem::FileStream shaderOutStream = shaderOutFile.OpenStream(FileSystem::OpenMode::Write | FileSystem::OpenMode::Text);
         shaderOutStream.WriteRaw(shaderGraph.GetShaderCode().data(), shaderGraph.GetShaderCode().size());
 
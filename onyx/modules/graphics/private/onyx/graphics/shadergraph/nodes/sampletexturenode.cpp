@@ -1,5 +1,6 @@
 #include <onyx/graphics/shadergraph/nodes/sampletexturenode.h>
 
+#include <onyx/hash.h>
 #include <onyx/assets/assetsystem.h>
 
 #include <onyx/nodegraph/executioncontext.h>
@@ -144,6 +145,12 @@ namespace Onyx::Graphics::ShaderGraphNodes
         }
     }
 
+    void SampleTextureNode::DoHashSettings(Hash::FastHasher& hasher) const
+    {
+        const onyxU64 textureId = Texture.GetId().Get();
+        hasher.Update(&textureId, sizeof(textureId));
+    }
+
     void SampleTextureNode::OnChanged(Assets::AssetSystem& assetSystem)
     {
         if (Texture.HasAssetId())
@@ -11,6 +11,8 @@
 #include <onyx/serialize/serializer.h>
 #include <onyx/serialize/deserializer.h>
 
+#include <onyx/hash.h>
+
 namespace Onyx::Graphics
 {
     onyxU32 ShaderGraphTextures::AddTexture(const TextureHandle& texture)
@@ -81,6 +83,306 @@ namespace Onyx::Graphics
 
 #if !ONYX_IS_RELEASE || ONYX_IS_EDITOR
 
+    namespace
+    {
+        using PinTypeId = NodeGraph::PinTypeId;
+
+        // calls the visitor with the typed value, returns false for types that are not plain values (e.g.: textures)
+        template <typename VisitorT>
+        bool VisitPinValue(PinTypeId type, const std::any& value, VisitorT&& visitor)
+        {
+            if (value.has_value() == false)
+                return false;
+
+            switch (type)
+            {
+                case PinTypeId::Bool: visitor(std::any_cast<const bool&>(value)); return true;
+                case PinTypeId::Float: visitor(std::any_cast<const onyxF32&>(value)); return true;
+                case PinTypeId::Double: visitor(std::any_cast<const onyxF64&>(value)); return true;
+                case PinTypeId::Int32: visitor(std::any_cast<const onyxS32&>(value)); return true;
+                case PinTypeId::Int64: visitor(std::any_cast<const onyxS64&>(value)); return true;
+                case PinTypeId::Vector2s32: visitor(std::any_cast<const Vector2s32&>(value)); return true;
+                case PinTypeId::Vector2s64: visitor(std::any_cast<const Vector2s64&>(value)); return true;
+                case PinTypeId::Vector2f: visitor(std::any_cast<const Vector2f32&>(value)); return true;
+                case PinTypeId::Vector2d: visitor(std::any_cast<const Vector2f64&>(value)); return true;
+                case PinTypeId::Vector3s32: visitor(std::any_cast<const Vector3s32&>(value)); return true;
+                case PinTypeId::Vector3s64: visitor(std::any_cast<const Vector3s64&>(value)); return true;
+                case PinTypeId::Vector3f32: visitor(std::any_cast<const Vector3f32&>(value)); return true;
+                case PinTypeId::Vector3f64: visitor(std::any_cast<const Vector3f64&>(value)); return true;
+                case PinTypeId::Vector4s32: visitor(std::any_cast<const Vector4s32&>(value)); return true;
+                case PinTypeId::Vector4s64: visitor(std::any_cast<const Vector4s64&>(value)); return true;
+                case PinTypeId::Vector4f: visitor(std::any_cast<const Vector4f32&>(value)); return true;
+                case PinTypeId::Vector4d: visitor(std::any_cast<const Vector4f64&>(value)); return true;
+                default: return false;
+            }
+        }
+
+        // appends the raw bytes of a pin value, returns false if the value can not be compared this way
+        bool AppendPinValue(PinTypeId type, const std::any& value, String& outKey)
+        {
+            if (type == PinTypeId::String)
+            {
+                if (value.has_value() == false)
+                    return false;
+
+                const String& string = std::any_cast<const String&>(value);
+                const onyxU64 length = string.size();
+                outKey.append(reinterpret_cast<const char*>(&length), sizeof(length));
+                outKey += string;
+                return true;
+            }
+
+            return VisitPinValue(type, value, [&](const auto& typedValue)
+                {
+                    outKey.append(reinterpret_cast<const char*>(&typedValue), sizeof(typedValue));
+                });
+        }
+
+        template <typename T>
+        void AppendBytes(const T& value, String& outKey)
+        {
+            outKey.append(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+
+        // GLSL type of pins that can be folded or merged, all other types are generated as is
+        StringView GetShaderTypeString(PinTypeId type)
+        {
+            switch (type)
+            {
+                case PinTypeId::Float: return "float";
+                case PinTypeId::Int32: return "int";
+                case PinTypeId::Vector2f: return "vec2";
+                case PinTypeId::Vector3f32: return "vec3";
+                case PinTypeId::Vector4f: return "vec4";
+                default: return "";
+            }
+        }
+
+        // unlike std::to_string this does not lose precision, the decimal point is needed so GLSL parses it as float
+        bool FormatShaderFloat(onyxF32 value, String& outValue)
+        {
+            if (std::isfinite(value) == false)
+                return false;
+
+            String formattedValue = Format::Format("{}", value);
+            if (formattedValue.find_first_of(".e") == String::npos)
+                formattedValue += ".0";
+
+            outValue += formattedValue;
+            return true;
+        }
+
+        bool FormatShaderVector(StringView typeName, std::initializer_list<onyxF32> components, String& outValue)
+        {
+            outValue = typeName;
+            outValue += '(';
+            for (onyxF32 component : components)
+            {
+                if (outValue.back() != '(')
+                    outValue += ", ";
+
+                if (FormatShaderFloat(component, outValue) == false)
+                    return false;
+            }
+
+            outValue += ')';
+            return true;
+        }
+
+        // shader literal for a value that was computed on the cpu
+        bool FormatShaderConstant(PinTypeId type, const std::any& value, String& outValue)
+        {
+            if (value.has_value() == false)
+                return false;
+
+            switch (type)
+            {
+                case PinTypeId::Float:
+                    return FormatShaderFloat(std::any_cast<const onyxF32&>(value), outValue);
+                case PinTypeId::Int32:
+                    outValue = Format::Format("{}", std::any_cast<const onyxS32&>(value));
+                    return true;
+                case PinTypeId::Vector2f:
+                {
+                    const Vector2f32& vector = std::any_cast<const Vector2f32&>(value);
+                    return FormatShaderVector("vec2", { vector[0], vector[1] }, outValue);
+                }
+                case PinTypeId::Vector3f32:
+                {
+                    const Vector3f32& vector = std::any_cast<const Vector3f32&>(value);
+                    return FormatShaderVector("vec3", { vector[0], vector[1], vector[2] }, outValue);
+                }
+                case PinTypeId::Vector4f:
+                {
+                    const Vector4f32& vector = std::any_cast<const Vector4f32&>(value);
+                    return FormatShaderVector("vec4", { vector[0], vector[1], vector[2], vector[3] }, outValue);
+                }
+                default:
+                    return false;
+            }
+        }
+
+        // nodes that do not (indirectly) feed an output node are not generated
+        void CollectLiveNodes(const NodeGraph::NodeGraph& graph, DynamicArray<onyxS8>& outLiveNodes, HashSet<onyxU64>& outConsumedPins)
+        {
+            const DynamicArray<onyxS8>& executionOrder = graph.GetTopologicalOrder();
+            for (auto it = executionOrder.rbegin(); it != executionOrder.rend(); ++it)
+            {
+                const ShaderGraphNode& node = graph.GetNode<ShaderGraphNode>(*it);
+                const onyxU32 outputPinCount = node.GetOutputPinCount();
+
+                bool isLive = outputPinCount == 0;
+                for (onyxU32 i = 0; (isLive == false) && (i < outputPinCount); ++i)
+                    isLive = outConsumedPins.contains(node.GetOutputPin(i)->GetGlobalId().Get());
+
+                if (isLive == false)
+                    continue;
+
+                outLiveNodes.push_back(*it);
+                for (onyxU32 i = 0; i < node.GetInputPinCount(); ++i)
+                {
+                    const NodeGraph::PinBase* inputPin = node.GetInputPin(i);
+                    if (inputPin->IsConnected())
+                        outConsumedPins.insert(inputPin->GetLinkedPinGlobalId().Get());
+                }
+            }
+
+            std::ranges::reverse(outLiveNodes);
+        }
+
+        // everything the generated code depends on, pin ids are part of it as they are used for the variable names
+        // and the generator type as every generator wraps the node code differently
+        onyxU64 ComputeShaderCodeHash(const NodeGraph::NodeGraph& graph, const DynamicArray<onyxS8>& liveNodes, StringId32 generatorTypeId)
+        {
+            const HashMap<Guid64, std::any>& constantPinData = graph.GetConstantPinData();
+
+            String key;
+            AppendBytes(generatorTypeId.GetId(), key);
+
+            Hash::FastHasher hasher;
+            hasher.Update(key);
+            for (onyxS8 localNodeId : liveNodes)
+            {
+                const ShaderGraphNode& node = graph.GetNode<ShaderGraphNode>(localNodeId);
+
+                key.clear();
+                AppendBytes(node.GetId().Get(), key);
+                AppendBytes(node.GetTypeId().GetId(), key);
+
+                for (onyxU32 i = 0; i < node.GetInputPinCount(); ++i)
+                {
+                    const NodeGraph::PinBase* inputPin = node.GetInputPin(i);
+                    AppendBytes(inputPin->GetGlobalId().Get(), key);
+                    AppendBytes(inputPin->GetLinkedPinGlobalId().Get(), key);
+
+                    if (inputPin->IsConnected())
+                        continue;
+
+                    // pins without constant data use their default, values of custom types are covered by the node settings
+                    auto constantIt = constantPinData.find(inputPin->GetGlobalId());
+                    if (constantIt != constantPinData.end())
+                        std::ignore = AppendPinValue(inputPin->GetType(), constantIt->second, key);
+                }
+
+                for (onyxU32 i = 0; i < node.GetOutputPinCount(); ++i)
+                    AppendBytes(node.GetOutputPin(i)->GetGlobalId().Get(), key);
+
+                hasher.Update(key);
+                node.HashSettings(hasher);
+            }
+
+            return hasher.Finalize64();
+        }
+
+        // replaces pure nodes that only depend on constants with the value computed on the cpu
+        bool TryFoldNode(const ShaderGraphNode& node, const NodeGraph::ExecutionContext& context, const HashSet<onyxU64>& consumedPins, HashSet<onyxU64>& inOutConstantPins, ShaderGenerator& generator)
+        {
+            for (onyxU32 i = 0; i < node.GetInputPinCount(); ++i)
+            {
+                const NodeGraph::PinBase* inputPin = node.GetInputPin(i);
+                if (inputPin->IsConnected() && (inOutConstantPins.contains(inputPin->GetLinkedPinGlobalId().Get()) == false))
+                    return false;
+            }
+
+            const NodeGraph::ExecutionContext::NodeContext& nodeContext = context.GetNodeContext(node.GetId());
+
+            String code;
+            String value;
+            for (onyxU32 i = 0; i < node.GetOutputPinCount(); ++i)
+            {
+                const NodeGraph::PinBase* outputPin = node.GetOutputPin(i);
+                const onyxU64 outputPinId = outputPin->GetGlobalId().Get();
+                if (consumedPins.contains(outputPinId) == false)
+                    continue;
+
+                auto pinDataIt = nodeContext.PinData.find(outputPin->GetLocalId());
+                if (pinDataIt == nodeContext.PinData.end())
+                    return false;
+
+                value.clear();
+                if (FormatShaderConstant(outputPin->GetType(), pinDataIt->second, value) == false)
+                    return false;
+
+                code += Format::Format("const {} pin_{:x} = {}; \n", GetShaderTypeString(outputPin->GetType()), outputPinId, value);
+            }
+
+            for (onyxU32 i = 0; i < node.GetOutputPinCount(); ++i)
+                inOutConstantPins.insert(node.GetOutputPin(i)->GetGlobalId().Get());
+
+            generator.AppendCode(code);
+            return true;
+        }
+
+        // pure nodes with the same type, settings and inputs as an already generated node reuse its result
+        bool TryMergeNode(const ShaderGraphNode& node, const NodeGraph::ExecutionContext& context, HashMap<onyxU64, onyxU64>& inOutMergedPins, HashMap<String, const ShaderGraphNode*>& inOutPureNodes, ShaderGenerator& generator)
+        {
+            // nodes with multiple outputs only declare the connected ones, so their outputs can not be aliased safely
+            if (node.GetOutputPinCount() != 1)
+                return false;
+
+            const NodeGraph::PinBase* outputPin = node.GetOutputPin(0);
+            const StringView outputType = GetShaderTypeString(outputPin->GetType());
+            if (outputType.empty())
+                return false;
+
+            const NodeGraph::ExecutionContext::NodeContext& nodeContext = context.GetNodeContext(node.GetId());
+
+            String key;
+            AppendBytes(node.GetTypeId().GetId(), key);
+
+            Hash::FastHasher settingsHasher;
+            node.HashSettings(settingsHasher);
+            AppendBytes(settingsHasher.Finalize64(), key);
+
+            for (onyxU32 i = 0; i < node.GetInputPinCount(); ++i)
+            {
+                const NodeGraph::PinBase* inputPin = node.GetInputPin(i);
+                if (inputPin->IsConnected())
+                {
+                    const onyxU64 linkedPinId = inputPin->GetLinkedPinGlobalId().Get();
+                    auto mergedIt = inOutMergedPins.find(linkedPinId);
+                    AppendBytes(mergedIt != inOutMergedPins.end() ? mergedIt->second : linkedPinId, key);
+                    continue;
+                }
+
+                auto pinDataIt = nodeContext.PinData.find(inputPin->GetLocalId());
+                if ((pinDataIt == nodeContext.PinData.end()) || (AppendPinValue(inputPin->GetType(), pinDataIt->second, key) == false))
+                    return false;
+            }
+
+            auto [nodeIt, isNew] = inOutPureNodes.try_emplace(std::move(key), &node);
+            if (isNew)
+                return false;
+
+            const onyxU64 originalPinId = nodeIt->second->GetOutputPin(0)->GetGlobalId().Get();
+            const onyxU64 outputPinId = outputPin->GetGlobalId().Get();
+            inOutMergedPins[outputPinId] = originalPinId;
+
+            generator.AppendCode(Format::Format("{} pin_{:x} = pin_{:x}; \n", outputType, outputPinId, originalPinId));
+            return true;
+        }
+    }
+
     bool ShaderGraph::GenerateShader(ShaderGenerator& generator)
     {
         bool hasCompiled = Graph.Compile();
@@ -88,6 +390,20 @@ namespace Onyx::Graphics
         if (hasCompiled == false)
             return false;
 
+        DynamicArray<onyxS8> liveNodes;
+        HashSet<onyxU64> consumedPins;
+        CollectLiveNodes(Graph, liveNodes, consumedPins);
+
+        const onyxU64 shaderCodeHash = ComputeShaderCodeHash(Graph, liveNodes, generator.GetTypeId());
+
+        if ((shaderCodeHash == ShaderCodeHash) && (ShaderCode.empty() == false))
+        {
+            // only the node code generation is skipped, the caller's generator still ends up in the same state
+            generator = GeneratorState;
+            ShaderCode = generator.GenerateShader();
+            return true;
+        }
+
         NodeGraph::GraphRunner runner(Graph);
 
         // prepare nodes so data is setup
@@ -96,10 +412,12 @@ namespace Onyx::Graphics
         // run one fake update to calculate all values
         runner.Update(0);
 
-        ShaderGraphNodeFactory factory;
-        const DynamicArray<onyxS8>& executionOrder = Graph.GetTopologicalOrder();
+        HashSet<onyxU64> constantPins;
+        HashMap<onyxU64, onyxU64> mergedPins;
+        HashMap<String, const ShaderGraphNode*> pureNodes;
+
         NodeGraph::ExecutionContext& executionContext = runner.GetContext();
-        for (onyxS8 localNodeId : executionOrder)
+        for (onyxS8 localNodeId : liveNodes)
         {
             const ShaderGraphNode& node = Graph.GetNode<ShaderGraphNode>(localNodeId);
             executionContext.SetCurrentNode(node.GetId());
@@ -107,10 +425,22 @@ namespace Onyx::Graphics
             generator.SetStage(ShaderStage::Fragment); //TODO: Add support for other stages
 
             generator.AppendCode(Format::Format("// {} 0x{:x} \n", node.GetName(), node.GetId().Get()));
+
+            if (node.IsPure())
+            {
+                if (TryFoldNode(node, executionContext, consumedPins, constantPins, generator))
+                    continue;
+
+                if (TryMergeNode(node, executionContext, mergedPins, pureNodes, generator))
+                    continue;
+            }
+
             node.GenerateShader(executionContext, generator);
         }
 
+        GeneratorState = generator;
         ShaderCode = generator.GenerateShader();
+        ShaderCodeHash = shaderCodeHash;
         return true;
     }
 
@@ -0,0 +1,90 @@
+#pragma once
+
+namespace Onyx::Graphics
+{
+    struct ViewConstants;
+
+    // axis aligned bounding box, the default bounds are infinite and never get culled
+    struct MeshBounds
+    {
+        Vector3f32 Min = Vector3f32(std::numeric_limits<onyxF32>::lowest());
+        Vector3f32 Max = Vector3f32(std::numeric_limits<onyxF32>::max());
+
+        bool IsInfinite() const;
+
+        // bounds of the transformed box, infinite bounds stay infinite
+        MeshBounds Transform(const Matrix4<onyxF32>& transform) const;
+    };
+
+    // visible draws that share pipeline, material and mesh and can be submitted with the same state
+    struct MeshDrawBatch
+    {
+        // range in GetVisibleDraws()
+        onyxU32 FirstDraw = 0;
+        onyxU32 DrawCount = 0;
+    };
+
+    // CPU visibility for mesh draws.
+    // Draws are frustum culled on their world space bounds, the visible draws are sorted by a 64 bit key (pipeline, material, mesh, depth)
+    // and consecutive draws with the same pipeline, material and mesh are merged into batches.
+    // Ids are only used for sorting and merging, they should be dense so they fit into the key.
+    class MeshVisibility
+    {
+    public:
+        static constexpr onyxU32 PIPELINE_BITS = 12;
+        static constexpr onyxU32 MATERIAL_BITS = 16;
+        static constexpr onyxU32 MESH_BITS = 16;
+        static constexpr onyxU32 DEPTH_BITS = 20;
+
+        // front to back inside of each pipeline, material and mesh
+        static onyxU64 MakeSortKey(onyxU32 pipelineId, onyxU32 materialId, onyxU32 meshId, onyxU32 depth);
+
+        void Clear();
+
+        // returns the index of the draw
+        onyxU32 AddDraw(const MeshBounds& worldBounds, onyxU32 pipelineId, onyxU32 materialId, onyxU32 meshId);
+
+        void Build(const ViewConstants& viewConstants);
+
+        onyxU32 GetDrawCount() const { return m_DrawCount; }
+
+        // indices of the visible draws in sorted order
+        const DynamicArray<onyxU32>& GetVisibleDraws() const { return m_VisibleDraws; }
+        const DynamicArray<onyxU64>& GetSortKeys() const { return m_SortKeys; }
+        const DynamicArray<MeshDrawBatch>& GetBatches() const { return m_Batches; }
+
+    private:
+        // bounds of all draws as structure of arrays, padded to a multiple of 4 so the culling can test 4 draws at once
+        struct DrawBoundsSoA
+        {
+            DynamicArray<onyxF32> CenterX, CenterY, CenterZ;
+            DynamicArray<onyxF32> ExtentX, ExtentY, ExtentZ;
+
+            void Clear();
+            void Resize(onyxU64 size);
+        };
+
+        void CullDraws(const ViewConstants& viewConstants);
+        void ComputeSortKeys(const ViewConstants& viewConstants);
+        void SortVisibleDraws();
+        void BuildBatches();
+
+        bool IsSameBatch(onyxU32 lhsDraw, onyxU32 rhsDraw) const;
+
+    private:
+        onyxU32 m_DrawCount = 0;
+        DrawBoundsSoA m_Bounds;
+
+        DynamicArray<onyxU32> m_PipelineIds;
+        DynamicArray<onyxU32> m_MaterialIds;
+        DynamicArray<onyxU32> m_MeshIds;
+
+        DynamicArray<onyxU32> m_VisibleDraws;
+        DynamicArray<onyxU64> m_SortKeys;
+        DynamicArray<MeshDrawBatch> m_Batches;
+
+        // ping pong buffers of the radix sort
+        DynamicArray<onyxU32> m_SortScratchDraws;
+        DynamicArray<onyxU64> m_SortScratchKeys;
+    };
+}
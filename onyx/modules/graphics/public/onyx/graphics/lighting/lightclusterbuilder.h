@@ -0,0 +1,135 @@
+#pragma once
+
+#include <onyx/container/span.h>
+#include <onyx/rhi/lighting/lighting.h>
+
+namespace Onyx::Graphics
+{
+    struct ViewConstants;
+
+    // matches LightGridCell in lightdata.h
+    struct LightGridCell
+    {
+        onyxU32 PointLightOffset = 0;
+        onyxU32 PointLightCount = 0;
+        onyxU32 SpotLightOffset = 0;
+        onyxU32 SpotLightCount = 0;
+    };
+
+    // matches LightIndices in lightdata.h, point and spot lights use separate offsets into the same list
+    struct LightIndices
+    {
+        onyxU32 PointLightIndex = 0;
+        onyxU32 SpotLightIndex = 0;
+    };
+
+    struct LightClusterSettings
+    {
+        onyxU32 ClustersX = 16;
+        onyxU32 ClustersY = 9;
+        onyxU32 ClustersZ = 24;
+        onyxU32 MaxLightsPerCluster = 100;
+
+        // depth slices are distributed over the default thread pool, views with fewer visible lights are built on the calling thread
+        bool UseWorkerThreads = true;
+        onyxU32 MinLightsForWorkerThreads = 64;
+    };
+
+    // Assigns lights to the clusters of the view frustum on the CPU, producing the light grid and index list the lighting shaders consume.
+    // Clusters are laid out like the CreateLightClusters compute pass: screen tiles with exponentially distributed depth slices in view space.
+    // Lights outside of the frustum are culled first, the remaining lights are only tested against the clusters of the depth slices they touch.
+    class LightClusterBuilder
+    {
+    public:
+        LightClusterBuilder(const LightClusterSettings& settings = LightClusterSettings());
+
+        void Build(const ViewConstants& viewConstants, const Lighting& lighting);
+        void Build(const ViewConstants& viewConstants, Span<const PointLight> pointLights, Span<const SpotLight> spotLights);
+
+        const LightClusterSettings& GetSettings() const { return m_Settings; }
+        onyxU32 GetClusterCount() const { return m_Settings.ClustersX * m_Settings.ClustersY * m_Settings.ClustersZ; }
+        onyxU32 GetClusterIndex(onyxU32 x, onyxU32 y, onyxU32 z) const { return x + (y * m_Settings.ClustersX) + (z * m_Settings.ClustersX * m_Settings.ClustersY); }
+
+        const DynamicArray<LightGridCell>& GetLightGrid() const { return m_LightGrid; }
+        const DynamicArray<LightIndices>& GetLightIndices() const { return m_LightIndices; }
+        const DynamicArray<LightClusterAABB>& GetClusterBounds() const { return m_ClusterBounds; }
+
+        // lights that passed the frustum culling
+        onyxU32 GetVisiblePointLightCount() const { return static_cast<onyxU32>(m_PointLights.size()); }
+        onyxU32 GetVisibleSpotLightCount() const { return static_cast<onyxU32>(m_SpotLights.size()); }
+
+    private:
+        // view space bounding sphere of a light
+        struct CulledLight
+        {
+            onyxU32 Index = 0;
+            Vector3f32 Position;
+            onyxF32 Radius = 0.0f;
+
+            // spot lights only
+            Vector3f32 Direction;
+            onyxF32 CosAngle = 0.0f;
+            onyxF32 SinAngle = 0.0f;
+
+            onyxU32 FirstSlice = 0;
+            onyxU32 LastSlice = 0;
+        };
+
+        // cluster bounds of all slices as structure of arrays, every slice starts at a multiple of 4 so the tests can load 4 clusters at once
+        struct ClusterBoundsSoA
+        {
+            DynamicArray<onyxF32> MinX, MinY, MinZ;
+            DynamicArray<onyxF32> MaxX, MaxY, MaxZ;
+            DynamicArray<onyxF32> CenterX, CenterY, CenterZ;
+            DynamicArray<onyxF32> Radius;
+
+            void Resize(onyxU64 size);
+        };
+
+        // lights touching a slice and a bitmask per light with the clusters of the slice it overlaps
+        struct SliceAssignment
+        {
+            DynamicArray<onyxU32> PointLights;
+            DynamicArray<onyxU64> PointLightMasks;
+            DynamicArray<onyxU32> SpotLights;
+            DynamicArray<onyxU64> SpotLightMasks;
+        };
+
+        void UpdateClusterBounds(const ViewConstants& viewConstants);
+        void CullLights(const ViewConstants& viewConstants, Span<const PointLight> pointLights, Span<const SpotLight> spotLights);
+        bool GetSliceRange(onyxF32 depth, onyxF32 radius, onyxU32& outFirstSlice, onyxU32& outLastSlice) const;
+
+        // set the bit of every cluster in [first, first + count) the light overlaps, count is a multiple of 4
+        static void TestSpheres(const ClusterBoundsSoA& bounds, onyxU64 first, onyxU32 count, const CulledLight& light, onyxU64* outMask);
+        static void TestCones(const ClusterBoundsSoA& bounds, onyxU64 first, onyxU32 count, const CulledLight& light, onyxU64* outMask);
+
+        void TestSlice(onyxU32 slice);
+        void WriteSlice(onyxU32 slice);
+
+        template <typename Functor>
+        void ForEachSlice(Functor&& functor);
+
+    private:
+        LightClusterSettings m_Settings;
+
+        // inputs the cluster bounds got created for
+        Matrix4<onyxF32> m_InverseProjection { 0.0f };
+        Vector2f32 m_Viewport;
+        onyxF32 m_Near = 0.0f;
+        onyxF32 m_Far = 0.0f;
+
+        onyxU32 m_SliceStride = 0;
+        onyxU32 m_MaskWordsPerSlice = 0;
+        Array<Vector4f32, 4> m_FrustumPlanes;
+
+        ClusterBoundsSoA m_Bounds;
+        DynamicArray<LightClusterAABB> m_ClusterBounds;
+
+        DynamicArray<CulledLight> m_PointLights;
+        DynamicArray<CulledLight> m_SpotLights;
+        DynamicArray<SliceAssignment> m_Slices;
+
+        DynamicArray<LightGridCell> m_LightGrid;
+        DynamicArray<LightIndices> m_LightIndices;
+    };
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <onyx/graphics/mesh/meshoptimizer.h>
+#include <onyx/filesystem/path.h>
+#include <onyx/stream/stream.h>
+
+namespace Onyx::Graphics
+{
+    struct IndexedMesh;
+
+    // Binary, load ready mesh with optimized vertex cache and fetch order and prebuilt meshlets
+    struct CookedMesh
+    {
+        static constexpr onyxU32 MAGIC = 0x48534D4F; // "OMSH"
+        static constexpr onyxU32 VERSION = 1;
+        static constexpr StringView FILE_EXTENSION = ".omesh";
+
+        DynamicArray<Vertex> Vertices;
+        DynamicArray<onyxU32> Indices;
+        MeshletBuildResult Meshlets;
+
+        // optimizes the mesh in place and moves it into the cooked mesh
+        static void Cook(IndexedMesh&& mesh, CookedMesh& outCookedMesh);
+
+        bool Load(const FilePath& path);
+        bool Save(const FilePath& path) const;
+
+        void Serialize(Stream& outStream) const;
+        bool Deserialize(const Stream& inStream);
+    };
+}
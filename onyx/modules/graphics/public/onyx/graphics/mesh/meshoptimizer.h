@@ -0,0 +1,47 @@
+#pragma once
+
+#include <onyx/rhi/vertex.h>
+
+namespace Onyx::Graphics
+{
+    struct Meshlet
+    {
+        // offsets into the meshlet vertex and triangle arrays
+        onyxU32 VertexOffset = 0;
+        onyxU32 TriangleOffset = 0;
+        onyxU32 VertexCount = 0;
+        onyxU32 TriangleCount = 0;
+
+        Vector3f32 BoundsCenter;
+        onyxF32 BoundsRadius = 0.0f;
+    };
+
+    struct MeshletBuildResult
+    {
+        DynamicArray<Meshlet> Meshlets;
+        // indices into the mesh vertex array
+        DynamicArray<onyxU32> MeshletVertices;
+        // 3 local vertex indices per triangle, relative to the meshlet vertex offset
+        DynamicArray<onyxU8> MeshletTriangles;
+    };
+
+    namespace MeshOptimizer
+    {
+        static constexpr onyxU32 VERTEX_CACHE_SIZE = 32;
+        static constexpr onyxU32 MAX_MESHLET_VERTICES = 64;
+        static constexpr onyxU32 MAX_MESHLET_TRIANGLES = 124;
+
+        // Reorders triangles to improve post transform vertex cache hits (Forsyth, "Linear-Speed Vertex Cache Optimisation")
+        void OptimizeVertexCache(DynamicArray<onyxU32>& indices, onyxU32 vertexCount);
+
+        // Reorders vertices in order of first use and remaps the indices accordingly
+        void OptimizeVertexFetch(DynamicArray<Vertex>& vertices, DynamicArray<onyxU32>& indices);
+
+        // Greedily groups consecutive triangles into meshlets, expects the indices to be cache optimized
+        void BuildMeshlets(const DynamicArray<Vertex>& vertices, const DynamicArray<onyxU32>& indices, MeshletBuildResult& outResult,
+            onyxU32 maxVertices = MAX_MESHLET_VERTICES, onyxU32 maxTriangles = MAX_MESHLET_TRIANGLES);
+
+        // Average post transform cache misses per triangle for a FIFO cache of the given size, 0.5 is optimal for regular grids
+        onyxF32 GetAverageCacheMissRatio(const DynamicArray<onyxU32>& indices, onyxU32 vertexCount, onyxU32 cacheSize = 16);
+    }
+}
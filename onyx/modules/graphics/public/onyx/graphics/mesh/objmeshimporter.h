@@ -0,0 +1,33 @@
+#pragma once
+
+#include <onyx/filesystem/path.h>
+#include <onyx/rhi/vertex.h>
+
+namespace Onyx::Graphics
+{
+    struct ObjImportOptions
+    {
+        // Sources above this size are split at line boundaries and parsed in parallel on the default thread pool
+        onyxU64 ParallelParseThreshold = 8 * 1024 * 1024;
+        // 0 uses one chunk per hardware thread
+        onyxU32 MaxParseChunks = 0;
+        // Generate area weighted vertex normals if the source does not contain any
+        bool GenerateMissingNormals = true;
+    };
+
+    struct IndexedMesh
+    {
+        DynamicArray<Vertex> Vertices;
+        DynamicArray<onyxU32> Indices;
+    };
+
+    // Wavefront OBJ importer.
+    // Parses directly from a memory mapped file without allocating per line or per face,
+    // triangulates polygons as fans and deduplicates position/uv/normal combinations into an indexed mesh.
+    class ObjMeshImporter
+    {
+    public:
+        static bool Import(const FilePath& path, IndexedMesh& outMesh, const ObjImportOptions& options = {});
+        static bool Import(StringView source, IndexedMesh& outMesh, const ObjImportOptions& options = {});
+    };
+}
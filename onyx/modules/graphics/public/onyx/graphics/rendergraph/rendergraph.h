@@ -5,7 +5,10 @@
 #include <onyx/container/directedacyclicgraph.h>
 
 // TODO: move?
+#include <onyx/graphics/rendergraph/rendergraphbarrierplanner.h>
+#include <onyx/graphics/rendergraph/rendergraphmemoryplanner.h>
 #include <onyx/graphics/rendergraph/rendergraphtask.h>
+#include <onyx/rhi/commandbuffer.h>
 #include <onyx/rhi/graphicshandles.h>
 #include <onyx/nodegraph/graph.h>
 
@@ -46,12 +49,22 @@ namespace Onyx::Graphics
 
         bool IsInitialized() const { return m_IsInitialized; }
 
+        const DynamicArray<TransientResourceLifetime>& GetTransientResources() const { return m_TransientResources; }
+        const TransientMemoryPlan& GetTransientMemoryPlan() const { return m_TransientMemoryPlan; }
+        String GetTransientMemoryReport() const;
+
+        const RenderGraphBarrierPlan& GetBarrierPlan() const { return m_BarrierPlan; }
+        String GetBarrierReport() const;
+
     private:
         void OnBeginFrame(const FrameContext& frameContext);
         void OnRenderFrame(const FrameContext& context);
         void OnEndFrame(const FrameContext& frameContext);
 
-        bool CreateAttachment(GraphicsSystem& graphicsSystem, RenderGraphResource& resource, DynamicArray<RenderGraphResourceId>& freeList);
+        void CompileBarriers();
+        void SubmitBarriers(onyxU32 passIndex, CommandBuffer& commandBuffer);
+
+        bool CreateAttachment(GraphicsSystem& graphicsSystem, RenderGraphResource& resource, TextureStorageHandle& heapStorage);
         //bool CreateBuffer(GraphicsSystem& graphicsApi, RenderGraphNode& node, RenderGraphResource& resource);
 
     private:
@@ -61,6 +74,17 @@ namespace Onyx::Graphics
         RenderGraphResourceCache m_ResourceCache;
 
         RenderGraphResourceId m_FinalTextureId;
+
+        DynamicArray<TransientResourceLifetime> m_TransientResources;
+        TransientMemoryPlan m_TransientMemoryPlan;
+
+        DynamicArray<RenderGraphBarrierResource> m_BarrierResources;
+        DynamicArray<RenderGraphPassResourceUses> m_BarrierPasses;
+        RenderGraphBarrierPlan m_BarrierPlan;
+
+        // scratch storage for submitting the barriers of a pass
+        DynamicArray<TextureBarrier> m_TextureBarriers;
+        DynamicArray<BufferBarrier> m_BufferBarriers;
     };
 
 }
\ No newline at end of file
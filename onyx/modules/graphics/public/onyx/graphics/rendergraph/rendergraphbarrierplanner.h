@@ -0,0 +1,82 @@
+#pragma once
+
+#include <onyx/rhi/graphicstypes.h>
+
+namespace Onyx::Graphics
+{
+    enum class RenderGraphResourceUsage : onyxU8
+    {
+        Sampled,
+        InputAttachment,
+        ColorAttachment,
+        DepthStencilAttachment,
+        StorageRead,
+        StorageWrite,
+    };
+
+    struct RenderGraphResourceState
+    {
+        Context ExecutionContext = Context::Graphics;
+        Access AccessMask = Access::None;
+        ImageLayout Layout = ImageLayout::None;
+
+        bool operator==(const RenderGraphResourceState& other) const = default;
+    };
+
+    struct RenderGraphResourceUse
+    {
+        onyxU64 ResourceId = 0;
+        RenderGraphResourceUsage Usage = RenderGraphResourceUsage::Sampled;
+    };
+
+    struct RenderGraphPassResourceUses
+    {
+        String Name;
+        Context ExecutionContext = Context::Graphics;
+        DynamicArray<RenderGraphResourceUse> Uses;
+    };
+
+    struct RenderGraphBarrierResource
+    {
+        onyxU64 Id = 0;
+        String Name;
+
+        bool IsTexture = true;
+        bool IsDepth = false;
+        // transient textures are written before they are read every frame, so their previous contents can be discarded
+        bool IsTransient = false;
+    };
+
+    struct RenderGraphBarrier
+    {
+        onyxU64 ResourceId = 0;
+        bool IsTexture = true;
+        bool DiscardContents = false;
+
+        // Before is the default state on the first use in a frame, the real state is only known while recording
+        RenderGraphResourceState Before;
+        RenderGraphResourceState After;
+    };
+
+    struct RenderGraphBarrierPlan
+    {
+        // barriers to submit in one batch before each pass, indexed like the compiled passes
+        DynamicArray<DynamicArray<RenderGraphBarrier>> PassBarriers;
+
+        onyxU32 BarrierCount = 0;
+        // uses that did not need a barrier as the resource was already in a compatible state
+        onyxU32 ElidedCount = 0;
+    };
+
+    // Derives the state every pass needs for its resources and only emits barriers for layout changes and hazards.
+    // Read after read in the same layout needs no barrier, all other transitions at a pass boundary are merged.
+    class RenderGraphBarrierPlanner
+    {
+    public:
+        static RenderGraphResourceState GetRequiredState(RenderGraphResourceUsage usage, Context executionContext, bool isDepth);
+        static bool NeedsBarrier(const RenderGraphResourceState& before, const RenderGraphResourceState& after, bool isTexture);
+
+        static void Plan(const DynamicArray<RenderGraphBarrierResource>& resources, const DynamicArray<RenderGraphPassResourceUses>& passes, RenderGraphBarrierPlan& outPlan);
+        static String GetReport(const DynamicArray<RenderGraphBarrierResource>& resources, const DynamicArray<RenderGraphPassResourceUses>& passes, const RenderGraphBarrierPlan& plan);
+    };
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+namespace Onyx::Graphics
+{
+    struct TransientResourceLifetime
+    {
+        onyxU64 Id = 0;
+        String Name;
+
+        // memory requirements reported by the graphics api
+        onyxU64 Size = 0;
+        onyxU64 Alignment = 1;
+        // resources only share memory with resources of the same class (e.g.: memory type and tiling)
+        onyxU32 CompatibilityClass = 0;
+
+        // inclusive range of indices into the compiled node order
+        onyxU32 FirstUse = 0;
+        onyxU32 LastUse = 0;
+
+        bool Overlaps(const TransientResourceLifetime& other) const { return (FirstUse <= other.LastUse) && (other.FirstUse <= LastUse); }
+    };
+
+    struct TransientMemoryHeap
+    {
+        // padded to the alignment so every resource fits
+        onyxU64 Size = 0;
+        onyxU64 Alignment = 1;
+        onyxU32 CompatibilityClass = 0;
+        // indices into the planned resources, the first resource owns the memory and all others alias it
+        DynamicArray<onyxU32> Resources;
+    };
+
+    struct TransientMemoryPlan
+    {
+        DynamicArray<TransientMemoryHeap> Heaps;
+        // heap index per resource
+        DynamicArray<onyxU32> ResourceHeaps;
+
+        // sum of all heap sizes
+        onyxU64 TotalSize = 0;
+        // memory needed without any aliasing
+        onyxU64 UnaliasedSize = 0;
+        // highest amount of memory alive at the same time, lower bound for any plan
+        onyxU64 PeakLiveSize = 0;
+        onyxU32 PeakLiveNodeIndex = 0;
+    };
+
+    // Places transient render graph resources into as few and as small memory heaps as possible.
+    // Resources alias at the start of a heap so a heap is as big as its largest resource.
+    // Resources are placed from largest to smallest into the smallest heap whose resources do not overlap in lifetime.
+    class TransientMemoryPlanner
+    {
+    public:
+        static void Plan(const DynamicArray<TransientResourceLifetime>& resources, TransientMemoryPlan& outPlan);
+        static String GetReport(const DynamicArray<TransientResourceLifetime>& resources, const TransientMemoryPlan& plan);
+    };
+}
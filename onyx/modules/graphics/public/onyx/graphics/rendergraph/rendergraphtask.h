@@ -1,5 +1,6 @@
 #pragma once
 
+#include <onyx/graphics/rendergraph/rendergraphbarrierplanner.h>
 #include <onyx/rhi/graphicstypes.h>
 #include <onyx/rhi/renderpass.h>
 #include <onyx/rhi/buffer.h>
@@ -118,6 +119,9 @@ namespace Onyx::Graphics
 
         virtual void Compile(GraphicsSystem& api, RenderGraphResourceCache& resourceCache) = 0;
 
+        // called after Compile, the graph derives and submits all barriers between passes from the returned uses
+        virtual void GetResourceUses(const RenderGraphResourceCache& resourceCache, RenderGraphPassResourceUses& outPassUses) = 0;
+
         virtual void BeginFrame(const RenderGraphContext& context) = 0;
 
         virtual void PreRender(RenderGraphContext& context, CommandBuffer& commandBuffer) = 0;
@@ -140,6 +144,7 @@ namespace Onyx::Graphics
         void Init(GraphicsSystem& /*api*/, RenderGraphResourceCache& /*resourceCache*/) override { }
         void Shutdown(GraphicsSystem& /*api*/) override { }
         void Compile(GraphicsSystem& /*api*/, RenderGraphResourceCache& /*resourceCache*/) override { }
+        void GetResourceUses(const RenderGraphResourceCache& /*resourceCache*/, RenderGraphPassResourceUses& /*outPassUses*/) override { }
         void BeginFrame(const RenderGraphContext& /*context*/) override { }
         void PreRender(RenderGraphContext& /*context*/, CommandBuffer& /*commandBuffer*/) override { }
         void Render(RenderGraphContext& /*context*/, CommandBuffer& /*commandBuffer*/) override { }
@@ -159,6 +164,7 @@ namespace Onyx::Graphics
         void Shutdown(GraphicsSystem& api) final;
 
         void Compile(GraphicsSystem& api, RenderGraphResourceCache& resourceCache) override;
+        void GetResourceUses(const RenderGraphResourceCache& resourceCache, RenderGraphPassResourceUses& outPassUses) override;
 
         void BeginFrame(const RenderGraphContext& context) override;
 
@@ -171,8 +177,20 @@ namespace Onyx::Graphics
         bool OnSerialize(Serializer& serializer) const override;
         bool OnDeserialize(const Deserializer& deserializer) override;
 
-        const RenderGraphTextureResourceInfo& GetInputResourceInfo(onyxU32 pinIndex) { return pinIndex >= m_InputAttachmentInfos.size() ? m_InputAttachmentInfos.emplace_back() : m_InputAttachmentInfos[pinIndex]; }
-        const RenderGraphTextureResourceInfo& GetOuputResourceInfo(onyxU32 pinIndex) { return pinIndex >= m_OutputAttachmentInfos.size() ? m_OutputAttachmentInfos.emplace_back() : m_OutputAttachmentInfos[pinIndex]; }
+        // pins without an info use the default one, the infos only grow up to the pin count
+        const RenderGraphTextureResourceInfo& GetInputResourceInfo(onyxU32 pinIndex)
+        {
+            if (pinIndex >= m_InputAttachmentInfos.size())
+                m_InputAttachmentInfos.resize(pinIndex + 1);
+            return m_InputAttachmentInfos[pinIndex];
+        }
+
+        const RenderGraphTextureResourceInfo& GetOuputResourceInfo(onyxU32 pinIndex)
+        {
+            if (pinIndex >= m_OutputAttachmentInfos.size())
+                m_OutputAttachmentInfos.resize(pinIndex + 1);
+            return m_OutputAttachmentInfos[pinIndex];
+        }
 
         void OnSwapChainResized(GraphicsSystem& /*api*/, RenderGraphResourceCache& /*resourceCache*/) override;
 
@@ -2,6 +2,7 @@
 
 #include <onyx/nodegraph/nodes/fixedpinnode1out.h>
 #include <onyx/nodegraph/nodes/fixedpinnode1in3out.h>
+#include <onyx/graphics/lighting/lightclusterbuilder.h>
 #include <onyx/graphics/rendergraph/rendergraphtask.h>
 #include <onyx/rhi/graphicshandles.h>
 #include <onyx/rhi/graphicstypes.h>
@@ -77,6 +78,8 @@ namespace Onyx::Graphics::RenderGraphNodes
         InplaceArray<BufferHandle, MAX_FRAMES_IN_FLIGHT> m_LightIndexGlobalCountSSBO;
 
         InplaceArray<BufferHandle, MAX_FRAMES_IN_FLIGHT> m_LightsStorageBuffers;
+
+        LightClusterBuilder m_ClusterBuilder{ { .ClustersX = CLUSTER_X, .ClustersY = CLUSTER_Y, .ClustersZ = CLUSTER_Z, .MaxLightsPerCluster = MAX_LIGHTS_PER_CLUSTER } };
     };
 
 
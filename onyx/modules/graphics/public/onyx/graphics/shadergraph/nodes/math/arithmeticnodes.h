@@ -23,6 +23,8 @@ namespace Onyx::NodeGraph
     private:
         using Super = FixedPinNode_2_In_1_Out<Graphics::ShaderGraphNode, ScalarT, ScalarT, ScalarT>;
 
+        bool DoIsPure() const override { return true; }
+
         void OnUpdate(ExecutionContext& context) const override
         {
             ScalarT pin0 = context.GetPinData<typename Super::InPin0>();
@@ -74,6 +76,8 @@ namespace Onyx::NodeGraph
     private:
         using Super = FixedPinNode_2_In_1_Out<Graphics::ShaderGraphNode, ScalarT, ScalarT, ScalarT>;
 
+        bool DoIsPure() const override { return true; }
+
         void OnUpdate(ExecutionContext& context) const override
         {
             ScalarT pin0 = context.GetPinData<typename Super::InPin0>();
@@ -124,6 +128,8 @@ namespace Onyx::NodeGraph
     private:
         using Super = FixedPinNode_2_In_1_Out<Graphics::ShaderGraphNode, ScalarT, ScalarT, ScalarT>;
 
+        bool DoIsPure() const override { return true; }
+
         void OnUpdate(ExecutionContext& context) const override
         {
             ScalarT pin0 = context.GetPinData<typename Super::InPin0>();
@@ -174,6 +180,8 @@ namespace Onyx::NodeGraph
     private:
         using Super = FixedPinNode_2_In_1_Out<Graphics::ShaderGraphNode, ScalarT, ScalarT, ScalarT>;
 
+        bool DoIsPure() const override { return true; }
+
         void OnUpdate(ExecutionContext& context) const override
         {
             ScalarT pin0 = context.GetPinData<typename Super::InPin0>();
@@ -224,6 +232,8 @@ namespace Onyx::NodeGraph
     private:
         using Super = FixedPinNode_1_In_1_Out<Graphics::ShaderGraphNode, DataT, DataT>;
 
+        bool DoIsPure() const override { return true; }
+
         void OnUpdate(ExecutionContext& context) const override
         {
             DataT inPinValue = context.GetPinData<typename Super::InPin>();
@@ -18,6 +18,8 @@ namespace Onyx::NodeGraph
     private:
         using Super = FixedPinNode_2_In_1_Out<Graphics::ShaderGraphNode, VectorT<ScalarT>, ScalarT, VectorT<ScalarT>>;
 
+        bool DoIsPure() const override { return true; }
+
         void OnUpdate(ExecutionContext& context) const override
         {
             VectorT<ScalarT> pin0 = context.GetPinData<typename Super::InPin0>();
@@ -1,4 +1,5 @@
 #pragma once
+#include <onyx/hash.h>
 #include <onyx/nodegraph/nodes/math/vectornodes.h>
 
 #include <onyx/rhi/shader/generators/shadergenerator.h>
@@ -51,6 +52,12 @@ namespace Onyx::NodeGraph
             return true;
         }
 
+        void DoHashSettings(Hash::FastHasher& hasher) const override
+        {
+            // only the mask ends up in the shader code
+            hasher.Update(&Mask, sizeof(Mask));
+        }
+
 #if ONYX_IS_EDITOR
         bool OnDrawInPropertyGrid(HashMap<Guid64, std::any>& constantPinData) override
         {
@@ -111,6 +118,8 @@ namespace Onyx::NodeGraph
     private:
         using Super = FixedPinNode_1_In_2_Out<Graphics::ShaderGraphNode, Vector2<ScalarT>, ScalarT, ScalarT>;
 
+        bool DoIsPure() const override { return true; }
+
         void OnUpdate(ExecutionContext& context) const override
         {
             Vector2<ScalarT> inPin = context.GetPinData<typename Super::InPin>();
@@ -193,6 +202,8 @@ namespace Onyx::NodeGraph
     private:
         using Super = FixedPinNode_1_In_3_Out<Graphics::ShaderGraphNode, Vector3<ScalarT>, ScalarT, ScalarT, ScalarT>;
 
+        bool DoIsPure() const override { return true; }
+
         void OnUpdate(ExecutionContext& context) const override
         {
             Vector3<ScalarT> inPin = context.GetPinData<typename Super::InPin>();
@@ -295,6 +306,8 @@ namespace Onyx::NodeGraph
     private:
         using Super = FixedPinNode_1_In_4_Out<Graphics::ShaderGraphNode, Vector4<ScalarT>, ScalarT, ScalarT, ScalarT, ScalarT>;
 
+        bool DoIsPure() const override { return true; }
+
         void OnUpdate(ExecutionContext& context) const override
         {
             Vector4<ScalarT> inPin = context.GetPinData<typename Super::InPin>();
@@ -417,6 +430,8 @@ namespace Onyx::NodeGraph
     private:
         using Super = FixedPinNode_2_In_1_Out<Graphics::ShaderGraphNode, ScalarT, ScalarT, Vector2<ScalarT>>;
 
+        bool DoIsPure() const override { return true; }
+
         void OnUpdate(ExecutionContext& context) const override
         {
             ScalarT inPin0 = context.GetPinData<typename Super::InPin0>();
@@ -467,6 +482,8 @@ namespace Onyx::NodeGraph
     private:
         using Super = FixedPinNode_3_In_1_Out<Graphics::ShaderGraphNode, ScalarT, ScalarT, ScalarT, Vector3<ScalarT>>;
 
+        bool DoIsPure() const override { return true; }
+
         void OnUpdate(ExecutionContext& context) const override
         {
             ScalarT inPin0 = context.GetPinData<typename Super::InPin0>();
@@ -519,6 +536,8 @@ namespace Onyx::NodeGraph
     private:
         using Super = FixedPinNode_4_In_1_Out<Graphics::ShaderGraphNode, ScalarT, ScalarT, ScalarT, ScalarT, Vector4<ScalarT>>;
 
+        bool DoIsPure() const override { return true; }
+
         void OnUpdate(ExecutionContext& context) const override
         {
             ScalarT inPin0 = context.GetPinData<typename Super::InPin0>();
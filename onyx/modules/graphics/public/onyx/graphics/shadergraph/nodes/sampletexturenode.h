@@ -40,6 +40,7 @@ namespace Onyx::Graphics
             bool OnDeserialize(const Deserializer& deserializer) override;
 
             void DoGenerateShader(const NodeGraph::ExecutionContext& context, ShaderGenerator& generator) const override;
+            void DoHashSettings(Hash::FastHasher& hasher) const override;
             void OnChanged(Assets::AssetSystem& assetSystem) override;
 
 #if ONYX_IS_EDITOR
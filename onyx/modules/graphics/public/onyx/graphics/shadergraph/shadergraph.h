@@ -2,11 +2,7 @@
 #include <onyx/assets/asset.h>
 #include <onyx/nodegraph/graph.h>
 #include <onyx/rhi/graphicshandles.h>
-
-namespace Onyx::Graphics
-{
-    class ShaderGenerator;
-}
+#include <onyx/rhi/shader/generators/shadergenerator.h>
 
 namespace Onyx::FileSystem
 {
@@ -65,6 +61,10 @@ namespace Onyx::Graphics
     private:
 #if !ONYX_IS_RELEASE || ONYX_IS_EDITOR
         String ShaderCode;
+        // hash of the graph and generator type the shader code was generated from
+        onyxU64 ShaderCodeHash = 0;
+        // generator state before the final code was generated, restored into the caller's generator when the code is reused
+        ShaderGenerator GeneratorState;
 #endif
 
         NodeGraph::NodeGraph Graph;
@@ -6,6 +6,11 @@ namespace Onyx::Assets
     class AssetSystem;
 }
 
+namespace Onyx::Hash
+{
+    class FastHasher;
+}
+
 namespace Onyx::Graphics
 {
     class ShaderGenerator;
@@ -15,10 +20,17 @@ namespace Onyx::Graphics
     public:
         void GenerateShader(const NodeGraph::ExecutionContext& context, ShaderGenerator& generator) const { DoGenerateShader(context, generator); }
 
+        // pure nodes only depend on their inputs and settings, so equal nodes can be merged and nodes with constant inputs folded
+        bool IsPure() const { return DoIsPure(); }
+        // settings that are not stored in pins but change the generated code (e.g.: swizzle mask)
+        void HashSettings(Hash::FastHasher& hasher) const { DoHashSettings(hasher); }
+
         void OnNodeChanged(Assets::AssetSystem& assetSystem) { OnChanged(assetSystem); }
 
     private:
         virtual void DoGenerateShader(const NodeGraph::ExecutionContext& /*context*/, ShaderGenerator& /*generator*/) const {}
+        virtual bool DoIsPure() const { return false; }
+        virtual void DoHashSettings(Hash::FastHasher& /*hasher*/) const {}
         virtual void OnChanged(Assets::AssetSystem& /*assetSystem*/) {}
     };
 }
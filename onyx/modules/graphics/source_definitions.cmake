@@ -1,6 +1,13 @@
 set(onyx_TARGET_PUBLIC_SOURCES
+    culling/meshvisibility.h
     font/sdffont.h
+    lighting/lightclusterbuilder.h
+    mesh/cookedmesh.h
+    mesh/meshoptimizer.h
+    mesh/objmeshimporter.h
     rendergraph/rendergraph.h
+    rendergraph/rendergraphbarrierplanner.h
+    rendergraph/rendergraphmemoryplanner.h
     rendergraph/rendergraphnodefactory.h
     rendergraph/rendergraphtask.h
     rendergraph/tasks/atmosphericskytask.h
@@ -35,7 +42,14 @@ set(onyx_TARGET_PUBLIC_SOURCES
 
 set(onyx_TARGET_PRIVATE_SOURCES
     textureasset.cpp
+    culling/meshvisibility.cpp
+    lighting/lightclusterbuilder.cpp
+    mesh/cookedmesh.cpp
+    mesh/meshoptimizer.cpp
+    mesh/objmeshimporter.cpp
     rendergraph/rendergraph.cpp
+    rendergraph/rendergraphbarrierplanner.cpp
+    rendergraph/rendergraphmemoryplanner.cpp
     rendergraph/rendergraphtask.cpp
     rendergraph/rendergraphnodefactory.cpp
     rendergraph/tasks/atmosphericskytask.cpp
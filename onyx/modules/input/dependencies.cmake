@@ -4,5 +4,6 @@ set(onyx_TARGET_PUBLIC_DEPENDENCIES
 # maybe move the window out of onyx-graphics to avoid pulling the whole graphics module just for input handling 
 
 set(onyx_TARGET_PRIVATE_DEPENDENCIES
+    onyx-filesystem
     onyx-profiler
 )
\ No newline at end of file
@@ -0,0 +1,199 @@
+#include <onyx/input/inputrecording.h>
+
+#include <onyx/filesystem/filestream.h>
+#include <onyx/filesystem/memorymappedfile.h>
+#include <onyx/stream/memorystream.h>
+
+namespace Onyx::Input
+{
+    namespace
+    {
+        // events are written field by field, so the file has no padding and is smaller than the structs
+        void WriteEvent(Stream& outStream, const MouseAxisEvent& event)
+        {
+            outStream.Write(event.Value);
+        }
+
+        void WriteEvent(Stream& outStream, const MouseButtonEvent& event)
+        {
+            outStream.Write(event.Button);
+            outStream.Write(event.State);
+        }
+
+        void WriteEvent(Stream& outStream, const MousePositionEvent& event)
+        {
+            outStream.Write(event.Position.X);
+            outStream.Write(event.Position.Y);
+        }
+
+        void WriteEvent(Stream& outStream, const KeyboardEvent& event)
+        {
+            outStream.Write(event.Char);
+            outStream.Write(event.Key);
+            outStream.Write(event.State);
+        }
+
+        void WriteEvent(Stream& outStream, const GameControllerButtonEvent& event)
+        {
+            outStream.Write(event.ControllerIndex);
+            outStream.Write(event.Button);
+            outStream.Write(event.State);
+        }
+
+        void WriteEvent(Stream& outStream, const GameControllerAxisEvent& event)
+        {
+            outStream.Write(event.ControllerIndex);
+            outStream.Write(event.Axis);
+            outStream.Write(event.Value);
+        }
+
+        void ReadEvent(const Stream& inStream, MouseAxisEvent& outEvent)
+        {
+            inStream.Read(outEvent.Value);
+        }
+
+        void ReadEvent(const Stream& inStream, MouseButtonEvent& outEvent)
+        {
+            inStream.Read(outEvent.Button);
+            inStream.Read(outEvent.State);
+        }
+
+        void ReadEvent(const Stream& inStream, MousePositionEvent& outEvent)
+        {
+            inStream.Read(outEvent.Position.X);
+            inStream.Read(outEvent.Position.Y);
+        }
+
+        void ReadEvent(const Stream& inStream, KeyboardEvent& outEvent)
+        {
+            inStream.Read(outEvent.Char);
+            inStream.Read(outEvent.Key);
+            inStream.Read(outEvent.State);
+        }
+
+        void ReadEvent(const Stream& inStream, GameControllerButtonEvent& outEvent)
+        {
+            inStream.Read(outEvent.ControllerIndex);
+            inStream.Read(outEvent.Button);
+            inStream.Read(outEvent.State);
+        }
+
+        void ReadEvent(const Stream& inStream, GameControllerAxisEvent& outEvent)
+        {
+            inStream.Read(outEvent.ControllerIndex);
+            inStream.Read(outEvent.Axis);
+            inStream.Read(outEvent.Value);
+        }
+
+        // serialized size per variant index, used to validate the stream before reading an event
+        constexpr Array<onyxU64, std::variant_size_v<InputEventVariant>> EVENT_SIZES
+        {
+            sizeof(onyxS16),
+            sizeof(MouseButton) + sizeof(ButtonState),
+            sizeof(onyxS32) * 2,
+            sizeof(onyxU16) + sizeof(Key) + sizeof(ButtonState),
+            sizeof(onyxU32) + sizeof(GameControllerButton) + sizeof(ButtonState),
+            sizeof(onyxU32) + sizeof(GameControllerAxis) + sizeof(onyxS16),
+        };
+
+        template <onyxU64 Index = 0>
+        void ReadEventVariant(const Stream& inStream, onyxU64 typeIndex, InputEventVariant& outEvent)
+        {
+            if constexpr (Index < std::variant_size_v<InputEventVariant>)
+            {
+                if (typeIndex == Index)
+                    ReadEvent(inStream, outEvent.emplace<Index>());
+                else
+                    ReadEventVariant<Index + 1>(inStream, typeIndex, outEvent);
+            }
+        }
+    }
+
+    void InputRecording::Clear()
+    {
+        FrameCount = 0;
+        Events.clear();
+    }
+
+    bool InputRecording::Load(const FilePath& path)
+    {
+        FileSystem::MemoryMappedFile mappedFile(path);
+        if (mappedFile.IsValid() == false)
+            return false;
+
+        MemoryStream stream(mappedFile.GetData(), mappedFile.GetSize());
+        return Deserialize(stream);
+    }
+
+    bool InputRecording::Save(const FilePath& path) const
+    {
+        MemoryStream stream;
+        Serialize(stream);
+
+        FileSystem::FileStream fileStream(path, FileSystem::OpenMode::Write | FileSystem::OpenMode::Binary);
+        if (fileStream.IsValid() == false)
+            return false;
+
+        const DynamicArray<char>& buffer = stream.GetBuffer();
+        fileStream.WriteRaw(buffer.data(), buffer.size());
+        return fileStream.IsValid();
+    }
+
+    void InputRecording::Serialize(Stream& outStream) const
+    {
+        outStream.Write(MAGIC);
+        outStream.Write(VERSION);
+        outStream.Write(FixedDeltaTime);
+        outStream.Write(FrameCount);
+        outStream.Write(static_cast<onyxU32>(Events.size()));
+
+        for (const RecordedInputEvent& recordedEvent : Events)
+        {
+            outStream.Write(recordedEvent.Frame);
+            outStream.Write(static_cast<onyxU8>(recordedEvent.Event.index()));
+            std::visit([&](const auto& event) { WriteEvent(outStream, event); }, recordedEvent.Event);
+        }
+    }
+
+    bool InputRecording::Deserialize(const Stream& inStream)
+    {
+        Clear();
+
+        onyxU32 magic = 0;
+        onyxU32 version = 0;
+        onyxU32 eventCount = 0;
+        constexpr onyxU64 headerSize = sizeof(magic) + sizeof(version) + sizeof(FixedDeltaTime) + sizeof(FrameCount) + sizeof(eventCount);
+        if (inStream.GetRemainingLength() < headerSize)
+            return false;
+
+        inStream.Read(magic);
+        inStream.Read(version);
+        if ((magic != MAGIC) || (version != VERSION))
+            return false;
+
+        inStream.Read(FixedDeltaTime);
+        inStream.Read(FrameCount);
+        inStream.Read(eventCount);
+
+        // every event has at least its frame, type and one value
+        if (eventCount > (inStream.GetRemainingLength() / (sizeof(onyxU32) + sizeof(onyxU8) + sizeof(onyxS16))))
+            return false;
+
+        Events.resize(eventCount);
+        for (RecordedInputEvent& recordedEvent : Events)
+        {
+            onyxU8 typeIndex = 0;
+            if (inStream.GetRemainingLength() < (sizeof(recordedEvent.Frame) + sizeof(typeIndex)))
+                return false;
+
+            inStream.Read(recordedEvent.Frame);
+            inStream.Read(typeIndex);
+            if ((typeIndex >= EVENT_SIZES.size()) || (inStream.GetRemainingLength() < EVENT_SIZES[typeIndex]))
+                return false;
+
+            ReadEventVariant(inStream, typeIndex, recordedEvent.Event);
+        }
+
+        return true;
+    }
+}
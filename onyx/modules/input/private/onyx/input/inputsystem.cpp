@@ -10,11 +10,27 @@ namespace Onyx::Input
         onyxU8 queueIndex = m_CurrentQueueIndex;
         m_CurrentQueueIndex = (m_CurrentQueueIndex + 1) % INPUT_QUEUE_COUNT;
 
+        if (m_RecordingMode == RecordingMode::Replaying)
+        {
+            // replace the platform input with the recorded events of this frame
+            ClearQueue(queueIndex);
+            QueueReplayEvents(queueIndex);
+        }
+
         // process input queues
         UpdateMouse(queueIndex);
         UpdateKeyboard(queueIndex);
         UpdateGameControllers(queueIndex);
         
+        if (m_RecordingMode != RecordingMode::None)
+        {
+            ++m_RecordingFrame;
+            if ((m_RecordingMode == RecordingMode::Replaying) && (m_RecordingFrame >= m_Recording.FrameCount))
+            {
+                StopReplay();
+                m_ReplayFinishedSignal.Dispatch();
+            }
+        }
 
         m_MouseDelta = m_MousePosition - m_LastMousePosition;
         m_LastMousePosition = m_MousePosition;
@@ -144,12 +160,92 @@ namespace Onyx::Input
         //m_MainWindow->EnableSystemMouseCapture(enable);
     }
 
+    void InputSystem::StartRecording(onyxU64 fixedDeltaTime)
+    {
+        ONYX_ASSERT(m_RecordingMode == RecordingMode::None, "Input is already being recorded or replayed.");
+
+        m_Recording.Clear();
+        m_Recording.FixedDeltaTime = fixedDeltaTime;
+        m_RecordingFrame = 0;
+        m_RecordingMode = RecordingMode::Recording;
+    }
+
+    bool InputSystem::StopRecording(const FilePath& path)
+    {
+        if (m_RecordingMode != RecordingMode::Recording)
+            return false;
+
+        m_RecordingMode = RecordingMode::None;
+        m_Recording.FrameCount = m_RecordingFrame;
+
+        bool hasSaved = m_Recording.Save(path);
+        if (hasSaved == false)
+        {
+            ONYX_LOG_ERROR("Failed saving input recording to {}", path.string());
+        }
+
+        m_Recording.Clear();
+        return hasSaved;
+    }
+
+    bool InputSystem::StartReplay(const FilePath& path)
+    {
+        ONYX_ASSERT(m_RecordingMode == RecordingMode::None, "Input is already being recorded or replayed.");
+
+        if (m_Recording.Load(path) == false)
+        {
+            ONYX_LOG_ERROR("Failed loading input recording {}", path.string());
+            m_Recording.Clear();
+            return false;
+        }
+
+        m_RecordingFrame = 0;
+        m_ReplayEventIndex = 0;
+        m_RecordingMode = RecordingMode::Replaying;
+        return true;
+    }
+
+    void InputSystem::StopReplay()
+    {
+        if (m_RecordingMode != RecordingMode::Replaying)
+            return;
+
+        m_RecordingMode = RecordingMode::None;
+        m_Recording.Clear();
+    }
+
+    void InputSystem::QueueReplayEvents(onyxU8 queueIndex)
+    {
+        // the queue index only changes in Update, so adding the events now puts them into the queue that is processed next
+        const onyxU8 currentQueueIndex = m_CurrentQueueIndex;
+        m_CurrentQueueIndex = queueIndex;
+
+        const DynamicArray<RecordedInputEvent>& events = m_Recording.Events;
+        for (; (m_ReplayEventIndex < events.size()) && (events[m_ReplayEventIndex].Frame == m_RecordingFrame); ++m_ReplayEventIndex)
+        {
+            std::visit([&](const auto& event) { AddEvent(event); }, events[m_ReplayEventIndex].Event);
+        }
+
+        m_CurrentQueueIndex = currentQueueIndex;
+    }
+
+    void InputSystem::ClearQueue(onyxU8 queueIndex)
+    {
+        m_MouseAxisInputQueue[queueIndex].reset();
+        m_MouseButtonInputQueue[queueIndex].clear();
+        m_MousePositionInputQueue[queueIndex].reset();
+        m_KeyboardInputQueue[queueIndex].clear();
+        m_ControllerButtonInputQueue[queueIndex].clear();
+        m_ControllerAxisInputQueue[queueIndex].clear();
+    }
+
     void InputSystem::UpdateMouse(onyxU8 queueIndex)
     {
         if (m_MouseAxisInputQueue[queueIndex].has_value())
         {
             MouseAxisEvent event = m_MouseAxisInputQueue[queueIndex].value();
             m_MouseScroll = event.Value;
+            RecordEvent(event);
             m_MouseAxisSignal.Dispatch(event);
             m_MouseAxisInputQueue[queueIndex].reset();
         }
@@ -157,6 +253,7 @@ namespace Onyx::Input
         for (const MouseButtonEvent& event : m_MouseButtonInputQueue[queueIndex])
         {
             m_MouseButtonStates[ToIndex(event.Button)] = event.State != ButtonState::Up;
+            RecordEvent(event);
             m_MouseButtonSignal.Dispatch(event);
         }
          m_MouseButtonInputQueue[queueIndex].clear();
@@ -165,6 +262,7 @@ namespace Onyx::Input
         {
             MousePositionEvent event = m_MousePositionInputQueue[queueIndex].value();
             m_MousePosition = event.Position;
+            RecordEvent(event);
             m_MousePositionSignal.Dispatch(event);
             m_MousePositionInputQueue[queueIndex].reset();
         }
@@ -175,6 +273,7 @@ namespace Onyx::Input
         for (const KeyboardEvent& event : m_KeyboardInputQueue[queueIndex])
         {
             m_KeyState[ToIndex(event.Key)] = event.State != ButtonState::Up;
+            RecordEvent(event);
             m_KeySignal.Dispatch(event);
         }
         m_KeyboardInputQueue[queueIndex].clear();
@@ -184,15 +283,16 @@ namespace Onyx::Input
     {
         for (const GameControllerAxisEvent& event : m_ControllerAxisInputQueue[queueIndex])
         {
-            GameController& controller = m_Gamepads[event.ControllerIndex];
+            GameController& controller = GetOrAddController(event.ControllerIndex);
             controller.m_AxisValues[ToIndex((event.Axis))] = event.Value;
+            RecordEvent(event);
             m_ControllerAxisSignal.Dispatch(event);
         }
         m_ControllerAxisInputQueue[queueIndex].clear();
 
         for (const GameControllerButtonEvent& event : m_ControllerButtonInputQueue[queueIndex])
         {
-            GameController& controller = m_Gamepads[event.ControllerIndex];
+            GameController& controller = GetOrAddController(event.ControllerIndex);
 
             onyxU32 buttonMask = 1 << ToIndex(event.Button);
             if (event.State == ButtonState::Up)
@@ -204,14 +304,25 @@ namespace Onyx::Input
                 controller.ButtonStates |= buttonMask;
             }
 
-            
-
+            RecordEvent(event);
             m_ControllerButtonSignal.Dispatch(event);
         }
 
         m_ControllerButtonInputQueue[queueIndex].clear();
     }
 
+    GameController& InputSystem::GetOrAddController(onyxU32 controllerIndex)
+    {
+        // controllers are added on their first event, replays also send events for controllers that are not connected
+        if (controllerIndex >= m_Gamepads.size())
+            m_Gamepads.resize(controllerIndex + 1);
+
+        GameController& controller = m_Gamepads[controllerIndex];
+        controller.Index = controllerIndex;
+        controller.IsConnected = true;
+        return controller;
+    }
+
 #if ONYX_IS_WINDOWS && !ONYX_USE_SDL2
 
 
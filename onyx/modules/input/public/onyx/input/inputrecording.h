@@ -0,0 +1,42 @@
+#pragma once
+
+#include <onyx/input/inputevent.h>
+
+namespace Onyx
+{
+    class Stream;
+}
+
+namespace Onyx::Input
+{
+    using InputEventVariant = Variant<MouseAxisEvent, MouseButtonEvent, MousePositionEvent, KeyboardEvent, GameControllerButtonEvent, GameControllerAxisEvent>;
+
+    struct RecordedInputEvent
+    {
+        // number of input updates since the recording started
+        onyxU32 Frame = 0;
+        InputEventVariant Event;
+    };
+
+    // Raw input events of a session in the order the input system processed them.
+    // Replaying it with the same fixed delta time reproduces the simulation independent of the platform input backends.
+    struct InputRecording
+    {
+        static constexpr onyxU32 MAGIC = 0x504E494F; // "OINP"
+        static constexpr onyxU32 VERSION = 2;
+        static constexpr StringView FILE_EXTENSION = ".oinput";
+
+        // in nanoseconds, 0 uses the measured frame time
+        onyxU64 FixedDeltaTime = 0;
+        onyxU32 FrameCount = 0;
+        DynamicArray<RecordedInputEvent> Events;
+
+        void Clear();
+
+        bool Load(const FilePath& path);
+        bool Save(const FilePath& path) const;
+
+        void Serialize(Stream& outStream) const;
+        bool Deserialize(const Stream& inStream);
+    };
+}
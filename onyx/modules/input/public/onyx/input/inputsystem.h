@@ -9,6 +9,7 @@
 
 #include <onyx/eventhandler.h>
 #include <onyx/input/inputevent.h>
+#include <onyx/input/inputrecording.h>
 
 namespace Onyx
 {
@@ -43,6 +44,8 @@ namespace Onyx::Input
         using ControllerAxisSignalT = Signal<void(const GameControllerAxisEvent&)>;
         using ControllerButtonSignalT = Signal<void(const GameControllerButtonEvent&)>;
 
+        using ReplayFinishedSignalT = Signal<void()>;
+
         static constexpr StringId32 TypeId = "Onyx::Input::InputModule";
         StringId32 GetTypeId() const override { return TypeId; }
 
@@ -55,6 +58,8 @@ namespace Onyx::Input
         Sink<ControllerAxisSignalT> OnControllerAxisChange() { return Sink<ControllerAxisSignalT>(m_ControllerAxisSignal); } 
         Sink<ControllerButtonSignalT> OnControllerButton() { return Sink<ControllerButtonSignalT>(m_ControllerButtonSignal); } 
 
+        Sink<ReplayFinishedSignalT> OnReplayFinished() { return Sink<ReplayFinishedSignalT>(m_ReplayFinishedSignal); }
+
         void Update();
 
         void AddEvent(MouseAxisEvent event) { m_MouseAxisInputQueue[m_CurrentQueueIndex] = event; }
@@ -81,10 +86,42 @@ namespace Onyx::Input
 
         void EnableSystemMouseCapture(bool enable);
 
+        // records all processed input events, the fixed delta time is in nanoseconds and 0 keeps the measured frame time
+        void StartRecording(onyxU64 fixedDeltaTime = 0);
+        bool StopRecording(const FilePath& path);
+        bool IsRecording() const { return m_RecordingMode == RecordingMode::Recording; }
+
+        // events of the platform backends are ignored while replaying
+        bool StartReplay(const FilePath& path);
+        void StopReplay();
+        bool IsReplaying() const { return m_RecordingMode == RecordingMode::Replaying; }
+
+        // the application uses the fixed delta time instead of the measured frame time so replays simulate the same frames
+        bool HasFixedDeltaTime() const { return (m_RecordingMode != RecordingMode::None) && (m_Recording.FixedDeltaTime != 0); }
+        onyxU64 GetFixedDeltaTime() const { return m_Recording.FixedDeltaTime; }
+
     private:
+        enum class RecordingMode : onyxU8
+        {
+            None,
+            Recording,
+            Replaying
+        };
+
+        template <typename T>
+        void RecordEvent(const T& event)
+        {
+            if (m_RecordingMode == RecordingMode::Recording)
+                m_Recording.Events.push_back({ m_RecordingFrame, event });
+        }
+
+        void QueueReplayEvents(onyxU8 queueIndex);
+        void ClearQueue(onyxU8 queueIndex);
+
         void UpdateMouse(onyxU8 queueIndex);
         void UpdateKeyboard(onyxU8 queueIndex);
         void UpdateGameControllers(onyxU8 queueIndex);
+        GameController& GetOrAddController(onyxU32 controllerIndex);
 
     private:
         MouseAxisSignalT m_MouseAxisSignal;
@@ -96,6 +133,8 @@ namespace Onyx::Input
         ControllerAxisSignalT m_ControllerAxisSignal;
         ControllerButtonSignalT m_ControllerButtonSignal;
 
+        ReplayFinishedSignalT m_ReplayFinishedSignal;
+
 //#if ONYX_IS_PC
         bool m_MouseButtonStates[MouseButton_Count] = { false };
         bool m_KeyState[Key_Count] = { false };
@@ -119,5 +158,10 @@ namespace Onyx::Input
         InplaceArray<DynamicArray<GameControllerAxisEvent>, INPUT_QUEUE_COUNT> m_ControllerAxisInputQueue;
 
         onyxU8 m_CurrentQueueIndex = 0;
+
+        InputRecording m_Recording;
+        RecordingMode m_RecordingMode = RecordingMode::None;
+        onyxU32 m_RecordingFrame = 0;
+        onyxU64 m_ReplayEventIndex = 0;
     };
 }
@@ -2,6 +2,7 @@ set(onyx_TARGET_PUBLIC_SOURCES
     gamecontroller.h    
     inputevent.h
     inputid.h
+    inputrecording.h
     inputsystem.h
     inputtypes.h
     keycodes.h
@@ -10,5 +11,6 @@ set(onyx_TARGET_PUBLIC_SOURCES
 
 set(onyx_TARGET_PRIVATE_SOURCES
     inputid.cpp
+    inputrecording.cpp
     inputsystem.cpp
 )
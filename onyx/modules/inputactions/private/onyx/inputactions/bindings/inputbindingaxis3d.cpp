@@ -9,9 +9,9 @@ namespace Onyx::InputActions
     bool InputBindingAxis3D::DoUpdate(const Input::InputSystem& inputSystem, Vector3f32& outInputValue)
     {
         outInputValue.X = numeric_cast<onyxF32>(inputSystem.GetAxisValue1D(0, m_AxisX));
-        outInputValue.X = numeric_cast<onyxF32>(inputSystem.GetAxisValue1D(0, m_AxisY));
+        outInputValue.Y = numeric_cast<onyxF32>(inputSystem.GetAxisValue1D(0, m_AxisY));
         outInputValue.Z = numeric_cast<onyxF32>(inputSystem.GetAxisValue1D(0, m_AxisZ));
-        return IsZero(outInputValue.X) == false || IsZero(outInputValue.Y) || IsZero(outInputValue.Z);
+        return IsZero(outInputValue.X) == false || IsZero(outInputValue.Y) == false || IsZero(outInputValue.Z) == false;
     }
 
     void InputBindingAxis3D::Reset()
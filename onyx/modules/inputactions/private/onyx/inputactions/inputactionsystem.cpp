@@ -7,11 +7,60 @@
 #include <onyx/inputactions/inputactionsasset.h>
 #include <onyx/inputactions/inputactionsmap.h>
 #include <onyx/inputactions/bindings/inputbinding.h>
+#include <onyx/inputactions/bindings/inputbindingaxis1d.h>
+#include <onyx/inputactions/bindings/inputbindingaxis1dcomposite.h>
+#include <onyx/inputactions/bindings/inputbindingaxis2d.h>
+#include <onyx/inputactions/bindings/inputbindingaxis2dcomposite.h>
+#include <onyx/inputactions/bindings/inputbindingaxis3d.h>
+#include <onyx/inputactions/bindings/inputbindingaxis3dcomposite.h>
+#include <onyx/inputactions/bindings/inputbindingbool.h>
 
 #include <onyx/serialize/deserializer.h>
 
 namespace Onyx::InputActions
 {
+    namespace
+    {
+        struct BatchedSlot
+        {
+            onyxU8 Component;
+            onyxF32 Scale;
+        };
+
+        // how the slots of a binding type map to the action value, has to match the DoUpdate of the binding
+        struct BatchedBindingLayout
+        {
+            StringId32 TypeId;
+            bool IsAxis;
+            onyxU8 SlotCount;
+            Array<BatchedSlot, 6> Slots;
+        };
+
+        constexpr Array<BatchedBindingLayout, 7> BATCHED_BINDING_LAYOUTS
+        {{
+            { InputBindingBool::TypeId, false, 1, {{ { 0, 1.0f } }} },
+            { InputBindingAxis1DComposite::TypeId, false, 2, {{ { 0, 1.0f }, { 0, -1.0f } }} },
+            // up, down, left, right
+            { InputBindingAxis2DComposite::TypeId, false, 4, {{ { 1, 1.0f }, { 1, -1.0f }, { 0, -1.0f }, { 0, 1.0f } }} },
+            // up, down, left, right, forward, backward
+            { InputBindingAxis3DComposite::TypeId, false, 6, {{ { 1, 1.0f }, { 1, -1.0f }, { 0, -1.0f }, { 0, 1.0f }, { 2, 1.0f }, { 2, -1.0f } }} },
+            { InputBindingAxis1D::TypeId, true, 1, {{ { 0, 1.0f } }} },
+            { InputBindingAxis2D::TypeId, true, 2, {{ { 0, 1.0f }, { 1, 1.0f } }} },
+            { InputBindingAxis3D::TypeId, true, 3, {{ { 0, 1.0f }, { 1, 1.0f }, { 2, 1.0f } }} },
+        }};
+
+        const BatchedBindingLayout* FindBatchedBindingLayout(StringId32 typeId)
+        {
+            for (const BatchedBindingLayout& layout : BATCHED_BINDING_LAYOUTS)
+            {
+                if (layout.TypeId == typeId)
+                    return &layout;
+            }
+
+            return nullptr;
+        }
+    }
+
     InputActionSystem::InputActionSystem(const InputActionSystemSettings& settings, Input::InputSystem& inputSystem, Assets::AssetSystem& assetSystem)
         : m_InputSystem(&inputSystem)
     {
@@ -24,6 +73,11 @@ namespace Onyx::InputActions
         }
     }
 
+    InputActionSystem::InputActionSystem(Input::InputSystem& inputSystem)
+        : m_InputSystem(&inputSystem)
+    {
+    }
+
     InputActionSystem::~InputActionSystem() = default;
 
     void InputActionSystem::Update()
@@ -31,7 +85,7 @@ namespace Onyx::InputActions
         if (m_ContextId.IsValid() == false)
             return;
 
-        UpdateContext(m_InputActionsAsset->GetContext(m_ContextId));
+        UpdateContext();
     }
 
     void InputActionSystem::SetActionsMapAsset(Assets::AssetHandle<InputActionsAsset> inputAsset)
@@ -59,13 +113,19 @@ namespace Onyx::InputActions
             }
 
         }
+        else if (m_ContextId.IsValid() && m_InputActionsAsset.IsValid())
+        {
+            // reloaded, the compiled bindings point into the old bindings
+            ClearContext();
+            InitContext();
+        }
     }
 
     void InputActionSystem::SetCurrentInputActionMap(StringId32 id)
     {
         if (id != m_ContextId)
         {
-            m_CurrentActionStates.clear();
+            ClearContext();
 
             // should we clear input signals not in the map anymore?
 
@@ -78,32 +138,52 @@ namespace Onyx::InputActions
         }
     }
 
-    Optional<const InputActionState*> InputActionSystem::GetActionState(StringId64 actionId) const
+    InputActionHandle InputActionSystem::GetActionHandle(StringId64 actionId)
     {
-        auto it = std::find_if(m_CurrentActionStates.begin(), m_CurrentActionStates.end(), [&](const InputActionState& state)
-            {
-                return state.ActionId == actionId;
-            });
+        auto [it, isNew] = m_ActionIndices.try_emplace(actionId, static_cast<onyxU32>(m_ActionStates.size()));
+        if (isNew)
+        {
+            m_ActionStates.emplace_back(actionId);
+            m_IsActionInContext.push_back(0);
+        }
+
+        return { it->second };
+    }
 
-        if (it == m_CurrentActionStates.end())
+    Optional<const InputActionState*> InputActionSystem::GetActionState(InputActionHandle handle) const
+    {
+        if ((handle.Index >= m_ActionStates.size()) || (m_IsActionInContext[handle.Index] == 0))
             return std::nullopt;
 
-        const InputActionState& actionState = *it;
-        return &actionState;
+        return &m_ActionStates[handle.Index];
     }
 
-    Optional<InputActionState*> InputActionSystem::GetActionState(StringId64 actionId)
+    Optional<const InputActionState*> InputActionSystem::GetActionState(StringId64 actionId) const
     {
-        auto it = std::find_if(m_CurrentActionStates.begin(), m_CurrentActionStates.end(), [&](const InputActionState& state)
-            {
-                return state.ActionId == actionId;
-            });
+        auto it = m_ActionIndices.find(actionId);
+        if (it == m_ActionIndices.end())
+            return std::nullopt;
+
+        return GetActionState(InputActionHandle{ it->second });
+    }
 
-        if (it == m_CurrentActionStates.end())
+    Optional<InputActionState*> InputActionSystem::GetActionState(StringId64 actionId)
+    {
+        const InputActionState* state = std::as_const(*this).GetActionState(actionId).value_or(nullptr);
+        if (state == nullptr)
             return std::nullopt;
 
-        InputActionState& actionState = *it;
-        return &actionState;
+        return const_cast<InputActionState*>(state);
+    }
+
+    bool InputActionSystem::IsActionTriggered(InputActionHandle handle) const
+    {
+        if (const InputActionState* state = GetActionState(handle).value_or(nullptr))
+        {
+            return IsZero(state->Value) == false;
+        }
+
+        return false;
     }
 
     bool InputActionSystem::IsActionTriggered(StringId64 actionId) const
@@ -118,50 +198,117 @@ namespace Onyx::InputActions
 
     void InputActionSystem::InitContext()
     {
-        const InputActionsMap& context = m_InputActionsAsset->GetContext(m_ContextId);
+        InputActionsMap& context = m_InputActionsAsset->GetContext(m_ContextId);
 
-        m_CurrentActionStates.reserve(context.GetActions().size());
-        for (const InputAction& action : context.GetActions())
+        DynamicArray<InputAction>& actions = context.GetActions();
+        m_ContextActions.reserve(actions.size());
+        for (InputAction& action : actions)
         {
-            auto it = std::find_if(m_CurrentActionStates.begin(), m_CurrentActionStates.end(), [&](const InputActionState& state)
-                {
-                    return state.ActionId == action.GetId();
-                });
+            const InputActionHandle handle = GetActionHandle(action.GetId());
+            m_IsActionInContext[handle.Index] = 1;
 
-            if (it != m_CurrentActionStates.end())
-                continue;
+            ContextAction& contextAction = m_ContextActions.emplace_back();
+            contextAction.StateIndex = handle.Index;
+            contextAction.FirstBinding = static_cast<onyxU32>(m_UnbatchedBindings.size());
+            contextAction.BindingCount = static_cast<onyxU32>(action.GetBindings().size());
 
-            m_CurrentActionStates.emplace_back(action.GetId());
+            for (UniquePtr<InputBinding>& binding : action.GetBindings())
+                CompileBinding(*binding);
         }
+
+        m_BindingValues.resize(m_UnbatchedBindings.size());
+        m_IsBindingTriggered.resize(m_UnbatchedBindings.size());
     }
 
-    void InputActionSystem::UpdateContext(InputActionsMap& context)
+    void InputActionSystem::ClearContext()
     {
-        DynamicArray<InputAction>& actions = context.GetActions();
-        const onyxU32 actionsCount = static_cast<onyxU32>(actions.size());
+        for (onyxU32 i = 0; i < m_ActionStates.size(); ++i)
+        {
+            m_ActionStates[i].Value = Vector3f32::Zero();
+            m_IsActionInContext[i] = 0;
+        }
+
+        m_ContextActions.clear();
+        m_ButtonInputs.clear();
+        m_AxisInputs.clear();
+        m_UnbatchedBindings.clear();
+        m_BindingValues.clear();
+        m_IsBindingTriggered.clear();
+    }
+
+    void InputActionSystem::CompileBinding(InputBinding& binding)
+    {
+        const onyxU32 bindingIndex = static_cast<onyxU32>(m_UnbatchedBindings.size());
 
-        for (onyxU32 actionIndex = 0; actionIndex < actionsCount; ++actionIndex)
+        // triggers can depend on other actions so they are evaluated in action order
+        const BatchedBindingLayout* layout = binding.GetTriggers().empty() ? FindBatchedBindingLayout(binding.GetTypeId()) : nullptr;
+        if (layout == nullptr)
         {
-            InputAction& action = actions[actionIndex];
-            StringId64 actionId = action.GetId();
+            m_UnbatchedBindings.push_back(&binding);
+            return;
+        }
 
-            Optional<InputActionState*> optionalActionState = GetActionState(actionId);
-            ONYX_ASSERT(optionalActionState.has_value());
+        m_UnbatchedBindings.push_back(nullptr);
 
-            InputActionState& actionState = *optionalActionState.value();
+        DynamicArray<BatchedInput>& inputs = layout->IsAxis ? m_AxisInputs : m_ButtonInputs;
+        for (onyxU8 slot = 0; slot < layout->SlotCount; ++slot)
+        {
+            BatchedInput& input = inputs.emplace_back();
+            input.Input = binding.GetBoundInputForSlot(slot);
+            input.Component = layout->Slots[slot].Component;
+            input.Scale = layout->Slots[slot].Scale;
+            input.BindingIndex = bindingIndex;
+        }
+    }
 
-            DynamicArray<UniquePtr<InputBinding>>& bindings = action.GetBindings();
-            const onyxU32 bindingsCount = static_cast<onyxU32>(bindings.size());
+    void InputActionSystem::EvaluateBatchedBindings()
+    {
+        std::ranges::fill(m_BindingValues, Vector3f32::Zero());
+        std::ranges::fill(m_IsBindingTriggered, onyxU8(0));
+
+        for (const BatchedInput& input : m_ButtonInputs)
+        {
+            if (m_InputSystem->IsButtonDown(input.Input))
+            {
+                m_BindingValues[input.BindingIndex][input.Component] += input.Scale;
+                m_IsBindingTriggered[input.BindingIndex] = 1;
+            }
+        }
+
+        for (const BatchedInput& input : m_AxisInputs)
+        {
+            const onyxF32 value = numeric_cast<onyxF32>(m_InputSystem->GetAxisValue1D(0, input.Input));
+            m_BindingValues[input.BindingIndex][input.Component] = value;
+            if (IsZero(value) == false)
+                m_IsBindingTriggered[input.BindingIndex] = 1;
+        }
+    }
+
+    void InputActionSystem::UpdateContext()
+    {
+        EvaluateBatchedBindings();
+
+        for (const ContextAction& action : m_ContextActions)
+        {
+            InputActionState& actionState = m_ActionStates[action.StateIndex];
 
             bool hasTriggered = false;
             Vector3f32 newInputValue(std::numeric_limits<onyxF32>::lowest());
-            for (onyxU32 bindingIndex = 0; bindingIndex < bindingsCount; ++bindingIndex )
+            const onyxU32 bindingsEnd = action.FirstBinding + action.BindingCount;
+            for (onyxU32 bindingIndex = action.FirstBinding; bindingIndex < bindingsEnd; ++bindingIndex)
             {
-                InputBinding& binding = *bindings[bindingIndex];
-
                 Vector3f32 bindingInputValue;
-                bool isTriggered = binding.Update(*m_InputSystem, *this, bindingInputValue);
-               
+                bool isTriggered = false;
+                if (InputBinding* binding = m_UnbatchedBindings[bindingIndex])
+                {
+                    isTriggered = binding->Update(*m_InputSystem, *this, bindingInputValue);
+                }
+                else
+                {
+                    isTriggered = m_IsBindingTriggered[bindingIndex] != 0;
+                    bindingInputValue = m_BindingValues[bindingIndex];
+                }
+
                 if (isTriggered)
                 {
                     hasTriggered = true;
@@ -179,8 +326,13 @@ namespace Onyx::InputActions
             if (actionState.Value != newInputValue)
             {
                 actionState.Value = newInputValue;
-                InputActionEvent event{ actionId, actionState.Value };
-                m_InputActionSignals[actionId].Dispatch(event);
+
+                auto signalIt = m_InputActionSignals.find(actionState.ActionId);
+                if (signalIt != m_InputActionSignals.end())
+                {
+                    InputActionEvent event{ actionState.ActionId, actionState.Value };
+                    signalIt->second.Dispatch(event);
+                }
             }
         }
     }
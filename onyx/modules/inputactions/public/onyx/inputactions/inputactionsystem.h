@@ -3,6 +3,7 @@
 #include <onyx/engine/enginesystem.h>
 #include <onyx/assets/assethandle.h>
 
+#include <onyx/input/inputid.h>
 #include <onyx/inputactions/inputactionsasset.h>
 #include <onyx/inputactions/inputactionsmap.h>
 
@@ -68,6 +69,15 @@ namespace Onyx::InputActions
         StringId64 ActionId;
     };
 
+    // Index of an action state, resolve it once through InputActionSystem::GetActionHandle instead of looking up the id per query.
+    // Handles stay valid when switching the input action map, actions that are not part of the current map have no state.
+    struct InputActionHandle
+    {
+        bool IsValid() const { return Index != onyxMax_U32; }
+
+        onyxU32 Index = onyxMax_U32;
+    };
+
     struct InputActionSystemSettings
     {
         Assets::AssetId InputActionId { "engine:/inputcontexts.oinput" };
@@ -83,6 +93,8 @@ namespace Onyx::InputActions
         StringId32 GetTypeId() const override { return TypeId; }
 
         InputActionSystem(const InputActionSystemSettings& settings, Input::InputSystem& inputSystem, Assets::AssetSystem& assetSystem);
+        // starts without actions map, it has to be set with SetActionsMapAsset
+        explicit InputActionSystem(Input::InputSystem& inputSystem);
         ~InputActionSystem() override;
 
         void Update();
@@ -90,8 +102,11 @@ namespace Onyx::InputActions
         void SetActionsMapAsset(Assets::AssetHandle<InputActionsAsset> inputAsset);
         void SetCurrentInputActionMap(StringId32 id);
 
+        InputActionHandle GetActionHandle(StringId64 actionId);
+
         Optional<InputActionState*> GetActionState(StringId64 actionId);
         Optional<const InputActionState*> GetActionState(StringId64 actionId) const;
+        Optional<const InputActionState*> GetActionState(InputActionHandle handle) const;
 
         template<auto Candidate, typename... Type>
         void OnInput(StringId64 actionId, Type&&... value_or_instance)
@@ -111,16 +126,51 @@ namespace Onyx::InputActions
         }
 
         bool IsActionTriggered(StringId64 actionId) const;
+        bool IsActionTriggered(InputActionHandle handle) const;
 
     private:
+        // input of a binding that is evaluated in a batch with all other inputs of the same kind
+        struct BatchedInput
+        {
+            Input::InputID Input;
+            onyxU8 Component = 0;
+            onyxF32 Scale = 1.0f;
+            onyxU32 BindingIndex = 0;
+        };
+
+        struct ContextAction
+        {
+            onyxU32 StateIndex = 0;
+            onyxU32 FirstBinding = 0;
+            onyxU32 BindingCount = 0;
+        };
+
         void InitContext();
-        void UpdateContext(InputActionsMap& context);
+        void ClearContext();
+        void CompileBinding(InputBinding& binding);
+
+        void EvaluateBatchedBindings();
+        void UpdateContext();
 
     private:
         Input::InputSystem* m_InputSystem = nullptr;
 
         Assets::AssetHandle<InputActionsAsset> m_InputActionsAsset;
-        DynamicArray<InputActionState> m_CurrentActionStates;
+
+        // states are only ever added so handles stay stable
+        HashMap<StringId64, onyxU32> m_ActionIndices;
+        DynamicArray<InputActionState> m_ActionStates;
+        DynamicArray<onyxU8> m_IsActionInContext;
+
+        // current map compiled into flat arrays, bindings are indexed in action order
+        DynamicArray<ContextAction> m_ContextActions;
+        DynamicArray<BatchedInput> m_ButtonInputs;
+        DynamicArray<BatchedInput> m_AxisInputs;
+        // bindings with triggers or of unknown types still use the virtual update, nullptr if the binding is batched
+        DynamicArray<InputBinding*> m_UnbatchedBindings;
+        DynamicArray<Vector3f32> m_BindingValues;
+        DynamicArray<onyxU8> m_IsBindingTriggered;
+
         HashMap<StringId64, InputActionSignalT> m_InputActionSignals;
 
         StringId32 m_ContextId = 0;
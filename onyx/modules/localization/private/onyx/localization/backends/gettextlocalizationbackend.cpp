@@ -99,33 +99,12 @@ namespace Onyx::Localization
 
     Optional<StringView> GetTextLocalizationBackend::GetLocalized(LocalizationId id, const GetTextLocalizationDatabase& database) const
     {
-        const HashMap<LocalizationId, DynamicArray<String>>& databaseMap = database.GetDatabase();
-        auto it = databaseMap.find(id);
-        if (it == databaseMap.end())
-        {
-            return std::nullopt;
-        }
-
-        return it->second.front();
+        return database.GetCatalog().GetLocalized(id);
     }
 
     Optional<StringView> GetTextLocalizationBackend::GetLocalized(LocalizationId id, onyxS32 count, const GetTextLocalizationDatabase& database) const
     {
-        const HashMap<LocalizationId, DynamicArray<String>>& databaseMap = database.GetDatabase();
-        auto it = databaseMap.find(id);
-        if (it == databaseMap.end())
-        {
-            return std::nullopt;
-        }
-
-        onyxS32 index = database.GetPluralFunction()(count);
-        const DynamicArray<String>& localizedTexts = it->second;
-        if (index > static_cast<onyxS32>(localizedTexts.size()))
-        {
-            return std::nullopt;
-        }
-
-        return localizedTexts[index];
+        return database.GetCatalog().GetLocalized(id, count);
     }
 
 #if !ONYX_IS_RETAIL
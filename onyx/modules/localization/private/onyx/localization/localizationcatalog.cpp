@@ -0,0 +1,291 @@
+#include <onyx/localization/localizationcatalog.h>
+
+#include <onyx/filesystem/filestream.h>
+#include <onyx/stream/memorystream.h>
+
+#include <numeric>
+
+namespace Onyx::Localization
+{
+    namespace
+    {
+        constexpr onyxU64 GOLDEN_RATIO = 0x9E3779B97F4A7C15ull;
+        constexpr onyxU32 ENTRIES_PER_BUCKET = 4;
+        constexpr onyxU32 INVALID_INDEX = onyxMax_U32;
+
+        // the hashes are persisted in the catalog so they have to be stable across platforms, which the std hash is not
+        onyxU64 Mix(onyxU64 value)
+        {
+            value ^= value >> 30;
+            value *= 0xBF58476D1CE4E5B9ull;
+            value ^= value >> 27;
+            value *= 0x94D049BB133111EBull;
+            value ^= value >> 31;
+            return value;
+        }
+
+        onyxU64 GetKey(LocalizationId id)
+        {
+            return (static_cast<onyxU64>(id.Context.GetId()) << 32) | id.Id.GetId();
+        }
+
+        onyxU32 GetBucket(onyxU64 key, onyxU32 bucketCount)
+        {
+            return static_cast<onyxU32>(Mix(key) % bucketCount);
+        }
+
+        onyxU32 GetSlot(onyxU64 key, onyxU32 seed, onyxU32 entryCount)
+        {
+            return static_cast<onyxU32>(Mix(key ^ ((seed + 1ull) * GOLDEN_RATIO)) % entryCount);
+        }
+
+        // finds a seed per bucket so every key lands in its own slot, largest buckets are placed first while most slots are still free
+        void BuildPerfectHash(const DynamicArray<onyxU64>& keys, onyxU32 bucketCount, DynamicArray<onyxU32>& outSeeds, DynamicArray<onyxU32>& outSlotToKey)
+        {
+            const onyxU32 entryCount = static_cast<onyxU32>(keys.size());
+
+            DynamicArray<DynamicArray<onyxU32>> buckets(bucketCount);
+            for (onyxU32 i = 0; i < entryCount; ++i)
+                buckets[GetBucket(keys[i], bucketCount)].push_back(i);
+
+            DynamicArray<onyxU32> bucketOrder(bucketCount);
+            std::iota(bucketOrder.begin(), bucketOrder.end(), 0);
+            std::ranges::stable_sort(bucketOrder, [&](onyxU32 lhs, onyxU32 rhs) { return buckets[lhs].size() > buckets[rhs].size(); });
+
+            outSeeds.assign(bucketCount, 0);
+            outSlotToKey.assign(entryCount, INVALID_INDEX);
+
+            DynamicArray<onyxU32> bucketSlots;
+            for (onyxU32 bucketIndex : bucketOrder)
+            {
+                const DynamicArray<onyxU32>& bucket = buckets[bucketIndex];
+                if (bucket.empty())
+                    break;
+
+                for (onyxU32 seed = 0; ; ++seed)
+                {
+                    ONYX_ASSERT(seed != onyxMax_U32, "Failed building perfect hash for localization catalog.");
+
+                    bucketSlots.clear();
+                    bool hasCollision = false;
+                    for (onyxU32 keyIndex : bucket)
+                    {
+                        const onyxU32 slot = GetSlot(keys[keyIndex], seed, entryCount);
+                        if ((outSlotToKey[slot] != INVALID_INDEX) || (std::ranges::find(bucketSlots, slot) != bucketSlots.end()))
+                        {
+                            hasCollision = true;
+                            break;
+                        }
+
+                        bucketSlots.push_back(slot);
+                    }
+
+                    if (hasCollision)
+                        continue;
+
+                    for (onyxU32 i = 0; i < bucket.size(); ++i)
+                        outSlotToKey[bucketSlots[i]] = bucket[i];
+
+                    outSeeds[bucketIndex] = seed;
+                    break;
+                }
+            }
+        }
+    }
+
+    void LocalizationCatalog::Compile(const SourceEntries& entries, onyxU8 pluralRuleIndex, onyxU64 sourceHash, Stream& outStream)
+    {
+        ONYX_ASSERT(PluralRules::IsValid(pluralRuleIndex), "Invalid plural rule index");
+
+        // sort by key so compiling the same source always results in the same catalog
+        DynamicArray<const SourceEntries::value_type*> sourceEntries;
+        sourceEntries.reserve(entries.size());
+        for (const auto& entry : entries)
+            sourceEntries.push_back(&entry);
+
+        std::ranges::sort(sourceEntries, [](const auto* lhs, const auto* rhs) { return GetKey(lhs->first) < GetKey(rhs->first); });
+
+        DynamicArray<onyxU64> keys;
+        keys.reserve(sourceEntries.size());
+        for (const auto* entry : sourceEntries)
+            keys.push_back(GetKey(entry->first));
+
+        const onyxU32 entryCount = static_cast<onyxU32>(keys.size());
+        const onyxU32 bucketCount = (entryCount + ENTRIES_PER_BUCKET - 1) / ENTRIES_PER_BUCKET;
+
+        DynamicArray<onyxU32> seeds;
+        DynamicArray<onyxU32> slotToKey;
+        BuildPerfectHash(keys, bucketCount, seeds, slotToKey);
+
+        DynamicArray<Entry> catalogEntries(entryCount);
+        DynamicArray<StringEntry> strings;
+        String stringPool;
+
+        // identical translations (e.g.: plural forms that read the same) share their pool entry
+        HashMap<StringView, onyxU32> stringOffsets;
+        for (onyxU32 slot = 0; slot < entryCount; ++slot)
+        {
+            const auto& [id, translations] = *sourceEntries[slotToKey[slot]];
+
+            Entry& entry = catalogEntries[slot];
+            entry.Context = id.Context.GetId();
+            entry.Id = id.Id.GetId();
+            entry.FirstString = static_cast<onyxU32>(strings.size());
+            entry.FormCount = static_cast<onyxU32>(translations.size());
+
+            for (const String& translation : translations)
+            {
+                auto [it, isNew] = stringOffsets.try_emplace(translation, static_cast<onyxU32>(stringPool.size()));
+                if (isNew)
+                    stringPool += translation;
+
+                strings.push_back({ it->second, static_cast<onyxU32>(translation.size()) });
+            }
+        }
+
+        Header header{};
+        header.Magic = MAGIC;
+        header.Version = VERSION;
+        header.EntryCount = entryCount;
+        header.BucketCount = bucketCount;
+        header.StringCount = static_cast<onyxU32>(strings.size());
+        header.StringPoolSize = static_cast<onyxU32>(stringPool.size());
+        header.PluralRuleIndex = pluralRuleIndex;
+        header.SourceHash = sourceHash;
+
+        outStream.WriteRaw(header);
+        outStream.WriteRaw(seeds, false);
+        outStream.WriteRaw(catalogEntries, false);
+        outStream.WriteRaw(strings, false);
+        outStream.WriteRaw(stringPool.data(), stringPool.size());
+    }
+
+    bool LocalizationCatalog::Compile(const SourceEntries& entries, onyxU8 pluralRuleIndex, onyxU64 sourceHash, const FilePath& path)
+    {
+        MemoryStream stream;
+        Compile(entries, pluralRuleIndex, sourceHash, stream);
+
+        FileSystem::FileStream fileStream(path, FileSystem::OpenMode::Write | FileSystem::OpenMode::Binary);
+        if (fileStream.IsValid() == false)
+            return false;
+
+        const DynamicArray<char>& buffer = stream.GetBuffer();
+        fileStream.WriteRaw(buffer.data(), buffer.size());
+        return fileStream.IsValid();
+    }
+
+    bool LocalizationCatalog::Load(const FilePath& path)
+    {
+        Reset();
+
+        if (m_MappedFile.Open(path) == false)
+            return false;
+
+        if (Map(m_MappedFile.GetData(), m_MappedFile.GetSize()))
+            return true;
+
+        ONYX_LOG_ERROR("Invalid localization catalog {}", path.string());
+        Reset();
+        return false;
+    }
+
+    bool LocalizationCatalog::Load(DynamicArray<char>&& data)
+    {
+        Reset();
+
+        m_OwnedData = std::move(data);
+        if (Map(m_OwnedData.data(), m_OwnedData.size()))
+            return true;
+
+        Reset();
+        return false;
+    }
+
+    void LocalizationCatalog::Reset()
+    {
+        m_MappedFile.Close();
+        m_OwnedData.clear();
+
+        m_Header = nullptr;
+        m_BucketSeeds = nullptr;
+        m_Entries = nullptr;
+        m_Strings = nullptr;
+        m_StringPool = nullptr;
+        m_PluralFunction = nullptr;
+    }
+
+    Optional<StringView> LocalizationCatalog::GetLocalized(LocalizationId id) const
+    {
+        const Entry* entry = Find(id);
+        if ((entry == nullptr) || (entry->FormCount == 0))
+            return std::nullopt;
+
+        return GetString(entry->FirstString);
+    }
+
+    Optional<StringView> LocalizationCatalog::GetLocalized(LocalizationId id, onyxS32 count) const
+    {
+        const Entry* entry = Find(id);
+        if (entry == nullptr)
+            return std::nullopt;
+
+        const onyxS32 pluralForm = m_PluralFunction(count);
+        if ((pluralForm < 0) || (pluralForm >= static_cast<onyxS32>(entry->FormCount)))
+            return std::nullopt;
+
+        return GetString(entry->FirstString + pluralForm);
+    }
+
+    bool LocalizationCatalog::Map(const char* data, onyxU64 size)
+    {
+        if ((size < sizeof(Header)) || ((reinterpret_cast<uintptr_t>(data) % alignof(Header)) != 0))
+            return false;
+
+        const Header* header = reinterpret_cast<const Header*>(data);
+        if ((header->Magic != MAGIC) || (header->Version != VERSION) || (PluralRules::IsValid(static_cast<onyxU8>(header->PluralRuleIndex)) == false))
+            return false;
+
+        const onyxU64 seedsOffset = sizeof(Header);
+        const onyxU64 entriesOffset = seedsOffset + static_cast<onyxU64>(header->BucketCount) * sizeof(onyxU32);
+        const onyxU64 stringsOffset = entriesOffset + static_cast<onyxU64>(header->EntryCount) * sizeof(Entry);
+        const onyxU64 stringPoolOffset = stringsOffset + static_cast<onyxU64>(header->StringCount) * sizeof(StringEntry);
+        if ((stringPoolOffset + header->StringPoolSize) != size)
+            return false;
+
+        if ((header->EntryCount != 0) && (header->BucketCount == 0))
+            return false;
+
+        m_Header = header;
+        m_BucketSeeds = reinterpret_cast<const onyxU32*>(data + seedsOffset);
+        m_Entries = reinterpret_cast<const Entry*>(data + entriesOffset);
+        m_Strings = reinterpret_cast<const StringEntry*>(data + stringsOffset);
+        m_StringPool = data + stringPoolOffset;
+        m_PluralFunction = PluralRules::GetFunction(static_cast<onyxU8>(header->PluralRuleIndex));
+        return true;
+    }
+
+    const LocalizationCatalog::Entry* LocalizationCatalog::Find(LocalizationId id) const
+    {
+        if ((m_Header == nullptr) || (m_Header->EntryCount == 0))
+            return nullptr;
+
+        const onyxU64 key = GetKey(id);
+        const onyxU32 seed = m_BucketSeeds[GetBucket(key, m_Header->BucketCount)];
+        const Entry& entry = m_Entries[GetSlot(key, seed, m_Header->EntryCount)];
+
+        // ids that are not in the catalog still map to some slot
+        if ((entry.Context != id.Context.GetId()) || (entry.Id != id.Id.GetId()))
+            return nullptr;
+
+        return &entry;
+    }
+
+    StringView LocalizationCatalog::GetString(onyxU32 index) const
+    {
+        ONYX_ASSERT(index < m_Header->StringCount, "String index is out of range");
+
+        const StringEntry& string = m_Strings[index];
+        ONYX_ASSERT((static_cast<onyxU64>(string.Offset) + string.Length) <= m_Header->StringPoolSize, "String is out of range of the string pool");
+        return { m_StringPool + string.Offset, string.Length };
+    }
+}
@@ -0,0 +1,122 @@
+#include <onyx/localization/pluralrules.h>
+
+namespace Onyx::Localization
+{
+    namespace
+    {
+        struct PluralRule
+        {
+            StringView Rule;
+            PluralFunction Function;
+        };
+
+        constexpr Array<PluralRule, 24>  PluralFunctions =
+        {
+            // Note that the plural forms here shouldn't contain any spaces
+            // Japanese, Vietnamese, Korean
+            // Thai 
+            PluralRule{ "nplurals=1;plural=0;", [](onyxS32) { return 0; } },
+
+            // English, German, Dutch, Swedish, Danish, Norwegian, Faroese
+            // Spanish, Portuguese, Italian
+            // Greek
+            // Bulgarian
+            // Finnish, Estonian
+            // Hebrew
+            // Bahasa Indonesian
+            // Esperanto
+            // Hungarian
+            // Turkish 
+            PluralRule{ "nplurals=2;plural=(n!=1);", [](onyxS32 n) { return n != 1 ? 1 : 0; }  },
+
+            /// Brazilian Portuguese, French 
+            PluralRule{ "nplurals=2;plural=(n>1);", [](onyxS32 n) { return n > 1 ? 1 : 0; } },
+
+            // Macedonian
+            PluralRule{ "nplurals=2;plural=n==1||n%10==1?0:1;", [](onyxS32 n) { return (n == 1) || ((n % 10) == 1) ? 0 : 1; } },
+
+            // Macedonian 2
+            PluralRule{ "nplurals=2;plural=(n%10==1&&n%100!=11)?0:1;", [](onyxS32 n) { return ((n % 10) == 1) && ((n % 100) != 11) ? 0 : 1; } },
+
+            // Latvian 
+            PluralRule{ "nplurals=3;plural=n%10==1&&n%100!=11?0:n!=0?1:2);", [](onyxS32 n) { return ((n % 10) == 1) && ((n % 100) != 11) ? 0 : (n != 0) ? 1 : 2; } },
+
+            // Gaeilge Irish
+            PluralRule{ "nplurals=3;plural=n==1?0:n==2?1:2;", [](onyxS32 n) { return (n == 1) ? 0 : (n == 2) ? 1 : 2; } },
+
+            // Lithuanian
+            PluralRule{ "nplurals=3;plural=(n%10==1&&n%100!=11?0:n%10>=2&&(n%100<10||n%100>=20)?1:2);", [](onyxS32 n) { return ((n % 10) == 1) && ((n % 100) != 11) ? 0 : ((n % 10) >= 2) && (((n % 100) < 10) || ((n % 100) >= 20)) ? 1 : 2; }  },
+
+            // Russian, Ukrainian, Belarusian, Serbian, Croatian 
+            PluralRule{ "nplurals=3;plural=(n%10==1&&n%100!=11?0:n%10>=2&&n%10<=4&&(n%100<10||n%100>=20)?1:2);", [](onyxS32 n) { return ((n % 10) == 1) && ((n % 100) != 11) ? 0 : ((n % 10) >= 2) && ((n % 10) <= 4) && (((n % 100) < 10) || ((n % 100) >= 20)) ? 1 : 2; }},
+
+            // Czech, Slovak 
+            PluralRule{ "nplurals=3;plural=(n==1)?0:(n>=2&&n<=4)?1:2;", [](onyxS32 n) { return (n == 1) ? 0 : (n >= 2) && (n <= 4) ? 1 : 2; }  },
+
+            // Polish
+            PluralRule{ "nplurals=3;plural=(n==1?0:n%10>=2&&n%10<=4&&(n%100<10||n%100>=20)?1:2);", [](onyxS32 n) { return (n == 1) ? 0 : ((n % 10) >= 2) && ((n % 10) <= 4) && (((n % 100) < 10) || ((n % 100) >= 20)) ? 1 : 2; } },
+
+            // Romanian            
+            PluralRule{ "nplurals=3;plural=(n==1?0:(((n%100>19)||((n%100==0)&&(n!=0)))?2:1));", [](onyxS32 n) { return (n == 1) ? 0 : (((n % 100) > 19) || (((n % 100) == 0) && (n != 0))) ? 2 : 1; } },
+
+            // Slovenian
+            PluralRule{ "nplurals=4;plural=(n%100==1?0:n%100==2?1:n%100==3||n%100==4?2:3);", [](onyxS32 n) { return ((n % 100) == 1) ? 0 : ((n % 100) == 2) ? 1 : ((n % 100) == 3) || ((n % 100) == 4) ? 2 : 3; } },
+
+            // Slovak (alternative)
+            PluralRule{ "nplurals=4;plural=(n%1==0&&n==1?0:n%1==0&&n>=2&&n<=4?1:n%1!=0?2:3);", [](onyxS32 n) { return ((n % 1) == 0) && (n == 1) ? 0 : ((n % 1) == 0) && (n >= 2) && (n <= 4) ? 1 : ((n % 1) != 0) ? 2 : 3; } },
+
+            // Czech
+            PluralRule{ "nplurals=4;plural=(n==1&&n%1==0)?0:(n>=2&&n<=4&&n%1==0)?1:(n%1!=0)?2:3;", [](onyxS32 n) { return (n == 1) && ((n % 1) == 0) ? 0 : ((n >= 2) && (n <= 4) && ((n % 1) == 0)) ? 1 : ((n % 1) != 0) ? 2 : 3; } },
+
+            // Belarusian
+            PluralRule{ "nplurals=4;plural=(n%10==1&&n%100!=11?0:n%10>=2&&n%10<=4&&(n%100<12||n%100>14)?1:n%10==0||(n%10>=5&&n%10<=9)||(n%100>=11&&n%100<=14)?2:3);", [](onyxS32 n) { return ((n % 10) == 1) && ((n % 100) != 11) ? 0 : ((n % 10) >= 2) && ((n % 10) <= 4) && (((n % 100) < 12) || ((n % 100) > 14)) ? 1 : ((n % 10) == 0) || (((n % 10) >= 5) && ((n % 10) <= 9)) || (((n % 100) >= 11) && ((n % 100) <= 14)) ? 2 : 3; } },
+
+            // Scottish Gaelic
+            PluralRule{ "nplurals=4;plural=(n==1||n==11)?0:(n==2||n==12)?1:(n>2&&n<20)?2:3;", [](onyxS32 n) { return (n == 1) || (n == 11) ? 0 : ((n == 2) || (n == 12)) ? 1 : ((n > 2) && (n < 20)) ? 2 : 3; } },
+
+            // Welsh
+            PluralRule{ "nplurals=4;plural=(n==1)?0:(n==2)?1:(n!=8&&n!=11)?2:3;", [](onyxS32 n) { return (n == 1) ? 0 : (n == 2) ? 1 : ((n != 8) && (n != 11)) ? 2 : 3; } },
+
+            // Lithuanian (alternative)
+            PluralRule{ "nplurals=4;plural=(n%10==1&&(n%100>19||n%100<11)?0:(n%10>=2&&n%10<=9)&&(n%100>19||n%100<11)?1:n%1!=0?2:3);", [](onyxS32 n) { return ((n % 10) == 1) && (((n % 100) > 19) || ((n % 100) < 11)) ? 0 : (((n % 10) >= 2) && ((n % 10) <= 9)) && (((n % 100) > 19) || ((n % 100) < 11)) ? 1 : ((n % 1) != 0) ? 2 : 3; } },
+
+            // Ukranian
+            PluralRule{ "nplurals=4;plural=(n%1==0&&n%10==1&&n%100!=11?0:n%1==0&&n%10>=2&&n%10<=4&&(n%100<12||n%100>14)?1:n%1==0&&(n%10==0||(n%10>=5&&n%10<=9)||(n%100>=11&&n%100<=14))?2:3);", [](onyxS32 n) { return ((n % 1) == 0) && ((n % 10) == 1) && ((n % 100) != 11) ? 0 : ((n % 1) == 0) && ((n % 10) >= 2) && ((n % 10) <= 4) && (((n % 100) < 12) || ((n % 100) > 14)) ? 1 : ((n % 1) == 0) && (((n % 10) == 0) || (((n % 10) >= 5) && ((n % 10) <= 9)) || (((n % 100) >= 11) && ((n % 100) <= 14))) ? 2 : 3; } },
+
+            // Polish (alternative)
+            PluralRule{ "nplurals=4;plural=(n==1?0:(n%10>=2&&n%10<=4)&&(n%100<12||n%100>14)?1:n!=1&&(n%10>=0&&n%10<=1)||(n%10>=5&&n%10<=9)||(n%100>=12&&n%100<=14)?2:3);", [](onyxS32 n) { return (n == 1) ? 0 : (((n % 10) >= 2) && ((n % 10) <= 4)) && (((n % 100) < 12) || ((n % 100) > 14)) ? 1 : ((n != 1) && ((n % 10) >= 0) && ((n % 10) <= 1)) || (((n % 10) >= 5) && ((n % 10) <= 9)) || (((n % 100) >= 12) && ((n % 100) <= 14)) ? 2 : 3; } },
+
+            // Hebrew
+            PluralRule{ "nplurals=4;plural=(n==1&&n%1==0)?0:(n==2&&n%1==0)?1:(n%10==0&&n%1==0&&n>10)?2:3;", [](onyxS32 n) { return (n == 1) && ((n % 1) == 0) ? 0 : ((n == 2) && ((n % 1) == 0)) ? 1 : (((n % 10) == 0) && ((n % 1) == 0) && (n > 10)) ? 2 : 3; } },
+
+            // Gaeilge Irish (alternative)
+            PluralRule{ "nplurals=5;plural=(n==1?0:n==2?1:n<7?2:n<11?3:4)", [](onyxS32 n) { return (n == 1) ? 0 : (n == 2) ? 1 : (n < 7) ? 2 : (n < 11) ? 3 : 4; } },
+
+            // Arabic
+            PluralRule{ "nplurals=6;plural=n==0?0:n==1?1:n==2?2:n%100>=3&&n%100<=10?3:n%100>=11?4:5", [](onyxS32 n) { return (n == 0) ? 0 : (n == 1) ? 1 : (n == 2) ? 2 : ((n % 100) >= 3) && ((n % 100) <= 10) ? 3 : ((n % 100) >= 11) ? 4 : 5; } }
+        };
+    }
+
+    namespace PluralRules
+    {
+        onyxU8 Find(StringView rule)
+        {
+            auto it = std::ranges::find_if(PluralFunctions, [&](const PluralRule& pluralRule) { return pluralRule.Rule == rule; });
+            if (it == PluralFunctions.end())
+                return INVALID_INDEX;
+
+            return static_cast<onyxU8>(std::distance(PluralFunctions.begin(), it));
+        }
+
+        bool IsValid(onyxU8 index)
+        {
+            return index < PluralFunctions.size();
+        }
+
+        PluralFunction GetFunction(onyxU8 index)
+        {
+            ONYX_ASSERT(index < PluralFunctions.size(), "Plural rule index is out of range");
+            return PluralFunctions[index].Function;
+        }
+    }
+}
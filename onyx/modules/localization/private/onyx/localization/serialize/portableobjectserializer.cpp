@@ -1,6 +1,9 @@
 #include <onyx/localization/serialize/portableobjectserializer.h>
 
 #include <onyx/localization/assets/gettextlocalizationdatabase.h>
+#include <onyx/localization/localizationcatalog.h>
+#include <onyx/hash.h>
+#include <onyx/stream/memorystream.h>
 #include <onyx/filesystem/onyxfile.h>
 #include <onyx/stream/stringstream.h>
 
@@ -11,117 +14,16 @@ namespace Onyx::Localization
         constexpr StringView PO_HEADER_MSG_ID = "msgid \"\"\n";
         constexpr StringView PO_HEADER_MSG_STR = "msgstr \"\"\n";
         constexpr StringView PO_HEADER_PLURAL_FORMS = "plural-forms:";
+        constexpr StringView PO_FILE_EXTENSION = ".po";
 
-        struct PluralRule
+        bool ParsePoFile(const String& fileContent, LocalizationCatalog::SourceEntries& outEntries, onyxU8& outPluralRuleIndex)
         {
-            using PluralFunc = onyxS32(*)(onyxS32);
-
-            StringView Rule;
-            PluralFunc Function;
-        };
-
-        constexpr Array<PluralRule, 24>  PluralFunctions =
-        {
-            // Note that the plural forms here shouldn't contain any spaces
-            // Japanese, Vietnamese, Korean
-            // Thai 
-            PluralRule{ "nplurals=1;plural=0;", [](onyxS32) { return 0; } },
-
-            // English, German, Dutch, Swedish, Danish, Norwegian, Faroese
-            // Spanish, Portuguese, Italian
-            // Greek
-            // Bulgarian
-            // Finnish, Estonian
-            // Hebrew
-            // Bahasa Indonesian
-            // Esperanto
-            // Hungarian
-            // Turkish 
-            PluralRule{ "nplurals=2;plural=(n!=1);", [](onyxS32 n) { return n != 1 ? 1 : 0; }  },
-
-            /// Brazilian Portuguese, French 
-            PluralRule{ "nplurals=2;plural=(n>1);", [](onyxS32 n) { return n > 1 ? 1 : 0; } },
-
-            // Macedonian
-            PluralRule{ "nplurals=2;plural=n==1||n%10==1?0:1;", [](onyxS32 n) { return (n == 1) || ((n % 10) == 1) ? 0 : 1; } },
-
-            // Macedonian 2
-            PluralRule{ "nplurals=2;plural=(n%10==1&&n%100!=11)?0:1;", [](onyxS32 n) { return ((n % 10) == 1) && ((n % 100) != 11) ? 0 : 1; } },
-
-            // Latvian 
-            PluralRule{ "nplurals=3;plural=n%10==1&&n%100!=11?0:n!=0?1:2);", [](onyxS32 n) { return ((n % 10) == 1) && ((n % 100) != 11) ? 0 : (n != 0) ? 1 : 2; } },
-
-            // Gaeilge Irish
-            PluralRule{ "nplurals=3;plural=n==1?0:n==2?1:2;", [](onyxS32 n) { return (n == 1) ? 0 : (n == 2) ? 1 : 2; } },
-
-            // Lithuanian
-            PluralRule{ "nplurals=3;plural=(n%10==1&&n%100!=11?0:n%10>=2&&(n%100<10||n%100>=20)?1:2);", [](onyxS32 n) { return ((n % 10) == 1) && ((n % 100) != 11) ? 0 : ((n % 10) >= 2) && (((n % 100) < 10) || ((n % 100) >= 20)) ? 1 : 2; }  },
-
-            // Russian, Ukrainian, Belarusian, Serbian, Croatian 
-            PluralRule{ "nplurals=3;plural=(n%10==1&&n%100!=11?0:n%10>=2&&n%10<=4&&(n%100<10||n%100>=20)?1:2);", [](onyxS32 n) { return ((n % 10) == 1) && ((n % 100) != 11) ? 0 : ((n % 10) >= 2) && ((n % 10) <= 4) && (((n % 100) < 10) || ((n % 100) >= 20)) ? 1 : 2; }},
-
-            // Czech, Slovak 
-            PluralRule{ "nplurals=3;plural=(n==1)?0:(n>=2&&n<=4)?1:2;", [](onyxS32 n) { return (n == 1) ? 0 : (n >= 2) && (n <= 4) ? 1 : 2; }  },
-
-            // Polish
-            PluralRule{ "nplurals=3;plural=(n==1?0:n%10>=2&&n%10<=4&&(n%100<10||n%100>=20)?1:2);", [](onyxS32 n) { return (n == 1) ? 0 : ((n % 10) >= 2) && ((n % 10) <= 4) && (((n % 100) < 10) || ((n % 100) >= 20)) ? 1 : 2; } },
-
-            // Romanian            
-            PluralRule{ "nplurals=3;plural=(n==1?0:(((n%100>19)||((n%100==0)&&(n!=0)))?2:1));", [](onyxS32 n) { return (n == 1) ? 0 : (((n % 100) > 19) || (((n % 100) == 0) && (n != 0))) ? 2 : 1; } },
-
-            // Slovenian
-            PluralRule{ "nplurals=4;plural=(n%100==1?0:n%100==2?1:n%100==3||n%100==4?2:3);", [](onyxS32 n) { return ((n % 100) == 1) ? 0 : ((n % 100) == 2) ? 1 : ((n % 100) == 3) || ((n % 100) == 4) ? 2 : 3; } },
-
-            // Slovak (alternative)
-            PluralRule{ "nplurals=4;plural=(n%1==0&&n==1?0:n%1==0&&n>=2&&n<=4?1:n%1!=0?2:3);", [](onyxS32 n) { return ((n % 1) == 0) && (n == 1) ? 0 : ((n % 1) == 0) && (n >= 2) && (n <= 4) ? 1 : ((n % 1) != 0) ? 2 : 3; } },
-
-            // Czech
-            PluralRule{ "nplurals=4;plural=(n==1&&n%1==0)?0:(n>=2&&n<=4&&n%1==0)?1:(n%1!=0)?2:3;", [](onyxS32 n) { return (n == 1) && ((n % 1) == 0) ? 0 : ((n >= 2) && (n <= 4) && ((n % 1) == 0)) ? 1 : ((n % 1) != 0) ? 2 : 3; } },
-
-            // Belarusian
-            PluralRule{ "nplurals=4;plural=(n%10==1&&n%100!=11?0:n%10>=2&&n%10<=4&&(n%100<12||n%100>14)?1:n%10==0||(n%10>=5&&n%10<=9)||(n%100>=11&&n%100<=14)?2:3);", [](onyxS32 n) { return ((n % 10) == 1) && ((n % 100) != 11) ? 0 : ((n % 10) >= 2) && ((n % 10) <= 4) && (((n % 100) < 12) || ((n % 100) > 14)) ? 1 : ((n % 10) == 0) || (((n % 10) >= 5) && ((n % 10) <= 9)) || (((n % 100) >= 11) && ((n % 100) <= 14)) ? 2 : 3; } },
-
-            // Scottish Gaelic
-            PluralRule{ "nplurals=4;plural=(n==1||n==11)?0:(n==2||n==12)?1:(n>2&&n<20)?2:3;", [](onyxS32 n) { return (n == 1) || (n == 11) ? 0 : ((n == 2) || (n == 12)) ? 1 : ((n > 2) && (n < 20)) ? 2 : 3; } },
-
-            // Welsh
-            PluralRule{ "nplurals=4;plural=(n==1)?0:(n==2)?1:(n!=8&&n!=11)?2:3;", [](onyxS32 n) { return (n == 1) ? 0 : (n == 2) ? 1 : ((n != 8) && (n != 11)) ? 2 : 3; } },
-
-            // Lithuanian (alternative)
-            PluralRule{ "nplurals=4;plural=(n%10==1&&(n%100>19||n%100<11)?0:(n%10>=2&&n%10<=9)&&(n%100>19||n%100<11)?1:n%1!=0?2:3);", [](onyxS32 n) { return ((n % 10) == 1) && (((n % 100) > 19) || ((n % 100) < 11)) ? 0 : (((n % 10) >= 2) && ((n % 10) <= 9)) && (((n % 100) > 19) || ((n % 100) < 11)) ? 1 : ((n % 1) != 0) ? 2 : 3; } },
-
-            // Ukranian
-            PluralRule{ "nplurals=4;plural=(n%1==0&&n%10==1&&n%100!=11?0:n%1==0&&n%10>=2&&n%10<=4&&(n%100<12||n%100>14)?1:n%1==0&&(n%10==0||(n%10>=5&&n%10<=9)||(n%100>=11&&n%100<=14))?2:3);", [](onyxS32 n) { return ((n % 1) == 0) && ((n % 10) == 1) && ((n % 100) != 11) ? 0 : ((n % 1) == 0) && ((n % 10) >= 2) && ((n % 10) <= 4) && (((n % 100) < 12) || ((n % 100) > 14)) ? 1 : ((n % 1) == 0) && (((n % 10) == 0) || (((n % 10) >= 5) && ((n % 10) <= 9)) || (((n % 100) >= 11) && ((n % 100) <= 14))) ? 2 : 3; } },
-
-            // Polish (alternative)
-            PluralRule{ "nplurals=4;plural=(n==1?0:(n%10>=2&&n%10<=4)&&(n%100<12||n%100>14)?1:n!=1&&(n%10>=0&&n%10<=1)||(n%10>=5&&n%10<=9)||(n%100>=12&&n%100<=14)?2:3);", [](onyxS32 n) { return (n == 1) ? 0 : (((n % 10) >= 2) && ((n % 10) <= 4)) && (((n % 100) < 12) || ((n % 100) > 14)) ? 1 : ((n != 1) && ((n % 10) >= 0) && ((n % 10) <= 1)) || (((n % 10) >= 5) && ((n % 10) <= 9)) || (((n % 100) >= 12) && ((n % 100) <= 14)) ? 2 : 3; } },
-
-            // Hebrew
-            PluralRule{ "nplurals=4;plural=(n==1&&n%1==0)?0:(n==2&&n%1==0)?1:(n%10==0&&n%1==0&&n>10)?2:3;", [](onyxS32 n) { return (n == 1) && ((n % 1) == 0) ? 0 : ((n == 2) && ((n % 1) == 0)) ? 1 : (((n % 10) == 0) && ((n % 1) == 0) && (n > 10)) ? 2 : 3; } },
-
-            // Gaeilge Irish (alternative)
-            PluralRule{ "nplurals=5;plural=(n==1?0:n==2?1:n<7?2:n<11?3:4)", [](onyxS32 n) { return (n == 1) ? 0 : (n == 2) ? 1 : (n < 7) ? 2 : (n < 11) ? 3 : 4; } },
-
-            // Arabic
-            PluralRule{ "nplurals=6;plural=n==0?0:n==1?1:n==2?2:n%100>=3&&n%100<=10?3:n%100>=11?4:5", [](onyxS32 n) { return (n == 0) ? 0 : (n == 1) ? 1 : (n == 2) ? 2 : ((n % 100) >= 3) && ((n % 100) <= 10) ? 3 : ((n % 100) >= 11) ? 4 : 5; } }
-        };
-
-        bool ParsePoFile(const FilePath& path, GetTextLocalizationDatabase& outLocalizationMap)
-        {
-            String fileContent;
-            bool hasSucceeded = FileSystem::OnyxFile::ReadAll(path, fileContent);
-
-            if (hasSucceeded == false)
-            {
-                return false;
-            }
-
             StringStream stringStream(fileContent);
             if (stringStream.IsEof())
                 return true;
 
             // use english as default
-            auto pluralFunction = PluralFunctions[1].Function;
+            outPluralRuleIndex = PluralRules::DEFAULT_INDEX;
 
             if (stringStream.ReadConditional(PO_HEADER_MSG_ID) &&
                 stringStream.ReadConditional(PO_HEADER_MSG_STR))
@@ -149,23 +51,20 @@ namespace Onyx::Localization
                         String pluralForm(headerLine);
                         std::erase_if(pluralForm, [](char c) { return std::isspace(c); });
 
-                        auto it = std::ranges::find_if(PluralFunctions, [&](const PluralRule& rule) { return rule.Rule == pluralForm; });
-                        if ((pluralFunction == nullptr) && (it == PluralFunctions.end()))
+                        const onyxU8 pluralRuleIndex = PluralRules::Find(pluralForm);
+                        if (pluralRuleIndex == PluralRules::INVALID_INDEX)
                         {
                             ONYX_LOG_WARNING("Failed finding language plural rule for {}", pluralForm);
                         }
                         else
                         {
-                            pluralFunction = it->Function;
+                            outPluralRuleIndex = pluralRuleIndex;
                         }
                     }
                 }
             }
 
-            outLocalizationMap.SetPluralFunction(pluralFunction);
-
-            HashMap<LocalizationId, DynamicArray<String>>& localeDatabase = outLocalizationMap.GetDatabase();
-            localeDatabase.clear();
+            outEntries.clear();
 
             StringView localizationIdString;
             StringView localizationPluralIdString;
@@ -224,7 +123,7 @@ namespace Onyx::Localization
 
                     stringStream.ReadString(localizedText);
 
-                    DynamicArray<String>& localizedTexts = localeDatabase[localizationId];
+                    DynamicArray<String>& localizedTexts = outEntries[localizationId];
                     if (index >= static_cast<onyxS32>(localizedTexts.size()))
                     {
                         localizedTexts.resize(index + 1);
@@ -246,6 +145,63 @@ namespace Onyx::Localization
            
             return true;
         }
+
+        onyxU64 GetSourceHash(const String& fileContent)
+        {
+            return Hash::FastHash64Bytes(fileContent.data(), fileContent.size());
+        }
+
+        bool ReadPoFile(const FilePath& path, String& outFileContent)
+        {
+            if (FileSystem::OnyxFile::ReadAll(path, outFileContent) == false)
+            {
+                ONYX_LOG_ERROR("Failed reading localization file {}", path.string());
+                return false;
+            }
+
+            return true;
+        }
+
+        bool ParsePoFile(const FilePath& path, const String& fileContent, LocalizationCatalog::SourceEntries& outEntries, onyxU8& outPluralRuleIndex)
+        {
+            if (ParsePoFile(fileContent, outEntries, outPluralRuleIndex) == false)
+            {
+                ONYX_LOG_ERROR("Failed parsing localization file {}", path.string());
+                return false;
+            }
+
+            return true;
+        }
+
+        // the po file is cooked into a catalog, the catalog is reused as long as it was cooked from the same po text
+        bool LoadPoFile(const FilePath& poPath, const FilePath& catalogPath, LocalizationCatalog& catalog)
+        {
+            // po files are not json or yaml so we do not use the provided serializer and instead read the file as raw text
+            String fileContent;
+            if (ReadPoFile(poPath, fileContent) == false)
+                return false;
+
+            const onyxU64 sourceHash = GetSourceHash(fileContent);
+            if (FileSystem::Path::Exists(catalogPath) && catalog.Load(catalogPath) && (catalog.GetSourceHash() == sourceHash))
+                return true;
+
+            // unmap the stale catalog before overwriting it
+            catalog.Reset();
+
+            LocalizationCatalog::SourceEntries entries;
+            onyxU8 pluralRuleIndex = PluralRules::DEFAULT_INDEX;
+            if (ParsePoFile(poPath, fileContent, entries, pluralRuleIndex) == false)
+                return false;
+
+            if (LocalizationCatalog::Compile(entries, pluralRuleIndex, sourceHash, catalogPath) && catalog.Load(catalogPath))
+                return true;
+
+            ONYX_LOG_WARNING("Failed writing localization catalog {}, using an in memory catalog instead.", catalogPath.string());
+
+            MemoryStream stream;
+            LocalizationCatalog::Compile(entries, pluralRuleIndex, sourceHash, stream);
+            return catalog.Load(DynamicArray<char>(stream.GetBuffer()));
+        }
     }
 
     bool PortableObjectSerializer::Serialize(const Assets::AssetHandle<Assets::AssetInterface>& /*asset*/, const Assets::AssetMetaData& /*meta*/, Serializer& /*serializer*/, const IEngine& /*engine*/) const
@@ -256,8 +212,32 @@ namespace Onyx::Localization
 
     bool PortableObjectSerializer::Deserialize(Assets::AssetHandle<Assets::AssetInterface>& asset, const Assets::AssetMetaData& meta, const Deserializer& /*deserializer*/, IEngine& /*engine*/) const
     {
-        // po files are not json or yaml so we do not use the provided serializer and instead read the file as raw text
         GetTextLocalizationDatabase& localizationDatabase = asset.As<GetTextLocalizationDatabase>();
-        return ParsePoFile(FileSystem::Path::GetFullPath(meta.Path), localizationDatabase);
+        LocalizationCatalog& catalog = localizationDatabase.GetCatalog();
+        const FilePath path = FileSystem::Path::GetFullPath(meta.Path);
+
+        if (path.extension() != LocalizationCatalog::FILE_EXTENSION)
+            return LoadPoFile(path, FileSystem::Path::ReplaceExtension(path, LocalizationCatalog::FILE_EXTENSION), catalog);
+
+        // compiled catalogs are mapped and used in place, they are only cooked again if the po file next to them got changed since
+        const FilePath poPath = FileSystem::Path::ReplaceExtension(path, PO_FILE_EXTENSION);
+        if (FileSystem::Path::Exists(poPath) && FileSystem::Path::IsNewerThan(poPath, path))
+            return LoadPoFile(poPath, path, catalog);
+
+        return catalog.Load(path);
+    }
+
+    bool PortableObjectSerializer::Compile(const FilePath& poPath, const FilePath& catalogPath)
+    {
+        String fileContent;
+        if (ReadPoFile(poPath, fileContent) == false)
+            return false;
+
+        LocalizationCatalog::SourceEntries entries;
+        onyxU8 pluralRuleIndex = PluralRules::DEFAULT_INDEX;
+        if (ParsePoFile(poPath, fileContent, entries, pluralRuleIndex) == false)
+            return false;
+
+        return LocalizationCatalog::Compile(entries, pluralRuleIndex, GetSourceHash(fileContent), catalogPath);
     }
 }
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <onyx/filesystem/memorymappedfile.h>
+#include <onyx/localization/localizedstring.h>
+#include <onyx/localization/pluralrules.h>
+
+namespace Onyx
+{
+    class Stream;
+}
+
+namespace Onyx::Localization
+{
+    // Compiled, read-only localization table of one locale that is used in place from a memory mapped file.
+    // Ids are looked up through a minimal perfect hash (hash and displace), all translations and plural forms live in one string pool,
+    // so loading a catalog is a single mapping instead of one allocation per translation.
+    class LocalizationCatalog
+    {
+    public:
+        static constexpr onyxU32 MAGIC = 0x434F4C4F; // "OLOC"
+        static constexpr onyxU32 VERSION = 2;
+        static constexpr StringView FILE_EXTENSION = ".olc";
+
+        // translations per id, index is the plural form
+        using SourceEntries = HashMap<LocalizationId, DynamicArray<String>>;
+
+        // the source hash identifies the po file the catalog was compiled from so stale catalogs can be recompiled
+        static void Compile(const SourceEntries& entries, onyxU8 pluralRuleIndex, onyxU64 sourceHash, Stream& outStream);
+        static bool Compile(const SourceEntries& entries, onyxU8 pluralRuleIndex, onyxU64 sourceHash, const FilePath& path);
+
+        LocalizationCatalog() = default;
+        LocalizationCatalog(const LocalizationCatalog&) = delete;
+        LocalizationCatalog& operator=(const LocalizationCatalog&) = delete;
+
+        bool Load(const FilePath& path);
+        // takes ownership of an in memory catalog, e.g. compiled from a po file at runtime
+        bool Load(DynamicArray<char>&& data);
+        void Reset();
+
+        bool IsValid() const { return m_Header != nullptr; }
+        onyxU32 GetEntryCount() const { return IsValid() ? m_Header->EntryCount : 0; }
+        onyxU8 GetPluralRuleIndex() const { return IsValid() ? static_cast<onyxU8>(m_Header->PluralRuleIndex) : PluralRules::DEFAULT_INDEX; }
+        onyxU64 GetSourceHash() const { return IsValid() ? m_Header->SourceHash : 0; }
+
+        Optional<StringView> GetLocalized(LocalizationId id) const;
+        Optional<StringView> GetLocalized(LocalizationId id, onyxS32 count) const;
+
+    private:
+        struct Header
+        {
+            onyxU32 Magic;
+            onyxU32 Version;
+            onyxU32 EntryCount;
+            onyxU32 BucketCount;
+            onyxU32 StringCount;
+            onyxU32 StringPoolSize;
+            onyxU32 PluralRuleIndex;
+            onyxU32 Padding;
+            onyxU64 SourceHash;
+        };
+
+        struct Entry
+        {
+            onyxU32 Context;
+            onyxU32 Id;
+            onyxU32 FirstString;
+            onyxU32 FormCount;
+        };
+
+        struct StringEntry
+        {
+            onyxU32 Offset;
+            onyxU32 Length;
+        };
+
+        bool Map(const char* data, onyxU64 size);
+        const Entry* Find(LocalizationId id) const;
+        StringView GetString(onyxU32 index) const;
+
+    private:
+        FileSystem::MemoryMappedFile m_MappedFile;
+        DynamicArray<char> m_OwnedData;
+
+        const Header* m_Header = nullptr;
+        const onyxU32* m_BucketSeeds = nullptr;
+        const Entry* m_Entries = nullptr;
+        const StringEntry* m_Strings = nullptr;
+        const char* m_StringPool = nullptr;
+        PluralFunction m_PluralFunction = nullptr;
+    };
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+namespace Onyx::Localization
+{
+    using PluralFunction = onyxS32(*)(onyxS32);
+
+    // Plural rules of the gettext Plural-Forms header we support, the rule index is stored in compiled catalogs
+    namespace PluralRules
+    {
+        static constexpr onyxU8 INVALID_INDEX = onyxMax_U8;
+        // nplurals=2;plural=(n!=1); used by english
+        static constexpr onyxU8 DEFAULT_INDEX = 1;
+
+        // the rule is expected to not contain any whitespaces
+        onyxU8 Find(StringView rule);
+        bool IsValid(onyxU8 index);
+        PluralFunction GetFunction(onyxU8 index);
+    }
+}
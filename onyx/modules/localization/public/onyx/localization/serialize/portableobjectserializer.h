@@ -9,9 +9,12 @@ namespace Onyx::Localization
 
     struct PortableObjectSerializer : public Assets::AssetSerializer<GetTextLocalizationDatabase>
     {
-        static constexpr Array<StringView, 1> Extensions { "po" };
+        static constexpr Array<StringView, 2> Extensions { "po", "olc" };
 
         bool Serialize(const Assets::AssetHandle<Assets::AssetInterface>& asset, const Assets::AssetMetaData& meta, Serializer& serializer, const IEngine& engine) const override;
         bool Deserialize(Assets::AssetHandle<Assets::AssetInterface>& asset, const Assets::AssetMetaData& meta, const Deserializer& deserializer, IEngine& engine) const override;
+
+        // cook step, compiles a po file into a binary catalog (.olc) that is loaded without parsing
+        static bool Compile(const FilePath& poPath, const FilePath& catalogPath);
     };
 }
@@ -2,7 +2,9 @@ set(onyx_TARGET_PUBLIC_SOURCES
     localization.h
     localizationbackend.h
     localizationmodule.h
+    localizationcatalog.h
     localizedstring.h
+    pluralrules.h
     assets/localizationdatabase.h
     assets/gettextlocalizationdatabase.h
     backends/gettextlocalizationbackend.h
@@ -13,7 +15,9 @@ set(onyx_TARGET_PRIVATE_SOURCES
     localization.cpp
     localizationbackend.cpp
     localizationmodule.cpp
+    localizationcatalog.cpp
     localizedstring.cpp
+    pluralrules.cpp
     backends/gettextlocalizationbackend.cpp
     serialize/portableobjectserializer.cpp
 )
\ No newline at end of file
@@ -0,0 +1,130 @@
+#include <onyx/nodegraph/pins/pinmeta.hpp>
+#include <onyx/nodegraph/nodegraphtyperegistry.h>
+
+namespace Onyx::NodeGraph
+{
+    void PinMetaObject<ExecutePin>::Register()
+    {
+        NodeGraphTypeRegistry::Register<ExecutePin, "execute">();
+    }
+
+    void PinMetaObject<bool>::Register()
+    {
+        NodeGraphTypeRegistry::Register<bool, "bool">();
+    }
+
+    void PinMetaObject<onyxS8>::Register()
+    {
+        NodeGraphTypeRegistry::Register<onyxS8, "onyxS8">();
+    }
+
+    void PinMetaObject<onyxS16>::Register()
+    {
+        NodeGraphTypeRegistry::Register<onyxS16, "onyxS16">();
+    }
+
+    void PinMetaObject<onyxS32>::Register()
+    {
+        NodeGraphTypeRegistry::Register<onyxS32, "onyxS32">();
+    }
+
+    void PinMetaObject<onyxS64>::Register()
+    {
+        NodeGraphTypeRegistry::Register<onyxS64, "onyxS64">();
+    }
+
+    void PinMetaObject<onyxU8>::Register()
+    {
+        NodeGraphTypeRegistry::Register<onyxU8, "onyxU8">();
+    }
+
+    void PinMetaObject<onyxU16>::Register()
+    {
+        NodeGraphTypeRegistry::Register<onyxU16, "onyxU8">();
+    }
+
+    void PinMetaObject<onyxU32>::Register()
+    {
+        NodeGraphTypeRegistry::Register<onyxU32, "onyxU32">();
+    }
+
+    void PinMetaObject<onyxU64>::Register()
+    {
+        NodeGraphTypeRegistry::Register<onyxU64, "onyxU64">();
+    }
+
+    void PinMetaObject<onyxF32>::Register()
+    {
+        NodeGraphTypeRegistry::Register<onyxF32, "onyxF32">();
+    }
+
+    void PinMetaObject<onyxF64>::Register()
+    {
+        NodeGraphTypeRegistry::Register<onyxF64, "onyxF64">();
+    }
+
+    void PinMetaObject<Vector2s32>::Register()
+    {
+        NodeGraphTypeRegistry::Register<Vector2s32, "vector2s32">();
+    }
+
+    void PinMetaObject<Vector2s64>::Register()
+    {
+        NodeGraphTypeRegistry::Register<Vector2s64, "vector2s64">();
+    }
+
+    void PinMetaObject<Vector2f32>::Register()
+    {
+        NodeGraphTypeRegistry::Register<Vector2f32, "vector2f32">();
+    }
+
+    void PinMetaObject<Vector2f64>::Register()
+    {
+        NodeGraphTypeRegistry::Register<Vector2f64, "vector2f64">();
+    }
+
+    void PinMetaObject<Vector3s32>::Register()
+    {
+        NodeGraphTypeRegistry::Register<Vector3s32, "vector3s32">();
+    }
+
+    void PinMetaObject<Vector3s64>::Register()
+    {
+        NodeGraphTypeRegistry::Register<Vector3s64, "vector3s64">();
+    }
+
+    void PinMetaObject<Vector3f32>::Register()
+    {
+        NodeGraphTypeRegistry::Register<Vector3f32, "vector3f32">();
+    }
+
+    void PinMetaObject<Vector3f64>::Register()
+    {
+        NodeGraphTypeRegistry::Register<Vector3f64, "vector3f64">();
+    }
+
+    void PinMetaObject<Vector4s32>::Register()
+    {
+        NodeGraphTypeRegistry::Register<Vector4s32, "vector4s32">();
+    }
+
+    void PinMetaObject<Vector4s64>::Register()
+    {
+        NodeGraphTypeRegistry::Register<Vector4s64, "vector4s64">();
+    }
+
+    void PinMetaObject<Vector4f32>::Register()
+    {
+        NodeGraphTypeRegistry::Register<Vector4f32, "vector4f32">();
+    }
+
+    void PinMetaObject<Vector4f64>::Register()
+    {
+        NodeGraphTypeRegistry::Register<Vector4f64, "vector4f64">();
+    }
+
+    void PinMetaObject<String>::Register()
+    {
+        NodeGraphTypeRegistry::Register<String, "string">();
+    }
+}
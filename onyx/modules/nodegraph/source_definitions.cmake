@@ -40,4 +40,5 @@ set(onyx_TARGET_PRIVATE_SOURCES
     nodegraphserializer.cpp
     nodes/node.cpp
     pins/dynamicpin.cpp
+    pins/pinmeta.cpp
 )
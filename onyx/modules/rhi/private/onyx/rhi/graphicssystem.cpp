@@ -12,6 +12,7 @@
 #include <onyx/platform/platformsystem.h>
 #include <onyx/platform/window.h>
 #include <onyx/rhi/commandbuffer.h>
+#include <onyx/rhi/null/graphicsapi.h>
 
 #if ONYX_USE_VULKAN
 #include <onyx/rhi/vulkan/graphicsapi.h>
@@ -26,6 +27,7 @@ namespace Onyx
         serializer.Write<"api">(settings.Api);
         serializer.Write<"isbindless">(settings.IsBindless);
         serializer.Write<"isdynamicrendering">(settings.IsDynamicRenderingEnabled);
+        serializer.Write<"ispipelined">(settings.IsPipelinedRenderingEnabled);
 
 #if !ONYX_IS_RETAIL
         serializer.Write<"istimelinesamplingenabled">(settings.IsTimeSamplingEnabled);
@@ -48,6 +50,7 @@ namespace Onyx
 
         deserializer.ReadOptional<"isbindless">(outSettings.IsBindless);
         deserializer.ReadOptional<"isdynamicrendering">(outSettings.IsDynamicRenderingEnabled);
+        deserializer.ReadOptional<"ispipelined">(outSettings.IsPipelinedRenderingEnabled);
 
 #if !ONYX_IS_RETAIL
         deserializer.ReadOptional<"istimelinesamplingenabled">(outSettings.IsTimeSamplingEnabled);
@@ -84,7 +87,28 @@ namespace Onyx::Graphics
         m_PlatformSystem->OnWindowCreate<&GraphicsSystem::OnWindowCreate>(this);
         m_PlatformSystem->OnWindowDestroy<&GraphicsSystem::OnWindowDestroy>(this);
 
-        m_GraphicsSystem = MakeUnique<Vulkan::VulkanGraphicsApi>();
+        switch (m_Settings.Api)
+        {
+            case ApiType::Vulkan:
+#if ONYX_USE_VULKAN
+                m_GraphicsSystem = MakeUnique<Vulkan::VulkanGraphicsApi>();
+#endif
+                break;
+            case ApiType::Null:
+                m_GraphicsSystem = MakeUnique<Null::NullGraphicsApi>();
+                break;
+            case ApiType::Dx12:
+            case ApiType::None:
+                break;
+        }
+
+        if (m_GraphicsSystem == nullptr)
+        {
+            ONYX_LOG_ERROR("Graphics api {} is not supported, falling back to the null api.", Enums::ToString(m_Settings.Api));
+            m_Settings.Api = ApiType::Null;
+            m_GraphicsSystem = MakeUnique<Null::NullGraphicsApi>();
+        }
+
         m_GraphicsSystem->Init(m_Settings);
 
         for (const UniquePtr<Platform::Window>& window : m_PlatformSystem->GetWindows())
@@ -92,14 +116,23 @@ namespace Onyx::Graphics
             OnWindowCreate(*window);
         }
 
-        m_PresentThread.Start();
+        if (IsHeadless())
+        {
+            CreateDepthImages(GetSwapchainExtent());
+            CreateViewConstantBuffers();
+        }
+
+        // the null api has nothing to present, frame pacing is done in the api itself
+        if (m_Settings.Api != ApiType::Null)
+            m_PresentThread.Start();
     }
 
     GraphicsSystem::~GraphicsSystem()
     {
         WaitIdle();
 
-        m_PresentThread.Shutdown();
+        if (m_Settings.Api != ApiType::Null)
+            m_PresentThread.Shutdown();
 
         m_FrameContext.Clear();
 
@@ -158,36 +191,21 @@ namespace Onyx::Graphics
         }
     }
 
-    bool GraphicsSystem::BeginFrame()
+    FrameContext& GraphicsSystem::BeginSimulationFrame(onyxU8 frameIndex)
     {
         ONYX_PROFILE(Graphics);
         ONYX_PROFILE_FUNCTION;
-        Platform::Window& mainWindow = m_PlatformSystem->GetMainWindow();
-        if (mainWindow.IsMinimized())
-            return false;
+
+        m_SimulationFrameIndex = frameIndex;
+        FrameContext& frameContext = m_FrameContext[frameIndex];
+        frameContext.FrameIndex = frameIndex;
 
         if (m_Camera != m_QueuedCamera)
             m_Camera = m_QueuedCamera;
 
-        m_HasComputeWork = false;
-
-        FrameContext& currentFrameContext = GetFrameContext();
-        bool hasBegunFrame = m_GraphicsSystem->BeginFrame(currentFrameContext);
-        if ((hasBegunFrame == false) || m_HasWindowResized)
-        {
-            m_HasWindowResized = false;
-            m_PresentThread.ClearQueue();
-            m_FramebufferCache.Clear();
-            CreateDepthImages(mainWindow.GetFrameBufferSize());
-            //m_RenderGraph->OnSwapChainResized(*this);
-            return false;
-        }
-
-        ONYX_PROFILE_MARK_FRAME_START(GPU_FRAME_NAME);
-
         if (m_Camera != nullptr)
         {
-            ViewConstants& viewConstants = currentFrameContext.ViewConstants;
+            ViewConstants& viewConstants = frameContext.ViewConstants;
             viewConstants.ProjectionMatrix = m_Camera->GetProjectionMatrix();
             viewConstants.InverseProjectionMatrix = m_Camera->GetProjectionMatrixInverse();
             viewConstants.ViewMatrix = m_Camera->GetViewMatrix();
@@ -201,6 +219,53 @@ namespace Onyx::Graphics
             viewConstants.Far = m_Camera->GetFar();
         }
 
+        return frameContext;
+    }
+
+    bool GraphicsSystem::BeginFrame()
+    {
+        return BeginFrame(m_FrameIndex);
+    }
+
+    bool GraphicsSystem::BeginFrame(onyxU8 frameIndex)
+    {
+        ONYX_PROFILE(Graphics);
+        ONYX_PROFILE_FUNCTION;
+        const bool isHeadless = IsHeadless();
+        if ((isHeadless == false) && m_PlatformSystem->GetMainWindow().IsMinimized())
+            return false;
+
+        m_HasComputeWork = false;
+
+        m_FrameIndex = frameIndex;
+
+        DynamicArray<RenderCommandT> renderCommands;
+        {
+            std::lock_guard lock(m_RenderCommandsMutex);
+            std::swap(renderCommands, m_RenderCommands);
+        }
+
+        for (RenderCommandT& command : renderCommands)
+            command(*this);
+
+        FrameContext& currentFrameContext = m_FrameContext[m_FrameIndex];
+        currentFrameContext.FrameIndex = m_FrameIndex;
+        currentFrameContext.AbsoluteFrame = m_AbsoluteFrame;
+        currentFrameContext.ComputeFrame = m_ComputeFrame;
+
+        bool hasBegunFrame = m_GraphicsSystem->BeginFrame(currentFrameContext);
+        const bool hasWindowResized = m_HasWindowResized.exchange(false);
+        if ((hasBegunFrame == false) || hasWindowResized)
+        {
+            m_PresentThread.ClearQueue();
+            m_FramebufferCache.Clear();
+            CreateDepthImages(isHeadless ? GetSwapchainExtent() : m_PlatformSystem->GetMainWindow().GetFrameBufferSize());
+            //m_RenderGraph->OnSwapChainResized(*this);
+            return false;
+        }
+
+        ONYX_PROFILE_MARK_FRAME_START(GPU_FRAME_NAME);
+
         m_ViewConstantsUniformBuffers[m_FrameIndex].Buffer->SetData(0, &currentFrameContext.ViewConstants, sizeof(ViewConstants));
 
         m_BeginFrameSignal.Dispatch(currentFrameContext);
@@ -213,7 +278,7 @@ namespace Onyx::Graphics
         ONYX_PROFILE(Graphics);
         ONYX_PROFILE_FUNCTION;
 
-        m_RenderFrameSignal.Dispatch(GetFrameContext());
+        m_RenderFrameSignal.Dispatch(GetRenderFrameContext());
     }
 
     void GraphicsSystem::EndFrame()
@@ -233,7 +298,8 @@ namespace Onyx::Graphics
 
         m_GraphicsSystem->EndFrame(currentFrameContext);
         
-        m_PresentThread.QueuePresent(m_FrameIndex, m_GraphicsSystem->GetAcquiredBackbufferIndex());
+        if (m_Settings.Api != ApiType::Null)
+            m_PresentThread.QueuePresent(m_FrameIndex, m_GraphicsSystem->GetAcquiredBackbufferIndex());
 
         /*if (hasSucceeded == false)
         {
@@ -245,13 +311,18 @@ namespace Onyx::Graphics
 
         ONYX_PROFILE_MARK_FRAME_END(GPU_FRAME_NAME);
 
+        // the next frame context might already be written by the simulation, the counters are copied over in BeginFrame
         m_FrameIndex = (m_FrameIndex + 1) % MAX_FRAMES_IN_FLIGHT;
-        FrameContext& nextFrameContext = m_FrameContext[m_FrameIndex];
-        nextFrameContext.FrameIndex = m_FrameIndex;
-        nextFrameContext.AbsoluteFrame = currentFrameContext.AbsoluteFrame + 1;
+        ++m_AbsoluteFrame;
 
         if (m_HasComputeWork)
-            nextFrameContext.ComputeFrame = currentFrameContext.ComputeFrame + 1;
+            ++m_ComputeFrame;
+    }
+
+    void GraphicsSystem::QueueRenderCommand(RenderCommandT&& command)
+    {
+        std::lock_guard lock(m_RenderCommandsMutex);
+        m_RenderCommands.emplace_back(std::move(command));
     }
 
     onyxU16 GraphicsSystem::GetRefreshRate() const
@@ -274,11 +345,6 @@ namespace Onyx::Graphics
         return m_GraphicsSystem->GetSwapchainExtent();
     }
 
-    const TextureHandle& GraphicsSystem::GetDepthImage() const
-    {
-        return m_DepthImages[m_FrameIndex];
-    }
-
     RenderPassHandle GraphicsSystem::GetOrCreateRenderPass(const RenderPassSettings& settings)
     {
         return m_RenderPassCache.GetOrCreateRenderPass(settings);
@@ -313,6 +379,11 @@ namespace Onyx::Graphics
         m_GraphicsSystem->CreateAlias(outTextrue, storageHandle, aliasStorageProperties, aliasTextureProperties);
     }
 
+    TextureMemoryRequirements GraphicsSystem::GetTextureMemoryRequirements(const TextureStorageProperties& storageProperties) const
+    {
+        return m_GraphicsSystem->GetTextureMemoryRequirements(storageProperties);
+    }
+
     void GraphicsSystem::CreateBuffer(BufferHandle& outBuffer, const BufferProperties& properties)
     {
         return m_GraphicsSystem->CreateBuffer(outBuffer, properties);
@@ -379,6 +450,11 @@ namespace Onyx::Graphics
         return m_BlendStates.at(defaultBlendStateKey);
     }
 
+    bool GraphicsSystem::IsHeadless() const
+    {
+        return (m_Settings.Api == ApiType::Null) && m_PlatformSystem->GetWindows().empty();
+    }
+
     bool GraphicsSystem::IsBindless() const
     {
         return m_GraphicsSystem->IsBindless();
@@ -0,0 +1,59 @@
+#include <onyx/rhi/null/buffer.h>
+
+#include <onyx/rhi/commandbuffer.h>
+
+namespace Onyx::Graphics::Null
+{
+    NullBuffer::NullBuffer(const BufferProperties& properties)
+        : Buffer(properties)
+    {
+        if (m_Properties.m_CpuAccess != CPUAccess::None)
+        {
+            m_HostMemory.resize(m_Properties.m_Size);
+            m_DataPointer = m_HostMemory.data();
+        }
+    }
+
+    void* NullBuffer::Map(MapMode /*mode*/)
+    {
+        ONYX_ASSERT(m_DataPointer != nullptr, "Buffer {} is not cpu accessible", m_Properties.m_DebugName);
+        return m_DataPointer;
+    }
+
+    void NullBuffer::SetData(onyxS32 offset, const void* data, onyxS32 length)
+    {
+        if (m_DataPointer == nullptr)
+            return;
+
+        ONYX_ASSERT((offset >= 0) && (static_cast<onyxU64>(offset + length) <= m_Properties.m_Size));
+        std::memcpy(m_HostMemory.data() + offset, data, length);
+    }
+
+    void NullBuffer::Barrier(CommandBuffer& commandBuffer, Context newContext, Access newAccess)
+    {
+        Barrier(commandBuffer, newContext, newAccess, INVALID_INDEX_8);
+    }
+
+    void NullBuffer::Barrier(CommandBuffer& commandBuffer, Context newContext, Access newAccess, onyxS8 aliasIndex)
+    {
+        BufferHandle handle{ this, aliasIndex };
+        commandBuffer.Barrier(handle, newContext, newAccess);
+    }
+
+    onyxS8 NullBuffer::Alias(const BufferProperties& properties)
+    {
+        m_Aliases.emplace_back(GetAliasedSize(), properties.m_Size);
+        return static_cast<onyxS8>(m_Aliases.size() - 1);
+    }
+
+    onyxU64 NullBuffer::GetAliasedSize() const
+    {
+        onyxU64 size = 0;
+        for (const AliasInfo& info : m_Aliases)
+        {
+            size += info.Size;
+        }
+
+        return size;
+    }
+}
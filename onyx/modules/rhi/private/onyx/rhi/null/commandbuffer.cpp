@@ -0,0 +1,255 @@
+#include <onyx/rhi/null/commandbuffer.h>
+
+namespace Onyx::Graphics::Null
+{
+    onyxU32 CommandStatistics::GetTotal() const
+    {
+        onyxU32 total = 0;
+        for (onyxU32 count : Commands)
+        {
+            total += count;
+        }
+
+        return total;
+    }
+
+    CommandStatistics& CommandStatistics::operator+=(const CommandStatistics& other)
+    {
+        for (onyxU32 i = 0; i < Commands.size(); ++i)
+        {
+            Commands[i] += other.Commands[i];
+        }
+
+        Vertices += other.Vertices;
+        Instances += other.Instances;
+        ThreadGroups += other.ThreadGroups;
+        return *this;
+    }
+
+    NullCommandBuffer::NullCommandBuffer(onyxU8 frameIndex)
+        : m_FrameIndex(frameIndex)
+    {
+    }
+
+    void NullCommandBuffer::Reset()
+    {
+        m_Statistics = {};
+        m_CurrentShaderEffect.Reset();
+        m_IsRecording = false;
+        m_IsInRenderPass = false;
+    }
+
+    void NullCommandBuffer::BeginRenderPass(const RenderPassHandle& /*renderPass*/, const FramebufferHandle& /*frameBuffer*/)
+    {
+        ONYX_ASSERT(m_IsInRenderPass == false, "RenderPass was not ended");
+        m_IsInRenderPass = true;
+        Record(CommandType::BeginRenderPass);
+    }
+
+    void NullCommandBuffer::EndRenderPass()
+    {
+        ONYX_ASSERT(m_IsInRenderPass, "RenderPass was not started");
+        m_IsInRenderPass = false;
+    }
+
+    void NullCommandBuffer::BindShaderEffect(const ShaderInstanceHandle& shader)
+    {
+        ONYX_ASSERT(m_IsInRenderPass || shader->IsCompute(), "RenderPass was not started");
+
+        m_CurrentShaderEffect = shader;
+        Record(CommandType::BindShaderEffect);
+    }
+
+    void NullCommandBuffer::BindVertexBuffer(const BufferHandle& /*buffer*/, onyxU32 /*binding*/, onyxU32 /*offset*/)
+    {
+        Record(CommandType::BindVertexBuffer);
+    }
+
+    void NullCommandBuffer::BindVertexBuffers(const InplaceArray<BufferHandle, 8>& /*bufferHandles*/, const InplaceArray<onyxU32, 8> /*bufferOffsets*/, onyxU32 /*firstBinding*/, onyxU32 /*bindingCount*/)
+    {
+        Record(CommandType::BindVertexBuffer);
+    }
+
+    void NullCommandBuffer::BindIndexBuffer(const BufferHandle& /*buffer*/, onyxU32 /*offset*/, IndexType /*indexType*/)
+    {
+        Record(CommandType::BindIndexBuffer);
+    }
+
+    void NullCommandBuffer::Bind(const TextureHandle& texture, const String& bindingName)
+    {
+        ONYX_ASSERT(m_CurrentShaderEffect, "No ShaderEffect is active.");
+        m_CurrentShaderEffect->Bind(texture, bindingName, m_FrameIndex);
+        Record(CommandType::BindResource);
+    }
+
+    void NullCommandBuffer::Bind(const BufferHandle& buffer, const String& bindingName)
+    {
+        ONYX_ASSERT(m_CurrentShaderEffect, "No ShaderEffect is active.");
+        m_CurrentShaderEffect->Bind(buffer, bindingName, m_FrameIndex);
+        Record(CommandType::BindResource);
+    }
+
+    void NullCommandBuffer::Barrier(BufferHandle& /*buffer*/, Context /*newContext*/, Access /*newAccess*/)
+    {
+        Record(CommandType::Barrier);
+    }
+
+    void NullCommandBuffer::TransitionLayout(TextureHandle& texture, Context newContext, Access newAccess, ImageLayout newLayout)
+    {
+        texture.Storage->TransitionLayout(*this, newContext, newAccess, newLayout);
+        Record(CommandType::Barrier);
+    }
+
+    void NullCommandBuffer::Barriers(Span<TextureBarrier> textureBarriers, Span<BufferBarrier> bufferBarriers)
+    {
+        if (textureBarriers.empty() && bufferBarriers.empty())
+            return;
+
+        for (TextureBarrier& textureBarrier : textureBarriers)
+            textureBarrier.Texture.Storage->TransitionLayout(*this, textureBarrier.NewContext, textureBarrier.NewAccess, textureBarrier.NewLayout);
+
+        // merged into a single dependency like on the gpu backends
+        Record(CommandType::Barrier);
+    }
+
+    void NullCommandBuffer::SetViewport()
+    {
+        Record(CommandType::SetViewport);
+    }
+
+    void NullCommandBuffer::SetViewport(const Viewport& /*viewport*/)
+    {
+        Record(CommandType::SetViewport);
+    }
+
+    void NullCommandBuffer::SetScissor()
+    {
+        Record(CommandType::SetScissor);
+    }
+
+    void NullCommandBuffer::SetScissor(Rect2s16 /*scissorRect*/)
+    {
+        Record(CommandType::SetScissor);
+    }
+
+    void NullCommandBuffer::ClearColor(onyxF32 /*red*/, onyxF32 /*green*/, onyxF32 /*blue*/, onyxF32 /*alpha*/, onyxU32 /*attachmentIndex*/)
+    {
+        Record(CommandType::Clear);
+    }
+
+    void NullCommandBuffer::ClearDepthStencil(onyxF32 /*depth*/, onyxU8 /*stencil*/)
+    {
+        Record(CommandType::Clear);
+    }
+
+    void NullCommandBuffer::Draw(PrimitiveTopology /*topology*/, onyxU32 /*firstVertex*/, onyxU32 vertexCount, onyxU32 /*firstInstance*/, onyxU32 instanceCount)
+    {
+        PreDraw();
+        Record(CommandType::Draw);
+        m_Statistics.Vertices += static_cast<onyxU64>(vertexCount) * instanceCount;
+        m_Statistics.Instances += instanceCount;
+    }
+
+    void NullCommandBuffer::DrawIndexed(PrimitiveTopology /*topology*/, onyxU32 indexCount, onyxU32 instanceCount, onyxU32 /*firstIndex*/, onyxS32 /*vertexOffset*/, onyxU32 /*firstInstance*/)
+    {
+        PreDraw();
+        Record(CommandType::Draw);
+        m_Statistics.Vertices += static_cast<onyxU64>(indexCount) * instanceCount;
+        m_Statistics.Instances += instanceCount;
+    }
+
+    void NullCommandBuffer::DrawIndirect(const BufferHandle& /*buffer*/, onyxU32 /*drawCount*/, onyxU32 /*offset*/, onyxU32 /*stride*/)
+    {
+        PreDraw();
+        Record(CommandType::DrawIndirect);
+    }
+
+    void NullCommandBuffer::DrawIndirectCount(const BufferHandle& /*argumentBuffer*/, onyxU32 /*argumentOffset*/, const BufferHandle& /*countBuffer*/, onyxU32 /*countOffset*/, onyxU32 /*maxDraws*/, onyxU32 /*stride*/)
+    {
+        PreDraw();
+        Record(CommandType::DrawIndirect);
+    }
+
+    void NullCommandBuffer::DrawIndexedIndirect(const BufferHandle& /*buffer*/, onyxU32 /*drawCount*/, onyxU32 /*offset*/, onyxU32 /*stride*/)
+    {
+        PreDraw();
+        Record(CommandType::DrawIndirect);
+    }
+
+    void NullCommandBuffer::DrawMeshTask(onyxU32 taskCount, onyxU32 /*firstTask*/)
+    {
+        PreDraw();
+        Record(CommandType::DrawMeshTask);
+        m_Statistics.ThreadGroups += taskCount;
+    }
+
+    void NullCommandBuffer::DrawMeshTaskIndirect(const BufferHandle& /*argumentBuffer*/, onyxU32 /*argumentOffset*/, const BufferHandle& /*countBuffer*/, onyxU32 /*countOffset*/, onyxU32 /*maxDraws*/, onyxU32 /*stride*/)
+    {
+        PreDraw();
+        Record(CommandType::DrawMeshTask);
+    }
+
+    void NullCommandBuffer::Dispatch(onyxU32 groupX, onyxU32 groupY, onyxU32 groupZ)
+    {
+        PreDraw();
+        Record(CommandType::Dispatch);
+        m_Statistics.ThreadGroups += static_cast<onyxU64>(groupX) * groupY * groupZ;
+    }
+
+    void NullCommandBuffer::DispatchIndirect(const BufferHandle& buffer)
+    {
+        DispatchIndirect(buffer, 0);
+    }
+
+    void NullCommandBuffer::DispatchIndirect(const BufferHandle& /*buffer*/, onyxU32 /*offset*/)
+    {
+        PreDraw();
+        Record(CommandType::Dispatch);
+    }
+
+    void NullCommandBuffer::Copy(const BufferHandle& /*source*/, BufferHandle& /*destination*/)
+    {
+        Record(CommandType::Copy);
+    }
+
+    void NullCommandBuffer::GlobalBarrier(onyxU64 /*srcAccess*/, onyxU64 /*dstAccess*/)
+    {
+        Record(CommandType::Barrier);
+    }
+
+    void NullCommandBuffer::GlobalBarrier(onyxU64 /*srcAccess*/, onyxU64 /*srcStage*/, onyxU64 /*dstAccess*/, onyxU64 /*dstStage*/)
+    {
+        Record(CommandType::Barrier);
+    }
+
+#if ONYX_IS_DEBUG || ONYX_IS_EDITOR
+    void NullCommandBuffer::BeginDebugLabel(StringView /*label*/, const Vector4f32& /*color*/)
+    {
+        Record(CommandType::DebugLabel);
+    }
+
+    void NullCommandBuffer::EndDebugLabel()
+    {
+    }
+#endif
+
+    void NullCommandBuffer::BindPushConstants(ShaderStage /*stage*/, onyxU32 /*offset*/, onyxU32 /*size*/, const void* /*data*/)
+    {
+        Record(CommandType::PushConstants);
+    }
+
+    void NullCommandBuffer::BeginConditionalRendering(const BufferHandle& /*conditionalBuffer*/, onyxU32 /*offset*/)
+    {
+        Record(CommandType::ConditionalRendering);
+    }
+
+    void NullCommandBuffer::EndConditionalRendering()
+    {
+    }
+
+    void NullCommandBuffer::PreDraw()
+    {
+        if (m_CurrentShaderEffect)
+            m_CurrentShaderEffect->PreDraw(m_FrameIndex);
+    }
+}
@@ -0,0 +1,25 @@
+#include <onyx/rhi/null/descriptorset.h>
+
+namespace Onyx::Graphics::Null
+{
+    NullDescriptorSet::NullDescriptorSet(onyxU8 set, HashSet<String>&& bindingIds)
+        : DescriptorSet(set)
+        , m_BindingIds(std::move(bindingIds))
+    {
+    }
+
+    void NullDescriptorSet::Bind(const TextureHandle& /*textureHandle*/, const String& bindingName)
+    {
+        ONYX_ASSERT(m_BindingIds.contains(bindingName), "Unknown binding name.");
+        ++m_PendingUpdateCount;
+    }
+
+    void NullDescriptorSet::Bind(const BufferHandle& /*bufferHandle*/, const String& bindingName)
+    {
+        // same as vulkan, buffers get bound for synchronization reasons even if the binding does not exist
+        if (m_BindingIds.contains(bindingName) == false)
+            return;
+
+        ++m_PendingUpdateCount;
+    }
+}
@@ -0,0 +1,353 @@
+#include <onyx/rhi/null/graphicsapi.h>
+
+#include <onyx/rhi/framecontext.h>
+#include <onyx/rhi/graphicsettings.h>
+#include <onyx/rhi/null/buffer.h>
+#include <onyx/rhi/null/descriptorset.h>
+#include <onyx/rhi/null/texture.h>
+#include <onyx/rhi/null/texturestorage.h>
+
+#include <onyx/platform/window.h>
+#include <onyx/profiler/profiler.h>
+
+namespace Onyx::Graphics::Null
+{
+    namespace
+    {
+        // there is no driver, tightly packed texels are the closest estimate
+        onyxU64 GetTextureMemorySize(const TextureStorageProperties& storageProperties)
+        {
+            onyxU64 bytesPerPixel = 0;
+            switch (storageProperties.m_Format)
+            {
+                case TextureFormat::STENCIL_UINT8: bytesPerPixel = 1; break;
+                case TextureFormat::RG_UNORM8:
+                case TextureFormat::DEPTH_UNORM16: bytesPerPixel = 2; break;
+                case TextureFormat::DEPTH_FLOAT32:
+                case TextureFormat::DEPTH_STENCIL_UNORM16_8UINT:
+                case TextureFormat::DEPTH_STENCIL_UNORM24_8UINT: bytesPerPixel = 4; break;
+                case TextureFormat::DEPTH_STENCIL_FLOAT32_8UINT: bytesPerPixel = 8; break;
+                default: bytesPerPixel = Utils::GetImageFormatBPP(storageProperties.m_Format); break;
+            }
+
+            const Vector3s32& size = storageProperties.m_Size;
+            const onyxU64 layerCount = std::max<onyxU64>(storageProperties.m_ArraySize, 1);
+            return static_cast<onyxU64>(size[0]) * std::max(size[1], 1) * std::max(size[2], 1) * layerCount * bytesPerPixel;
+        }
+    }
+
+    NullGraphicsApi::NullGraphicsApi() = default;
+    NullGraphicsApi::~NullGraphicsApi() = default;
+
+    void NullGraphicsApi::Init(const GraphicSettings& settings)
+    {
+        SetRefreshRate(settings.RefreshRate);
+
+        for (onyxU8 i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i)
+        {
+            FrameCommandBuffers& frameCommandBuffers = m_CommandBuffers[i];
+            for (onyxU8 j = 0; j < COMMAND_BUFFER_COUNT; ++j)
+            {
+                frameCommandBuffers.Graphics.emplace_back(MakeUnique<NullCommandBuffer>(i));
+                frameCommandBuffers.Compute.emplace_back(MakeUnique<NullCommandBuffer>(i));
+            }
+        }
+
+        BufferProperties transientBufferProperties;
+        transientBufferProperties.m_Size = TRANSIENT_BUFFER_SIZE;
+        transientBufferProperties.m_UsageFlags = static_cast<onyxU8>(BufferUsage::Storage | BufferUsage::Indirect | BufferUsage::DeviceAddress);
+        transientBufferProperties.m_GpuAccess = GPUAccess::Write;
+
+        for (onyxU8 i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i)
+        {
+            transientBufferProperties.m_DebugName = Format::Format("TransientBuffer-{}", i);
+            m_RingBuffer[i].Buffer = Reference<NullBuffer>::Create(transientBufferProperties);
+        }
+
+        // headless until a window is created
+        CreateBackbuffers(HEADLESS_SWAPCHAIN_EXTENT);
+    }
+
+    void NullGraphicsApi::Shutdown()
+    {
+        m_Backbuffers.Clear();
+        m_RingBuffer.Clear();
+        m_CommandBuffers.Clear();
+        m_Window = nullptr;
+    }
+
+    bool NullGraphicsApi::BeginFrame(const FrameContext& context)
+    {
+        ONYX_PROFILE_FUNCTION;
+
+        const onyxU64 waitStart = Time::GetCurrentNanoseconds();
+        if ((m_TargetFrameTime != 0) && (m_LastFrameStart != 0))
+        {
+            const onyxU64 elapsed = waitStart - m_LastFrameStart;
+            if (elapsed < m_TargetFrameTime)
+            {
+                std::this_thread::sleep_for(std::chrono::nanoseconds(m_TargetFrameTime - elapsed));
+            }
+        }
+
+        m_FrameStart = Time::GetCurrentNanoseconds();
+        m_LastFrameStart = m_FrameStart;
+
+        // same as an out of date swapchain
+        if ((m_Window != nullptr) && (m_Window->GetFrameBufferSize() != m_SwapchainExtent))
+        {
+            CreateBackbuffers(m_Window->GetFrameBufferSize());
+            return false;
+        }
+
+        m_BackbufferIndex = (m_BackbufferIndex + 1) % MAX_FRAMES_IN_FLIGHT;
+
+        FrameCommandBuffers& frameCommandBuffers = m_CommandBuffers[context.FrameIndex];
+        frameCommandBuffers.UsedGraphics = 0;
+        frameCommandBuffers.UsedCompute = 0;
+
+        m_RingBuffer[context.FrameIndex].Buffer->ClearAliases();
+
+        std::lock_guard lock(m_Mutex);
+        m_CurrentFrameStatistics = {};
+        m_CurrentFrameStatistics.AbsoluteFrame = context.AbsoluteFrame;
+        m_CurrentFrameStatistics.PacingNanoseconds = m_FrameStart - waitStart;
+        return true;
+    }
+
+    bool NullGraphicsApi::EndFrame(const FrameContext& context)
+    {
+        ONYX_PROFILE_FUNCTION;
+
+        FrameCommandBuffers& frameCommandBuffers = m_CommandBuffers[context.FrameIndex];
+
+        std::lock_guard lock(m_Mutex);
+        AccumulateCommandStatistics(frameCommandBuffers.Graphics, frameCommandBuffers.UsedGraphics, m_CurrentFrameStatistics.GraphicsCommands);
+        AccumulateCommandStatistics(frameCommandBuffers.Compute, frameCommandBuffers.UsedCompute, m_CurrentFrameStatistics.ComputeCommands);
+        m_CurrentFrameStatistics.CommandBuffers += frameCommandBuffers.UsedGraphics + frameCommandBuffers.UsedCompute;
+        m_CurrentFrameStatistics.FrameNanoseconds = Time::GetCurrentNanoseconds() - m_FrameStart;
+
+        m_LastFrameStatistics = m_CurrentFrameStatistics;
+        return true;
+    }
+
+    CommandBuffer& NullGraphicsApi::GetCommandBuffer(onyxU8 frameIndex)
+    {
+        return GetCommandBuffer(frameIndex, false);
+    }
+
+    CommandBuffer& NullGraphicsApi::GetCommandBuffer(onyxU8 frameIndex, bool shouldBegin)
+    {
+        FrameCommandBuffers& frameCommandBuffers = m_CommandBuffers[frameIndex];
+        return AcquireCommandBuffer(frameCommandBuffers.Graphics, frameCommandBuffers.UsedGraphics, shouldBegin);
+    }
+
+    CommandBuffer& NullGraphicsApi::GetComputeCommandBuffer(onyxU8 frameIndex)
+    {
+        return GetComputeCommandBuffer(frameIndex, false);
+    }
+
+    CommandBuffer& NullGraphicsApi::GetComputeCommandBuffer(onyxU8 frameIndex, bool shouldBegin)
+    {
+        FrameCommandBuffers& frameCommandBuffers = m_CommandBuffers[frameIndex];
+        return AcquireCommandBuffer(frameCommandBuffers.Compute, frameCommandBuffers.UsedCompute, shouldBegin);
+    }
+
+    void NullGraphicsApi::SubmitInstantCommandBuffer(Context context, onyxU8 frameIndex, InplaceFunction<void(CommandBuffer&)>&& functor)
+    {
+        NullCommandBuffer commandBuffer(frameIndex);
+        commandBuffer.BeginSingleSubmit();
+        functor(commandBuffer);
+        commandBuffer.End();
+
+        std::lock_guard lock(m_Mutex);
+        ++m_CurrentFrameStatistics.InstantSubmits;
+        if (context == Context::Compute)
+            m_CurrentFrameStatistics.ComputeCommands += commandBuffer.GetStatistics();
+        else
+            m_CurrentFrameStatistics.GraphicsCommands += commandBuffer.GetStatistics();
+    }
+
+    void NullGraphicsApi::SetRefreshRate(onyxU16 refreshRate)
+    {
+        m_TargetFrameTime = refreshRate == 0 ? 0 : 1000000000ull / refreshRate;
+    }
+
+    ResourceStatistics NullGraphicsApi::GetResourceStatistics() const
+    {
+        std::lock_guard lock(m_Mutex);
+        return m_ResourceStatistics;
+    }
+
+    void NullGraphicsApi::CreateSwapchain(const Platform::Window& window)
+    {
+        m_Window = &window;
+        CreateBackbuffers(window.GetFrameBufferSize());
+    }
+
+    void NullGraphicsApi::CreateBackbuffers(const Vector2s32& extent)
+    {
+        m_SwapchainExtent = extent;
+
+        TextureStorageProperties storageProperties;
+        storageProperties.m_Size = Vector3s32{ extent, 1 };
+        storageProperties.m_Format = GetSwapchainTextureFormat();
+        storageProperties.m_IsTexture = true;
+        storageProperties.m_IsFrameBuffer = true;
+
+        TextureProperties textureProperties;
+        textureProperties.m_Format = storageProperties.m_Format;
+
+        for (onyxU8 i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i)
+        {
+            storageProperties.m_DebugName = Format::Format("Backbuffer Storage {}", i);
+            textureProperties.m_DebugName = Format::Format("Backbuffer {}", i);
+
+            TextureHandle& backbuffer = m_Backbuffers[i];
+            Reference<NullTextureStorage> storage = Reference<NullTextureStorage>::Create(storageProperties);
+            backbuffer.Texture = new NullTexture(textureProperties, storage.Raw());
+            backbuffer.Storage = storage;
+        }
+    }
+
+    RenderPassHandle NullGraphicsApi::CreateRenderPass(const RenderPassSettings& settings)
+    {
+        {
+            std::lock_guard lock(m_Mutex);
+            ++m_ResourceStatistics.RenderPasses;
+        }
+
+        return Reference<RenderPass>::Create(settings);
+    }
+
+    FramebufferHandle NullGraphicsApi::CreateFramebuffer(const FramebufferSettings& settings)
+    {
+        {
+            std::lock_guard lock(m_Mutex);
+            ++m_ResourceStatistics.Framebuffers;
+        }
+
+        return Reference<Framebuffer>::Create(settings);
+    }
+
+    PipelineHandle NullGraphicsApi::CreatePipeline(ShaderHandle& /*shader*/, const PipelineProperties& properties)
+    {
+        {
+            std::lock_guard lock(m_Mutex);
+            ++m_ResourceStatistics.Pipelines;
+        }
+
+        return Reference<Pipeline>::Create(properties);
+    }
+
+    DynamicArray<DescriptorSetHandle> NullGraphicsApi::CreateDescriptorSet(const ShaderHandle& shader, StringView /*debugName*/)
+    {
+        DynamicArray<DescriptorSetHandle> descriptorSets;
+
+        const ShaderReflectionInfo& reflectionInfo = shader.As<Shader>().GetReflectionData();
+        for (const ShaderDescriptorSet& shaderDescriptorSet : reflectionInfo.shaderDescriptorSets)
+        {
+            HashSet<String> bindingIds;
+            for (const ShaderResourceDeclaration& resource : reflectionInfo.shaderResources | std::views::values)
+            {
+                if (resource.Set == shaderDescriptorSet.Set)
+                    bindingIds.emplace(resource.Name);
+            }
+
+            descriptorSets.push_back(Reference<NullDescriptorSet>::Create(shaderDescriptorSet.Set, std::move(bindingIds)));
+        }
+
+        std::lock_guard lock(m_Mutex);
+        m_ResourceStatistics.DescriptorSets += static_cast<onyxU32>(descriptorSets.size());
+        return descriptorSets;
+    }
+
+    void NullGraphicsApi::CreateTexture(TextureHandle& outTexture, const TextureStorageProperties& storageProperties, const TextureProperties& properties)
+    {
+        Reference<NullTextureStorage> storage = Reference<NullTextureStorage>::Create(storageProperties);
+
+        TextureHandle handle;
+        handle.Texture = new NullTexture(properties, storage.Raw());
+        handle.Storage = storage;
+
+        std::swap(outTexture.Storage, handle.Storage);
+        std::swap(outTexture.Texture, handle.Texture);
+
+        const Vector3s32& size = storageProperties.m_Size;
+        std::lock_guard lock(m_Mutex);
+        ++m_ResourceStatistics.TextureStorages;
+        ++m_ResourceStatistics.Textures;
+        m_ResourceStatistics.TextureTexels += static_cast<onyxU64>(size[0]) * size[1] * size[2] * std::max<onyxU16>(storageProperties.m_ArraySize, 1);
+    }
+
+    void NullGraphicsApi::CreateTexture(TextureHandle& outTexture, const TextureStorageProperties& storageProperties, const TextureProperties& properties, const Span<onyxU8>& /*initialData*/)
+    {
+        CreateTexture(outTexture, storageProperties, properties);
+    }
+
+    void NullGraphicsApi::CreateAlias(TextureHandle& outTexture, TextureStorageHandle& storageHandle, const TextureStorageProperties& aliasStorageProperties, const TextureProperties& aliasTextureProperties)
+    {
+        ONYX_ASSERT(storageHandle, "Storage handle is invalid");
+
+        NullTextureStorage& parentStorage = storageHandle.As<NullTextureStorage>();
+
+        outTexture.Storage = storageHandle;
+        outTexture.Alias = parentStorage.Alias(aliasStorageProperties);
+        outTexture.Texture = new NullTexture(aliasTextureProperties, &parentStorage);
+
+        std::lock_guard lock(m_Mutex);
+        ++m_ResourceStatistics.TextureAliases;
+    }
+
+    TextureMemoryRequirements NullGraphicsApi::GetTextureMemoryRequirements(const TextureStorageProperties& storageProperties) const
+    {
+        TextureMemoryRequirements requirements;
+        requirements.Size = GetTextureMemorySize(storageProperties);
+        return requirements;
+    }
+
+    void NullGraphicsApi::CreateBuffer(BufferHandle& outBuffer, const BufferProperties& properties)
+    {
+        outBuffer.Buffer = Reference<NullBuffer>::Create(properties);
+
+        std::lock_guard lock(m_Mutex);
+        ++m_ResourceStatistics.Buffers;
+        m_ResourceStatistics.BufferBytes += properties.m_Size;
+    }
+
+    BufferHandle NullGraphicsApi::GetTransientBuffer(onyxU8 frameIndex, const BufferProperties& properties)
+    {
+        BufferHandle& ringBuffer = m_RingBuffer[frameIndex];
+        NullBuffer& buffer = ringBuffer.Buffer.As<NullBuffer>();
+        ONYX_ASSERT(buffer.GetAliasedSize() + properties.m_Size <= TRANSIENT_BUFFER_SIZE, "Transient buffer is out of memory");
+
+        const onyxS8 alias = buffer.Alias(properties);
+
+        std::lock_guard lock(m_Mutex);
+        ++m_CurrentFrameStatistics.TransientAllocations;
+        m_CurrentFrameStatistics.TransientBytes += properties.m_Size;
+        return { ringBuffer.Buffer, alias };
+    }
+
+    NullCommandBuffer& NullGraphicsApi::AcquireCommandBuffer(DynamicArray<UniquePtr<NullCommandBuffer>>& commandBuffers, onyxU8& usedCount, bool shouldBegin)
+    {
+        ONYX_ASSERT(usedCount < commandBuffers.size(), "Out of command buffers.");
+
+        NullCommandBuffer& commandBuffer = *commandBuffers[usedCount];
+        ++usedCount;
+
+        commandBuffer.Reset();
+        if (shouldBegin)
+            commandBuffer.Begin();
+
+        return commandBuffer;
+    }
+
+    void NullGraphicsApi::AccumulateCommandStatistics(const DynamicArray<UniquePtr<NullCommandBuffer>>& commandBuffers, onyxU8 usedCount, CommandStatistics& outStatistics)
+    {
+        for (onyxU8 i = 0; i < usedCount; ++i)
+        {
+            outStatistics += commandBuffers[i]->GetStatistics();
+        }
+    }
+}
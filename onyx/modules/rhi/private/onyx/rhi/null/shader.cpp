@@ -0,0 +1,24 @@
+#include <onyx/rhi/null/shader.h>
+
+namespace Onyx::Graphics::Null
+{
+    bool NullShader::AddStage(GraphicsSystem& /*graphicsSystem*/, ShaderStage stage, const ByteCode& byteCode)
+    {
+        if (byteCode.empty())
+            return false;
+
+        m_StageByteCodeSizes[Enums::ToIntegral(stage)] = byteCode.size() * sizeof(onyxU32);
+        return true;
+    }
+
+    void NullShader::RemoveStage(ShaderStage stage)
+    {
+        m_StageByteCodeSizes[Enums::ToIntegral(stage)] = 0;
+    }
+
+    bool NullShader::UpdateReflectionData(GraphicsSystem& /*graphicsSystem*/, ShaderReflectionInfo& reflectionInfo)
+    {
+        m_ReflectionInfo = reflectionInfo;
+        return true;
+    }
+}
@@ -0,0 +1,11 @@
+#include <onyx/rhi/null/texture.h>
+
+#include <onyx/rhi/null/texturestorage.h>
+
+namespace Onyx::Graphics::Null
+{
+    NullTexture::NullTexture(const TextureProperties& properties, const NullTextureStorage* storage)
+        : Texture(properties, storage)
+    {
+    }
+}
@@ -0,0 +1,20 @@
+#include <onyx/rhi/null/texturestorage.h>
+
+namespace Onyx::Graphics::Null
+{
+    NullTextureStorage::NullTextureStorage(const TextureStorageProperties& properties)
+        : TextureStorage(properties)
+    {
+    }
+
+    void NullTextureStorage::TransitionLayout(CommandBuffer& /*commandBuffer*/, Context /*context*/, Access /*access*/, ImageLayout newLayout)
+    {
+        m_Layout = newLayout;
+    }
+
+    onyxS8 NullTextureStorage::Alias(const TextureStorageProperties& properties)
+    {
+        m_Aliases.push_back(properties);
+        return static_cast<onyxS8>(m_Aliases.size() - 1);
+    }
+}
@@ -1,5 +1,6 @@
 #include <onyx/rhi/graphicssystem.h>
 #include <onyx/rhi/shader/shader.h>
+#include <onyx/rhi/null/shader.h>
 
 #if ONYX_USE_VULKAN
 #include <onyx/rhi/vulkan/shader.h>
@@ -19,6 +20,8 @@ namespace Onyx::Graphics
     #else
                 return nullptr;
     #endif
+            case Null:
+                return Reference<Null::NullShader>::Create();
             case Dx12:
             case None:
                 return nullptr;
@@ -1,6 +1,8 @@
 #include <onyx/rhi/shader/shadercache.h>
 
 #include <onyx/hash.h>
+#include <onyx/assets/assetsystem.h>
+#include <onyx/rhi/graphicssystem.h>
 #include <onyx/rhi/shader/shadercompiler.h>
 #include <onyx/rhi/shader/shaderpreprocessor.h>
 #include <onyx/rhi/vulkan/graphicsapi.h>
@@ -22,8 +24,6 @@ namespace Onyx::Graphics
 
         for (const FilePath& shaderDirectory : GetShaderDirectories())
         {
-            m_DirectoryWatcher.AddPath(shaderDirectory, true);
-
             FileSystem::Path::EnumerateFiles(shaderDirectory, [&](const FilePath& path)
             {
                 if (path.has_filename() == false)
@@ -35,29 +35,35 @@ namespace Onyx::Graphics
                 //TODO: enqueue in a different thread
                 FilePath mountPointPath = FileSystem::Path::ConvertToMountPath(path);
 
-                String content;
-                if (FileSystem::OnyxFile::ReadAll(path, content) == false)
+                onyxU64 fileHash = Hash::FastHash64(mountPointPath.generic_string());
+                onyxU64 shaderFileHash;
+                if (FileSystem::OnyxFile::HashContent(path, fileHash, shaderFileHash) == false)
                 {
                     ONYX_LOG_ERROR("Failed reading shader file. ({})", path);
                     return true;
                 }
 
-                onyxU64 fileHash = Hash::FNV1aHash<onyxU64>(mountPointPath.generic_string());
-                onyxU64 shaderFileHash = Hash::FNV1aHash<onyxU64>(content, fileHash);
-
                 m_IncludesCache[fileHash] = { .Path = mountPointPath, .ShaderHash = shaderFileHash, };
                 return true;
             });
         }
 
-        m_DirectoryWatcher.OnFileChanged.Connect<&ShaderCache::OnFileChanged>(this);
+        // shader directories are part of the data mount points which are monitored by the asset system
+        m_GraphicsSystem.GetAssetSystem().GetHotReloadSystem().OnFilesChanged<&ShaderCache::OnFilesChanged>(this);
+#endif
+    }
+
+    ShaderCache::~ShaderCache()
+    {
+#if !ONYX_IS_RETAIL
+        m_GraphicsSystem.GetAssetSystem().GetHotReloadSystem().DisconnectSignals(this);
 #endif
     }
 
     bool ShaderCache::GetOrLoadShader(const FilePath& shaderPath, Reference<Shader>& outShader)
     {
         // TODO: Hash should be hash of properties not just the path
-        onyxU64 fileHash = Hash::FNV1aHash<onyxU64>(shaderPath.generic_string());
+        onyxU64 fileHash = Hash::FastHash64(shaderPath.generic_string());
 
         auto entryIt = m_Cache.find(fileHash);
         bool hasEntry = entryIt != m_Cache.end();
@@ -83,7 +89,7 @@ namespace Onyx::Graphics
             return false;
         }
 
-        onyxU64 shaderHash = Hash::FNV1aHash<onyxU64>(shaderCode, fileHash);
+        onyxU64 shaderHash = Hash::FastHash64(shaderCode, fileHash);
 
         // cached version is still valid we can return it
         // TODO: This is not correct when doing a reload from a header change
@@ -95,6 +101,7 @@ namespace Onyx::Graphics
             {
                 //outEntry = entry;
                 outShader = entry.Shader;
+                AddIncludeDependencies(entry);
                 return true;
             }
         }
@@ -108,6 +115,7 @@ namespace Onyx::Graphics
                 {
                     m_Cache[fileHash] = entry;
                     outShader = m_Cache[fileHash].Shader;
+                    AddIncludeDependencies(entry);
                     return true;
                 }
             }
@@ -135,7 +143,7 @@ namespace Onyx::Graphics
             if (preprocessedShader.m_IsValid)
             {
                 ShaderStageCacheEntry& stageCacheEntry = entry.Stages[i];
-                const onyxU64 stageHash = Hash::FNV1aHash<onyxU64>(preprocessedShader.m_Code, shaderHash);
+                const onyxU64 stageHash = Hash::FastHash64(preprocessedShader.m_Code, shaderHash);
                 if ((stageCacheEntry.Hash != stageHash) ||
                     (AreIncludesUpToDate(stageCacheEntry.IncludeHashes) == false))
                 {
@@ -161,8 +169,8 @@ namespace Onyx::Graphics
                     for (const String& includePath : stageIncludes)
                     {
                        FilePath mountPointPath = FileSystem::Path::ConvertToMountPath(includePath);
-                       onyxU64 includePathHash = Hash::FNV1aHash<onyxU64>(mountPointPath.generic_string());
-                       stageCacheEntry.IncludeHashes[includePathHash] = m_IncludesCache[includePathHash].ShaderHash;
+                       onyxU64 includePathHash = Hash::FastHash64(mountPointPath.generic_string());
+                       stageCacheEntry.IncludeHashes[includePathHash] = GetIncludeHash(includePathHash);
                     }
                 }
             }
@@ -188,6 +196,7 @@ namespace Onyx::Graphics
         SaveCacheToDisk(entry, diskShaderCachePath, reflectionInfo);
 
         outShader = entry.Shader;
+        AddIncludeDependencies(entry);
         return true;
 
     }
@@ -256,27 +265,50 @@ namespace Onyx::Graphics
         stream.Write(reflectionInfo);
     }
 
-    void ShaderCache::OnFileChanged(const FilePath& path, FileSystem::FileWatcher::FileAction /*action*/)
+    void ShaderCache::OnFilesChanged(const DynamicArray<FilePath>& changedFiles)
+    {
+        for (const FilePath& path : changedFiles)
+        {
+            if (path.extension() != ".h")
+                continue;
+
+            onyxU64 fileHash = Hash::FastHash64(path.generic_string());
+            onyxU64 shaderFileHash;
+            if (FileSystem::OnyxFile::HashContent(FileSystem::Path::GetFullPath(path), fileHash, shaderFileHash) == false)
+            {
+                ONYX_LOG_ERROR("Failed reading shader file. ({})", path);
+                continue;
+            }
+
+            std::lock_guard lock(m_IncludesMutex);
+            m_IncludesCache[fileHash] = { .Path = path, .ShaderHash = shaderFileHash, };
+        }
+    }
+
+    void ShaderCache::AddIncludeDependencies(const ShaderCacheEntry& entry)
     {
-        // handled by the asset system
-        if (path.extension() == "oshader")
-            return;
-
-        //FilePath mountPointPath = FileSystem::Path::ConvertToMountPath(path);
-        ////String genericPath = mountPointPath.generic_string();
-        //onyxU64 pathHash = Hash::FNV1aHash<onyxU64>(mountPointPath.generic_string());
-        //for (const ShaderCacheEntry& entry : m_Cache | std::views::values)
-        //{ 
-        //   //if (entry.ShaderPathHash == pathHash)
-        //   //{
-        //   //    ONYX_LOG_INFO("shader changed");
-        //   //}
-
-        //    //if (entry.Includes.contains(pathHash))
-        //    //{
-        //    //    ONYX_LOG_INFO("shader header changed");
-        //    //}
-        //}
+#if !ONYX_IS_RETAIL
+        // the shader asset gets reloaded by the asset system when one of its includes changed
+        DynamicArray<Assets::AssetId> includeAssets;
+        {
+            std::lock_guard lock(m_IncludesMutex);
+            for (const ShaderStageCacheEntry& stage : entry.Stages)
+            {
+                for (onyxU64 includePathHash : stage.IncludeHashes | std::views::keys)
+                {
+                    auto includeIt = m_IncludesCache.find(includePathHash);
+                    if (includeIt != m_IncludesCache.end())
+                        includeAssets.emplace_back(includeIt->second.Path);
+                }
+            }
+        }
+
+        Assets::AssetSystem& assetSystem = m_GraphicsSystem.GetAssetSystem();
+        for (const Assets::AssetId& includeAsset : includeAssets)
+            assetSystem.AddLoadDependency(includeAsset);
+#else
+        ONYX_UNUSED(entry);
+#endif
     }
 
     bool ShaderCache::IsEntryUpToDate(const ShaderCacheEntry& entry, onyxU64 shaderHash) const
@@ -298,6 +330,7 @@ namespace Onyx::Graphics
 
     bool ShaderCache::AreIncludesUpToDate(const HashMap<onyxU64, onyxU64>& includeHashes) const
     {
+        std::lock_guard lock(m_IncludesMutex);
         const auto predicate = [&](const std::pair<onyxU64, onyxU64>& includeEntry)
         {
             auto includeIt = m_IncludesCache.find(includeEntry.first);
@@ -306,4 +339,11 @@ namespace Onyx::Graphics
 
         return std::ranges::all_of(includeHashes, predicate);
     }
+
+    onyxU64 ShaderCache::GetIncludeHash(onyxU64 includePathHash) const
+    {
+        std::lock_guard lock(m_IncludesMutex);
+        auto includeIt = m_IncludesCache.find(includePathHash);
+        return includeIt != m_IncludesCache.end() ? includeIt->second.ShaderHash : 0;
+    }
 }
@@ -45,9 +45,22 @@ namespace Onyx::Graphics::Vulkan
 
     void VulkanBuffer::Barrier(CommandBuffer& commandBuffer, Context newContext, Access newAccess, onyxS8 aliasIndex)
     {
-        // TODO: hazard tracking for regions?
         VulkanCommandBuffer& vkCommandBuffer = static_cast<VulkanCommandBuffer&>(commandBuffer);
 
+        VkBufferMemoryBarrier2 barrier = CreateBarrier(newContext, newAccess, aliasIndex);
+
+        VkDependencyInfo dependency_info{};
+        dependency_info.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+        dependency_info.bufferMemoryBarrierCount = 1;
+        dependency_info.pBufferMemoryBarriers = &barrier;
+        dependency_info.pNext = nullptr;
+
+        vkCmdPipelineBarrier2(vkCommandBuffer.GetHandle(), &dependency_info);
+    }
+
+    VkBufferMemoryBarrier2 VulkanBuffer::CreateBarrier(Context newContext, Access newAccess, onyxS8 aliasIndex)
+    {
+        // TODO: hazard tracking for regions?
         Access currentAccess = m_Access;
         Context currentContext = m_Context;
         onyxU64 offset = 0;
@@ -77,15 +90,9 @@ namespace Onyx::Graphics::Vulkan
         barrier.size = bufferSize;
         barrier.pNext = nullptr;
 
-        VkDependencyInfo dependency_info{};
-        dependency_info.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
-        dependency_info.bufferMemoryBarrierCount = 1;
-        dependency_info.pBufferMemoryBarriers = &barrier;
-        dependency_info.pNext = nullptr;
-
-        vkCmdPipelineBarrier2(vkCommandBuffer.GetHandle(), &dependency_info);
         m_Access = newAccess;
         m_Context = newContext;
+        return barrier;
     }
 
     onyxS8 VulkanBuffer::Alias(const BufferProperties& properties)
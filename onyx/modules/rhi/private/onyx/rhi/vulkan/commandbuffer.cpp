@@ -10,6 +10,7 @@
 #include <onyx/rhi/vulkan/pipeline.h>
 #include <onyx/rhi/vulkan/pipelinelayout.h>
 #include <onyx/rhi/vulkan/texture.h>
+#include <onyx/rhi/vulkan/texturestorage.h>
 #include <onyx/rhi/vulkan/vulkan.h>
 
 #include <onyx/rhi/vulkan/swapchain.h>
@@ -321,6 +322,38 @@ namespace Onyx::Graphics::Vulkan
         texture.Storage->TransitionLayout(*this, newContext, newAccess, newLayout);
     }
 
+    void VulkanCommandBuffer::Barriers(Span<TextureBarrier> textureBarriers, Span<BufferBarrier> bufferBarriers)
+    {
+        if (textureBarriers.empty() && bufferBarriers.empty())
+            return;
+
+        DynamicArray<VkImageMemoryBarrier2KHR> vkImageBarriers;
+        vkImageBarriers.reserve(textureBarriers.size());
+        for (TextureBarrier& textureBarrier : textureBarriers)
+        {
+            VulkanTextureStorage& storage = textureBarrier.Texture.Storage.As<VulkanTextureStorage>();
+            vkImageBarriers.push_back(storage.CreateBarrier(textureBarrier.NewContext, textureBarrier.NewAccess, textureBarrier.NewLayout, textureBarrier.Texture.Alias, textureBarrier.DiscardContents));
+        }
+
+        DynamicArray<VkBufferMemoryBarrier2> vkBufferBarriers;
+        vkBufferBarriers.reserve(bufferBarriers.size());
+        for (BufferBarrier& bufferBarrier : bufferBarriers)
+        {
+            VulkanBuffer& buffer = bufferBarrier.Buffer.Buffer.As<VulkanBuffer>();
+            vkBufferBarriers.push_back(buffer.CreateBarrier(bufferBarrier.NewContext, bufferBarrier.NewAccess, bufferBarrier.Buffer.Alias));
+        }
+
+        VkDependencyInfoKHR dependencyInfo{};
+        dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
+        dependencyInfo.imageMemoryBarrierCount = static_cast<onyxU32>(vkImageBarriers.size());
+        dependencyInfo.pImageMemoryBarriers = vkImageBarriers.data();
+        dependencyInfo.bufferMemoryBarrierCount = static_cast<onyxU32>(vkBufferBarriers.size());
+        dependencyInfo.pBufferMemoryBarriers = vkBufferBarriers.data();
+        dependencyInfo.pNext = nullptr;
+
+        vkCmdPipelineBarrier2(m_CommandBuffer, &dependencyInfo);
+    }
+
     void VulkanCommandBuffer::BindDescriptorSets(VkPipelineLayout pipelineLayout, VkPipelineBindPoint bindingPoint)
     {
         onyxU8 firstSet = 0;
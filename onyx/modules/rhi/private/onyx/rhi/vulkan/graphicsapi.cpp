@@ -423,13 +423,14 @@ namespace Onyx::Graphics::Vulkan
                 TextureUpdate& textureUpdate = m_BindlessTexturesToUpdate[i];
                 // TODO: This is probably not the best way to handle textures that get allocated and dealloacted in the same frame
                 // TextureDeleter clears the index which is a bit hacky just to ensure resizing of the depth texture
-                if (textureUpdate.Texture->GetIndex() == onyxMax_U32)
+                // the handle is checked first as the texture is already freed when it got invalidated
+                if ((m_Textures.IsValid(textureUpdate.Handle) == false) || (textureUpdate.Texture->GetIndex() == onyxMax_U32))
                     continue;
 
                 VkWriteDescriptorSet& descriptor_write = bindlessDescriptorWrites.emplace_back();
                 descriptor_write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
                 descriptor_write.descriptorCount = 1;
-                descriptor_write.dstArrayElement = textureUpdate.Index;
+                descriptor_write.dstArrayElement = textureUpdate.Handle.Index;
                 descriptor_write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
                 descriptor_write.dstSet = m_BindlessDescriptorSets->GetHandle();
                 descriptor_write.dstBinding = BINDLESS_TEXTURE_BINDING;
@@ -689,9 +690,9 @@ namespace Onyx::Graphics::Vulkan
     void VulkanGraphicsApi::ReleaseTexture(const VulkanTexture& texture)
     {
         ONYX_ASSERT(texture.GetRefCount() == 0);
-        m_DeletionQueue.emplace_back([textureIndex = texture.GetIndex(), this]() mutable
+        m_DeletionQueue.emplace_back([textureHandle = texture.GetPoolHandle(), this]() mutable
         {
-            m_Textures.Release(textureIndex);
+            m_Textures.Destroy(textureHandle);
             return true;
         });
     }
@@ -932,15 +933,16 @@ namespace Onyx::Graphics::Vulkan
 
     void VulkanGraphicsApi::CreateTextureView(TextureHandle& handle, const Reference<VulkanTextureStorage>& textureStorage, const TextureProperties& properties)
     {
-        onyxU32 index;
+        PoolHandle poolHandle;
 
-        VulkanTexture* texture = m_Textures.AcquireAndEmplace(index, *this, properties, textureStorage.Raw());
-        texture->SetIndex(index);
+        VulkanTexture* texture = m_Textures.Emplace(poolHandle, *this, properties, textureStorage.Raw());
+        ONYX_ASSERT(texture != nullptr, "Texture pool is exhausted");
+        texture->SetPoolHandle(poolHandle);
 
         handle.Texture = texture;
 
-        //ONYX_LOG_INFO("Allocated texture on index {} with name {}", index, properties.m_DebugName);
-        m_BindlessTexturesToUpdate.push_back({ index, texture });
+        //ONYX_LOG_INFO("Allocated texture on index {} with name {}", poolHandle.Index, properties.m_DebugName);
+        m_BindlessTexturesToUpdate.push_back({ poolHandle, texture });
     }
 
     void VulkanGraphicsApi::CreateAlias(TextureHandle& outTexture, TextureStorageHandle& storageHandle, const TextureStorageProperties& aliasStorageProperties, const TextureProperties& aliasTextureProperties)
@@ -953,12 +955,18 @@ namespace Onyx::Graphics::Vulkan
         outTexture.Storage = storageHandle;
         outTexture.Alias = parentStorage.Alias(aliasStorageProperties);
 
-        onyxU32 index;
-        VulkanTexture* texture = m_Textures.AcquireAndEmplace(index, *this, aliasTextureProperties, &parentStorage, outTexture.Alias);
-        texture->SetIndex(index);
+        PoolHandle poolHandle;
+        VulkanTexture* texture = m_Textures.Emplace(poolHandle, *this, aliasTextureProperties, &parentStorage, outTexture.Alias);
+        ONYX_ASSERT(texture != nullptr, "Texture pool is exhausted");
+        texture->SetPoolHandle(poolHandle);
 
         outTexture.Texture = texture;
-        m_BindlessTexturesToUpdate.push_back({ index, texture });
+        m_BindlessTexturesToUpdate.push_back({ poolHandle, texture });
+    }
+
+    TextureMemoryRequirements VulkanGraphicsApi::GetTextureMemoryRequirements(const TextureStorageProperties& storageProperties) const
+    {
+        return VulkanTextureStorage::GetMemoryRequirements(*this, storageProperties);
     }
 
     void VulkanGraphicsApi::CreateBuffer(BufferHandle& outBuffer, const BufferProperties& properties)
@@ -108,6 +108,18 @@ namespace Onyx::Graphics::Vulkan
         return allocInfo;
     }
 
+    onyxU32 MemoryAllocator::FindMemoryTypeIndex(onyxU32 memoryTypeBits, VkMemoryPropertyFlags requiredFlags, VkMemoryPropertyFlags preferredFlags) const
+    {
+        VmaAllocationCreateInfo allocCreateInfo{};
+        allocCreateInfo.flags = VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT;
+        allocCreateInfo.requiredFlags = requiredFlags;
+        allocCreateInfo.preferredFlags = preferredFlags;
+
+        onyxU32 memoryTypeIndex = 0;
+        VK_CHECK_RESULT(vmaFindMemoryTypeIndex(m_Allocator, memoryTypeBits, &allocCreateInfo, &memoryTypeIndex))
+        return memoryTypeIndex;
+    }
+
     VkImage MemoryAllocator::Alias(VmaAllocation allocation, const VkImageCreateInfo& aliasInfo)
     {
         VkImage alias = nullptr;
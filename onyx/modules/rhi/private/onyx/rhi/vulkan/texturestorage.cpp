@@ -20,25 +20,7 @@ namespace Onyx::Graphics::Vulkan
 	    , DeviceMemory(api.GetAllocator())
 	    , m_Device(&api.GetDevice())
     {
-        const onyxU32 arraySizeScale = properties.m_Type == TextureType::TextureCube ? 6 : 1;
-
-        VkImageCreateInfo createInfo;
-        createInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
-		createInfo.pNext = nullptr;
-        createInfo.flags = VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT;
-	    createInfo.imageType = GetType(properties.m_Type);
-	    createInfo.format = GetFormat(properties.m_Format);
-	    createInfo.mipLevels = properties.m_MaxMipLevel;
-	    createInfo.arrayLayers = arraySizeScale * std::max<onyxU32>(properties.m_ArraySize, 1u);
-	    createInfo.samples = VK_SAMPLE_COUNT_1_BIT;
-	    createInfo.tiling = VK_IMAGE_TILING_OPTIMAL;// IsOptimalTiling(properties) ? VK_IMAGE_TILING_OPTIMAL : VK_IMAGE_TILING_LINEAR;
-	    createInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-	    createInfo.extent = VkExtent3D{ onyxU32(properties.m_Size[0]), onyxU32(properties.m_Size[1]), onyxU32(properties.m_Size[2]) };
-	    createInfo.usage = GetUsageFlags(properties);
-	    if (properties.m_Type == TextureType::TextureCube)
-		    createInfo.flags |= VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT;
-
-	    createInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        const VkImageCreateInfo createInfo = GetCreateInfo(properties);
 
 	    VK_CHECK_RESULT(vkCreateImage(m_Device->GetHandle(), &createInfo, nullptr, &m_Image));
 
@@ -88,6 +70,53 @@ namespace Onyx::Graphics::Vulkan
 	    }
     }
 
+    TextureMemoryRequirements VulkanTextureStorage::GetMemoryRequirements(const VulkanGraphicsApi& api, const TextureStorageProperties& properties)
+    {
+        const VkImageCreateInfo createInfo = GetCreateInfo(properties);
+
+        VkDeviceImageMemoryRequirements imageRequirementsInfo{};
+        imageRequirementsInfo.sType = VK_STRUCTURE_TYPE_DEVICE_IMAGE_MEMORY_REQUIREMENTS;
+        imageRequirementsInfo.pCreateInfo = &createInfo;
+
+        VkMemoryRequirements2 memRequirements{};
+        memRequirements.sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2;
+        vkGetDeviceImageMemoryRequirements(api.GetDevice().GetHandle(), &imageRequirementsInfo, &memRequirements);
+
+        VkMemoryPropertyFlags requiredMemoryPropertyFlags = 0, preferredMemoryPropertyFlags = 0;
+        GetMemoryPropertyFlags(properties.m_CpuAccess, properties.m_GpuAccess, requiredMemoryPropertyFlags, preferredMemoryPropertyFlags);
+
+        TextureMemoryRequirements requirements;
+        requirements.Size = memRequirements.memoryRequirements.size;
+        requirements.Alignment = memRequirements.memoryRequirements.alignment;
+        requirements.MemoryTypeIndex = api.GetAllocator().FindMemoryTypeIndex(memRequirements.memoryRequirements.memoryTypeBits, requiredMemoryPropertyFlags, preferredMemoryPropertyFlags);
+        requirements.IsOptimalTiling = createInfo.tiling == VK_IMAGE_TILING_OPTIMAL;
+        return requirements;
+    }
+
+    VkImageCreateInfo VulkanTextureStorage::GetCreateInfo(const TextureStorageProperties& properties)
+    {
+        const onyxU32 arraySizeScale = properties.m_Type == TextureType::TextureCube ? 6 : 1;
+
+        VkImageCreateInfo createInfo{};
+        createInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+		createInfo.pNext = nullptr;
+        createInfo.flags = VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT;
+	    createInfo.imageType = GetType(properties.m_Type);
+	    createInfo.format = GetFormat(properties.m_Format);
+	    createInfo.mipLevels = properties.m_MaxMipLevel;
+	    createInfo.arrayLayers = arraySizeScale * std::max<onyxU32>(properties.m_ArraySize, 1u);
+	    createInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+	    createInfo.tiling = VK_IMAGE_TILING_OPTIMAL;// IsOptimalTiling(properties) ? VK_IMAGE_TILING_OPTIMAL : VK_IMAGE_TILING_LINEAR;
+	    createInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+	    createInfo.extent = VkExtent3D{ static_cast<onyxU32>(properties.m_Size[0]), static_cast<onyxU32>(properties.m_Size[1]), static_cast<onyxU32>(properties.m_Size[2]) };
+	    createInfo.usage = GetUsageFlags(properties);
+	    if (properties.m_Type == TextureType::TextureCube)
+		    createInfo.flags |= VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT;
+
+	    createInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        return createInfo;
+    }
+
     VkImageAspectFlags VulkanTextureStorage::GetAspectFlags(TextureFormat format)
     {
 	    if (Utils::IsDepthFormat(format))
@@ -266,25 +295,8 @@ namespace Onyx::Graphics::Vulkan
     {
 	    ONYX_ASSERT(m_Image != nullptr, "Image is already allocated.");
 
-        const onyxU32 arraySizeScale = aliasProperties.m_Type == TextureType::TextureCube ? 6 : 1;
-
-        VkImageCreateInfo createInfo{};
-        createInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
-		createInfo.pNext = nullptr;
-        createInfo.flags = VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT;
-	    createInfo.imageType = GetType(aliasProperties.m_Type);
-	    createInfo.format = GetFormat(aliasProperties.m_Format);
-	    createInfo.mipLevels = aliasProperties.m_MaxMipLevel;
-	    createInfo.arrayLayers = arraySizeScale * std::max<onyxU32>(aliasProperties.m_ArraySize, 1u);
-	    createInfo.samples = VK_SAMPLE_COUNT_8_BIT;
-	    createInfo.tiling = VK_IMAGE_TILING_OPTIMAL;// IsOptimalTiling(properties) ? VK_IMAGE_TILING_OPTIMAL : VK_IMAGE_TILING_LINEAR;
-	    createInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-	    createInfo.extent = VkExtent3D{ static_cast<onyxU32>(aliasProperties.m_Size[0]), static_cast<onyxU32>(aliasProperties.m_Size[1]), static_cast<onyxU32>(aliasProperties.m_Size[2]) };
-	    createInfo.usage = GetUsageFlags(aliasProperties);
-	    if (aliasProperties.m_Type == TextureType::TextureCube)
-		    createInfo.flags |= VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT;
-
-	    createInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        // aliases are created with the same create info as the storage so the memory requirements match the planned ones
+        const VkImageCreateInfo createInfo = GetCreateInfo(aliasProperties);
 
 	    // move to device memory
 	    onyxS8 aliasIndex = static_cast<onyxS8>(m_Aliases.size());
@@ -332,16 +344,31 @@ namespace Onyx::Graphics::Vulkan
     }
 
     void VulkanTextureStorage::TransitionLayout(CommandBuffer& commandBuffer, Context context, Access newAccess, ImageLayout newLayout)
+    {
+		VkImageMemoryBarrier2KHR barrier = CreateBarrier(context, newAccess, newLayout, INVALID_INDEX_8, false);
+
+		VkDependencyInfoKHR dependency_info{};
+		dependency_info.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
+		dependency_info.imageMemoryBarrierCount = 1;
+		dependency_info.pImageMemoryBarriers = &barrier;
+		dependency_info.pNext = nullptr;
+
+		VulkanCommandBuffer& vkCommandBuffer = static_cast<VulkanCommandBuffer&>(commandBuffer);
+		vkCmdPipelineBarrier2(vkCommandBuffer.GetHandle(), &dependency_info);
+    }
+
+    VkImageMemoryBarrier2KHR VulkanTextureStorage::CreateBarrier(Context newContext, Access newAccess, ImageLayout newLayout, onyxS8 aliasIndex, bool discardContents)
     {
 		VkImageMemoryBarrier2KHR barrier{};
 		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR;
 		barrier.srcAccessMask = ToAccessFlag(m_Access);
-		barrier.srcStageMask = GetPipelineFlags(barrier.srcAccessMask, context);
+		barrier.srcStageMask = GetPipelineFlags(barrier.srcAccessMask, m_Context);
 		barrier.dstAccessMask = ToAccessFlag(newAccess);
-		barrier.dstStageMask = GetPipelineFlags(barrier.dstAccessMask, context);
+		barrier.dstStageMask = GetPipelineFlags(barrier.dstAccessMask, newContext);
 
         bool isDepthFormat = Utils::IsDepthFormat(m_Properties.m_Format);
-        VkImageLayout vkOldLayout = ToImageLayout(m_Layout);
+        // aliases share the tracked state with the storage, their contents are only valid if discarded on first use
+        VkImageLayout vkOldLayout = discardContents ? VK_IMAGE_LAYOUT_UNDEFINED : ToImageLayout(m_Layout);
         VkImageLayout vkNewLayout = ToImageLayout(newLayout);
  
         if (isDepthFormat)
@@ -361,7 +388,7 @@ namespace Onyx::Graphics::Vulkan
 		barrier.newLayout = vkNewLayout;
 		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
 		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-		barrier.image = m_Image;
+		barrier.image = aliasIndex == INVALID_INDEX_8 ? m_Image : GetAliasHandle(aliasIndex);
 		barrier.subresourceRange.aspectMask = isDepthFormat ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
 		barrier.subresourceRange.baseArrayLayer = 0;
 		barrier.subresourceRange.layerCount = 1;
@@ -370,17 +397,10 @@ namespace Onyx::Graphics::Vulkan
 		barrier.subresourceRange.levelCount = 1;
 		barrier.pNext = nullptr;
 
-		VkDependencyInfoKHR dependency_info{};
-		dependency_info.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
-		dependency_info.imageMemoryBarrierCount = 1;
-		dependency_info.pImageMemoryBarriers = &barrier;
-		dependency_info.pNext = nullptr;
-
-		VulkanCommandBuffer& vkCommandBuffer = static_cast<VulkanCommandBuffer&>(commandBuffer);
-		vkCmdPipelineBarrier2(vkCommandBuffer.GetHandle(), &dependency_info);
-
 		m_Layout = newLayout;
 		m_Access = newAccess;
+		m_Context = newContext;
+		return barrier;
     }
 
     VkImageUsageFlags VulkanTextureStorage::GetUsageFlags(const TextureStorageProperties& properties)
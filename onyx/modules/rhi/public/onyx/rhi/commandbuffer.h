@@ -12,6 +12,23 @@ namespace Onyx::Graphics
     class Framebuffer;
     class RenderPass;
 
+    struct TextureBarrier
+    {
+        TextureHandle Texture;
+        Context NewContext = Context::Graphics;
+        Access NewAccess = Access::None;
+        ImageLayout NewLayout = ImageLayout::None;
+        // previous contents are not needed (e.g.: first use of an aliased attachment)
+        bool DiscardContents = false;
+    };
+
+    struct BufferBarrier
+    {
+        BufferHandle Buffer;
+        Context NewContext = Context::Graphics;
+        Access NewAccess = Access::None;
+    };
+
     class CommandBuffer : public NonCopyable
     {
         friend struct ConditionalRender;
@@ -53,6 +70,9 @@ namespace Onyx::Graphics
         virtual void Barrier(BufferHandle& buffer, Context newContext, Access newAccess) = 0;
         virtual void TransitionLayout(TextureHandle& texture, Context newContext, Access newAccess, ImageLayout newLayout) = 0;
 
+        // Submits all barriers as a single dependency
+        virtual void Barriers(Span<TextureBarrier> textureBarriers, Span<BufferBarrier> bufferBarriers) = 0;
+
         virtual void SetViewport() = 0;
         virtual void SetViewport(const Viewport& viewport) = 0;
         virtual void SetScissor() = 0;
@@ -61,6 +61,7 @@ namespace Onyx
             virtual void CreateTexture(TextureHandle& outTexture, const TextureStorageProperties& storageProperties, const TextureProperties& properties) = 0;
             virtual void CreateTexture(TextureHandle& outTexture, const TextureStorageProperties& storageProperties, const TextureProperties& properties, const Span<onyxU8>& initialData) = 0;
             virtual void CreateAlias(TextureHandle& outTexture, TextureStorageHandle& storageHandle, const TextureStorageProperties& aliasStorageProperties, const TextureProperties& aliasTextureProperties) = 0;
+            virtual TextureMemoryRequirements GetTextureMemoryRequirements(const TextureStorageProperties& storageProperties) const = 0;
             
             virtual void CreateBuffer(BufferHandle& outBuffer, const BufferProperties& properties) = 0;
             virtual BufferHandle GetTransientBuffer(onyxU8 frameIndex, const BufferProperties& properties) = 0;
@@ -9,10 +9,13 @@ namespace Onyx::Graphics
         ApiType Api = ApiType::Vulkan;
         Assets::AssetId DefaultRenderGraph{ "engine:/rendergraphs/default.orendergraph" };
 
+        // 0 disables frame pacing for the null api
         onyxU16 RefreshRate = 60;
 
         bool IsBindless = true;
         bool IsDynamicRenderingEnabled = true;
+        // records frame N on a render thread while the simulation of frame N + 1 runs on the main thread
+        bool IsPipelinedRenderingEnabled = false;
 
 #if !ONYX_IS_RETAIL
         bool IsTimeSamplingEnabled = false;
@@ -55,6 +55,7 @@ namespace Onyx::Graphics
         using BeginFrameSignalT = Signal<void(const FrameContext&)>;
         using RenderFrameSignalT = Signal<void(const FrameContext&)>;
         using EndFrameSignalT = Signal<void(const FrameContext&)>;
+        using RenderCommandT = InplaceFunction<void(GraphicsSystem&)>;
 
     public:
         static constexpr StringId32 TypeId = "Onyx::Graphics::GraphicsSystem";
@@ -63,10 +64,20 @@ namespace Onyx::Graphics
         GraphicsSystem(const GraphicSettings& settings, Assets::AssetSystem& assetSystem, Platform::PlatformSystem& platformSystem);
         ~GraphicsSystem() override;
 
+        // Simulation side: snapshots the camera and selects the frame context systems write their frame data into.
+        // The sequential loop passes the frame index that gets rendered next, the pipelined loop the one the render thread is not using.
+        FrameContext& BeginSimulationFrame(onyxU8 frameIndex);
+
+        // Render side: renders the frame context of the frame index, which must not be written by the simulation until EndFrame returned
         bool BeginFrame();
+        bool BeginFrame(onyxU8 frameIndex);
         void Render();
         void EndFrame();
 
+        // runs the command on the render side at the beginning of the next rendered frame,
+        // for work that touches render state (e.g. initializing a render graph) and is triggered by the simulation
+        void QueueRenderCommand(RenderCommandT&& command);
+
         ApiType GetApiType() const { return m_Settings.Api; }
         GraphicSettings& GetSettings() { return m_Settings; }
         const GraphicSettings& GetSettings() const { return m_Settings; }
@@ -85,11 +96,12 @@ namespace Onyx::Graphics
         TextureFormat GetSwapchainTextureFormat() const;
         const Vector2s32& GetSwapchainExtent() const;
 
-        const TextureHandle& GetDepthImage() const;
+        const TextureHandle& GetDepthImage(onyxU8 frameIndex) const { return m_DepthImages[frameIndex]; }
         TextureFormat GetDepthTextureFormat() const { return m_DepthTextureFormat; }
         const Vector2s32& GetDepthTextureExtent() const { return m_DepthTextureExtent; }
 
         ShaderCache& GetShaderCache() { return m_ShaderCache; }
+        Assets::AssetSystem& GetAssetSystem() { return *m_AssetSystem; }
 
         RenderPassHandle GetOrCreateRenderPass(const RenderPassSettings& settings);
         FramebufferHandle GetOrCreateFramebuffer(const FramebufferSettings& settings);
@@ -99,17 +111,24 @@ namespace Onyx::Graphics
         void CreateTexture(TextureHandle& outTexture, const TextureStorageProperties& storageProperties, const TextureProperties& properties);
         void CreateTexture(TextureHandle& outTexture, const TextureStorageProperties& storageProperties, const TextureProperties& properties, const Span<onyxU8>& initialData);
         void CreateAlias(TextureHandle& outTexture, TextureStorageHandle& storageHandle, const TextureStorageProperties& aliasStorageProperties, const TextureProperties& aliasTextureProperties);
+        TextureMemoryRequirements GetTextureMemoryRequirements(const TextureStorageProperties& storageProperties) const;
 
         void CreateBuffer(BufferHandle& outBuffer, const BufferProperties& properties);
         BufferHandle GetTransientBuffer(const BufferProperties& properties);
 
         DynamicArray<DescriptorSetHandle> CreateDescriptorSet(const ShaderHandle& shader, StringView debugName) const;
 
+        bool IsPipelined() const { return m_Settings.IsPipelinedRenderingEnabled; }
+
+        // frame index of the render side, the simulation has to use the frame index of its frame context
         onyxU8 GetFrameIndex() const { return m_FrameIndex; }
-        FrameContext& GetFrameContext() { return m_FrameContext[m_FrameIndex]; }
-        const FrameContext& GetFrameContext() const { return m_FrameContext[m_FrameIndex]; }
-        const ViewConstants& GetViewContsants() const { return m_FrameContext[m_FrameIndex].ViewConstants; }
-        const BufferHandle& GetViewConstantsBuffer() const { return m_ViewConstantsUniformBuffers[m_FrameIndex]; }
+        // frame context of the simulation, equal to the render frame context unless rendering is pipelined
+        FrameContext& GetFrameContext() { return m_FrameContext[m_SimulationFrameIndex]; }
+        const FrameContext& GetFrameContext() const { return m_FrameContext[m_SimulationFrameIndex]; }
+        FrameContext& GetRenderFrameContext() { return m_FrameContext[m_FrameIndex]; }
+        const FrameContext& GetRenderFrameContext() const { return m_FrameContext[m_FrameIndex]; }
+        const ViewConstants& GetViewContsants(onyxU8 frameIndex) const { return m_FrameContext[frameIndex].ViewConstants; }
+        const BufferHandle& GetViewConstantsBuffer(onyxU8 frameIndex) const { return m_ViewConstantsUniformBuffers[frameIndex]; }
 
         CommandBuffer& GetCommandBuffer(onyxU8 frameIndex);
         CommandBuffer& GetCommandBuffer(onyxU8 frameIndex, bool shouldBegin);
@@ -120,6 +139,8 @@ namespace Onyx::Graphics
         const BlendState& GetDefaultBlendState() const;
 
         bool IsBindless() const;
+        // running without any window, only supported by the null api
+        bool IsHeadless() const;
 #if !ONYX_IS_RETAIL
         bool IsShaderDebugEnabled() const { return m_Settings.IsShaderDebugEnabled; }
 #endif
@@ -159,8 +180,13 @@ namespace Onyx::Graphics
         UniquePtr<GraphicsApiInterface> m_GraphicsSystem;
 
         onyxU8 m_FrameIndex = 0;
+        onyxU8 m_SimulationFrameIndex = 0;
         InplaceArray<FrameContext, MAX_FRAMES_IN_FLIGHT> m_FrameContext;
 
+        // owned by the render side and copied into the frame context when it begins rendering
+        onyxU64 m_AbsoluteFrame = 0;
+        onyxU64 m_ComputeFrame = 0;
+
         TextureFormat m_DepthTextureFormat = TextureFormat::Invalid;
         Vector2s32 m_DepthTextureExtent;
 
@@ -178,8 +204,12 @@ namespace Onyx::Graphics
         RenderFrameSignalT m_RenderFrameSignal;
         EndFrameSignalT m_EndFrameSignal;
 
+        std::mutex m_RenderCommandsMutex;
+        DynamicArray<RenderCommandT> m_RenderCommands;
+
         bool m_HasComputeWork = false;
-        bool m_HasWindowResized = false;
+        // set by the window callbacks and consumed by the render thread
+        Atomic<bool> m_HasWindowResized = false;
     };
 }
 
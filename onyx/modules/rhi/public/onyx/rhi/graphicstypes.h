@@ -19,7 +19,8 @@ namespace Onyx::Graphics
     {
         None,
         Dx12,
-        Vulkan
+        Vulkan,
+        Null // headless, no gpu work is done
     };
 
     enum class Access : onyxU32
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <onyx/rhi/buffer.h>
+
+namespace Onyx::Graphics::Null
+{
+    // Buffers only get host memory if the cpu can access them, gpu only buffers are just tracked
+    class NullBuffer : public Buffer
+    {
+    public:
+        NullBuffer(const BufferProperties& properties);
+        ~NullBuffer() override = default;
+
+        void* Map(MapMode mode) override;
+        void Unmap() override {}
+
+        void Flush(onyxU32 /*offset*/, onyxU32 /*count*/) override {}
+        void SetData(onyxS32 offset, const void* data, onyxS32 length) override;
+
+        onyxU64 GetAliasOffset(onyxS8 alias) const override
+        {
+            if (alias == INVALID_INDEX_8)
+                return 0;
+            return m_Aliases[alias].Offset;
+        }
+
+        onyxU64 GetAliasSize(onyxS8 alias) const override
+        {
+            if (alias == INVALID_INDEX_8)
+                return m_Properties.m_Size;
+
+            return m_Aliases[alias].Size;
+        }
+
+        void ClearAliases() override { m_Aliases.clear(); }
+
+        void Barrier(CommandBuffer& commandBuffer, Context newContext, Access newAccess) override;
+        void Barrier(CommandBuffer& commandBuffer, Context newContext, Access newAccess, onyxS8 aliasIndex) override;
+        onyxS8 Alias(const BufferProperties& properties) override;
+
+        onyxU64 GetAliasedSize() const;
+
+    private:
+        struct AliasInfo
+        {
+            onyxU64 Offset;
+            onyxU64 Size;
+        };
+
+        DynamicArray<AliasInfo> m_Aliases;
+        DynamicArray<onyxU8> m_HostMemory;
+    };
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <onyx/rhi/commandbuffer.h>
+
+namespace Onyx::Graphics::Null
+{
+    enum class CommandType : onyxU8
+    {
+        BeginRenderPass,
+        BindShaderEffect,
+        BindVertexBuffer,
+        BindIndexBuffer,
+        BindResource,
+        PushConstants,
+        Barrier,
+        SetViewport,
+        SetScissor,
+        Clear,
+        Draw,
+        DrawIndirect,
+        DrawMeshTask,
+        Dispatch,
+        Copy,
+        ConditionalRendering,
+        DebugLabel,
+        Count
+    };
+
+    struct CommandStatistics
+    {
+        Array<onyxU32, Enums::ToIntegral(CommandType::Count)> Commands{};
+
+        // only known for direct draws and dispatches
+        onyxU64 Vertices = 0;
+        onyxU64 Instances = 0;
+        onyxU64 ThreadGroups = 0;
+
+        onyxU32 Get(CommandType type) const { return Commands[Enums::ToIntegral(type)]; }
+        onyxU32 GetTotal() const;
+
+        CommandStatistics& operator+=(const CommandStatistics& other);
+    };
+
+    // Records nothing but counts every command so the cpu side of a frame can be measured without a gpu
+    class NullCommandBuffer : public CommandBuffer
+    {
+    public:
+        NullCommandBuffer(onyxU8 frameIndex);
+
+        void Reset() override;
+
+        void Begin() override { m_IsRecording = true; }
+        void BeginSingleSubmit() override { m_IsRecording = true; }
+        void End() override { m_IsRecording = false; }
+
+        void BeginRenderPass(const RenderPassHandle& renderPass, const FramebufferHandle& frameBuffer) override;
+        void EndRenderPass() override;
+
+        void BindShaderEffect(const ShaderInstanceHandle& shader) override;
+        void BindVertexBuffer(const BufferHandle& buffer, onyxU32 binding, onyxU32 offset) override;
+        void BindVertexBuffers(const InplaceArray<BufferHandle, 8>& bufferHandles, const InplaceArray<onyxU32, 8> bufferOffsets, onyxU32 firstBinding, onyxU32 bindingCount) override;
+        void BindIndexBuffer(const BufferHandle& buffer, onyxU32 offset, IndexType indexType) override;
+
+        void Bind(const TextureHandle& texture, const String& bindingName) override;
+        void Bind(const BufferHandle& buffer, const String& bindingName) override;
+
+        void Barrier(BufferHandle& buffer, Context newContext, Access newAccess) override;
+        void TransitionLayout(TextureHandle& texture, Context newContext, Access newAccess, ImageLayout newLayout) override;
+        void Barriers(Span<TextureBarrier> textureBarriers, Span<BufferBarrier> bufferBarriers) override;
+
+        void SetViewport() override;
+        void SetViewport(const Viewport& viewport) override;
+        void SetScissor() override;
+        void SetScissor(Rect2s16 scissorRect) override;
+
+        void ClearColor(onyxF32 red, onyxF32 green, onyxF32 blue, onyxF32 alpha, onyxU32 attachmentIndex) override;
+        void ClearDepthStencil(onyxF32 depth, onyxU8 stencil) override;
+
+        void Draw(PrimitiveTopology topology, onyxU32 firstVertex, onyxU32 vertexCount, onyxU32 firstInstance, onyxU32 instanceCount) override;
+        void DrawIndexed(PrimitiveTopology topology, onyxU32 indexCount, onyxU32 instanceCount, onyxU32 firstIndex, onyxS32 vertexOffset, onyxU32 firstInstance) override;
+        void DrawIndirect(const BufferHandle& buffer, onyxU32 drawCount, onyxU32 offset, onyxU32 stride) override;
+        void DrawIndirectCount(const BufferHandle& argumentBuffer, onyxU32 argumentOffset, const BufferHandle& countBuffer, onyxU32 countOffset, onyxU32 maxDraws, onyxU32 stride) override;
+        void DrawIndexedIndirect(const BufferHandle& buffer, onyxU32 drawCount, onyxU32 offset, onyxU32 stride) override;
+
+        void DrawMeshTask(onyxU32 taskCount, onyxU32 firstTask) override;
+        void DrawMeshTaskIndirect(const BufferHandle& argumentBuffer, onyxU32 argumentOffset, const BufferHandle& countBuffer, onyxU32 countOffset, onyxU32 maxDraws, onyxU32 stride) override;
+
+        void Dispatch(onyxU32 groupX, onyxU32 groupY, onyxU32 groupZ) override;
+        void DispatchIndirect(const BufferHandle& buffer) override;
+        void DispatchIndirect(const BufferHandle& buffer, onyxU32 offset) override;
+
+        void Copy(const BufferHandle& source, BufferHandle& destination) override;
+
+        // DEBUG
+        void GlobalBarrier(onyxU64 srcAccess, onyxU64 dstAccess) override;
+        void GlobalBarrier(onyxU64 srcAccess, onyxU64 srcStage, onyxU64 dstAccess, onyxU64 dstStage) override;
+
+#if ONYX_IS_DEBUG || ONYX_IS_EDITOR
+        void BeginDebugLabel(StringView label, const Vector4f32& color) override;
+        void EndDebugLabel() override;
+#endif
+
+        const CommandStatistics& GetStatistics() const { return m_Statistics; }
+        bool IsRecording() const { return m_IsRecording; }
+
+    protected:
+        void BindPushConstants(ShaderStage stage, onyxU32 offset, onyxU32 size, const void* data) override;
+        void BeginConditionalRendering(const BufferHandle& conditionalBuffer, onyxU32 offset) override;
+        void EndConditionalRendering() override;
+
+    private:
+        void Record(CommandType type) { ++m_Statistics.Commands[Enums::ToIntegral(type)]; }
+        void PreDraw();
+
+    private:
+        CommandStatistics m_Statistics;
+        ShaderInstanceHandle m_CurrentShaderEffect;
+
+        onyxU8 m_FrameIndex;
+
+        bool m_IsRecording = false;
+        bool m_IsInRenderPass = false;
+    };
+}
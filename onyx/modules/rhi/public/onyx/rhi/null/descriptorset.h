@@ -0,0 +1,24 @@
+#pragma once
+
+#include <onyx/rhi/descriptorset.h>
+
+namespace Onyx::Graphics::Null
+{
+    class NullDescriptorSet : public DescriptorSet
+    {
+    public:
+        NullDescriptorSet(onyxU8 set, HashSet<String>&& bindingIds);
+        ~NullDescriptorSet() override = default;
+
+        bool HasPendingUpdates() const override { return m_PendingUpdateCount != 0; }
+        void UpdateDescriptors() override { m_PendingUpdateCount = 0; }
+
+        void Bind(const TextureHandle& textureHandle, const String& bindingName) override;
+        void Bind(const BufferHandle& bufferHandle, const String& bindingName) override;
+        HashSet<String> GetBindingIds() const override { return m_BindingIds; }
+
+    private:
+        HashSet<String> m_BindingIds;
+        onyxU32 m_PendingUpdateCount = 0;
+    };
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <onyx/rhi/graphicsapiinterface.h>
+#include <onyx/rhi/null/commandbuffer.h>
+
+namespace Onyx::Graphics::Null
+{
+    struct ResourceStatistics
+    {
+        onyxU32 RenderPasses = 0;
+        onyxU32 Framebuffers = 0;
+        onyxU32 Pipelines = 0;
+        onyxU32 DescriptorSets = 0;
+        onyxU32 TextureStorages = 0;
+        onyxU32 Textures = 0;
+        onyxU32 TextureAliases = 0;
+        onyxU32 Buffers = 0;
+
+        onyxU64 BufferBytes = 0;
+        onyxU64 TextureTexels = 0;
+    };
+
+    struct FrameStatistics
+    {
+        onyxU64 AbsoluteFrame = 0;
+
+        CommandStatistics GraphicsCommands;
+        CommandStatistics ComputeCommands;
+        onyxU32 CommandBuffers = 0;
+        onyxU32 InstantSubmits = 0;
+
+        onyxU32 TransientAllocations = 0;
+        onyxU64 TransientBytes = 0;
+
+        // cpu time between BeginFrame and EndFrame
+        onyxU64 FrameNanoseconds = 0;
+        // time spent waiting in BeginFrame to match the refresh rate
+        onyxU64 PacingNanoseconds = 0;
+    };
+
+    // Headless backend without any gpu work.
+    // Resources and commands are only tracked so the cpu side of the engine can be run and benchmarked on machines without a gpu.
+    // Frames are paced to GraphicSettings::RefreshRate, a refresh rate of 0 runs unthrottled.
+    class NullGraphicsApi : public GraphicsApiInterface
+    {
+        static constexpr onyxU8 COMMAND_BUFFER_COUNT = 8;
+        static constexpr onyxU64 TRANSIENT_BUFFER_SIZE = 1ull << 28ull;
+        static constexpr Vector2s32 HEADLESS_SWAPCHAIN_EXTENT{ 1920, 1080 };
+
+    public:
+        NullGraphicsApi();
+        ~NullGraphicsApi() override;
+
+        void Init(const GraphicSettings& settings) override;
+        void Shutdown() override;
+
+        bool BeginFrame(const FrameContext& context) override;
+        bool EndFrame(const FrameContext& context) override;
+
+        bool IsBindless() const override { return false; }
+
+        CommandBuffer& GetCommandBuffer(onyxU8 frameIndex) override;
+        CommandBuffer& GetCommandBuffer(onyxU8 frameIndex, bool shouldBegin) override;
+        CommandBuffer& GetComputeCommandBuffer(onyxU8 frameIndex) override;
+        CommandBuffer& GetComputeCommandBuffer(onyxU8 frameIndex, bool shouldBegin) override;
+
+        void SubmitInstantCommandBuffer(Context context, onyxU8 frameIndex, InplaceFunction<void(CommandBuffer&)>&& functor) override;
+
+        void SetRefreshRate(onyxU16 refreshRate);
+
+        ResourceStatistics GetResourceStatistics() const;
+        const FrameStatistics& GetLastFrameStatistics() const { return m_LastFrameStatistics; }
+
+    private:
+        void WaitIdle() const override {}
+        void CreateSwapchain(const Platform::Window& window) override;
+        void CreateBackbuffers(const Vector2s32& extent);
+
+        TextureHandle& GetAcquiredSwapChainImage() override { return m_Backbuffers[m_BackbufferIndex]; }
+        const TextureHandle& GetAcquiredSwapChainImage() const override { return m_Backbuffers[m_BackbufferIndex]; }
+        onyxU32 GetAcquiredBackbufferIndex() const override { return m_BackbufferIndex; }
+
+        TextureFormat GetSwapchainTextureFormat() const override { return TextureFormat::BGRA_UNORM8; }
+        const Vector2s32& GetSwapchainExtent() const override { return m_SwapchainExtent; }
+
+        RenderPassHandle CreateRenderPass(const RenderPassSettings& settings) override;
+        FramebufferHandle CreateFramebuffer(const FramebufferSettings& settings) override;
+        PipelineHandle CreatePipeline(ShaderHandle& shader, const PipelineProperties& properties) override;
+        DynamicArray<DescriptorSetHandle> CreateDescriptorSet(const ShaderHandle& shader, StringView debugName) override;
+
+        void CreateTexture(TextureHandle& outTexture, const TextureStorageProperties& storageProperties, const TextureProperties& properties) override;
+        void CreateTexture(TextureHandle& outTexture, const TextureStorageProperties& storageProperties, const TextureProperties& properties, const Span<onyxU8>& initialData) override;
+        void CreateAlias(TextureHandle& outTexture, TextureStorageHandle& storageHandle, const TextureStorageProperties& aliasStorageProperties, const TextureProperties& aliasTextureProperties) override;
+        TextureMemoryRequirements GetTextureMemoryRequirements(const TextureStorageProperties& storageProperties) const override;
+
+        void CreateBuffer(BufferHandle& outBuffer, const BufferProperties& properties) override;
+        BufferHandle GetTransientBuffer(onyxU8 frameIndex, const BufferProperties& properties) override;
+
+        NullCommandBuffer& AcquireCommandBuffer(DynamicArray<UniquePtr<NullCommandBuffer>>& commandBuffers, onyxU8& usedCount, bool shouldBegin);
+        void AccumulateCommandStatistics(const DynamicArray<UniquePtr<NullCommandBuffer>>& commandBuffers, onyxU8 usedCount, CommandStatistics& outStatistics);
+
+    private:
+        struct FrameCommandBuffers
+        {
+            DynamicArray<UniquePtr<NullCommandBuffer>> Graphics;
+            DynamicArray<UniquePtr<NullCommandBuffer>> Compute;
+            onyxU8 UsedGraphics = 0;
+            onyxU8 UsedCompute = 0;
+        };
+
+        mutable std::mutex m_Mutex;
+        ResourceStatistics m_ResourceStatistics;
+
+        InplaceArray<FrameCommandBuffers, MAX_FRAMES_IN_FLIGHT> m_CommandBuffers;
+        InplaceArray<BufferHandle, MAX_FRAMES_IN_FLIGHT> m_RingBuffer;
+
+        const Platform::Window* m_Window = nullptr; // non owning, null when running headless
+        InplaceArray<TextureHandle, MAX_FRAMES_IN_FLIGHT> m_Backbuffers;
+        Vector2s32 m_SwapchainExtent;
+        onyxU32 m_BackbufferIndex = 0;
+
+        onyxU64 m_TargetFrameTime = 0;
+        onyxU64 m_LastFrameStart = 0;
+        onyxU64 m_FrameStart = 0;
+
+        FrameStatistics m_CurrentFrameStatistics;
+        FrameStatistics m_LastFrameStatistics;
+    };
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <onyx/rhi/shader/shader.h>
+
+namespace Onyx::Graphics::Null
+{
+    // Keeps the reflection data so shader instances and descriptor sets behave like on a real backend
+    class NullShader : public Shader
+    {
+    public:
+        NullShader() = default;
+        ~NullShader() override = default;
+
+        bool AddStage(GraphicsSystem& graphicsSystem, ShaderStage stage, const ByteCode& byteCode) override;
+        void RemoveStage(ShaderStage stage) override;
+
+        const ShaderReflectionInfo& GetReflectionData() const override { return m_ReflectionInfo; }
+        bool UpdateReflectionData(GraphicsSystem& graphicsSystem, ShaderReflectionInfo& reflectionInfo) override;
+
+        onyxU64 GetShaderHash() const override { return m_ShaderHash; }
+        void SetShaderHash(onyxU64 hash) override { m_ShaderHash = hash; }
+
+        bool IsComputeShader() const override { return HasStage(ShaderStage::Compute); }
+        bool HasStage(ShaderStage stage) const { return m_StageByteCodeSizes[Enums::ToIntegral(stage)] != 0; }
+        bool HasDescriptorSetLayout() const override { return m_ReflectionInfo.shaderDescriptorSets.empty() == false; }
+
+    private:
+        onyxU64 m_ShaderHash = 0;
+        Array<onyxU64, MAX_SHADER_STAGES> m_StageByteCodeSizes{};
+        ShaderReflectionInfo m_ReflectionInfo;
+    };
+}
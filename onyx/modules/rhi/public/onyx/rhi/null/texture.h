@@ -0,0 +1,19 @@
+#pragma once
+
+#include <onyx/rhi/texture.h>
+
+namespace Onyx::Graphics::Null
+{
+    class NullTextureStorage;
+
+    // Null textures are not part of a bindless pool and are deleted as soon as the last reference is gone
+    class NullTexture : public Texture
+    {
+    public:
+        NullTexture(const TextureProperties& properties, const NullTextureStorage* storage);
+        ~NullTexture() override = default;
+
+    private:
+        void Release() override {}
+    };
+}
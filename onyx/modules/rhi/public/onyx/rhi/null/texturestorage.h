@@ -0,0 +1,24 @@
+#pragma once
+
+#include <onyx/rhi/texturestorage.h>
+
+namespace Onyx::Graphics::Null
+{
+    class NullTextureStorage : public TextureStorage
+    {
+    public:
+        NullTextureStorage(const TextureStorageProperties& properties);
+        ~NullTextureStorage() override = default;
+
+        void TransitionLayout(CommandBuffer& commandBuffer, Context context, Access access, ImageLayout newLayout) override;
+
+        onyxS8 Alias(const TextureStorageProperties& properties);
+        onyxU32 GetAliasCount() const { return static_cast<onyxU32>(m_Aliases.size()); }
+
+        ImageLayout GetLayout() const { return m_Layout; }
+
+    private:
+        DynamicArray<TextureStorageProperties> m_Aliases;
+        ImageLayout m_Layout = ImageLayout::None;
+    };
+}
@@ -29,9 +29,16 @@ namespace Onyx::Graphics
     class ShaderGenerator
     {
     public:
+        static constexpr StringId32 TypeId = "Onyx::Graphics::ShaderGenerator";
+        virtual StringId32 GetTypeId() const { return TypeId; }
+
         ShaderGenerator() = default;
         virtual ~ShaderGenerator() = default;
 
+        // copies only the generated state, used to restore a generator of the same type
+        ShaderGenerator(const ShaderGenerator& other) = default;
+        ShaderGenerator& operator=(const ShaderGenerator& other) = default;
+
         template <typename T>
         static String GenerateShaderValue(const T& value)
         {
@@ -150,6 +157,9 @@ namespace Onyx::Graphics
     class PBRShaderGenerator : public ShaderGenerator
     {
     public:
+        static constexpr StringId32 TypeId = "Onyx::Graphics::PBRShaderGenerator";
+        StringId32 GetTypeId() const override { return TypeId; }
+
         PBRShaderGenerator();
 
     protected:
@@ -1,6 +1,5 @@
 #pragma once
 
-#include <onyx/filesystem/filewatcher.h>
 #include <onyx/rhi/graphicstypes.h>
 #include <onyx/filesystem/path.h>
 
@@ -58,6 +57,8 @@ namespace Onyx::Graphics
         static constexpr StringView SHADER_CACHE_PATH = "tmp:/shaders/cache";
 
         ShaderCache(GraphicsSystem& graphicsSystem);
+        ~ShaderCache();
+
         bool GetOrLoadShader(const FilePath& shaderPath, Reference<Shader>& outShader);
         void Clear();
 
@@ -66,17 +67,20 @@ namespace Onyx::Graphics
         bool LoadCacheFromDisk(const FilePath& diskShaderCachePath, ShaderCacheEntry& outEntry);
         void SaveCacheToDisk(const ShaderCacheEntry& entry, const FilePath& diskShaderCachePath, const ShaderReflectionInfo& reflectionInfo);
 
-        void OnFileChanged(const FilePath& path, FileSystem::FileWatcher::FileAction action);
+        // rehashes changed includes, called by the asset hot reload before the dependent shaders get reloaded
+        void OnFilesChanged(const DynamicArray<FilePath>& changedFiles);
+        void AddIncludeDependencies(const ShaderCacheEntry& entry);
 
         bool IsEntryUpToDate(const ShaderCacheEntry& entry, onyxU64 shaderHash) const;
         bool AreIncludesUpToDate(const HashMap<onyxU64, onyxU64>& includeHashes) const;
+        onyxU64 GetIncludeHash(onyxU64 includePathHash) const;
 
     private:
         GraphicsSystem& m_GraphicsSystem;
         HashMap<onyxU64, ShaderCacheEntry> m_Cache;
         // stores a shader include path and the hashed content - used to identify if a shader has changed
+        // shaders are loaded on the loader threads while hot reload rehashes includes on the main thread
+        mutable std::mutex m_IncludesMutex;
         HashMap<onyxU64, ShaderIncludeCacheEntry> m_IncludesCache;
-
-        FileSystem::FileWatcher m_DirectoryWatcher;
     };
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <onyx/memory/objectpool.h>
 #include <onyx/rhi/textureproperties.h>
 #include <onyx/rhi/graphicstypes.h>
 
@@ -32,15 +33,16 @@ namespace Onyx::Graphics
 
 		const TextureStorage& GetStorage() const { ONYX_ASSERT(m_Storage != nullptr); return *m_Storage; }
 
-		onyxU32 GetIndex() const { return m_Index; }
+		onyxU32 GetIndex() const { return m_PoolHandle.Index; }
 
     private:
-		void SetIndex(onyxU32 index) { m_Index = index; }
+		const PoolHandle& GetPoolHandle() const { return m_PoolHandle; }
+		void SetPoolHandle(const PoolHandle& handle) { m_PoolHandle = handle; }
 
 		virtual void Release() = 0;
 
 	protected:
-		onyxU32 m_Index = onyxMax_U32; // index in memory pool and bindless texture index
+		PoolHandle m_PoolHandle; // handle in the texture pool, the index is the bindless texture index
 		TextureProperties m_Properties;
 		const TextureStorage* m_Storage; // non owning
 	};
@@ -66,7 +68,7 @@ namespace Onyx::Graphics
 				{
                     texture->Release();
                     // TODO: this should not be done and is only done to remove a validation error currently when resizing with the depth texture
-                    texture->SetIndex(onyxMax_U32);
+                    texture->SetPoolHandle({});
 				}
 			}
 		};
@@ -38,4 +38,14 @@ namespace Onyx::Graphics
 
 		String m_DebugName;
 	};
+
+	// memory the driver needs for a texture created with the given storage properties
+	struct TextureMemoryRequirements
+	{
+		onyxU64 Size = 0;
+		onyxU64 Alignment = 1;
+		// index of the memory type the texture gets allocated from
+		onyxU32 MemoryTypeIndex = 0;
+		bool IsOptimalTiling = true;
+	};
 }
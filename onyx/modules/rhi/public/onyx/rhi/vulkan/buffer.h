@@ -46,6 +46,8 @@ namespace Onyx::Graphics::Vulkan
 
         void Barrier(CommandBuffer& commandBuffer, Context newContext, Access newAccess) override;
         void Barrier(CommandBuffer& commandBuffer, Context newContext, Access newAccess, onyxS8 aliasIndex) override;
+        // creates the barrier and updates the tracked state, used to batch multiple barriers
+        VkBufferMemoryBarrier2 CreateBarrier(Context newContext, Access newAccess, onyxS8 aliasIndex);
         onyxS8 Alias(const BufferProperties& properties) override;
 
     private:
@@ -40,6 +40,7 @@ namespace Onyx::Graphics::Vulkan
 
         void Barrier(BufferHandle& buffer, Context newContext, Access newAccess) override;
         void TransitionLayout(TextureHandle& texture, Context newContext, Access newAccess, ImageLayout newLayout) override;
+        void Barriers(Span<TextureBarrier> textureBarriers, Span<BufferBarrier> bufferBarriers) override;
 
         void SetViewport() override;
         void SetViewport(const Viewport& viewport) override;
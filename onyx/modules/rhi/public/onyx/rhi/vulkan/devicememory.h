@@ -29,7 +29,7 @@ namespace Onyx::Graphics
             void Unmap();
 
         protected:
-            void GetMemoryPropertyFlags(const CPUAccess& cpuAccess, const GPUAccess& gpuAccess, VkMemoryPropertyFlags& outRequired, VkMemoryPropertyFlags& outPreferred);
+            static void GetMemoryPropertyFlags(const CPUAccess& cpuAccess, const GPUAccess& gpuAccess, VkMemoryPropertyFlags& outRequired, VkMemoryPropertyFlags& outPreferred);
             void GetMemoryRange(VkMappedMemoryRange& aRange) const;
 
         protected:
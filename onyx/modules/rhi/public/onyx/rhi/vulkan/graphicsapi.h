@@ -1,7 +1,7 @@
 #pragma once
 
+#include <onyx/memory/objectpool.h>
 #include <onyx/rhi/graphicsapiinterface.h>
-#include <onyx/rhi/graphicsresourcepool.h>
 #include <onyx/rhi/sampler.h>
 
 namespace Onyx::Graphics
@@ -99,6 +99,7 @@ namespace Onyx::Graphics
             void CreateTexture(TextureHandle& outTexture, const TextureStorageProperties& storageProperties, const TextureProperties& properties, const Span<onyxU8>& initialData) override;
             void CreateTextureView(TextureHandle& handle, const Reference<VulkanTextureStorage>& textureStorage, const TextureProperties& properties);
             void CreateAlias(TextureHandle& outTexture, TextureStorageHandle& storageHandle, const TextureStorageProperties& aliasStorageProperties, const TextureProperties& aliasTextureProperties) override;
+            TextureMemoryRequirements GetTextureMemoryRequirements(const TextureStorageProperties& storageProperties) const override;
             
             void CreateBuffer(BufferHandle& outBuffer, const BufferProperties& properties) override;
             BufferHandle GetTransientBuffer(onyxU8 frameIndex, const BufferProperties& properties) override;
@@ -148,14 +149,14 @@ namespace Onyx::Graphics
 
             struct TextureUpdate
             {
-                onyxU32 Index;
+                PoolHandle Handle;
                 VulkanTexture* Texture;
             };
 
             DynamicArray<TextureUpdate> m_BindlessTexturesToUpdate;
             DynamicArray<InplaceFunction<bool(), 48>> m_DeletionQueue;
 
-            GraphicsResourcePool<VulkanTexture, 1024> m_Textures;
+            StaticObjectPool<VulkanTexture, 1024> m_Textures;
         };
     }
 }
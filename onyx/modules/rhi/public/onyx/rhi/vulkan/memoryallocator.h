@@ -30,6 +30,8 @@ namespace Onyx::Graphics::Vulkan
         VmaAllocation AllocateDedicatedMemory(VkBuffer buffer, onyxU32 memoryTypeBits, VkMemoryPropertyFlags requiredFlags, VkMemoryPropertyFlags preferredFlags);
 		VmaAllocation AllocateDedicatedMemory(VkImage image, onyxU32 memoryTypeBits, VkMemoryPropertyFlags requiredFlags, VkMemoryPropertyFlags preferredFlags);
 		VmaAllocationInfo GetAllocationInfo(const VmaAllocation& allocation);
+		// memory type a dedicated allocation with the same flags would use
+		onyxU32 FindMemoryTypeIndex(onyxU32 memoryTypeBits, VkMemoryPropertyFlags requiredFlags, VkMemoryPropertyFlags preferredFlags) const;
 
 		VkImage Alias(VmaAllocation allocation, const VkImageCreateInfo& aliasInfo);
 		VkBuffer Alias(VmaAllocation allocation, const VkBufferCreateInfo& aliasInfo, onyxU64 offset);
@@ -35,14 +35,20 @@ namespace Onyx::Graphics::Vulkan
 
         onyxS8 Alias(const TextureStorageProperties& aliasProperties);
 
+        // queried from the create info without creating the image
+        static TextureMemoryRequirements GetMemoryRequirements(const VulkanGraphicsApi& api, const TextureStorageProperties& properties);
+
         bool HasAlias(onyxS8 aliasIndex) { return aliasIndex < m_Aliases.size(); }
         VkImage GetAliasHandle(onyxS8 aliasIndex) const { ONYX_ASSERT(aliasIndex < m_Aliases.size()); return m_Aliases[aliasIndex]; }
 
         void TransitionPresent(VulkanCommandBuffer& commandBuffer);
 
         void TransitionLayout(CommandBuffer& commandBuffer, Context newContext, Access newAccess, ImageLayout newLayout) override;
+        // creates the barrier for the transition and updates the tracked state, used to batch multiple barriers
+        VkImageMemoryBarrier2KHR CreateBarrier(Context newContext, Access newAccess, ImageLayout newLayout, onyxS8 aliasIndex, bool discardContents);
 
     private:
+        static VkImageCreateInfo GetCreateInfo(const TextureStorageProperties& properties);
         static VkImageType GetType(TextureType type);
         static VkImageUsageFlags GetUsageFlags(const TextureStorageProperties& properties);
         static bool IsOptimalTiling(const TextureStorageProperties& properties);
@@ -55,5 +61,6 @@ namespace Onyx::Graphics::Vulkan
 
         ImageLayout m_Layout = ImageLayout::None;
         Access m_Access = Access::None;
+        Context m_Context = Context::Graphics;
     };
 }
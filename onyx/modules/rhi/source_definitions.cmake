@@ -9,7 +9,6 @@ set(onyx_TARGET_PUBLIC_SOURCES
     framecontext.h
     graphicsapiinterface.h
     graphicsettings.h
-    graphicsresourcepool.h
     graphicshandles.h
     graphicstypes.h
     graphicssystem.h
@@ -36,6 +35,13 @@ set(onyx_TARGET_PUBLIC_SOURCES
     shader/shaderpass.h
     shader/shaderpreprocessor.h
     shader/generators/shadergenerator.h
+    null/buffer.h
+    null/commandbuffer.h
+    null/descriptorset.h
+    null/graphicsapi.h
+    null/shader.h
+    null/texture.h
+    null/texturestorage.h
     vulkan/buffer.h
     vulkan/commandbuffer.h
     vulkan/commandbuffermanager.h
@@ -84,6 +90,13 @@ set(onyx_TARGET_PRIVATE_SOURCES
     shader/shaderincluder.cpp
     shader/shaderpreprocessor.cpp
     shader/generators/shadergenerator.cpp
+    null/buffer.cpp
+    null/commandbuffer.cpp
+    null/descriptorset.cpp
+    null/graphicsapi.cpp
+    null/shader.cpp
+    null/texture.cpp
+    null/texturestorage.cpp
     vulkan/buffer.cpp
     vulkan/commandbuffer.cpp
     vulkan/commandbuffermanager.cpp
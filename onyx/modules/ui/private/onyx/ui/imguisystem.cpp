@@ -642,7 +642,7 @@ namespace Onyx::Ui
 		ImGuiIO& io = ImGui::GetIO();	
 
 		g_UiContext.GraphicsSystem = &system;
-		io.DeltaTime = std::max(numeric_cast<onyxF32>(deltaTime.DeltaMilliseconds) * 0.001f, 0.001f);
+		io.DeltaTime = std::max(deltaTime.GetSeconds(), 0.001f);
 
 		//// this is an index based loop on purpose as windows might be added during rendering by other windows
 		const onyxU32 windowsCount = numeric_cast<onyxU32>(m_Windows.size());
@@ -3,6 +3,7 @@
 #include <onyx/thread/async/asynctask.h>
 #include <onyx/thread/threadpool/threadpool.h>
 #include <onyx/volume/source/volumebase.h>
+#include <onyx/volume/source/volumesamplecache.h>
 #include <onyx/volume/dualmarchingcubes/dmcoctreesplitpolicy.h>
 #include <onyx/volume/cubicalmarchingsquares/cmsoctreesplitpolicy.h>
 #include <onyx/volume/isosurface/marchingcubessurface.h>
@@ -317,11 +318,12 @@ namespace Onyx::Volume
         VolumeChunk::VolumeChunkOctree volumeOctree;
         VolumeChunk::VolumeChunkDualgrid volumeDualgrid;
 
-        const VolumeBase& volumeBase = *m_LoadRequestData.m_VolumeSource;
+        // split policy, dualgrid and surface extraction sample the same corners, so they all share the cache
+        const VolumeSampleCache volumeBase(*m_LoadRequestData.m_VolumeSource, m_LoadRequestData.m_Position, m_LoadRequestData.m_Size, m_LoadRequestData.m_MaxOctreeLevel);
 
         if (m_LoadRequestData.m_IsoSurfaceMethod == IsoSurfaceMethod::CMS)
         {
-            GenerateOctree(volumeOctree);
+            GenerateOctree(volumeOctree, volumeBase);
 
             Volume::CubicalMarchingSquares::MarchingSquares cubicalMarchingSquares(1.0f);
 
@@ -333,12 +335,12 @@ namespace Onyx::Volume
         }
         else
         {
-            GenerateOctree(volumeOctree);
+            GenerateOctree(volumeOctree, volumeBase);
 
-            MarchingCubesSurface<onyxF32> marchingCubesSurface(m_LoadRequestData.m_VolumeSource);
+            MarchingCubesSurface<onyxF32> marchingCubesSurface(&volumeBase);
             marchingCubesSurface.SetMeshBuilder(m_LoadRequestData.m_MeshBuilder);
 
-            MarchingSquaresSurface<onyxF32> marchingSquaresSurface(m_LoadRequestData.m_VolumeSource, m_LoadRequestData.m_MeshBuilder, m_LoadRequestData.m_MaxDistanceSkirts);
+            MarchingSquaresSurface<onyxF32> marchingSquaresSurface(&volumeBase, m_LoadRequestData.m_MeshBuilder, m_LoadRequestData.m_MaxDistanceSkirts);
 
             VolumeChunk::VolumeChunkDualgrid& dualgrid = volumeDualgrid;
             dualgrid.GetDualCells().clear();
@@ -349,14 +351,18 @@ namespace Onyx::Volume
             dualgrid.GenerateDualgrid(volumeOctree.GetRootNode(), m_LoadRequestData.m_Position, volumeBase);
             
         }
+
+        const VolumeSampleCache::Statistics& cacheStatistics = volumeBase.GetStatistics();
+        m_LoadRequestData.m_SampleCacheStatistics = cacheStatistics;
+        ONYX_LOG_DEBUG("Volume chunk sample cache: {} hits, {} misses, {} uncached ({:.1f}% hit rate)", cacheStatistics.Hits, cacheStatistics.Misses, cacheStatistics.Uncached, cacheStatistics.GetHitRate() * 100.0f);
     }
 
-    void VolumeChunkLoadRequest::GenerateOctree(VolumeChunk::VolumeChunkOctree& octree)
+    void VolumeChunkLoadRequest::GenerateOctree(VolumeChunk::VolumeChunkOctree& octree, const VolumeBase& volumeBase)
     {
         UniquePtr<OctreeSplitPolicy<onyxF32>> splitPolicy = nullptr;
         if (m_LoadRequestData.m_IsoSurfaceMethod == IsoSurfaceMethod::DMC)
         {
-            auto policy = MakeUnique<DMCOctreeSplitPolicy<onyxF32>>(m_LoadRequestData.m_MaxOctreeLevel, m_LoadRequestData.m_Size, m_LoadRequestData.m_MaxGeometricError, m_LoadRequestData.m_SampleResolution, m_LoadRequestData.m_ComplexSurfaceThreshold, *m_LoadRequestData.m_VolumeSource);
+            auto policy = MakeUnique<DMCOctreeSplitPolicy<onyxF32>>(m_LoadRequestData.m_MaxOctreeLevel, m_LoadRequestData.m_Size, m_LoadRequestData.m_MaxGeometricError, m_LoadRequestData.m_SampleResolution, m_LoadRequestData.m_ComplexSurfaceThreshold, volumeBase);
             policy->SetUseTriPlanarError(true);
             policy->SetUseEdgeAmbiguity(false);
 
@@ -364,7 +370,7 @@ namespace Onyx::Volume
         }
         else if (m_LoadRequestData.m_IsoSurfaceMethod == IsoSurfaceMethod::DMC_WITH_CMS_ERROR_METRIC)
         {
-            auto policy = MakeUnique<DMCOctreeSplitPolicy<onyxF32>>(m_LoadRequestData.m_MaxOctreeLevel, m_LoadRequestData.m_Size, m_LoadRequestData.m_MaxGeometricError, m_LoadRequestData.m_SampleResolution, m_LoadRequestData.m_ComplexSurfaceThreshold, *m_LoadRequestData.m_VolumeSource);
+            auto policy = MakeUnique<DMCOctreeSplitPolicy<onyxF32>>(m_LoadRequestData.m_MaxOctreeLevel, m_LoadRequestData.m_Size, m_LoadRequestData.m_MaxGeometricError, m_LoadRequestData.m_SampleResolution, m_LoadRequestData.m_ComplexSurfaceThreshold, volumeBase);
             policy->SetUseTriPlanarError(false);
             policy->SetUseEdgeAmbiguity(true);
 
@@ -372,7 +378,7 @@ namespace Onyx::Volume
         }
         else if (m_LoadRequestData.m_IsoSurfaceMethod == IsoSurfaceMethod::CMS)
         {
-            splitPolicy = MakeUnique<CMSOctreeSplitPolicy<onyxF32>>(m_LoadRequestData.m_MaxOctreeLevel, m_LoadRequestData.m_Size, m_LoadRequestData.m_SampleResolution, m_LoadRequestData.m_ComplexSurfaceThreshold, *m_LoadRequestData.m_VolumeSource);
+            splitPolicy = MakeUnique<CMSOctreeSplitPolicy<onyxF32>>(m_LoadRequestData.m_MaxOctreeLevel, m_LoadRequestData.m_Size, m_LoadRequestData.m_SampleResolution, m_LoadRequestData.m_ComplexSurfaceThreshold, volumeBase);
         }
 
 
@@ -400,8 +406,6 @@ namespace Onyx::Volume
             nodeData->HalfExtent = cellSize / 2.0f;
             nodeData->MetaData = GetNodeMetaData(nodeData->Position, nodeData->HalfExtent);
 
-            const VolumeBase& volumeBase = *m_LoadRequestData.m_VolumeSource;
-
             if (splitPolicy->ShouldSplit(node, nodeWorldPosition, nodeData->HalfExtent, depth))
             {
                 node.Subdivide();
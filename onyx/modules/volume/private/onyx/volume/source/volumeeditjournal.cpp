@@ -0,0 +1,534 @@
+#include <onyx/volume/source/volumeeditjournal.h>
+
+#include <onyx/serialize/deserializer.h>
+#include <onyx/serialize/serializer.h>
+
+#include <algorithm>
+#include <bit>
+#include <iterator>
+#include <numeric>
+
+namespace Onyx::Volume
+{
+    namespace
+    {
+        // cell coordinates are packed into 21 bits per axis
+        constexpr onyxS32 CELL_COORDINATE_LIMIT = (1 << 20) - 1;
+
+        // matches GetVolumeSourcesCellHash in includes/volume/volumesources.h
+        onyxU32 GetGpuCellHash(const Vector3s32& cell)
+        {
+            return (static_cast<onyxU32>(cell[0]) * 73856093u) ^ (static_cast<onyxU32>(cell[1]) * 19349663u) ^ (static_cast<onyxU32>(cell[2]) * 83492791u);
+        }
+
+        Vector4f32 Negate(const Vector4f32& value)
+        {
+            return Vector4f32(-value[0], -value[1], -value[2], -value[3]);
+        }
+
+        onyxF32 GetDistanceToCube(const Vector3f32& position, const Vector3f32& center, const Vector3f32& halfExtents)
+        {
+            onyxF32 distance = std::numeric_limits<onyxF32>::lowest();
+            for (onyxU32 axis = 0; axis < 3; ++axis)
+                distance = std::max(distance, std::abs(position[axis] - center[axis]) - halfExtents[axis]);
+
+            return distance;
+        }
+
+        // the evaluation below mirrors includes/volume/csg/*.h, the distance is negative inside
+        Vector4f32 GetSphereValueAndGradient(const Vector3f32& position, const Vector3f32& center, onyxF32 radius)
+        {
+            constexpr onyxF32 epsilon = 0.00001f;
+            const Vector3f32 difference = position - center;
+            const onyxF32 distance = difference.Length();
+            const Vector3f32 gradient = difference * (1.0f / (distance + epsilon));
+            return Vector4f32(gradient, distance - radius);
+        }
+
+        Vector4f32 GetCubeValueAndGradient(const Vector3f32& position, const Vector3f32& center, const Vector3f32& halfExtents)
+        {
+            constexpr onyxF32 difference = 0.0001f;
+
+            Vector4f32 result(0.0f, 0.0f, 0.0f, GetDistanceToCube(position, center, halfExtents));
+            for (onyxU32 axis = 0; axis < 3; ++axis)
+            {
+                Vector3f32 offset = Vector3f32::Zero();
+                offset[axis] = difference;
+                result[axis] = GetDistanceToCube(position + offset, center, halfExtents) - GetDistanceToCube(position - offset, center, halfExtents);
+            }
+
+            return result;
+        }
+
+        Vector4f32 GetEllipsoidValueAndGradient(const Vector3f32& position, const Vector3f32& center, const Vector3f32& radii)
+        {
+            const Vector3f32 difference = position - center;
+            const Vector3f32 scaled(difference[0] / radii[0], difference[1] / radii[1], difference[2] / radii[2]);
+            const Vector3f32 gradient(scaled[0] / radii[0], scaled[1] / radii[1], scaled[2] / radii[2]);
+
+            const onyxF32 k0 = scaled.Length();
+            const onyxF32 k1 = gradient.Length();
+            return Vector4f32(gradient * (1.0f / k1), k0 * (k0 - 1.0f) / k1);
+        }
+
+        Vector4f32 GetUnionSmooth(const Vector4f32& lhs, const Vector4f32& rhs, onyxF32 smoothness)
+        {
+            smoothness *= 4.0f;
+            const onyxF32 h = std::max(smoothness - std::abs(lhs[3] - rhs[3]), 0.0f) / (2.0f * smoothness);
+            const onyxF32 blend = (lhs[3] < rhs[3]) ? h : 1.0f - h;
+
+            Vector4f32 result;
+            for (onyxU32 axis = 0; axis < 3; ++axis)
+                result[axis] = lhs[axis] + (rhs[axis] - lhs[axis]) * blend;
+
+            result[3] = std::min(lhs[3], rhs[3]) - h * h * smoothness;
+            return result;
+        }
+
+        // smoothness < 0 for hard edges
+        bool GetValueAndGradient(const VolumeEdit& edit, const Vector3f32& position, Vector4f32& outValue, onyxF32& outSmoothness)
+        {
+            const Array<onyxF32, VOLUME_EDIT_DATA_SIZE>& data = edit.Data;
+            const Vector3f32 center(data[0], data[1], data[2]);
+
+            outSmoothness = -1.0f;
+            switch (edit.Type)
+            {
+                case VolumeEditType::Sphere:
+                    outValue = GetSphereValueAndGradient(position, center, data[3]);
+                    return true;
+                case VolumeEditType::Cube:
+                    outValue = GetCubeValueAndGradient(position, center, Vector3f32(data[3], data[4], data[5]));
+                    return true;
+                case VolumeEditType::Ellipsoid:
+                    outValue = GetEllipsoidValueAndGradient(position, center, Vector3f32(data[3], data[4], data[5]));
+                    return true;
+                case VolumeEditType::SphereBrush:
+                    outValue = GetSphereValueAndGradient(position, center, data[3]);
+                    outSmoothness = data[5];
+                    return true;
+                case VolumeEditType::CubeBrush:
+                    outValue = GetCubeValueAndGradient(position, center, Vector3f32(data[3], data[4], data[5]));
+                    outSmoothness = data[7];
+                    return true;
+                case VolumeEditType::Plane:
+                case VolumeEditType::Grid:
+                    // not evaluated on the GPU either
+                    return false;
+            }
+
+            return false;
+        }
+
+        // true if the box lies strictly inside the shape of the edit
+        bool ContainsBox(const VolumeEdit& edit, const Vector3f32& min, const Vector3f32& max)
+        {
+            const Array<onyxF32, VOLUME_EDIT_DATA_SIZE>& data = edit.Data;
+            const Vector3f32 center(data[0], data[1], data[2]);
+
+            switch (edit.Type)
+            {
+                case VolumeEditType::Sphere:
+                case VolumeEditType::SphereBrush:
+                {
+                    // farthest corner of the box
+                    Vector3f32 farthest;
+                    for (onyxU32 axis = 0; axis < 3; ++axis)
+                        farthest[axis] = std::max(std::abs(min[axis] - center[axis]), std::abs(max[axis] - center[axis]));
+
+                    return farthest.LengthSquared() < (data[3] * data[3]);
+                }
+                case VolumeEditType::Cube:
+                case VolumeEditType::CubeBrush:
+                {
+                    for (onyxU32 axis = 0; axis < 3; ++axis)
+                    {
+                        if ((min[axis] <= (center[axis] - data[3 + axis])) || (max[axis] >= (center[axis] + data[3 + axis])))
+                            return false;
+                    }
+
+                    return true;
+                }
+                default:
+                    return false;
+            }
+        }
+    }
+
+    VolumeEdit VolumeEdit::CreateSphere(VolumeEditOperation operation, const Vector3f32& center, onyxF32 radius)
+    {
+        VolumeEdit edit;
+        edit.Type = VolumeEditType::Sphere;
+        edit.Operation = operation;
+        edit.Data = { center[0], center[1], center[2], radius };
+        return edit;
+    }
+
+    VolumeEdit VolumeEdit::CreateCube(VolumeEditOperation operation, const Vector3f32& center, const Vector3f32& halfExtents)
+    {
+        VolumeEdit edit;
+        edit.Type = VolumeEditType::Cube;
+        edit.Operation = operation;
+        edit.Data = { center[0], center[1], center[2], halfExtents[0], halfExtents[1], halfExtents[2] };
+        return edit;
+    }
+
+    VolumeEdit VolumeEdit::CreateEllipsoid(VolumeEditOperation operation, const Vector3f32& center, const Vector3f32& radii)
+    {
+        VolumeEdit edit;
+        edit.Type = VolumeEditType::Ellipsoid;
+        edit.Operation = operation;
+        edit.Data = { center[0], center[1], center[2], radii[0], radii[1], radii[2] };
+        return edit;
+    }
+
+    VolumeEdit VolumeEdit::CreateSphereBrush(VolumeEditOperation operation, const Vector3f32& center, onyxF32 radius, onyxF32 smoothness)
+    {
+        // same layout as createvolumebrush.oshader, the strength is unused for now
+        VolumeEdit edit;
+        edit.Type = VolumeEditType::SphereBrush;
+        edit.Operation = operation;
+        edit.Data = { center[0], center[1], center[2], radius, 0.0f, smoothness };
+        return edit;
+    }
+
+    bool VolumeEdit::GetBounds(Vector3f32& outMin, Vector3f32& outMax) const
+    {
+        // intersections remove everything outside of the shape
+        if (Operation == VolumeEditOperation::Intersect)
+            return false;
+
+        const Vector3f32 center(Data[0], Data[1], Data[2]);
+        Vector3f32 extents;
+        onyxF32 smoothness = -1.0f;
+        switch (Type)
+        {
+            case VolumeEditType::Sphere:
+                extents = Vector3f32(Data[3]);
+                break;
+            case VolumeEditType::Cube:
+            case VolumeEditType::Ellipsoid:
+                extents = Vector3f32(Data[3], Data[4], Data[5]);
+                break;
+            case VolumeEditType::SphereBrush:
+                extents = Vector3f32(Data[3]);
+                smoothness = Data[5];
+                break;
+            case VolumeEditType::CubeBrush:
+                extents = Vector3f32(Data[3], Data[4], Data[5]);
+                smoothness = Data[7];
+                break;
+            case VolumeEditType::Plane:
+            case VolumeEditType::Grid:
+                return false;
+        }
+
+        // a smooth union lowers the distance by at most the blend distance (4 * smoothness) / 4,
+        // so the surface can only move where the edit is closer than twice the blend distance
+        if (smoothness > 0.0f)
+            extents += Vector3f32(8.0f * smoothness);
+
+        outMin = center - extents;
+        outMax = center + extents;
+        return true;
+    }
+
+    VolumeEditJournal::VolumeEditJournal(onyxF32 cellSize)
+        : m_CellSize(cellSize)
+        , m_InverseCellSize(1.0f / cellSize)
+    {
+        ONYX_ASSERT(cellSize > 0.0f, "Cell size has to be positive.");
+    }
+
+    onyxU32 VolumeEditJournal::Add(const VolumeEdit& edit)
+    {
+        const onyxU32 index = static_cast<onyxU32>(m_Edits.size());
+        m_Edits.push_back(edit);
+        AddToIndex(index);
+
+        ++m_Version;
+        ++m_EditsSinceCollapse;
+        return index;
+    }
+
+    void VolumeEditJournal::Clear()
+    {
+        m_Edits.clear();
+        m_Cells.clear();
+        m_UnboundedEdits.clear();
+
+        ++m_Version;
+        m_EditsSinceCollapse = 0;
+    }
+
+    void VolumeEditJournal::Query(const Vector3f32& min, const Vector3f32& max, DynamicArray<onyxU32>& outEditIndices) const
+    {
+        outEditIndices.clear();
+
+        Vector3s32 minCell;
+        Vector3s32 maxCell;
+        if (GetCellRange(min, max, minCell, maxCell) == false)
+        {
+            // larger than the grid covers, every edit can overlap
+            outEditIndices.resize(m_Edits.size());
+            std::iota(outEditIndices.begin(), outEditIndices.end(), 0);
+            return;
+        }
+
+        outEditIndices.insert(outEditIndices.end(), m_UnboundedEdits.begin(), m_UnboundedEdits.end());
+        for (onyxS32 z = minCell[2]; z <= maxCell[2]; ++z)
+        {
+            for (onyxS32 y = minCell[1]; y <= maxCell[1]; ++y)
+            {
+                for (onyxS32 x = minCell[0]; x <= maxCell[0]; ++x)
+                {
+                    auto it = m_Cells.find(GetCellKey(x, y, z));
+                    if (it != m_Cells.end())
+                        outEditIndices.insert(outEditIndices.end(), it->second.begin(), it->second.end());
+                }
+            }
+        }
+
+        // edits that span multiple cells show up once per cell
+        std::sort(outEditIndices.begin(), outEditIndices.end());
+        outEditIndices.erase(std::unique(outEditIndices.begin(), outEditIndices.end()), outEditIndices.end());
+    }
+
+    Vector4f32 VolumeEditJournal::Apply(const Vector3f32& position, const Vector4f32& baseSample) const
+    {
+        DynamicArray<onyxU32> editIndices;
+        Query(position, position, editIndices);
+
+        Vector4f32 sample = baseSample;
+        for (onyxU32 editIndex : editIndices)
+        {
+            const VolumeEdit& edit = m_Edits[editIndex];
+
+            Vector3f32 min;
+            Vector3f32 max;
+            if (edit.GetBounds(min, max))
+            {
+                // the cell overlaps the bounds, the position does not have to
+                if ((position[0] < min[0]) || (position[1] < min[1]) || (position[2] < min[2]) ||
+                    (position[0] > max[0]) || (position[1] > max[1]) || (position[2] > max[2]))
+                    continue;
+            }
+
+            Vector4f32 editSample;
+            onyxF32 smoothness;
+            if (GetValueAndGradient(edit, position, editSample, smoothness) == false)
+                continue;
+
+            switch (edit.Operation)
+            {
+                case VolumeEditOperation::Union:
+                    if (smoothness < 0.0f)
+                        sample = (editSample[3] < sample[3]) ? editSample : sample;
+                    else
+                        sample = GetUnionSmooth(editSample, sample, smoothness);
+                    break;
+                case VolumeEditOperation::Difference:
+                    if (smoothness < 0.0f)
+                        sample = (-editSample[3] > sample[3]) ? Negate(editSample) : sample;
+                    else
+                        sample = Negate(GetUnionSmooth(editSample, Negate(sample), smoothness));
+                    break;
+                case VolumeEditOperation::Intersect:
+                    sample = (editSample[3] > sample[3]) ? editSample : sample;
+                    break;
+            }
+        }
+
+        return sample;
+    }
+
+    void VolumeEditJournal::WriteGpuGrid(DynamicArray<onyxU32>& outGrid) const
+    {
+        // open addressing with at most half of the slots used, so every probe ends at an empty slot
+        const onyxU32 tableSize = std::bit_ceil(std::max<onyxU32>(2 * static_cast<onyxU32>(m_Cells.size()), 1));
+        const onyxU32 tableMask = tableSize - 1;
+
+        outGrid.assign(VOLUME_EDIT_GRID_HEADER_SIZE + tableSize * VOLUME_EDIT_GRID_CELL_SIZE, 0);
+        outGrid[0] = std::bit_cast<onyxU32>(m_InverseCellSize);
+        outGrid[1] = tableMask;
+
+        // cells without an entry are only changed by the unbounded edits
+        outGrid[2] = static_cast<onyxU32>(outGrid.size());
+        outGrid[3] = static_cast<onyxU32>(m_UnboundedEdits.size());
+        outGrid.insert(outGrid.end(), m_UnboundedEdits.begin(), m_UnboundedEdits.end());
+
+        for (auto&& [cellKey, cellEdits] : m_Cells)
+        {
+            if (cellEdits.empty())
+                continue;
+
+            const Vector3s32 cell = GetCellCoordinates(cellKey);
+
+            onyxU32 slot = GetGpuCellHash(cell) & tableMask;
+            while (outGrid[VOLUME_EDIT_GRID_HEADER_SIZE + slot * VOLUME_EDIT_GRID_CELL_SIZE + 4] != 0)
+                slot = (slot + 1) & tableMask;
+
+            const onyxU32 start = static_cast<onyxU32>(outGrid.size());
+            std::merge(cellEdits.begin(), cellEdits.end(), m_UnboundedEdits.begin(), m_UnboundedEdits.end(), std::back_inserter(outGrid));
+
+            const onyxU32 cellOffset = VOLUME_EDIT_GRID_HEADER_SIZE + slot * VOLUME_EDIT_GRID_CELL_SIZE;
+            outGrid[cellOffset] = static_cast<onyxU32>(cell[0]);
+            outGrid[cellOffset + 1] = static_cast<onyxU32>(cell[1]);
+            outGrid[cellOffset + 2] = static_cast<onyxU32>(cell[2]);
+            outGrid[cellOffset + 3] = start;
+            outGrid[cellOffset + 4] = static_cast<onyxU32>(outGrid.size()) - start;
+        }
+    }
+
+    onyxU32 VolumeEditJournal::Collapse()
+    {
+        m_EditsSinceCollapse = 0;
+
+        // inside a later union the surface is solid and inside a later difference it is empty, whatever came before
+        const onyxU32 editCount = GetEditCount();
+        DynamicArray<bool> isOverwritten(editCount, false);
+        DynamicArray<onyxU32> candidates;
+        for (onyxU32 i = 0; i < editCount; ++i)
+        {
+            Vector3f32 min;
+            Vector3f32 max;
+            if (m_Edits[i].GetBounds(min, max) == false)
+                continue;
+
+            Query(min, max, candidates);
+            for (auto it = std::upper_bound(candidates.begin(), candidates.end(), i); it != candidates.end(); ++it)
+            {
+                const VolumeEdit& laterEdit = m_Edits[*it];
+                if ((laterEdit.Operation != VolumeEditOperation::Intersect) && ContainsBox(laterEdit, min, max))
+                {
+                    isOverwritten[i] = true;
+                    break;
+                }
+            }
+        }
+
+        const onyxU32 removedCount = static_cast<onyxU32>(std::count(isOverwritten.begin(), isOverwritten.end(), true));
+        if (removedCount == 0)
+            return 0;
+
+        onyxU32 writeIndex = 0;
+        for (onyxU32 i = 0; i < editCount; ++i)
+        {
+            if (isOverwritten[i] == false)
+                m_Edits[writeIndex++] = m_Edits[i];
+        }
+
+        m_Edits.resize(writeIndex);
+        RebuildIndex();
+
+        ++m_Version;
+        return removedCount;
+    }
+
+    onyxU64 VolumeEditJournal::GetCellKey(onyxS32 x, onyxS32 y, onyxS32 z) const
+    {
+        constexpr onyxU64 mask = (1 << 21) - 1;
+        return (static_cast<onyxU64>(x) & mask) | ((static_cast<onyxU64>(y) & mask) << 21) | ((static_cast<onyxU64>(z) & mask) << 42);
+    }
+
+    Vector3s32 VolumeEditJournal::GetCellCoordinates(onyxU64 cellKey) const
+    {
+        // sign extends the 21 bit coordinates
+        constexpr onyxU64 mask = (1 << 21) - 1;
+        Vector3s32 cell;
+        for (onyxU32 axis = 0; axis < 3; ++axis)
+            cell[axis] = static_cast<onyxS32>(static_cast<onyxU32>((cellKey >> (21 * axis)) & mask) << 11) >> 11;
+
+        return cell;
+    }
+
+    bool VolumeEditJournal::GetCellRange(const Vector3f32& min, const Vector3f32& max, Vector3s32& outMinCell, Vector3s32& outMaxCell) const
+    {
+        onyxU64 cellCount = 1;
+        for (onyxU32 axis = 0; axis < 3; ++axis)
+        {
+            const onyxF32 minCell = std::floor(min[axis] * m_InverseCellSize);
+            const onyxF32 maxCell = std::floor(max[axis] * m_InverseCellSize);
+            if ((minCell < -CELL_COORDINATE_LIMIT) || (maxCell > CELL_COORDINATE_LIMIT))
+                return false;
+
+            outMinCell[axis] = static_cast<onyxS32>(minCell);
+            outMaxCell[axis] = static_cast<onyxS32>(maxCell);
+            cellCount *= static_cast<onyxU64>(outMaxCell[axis] - outMinCell[axis] + 1);
+        }
+
+        return cellCount <= MAX_CELLS_PER_EDIT;
+    }
+
+    void VolumeEditJournal::AddToIndex(onyxU32 editIndex)
+    {
+        Vector3f32 min;
+        Vector3f32 max;
+        Vector3s32 minCell;
+        Vector3s32 maxCell;
+        if ((m_Edits[editIndex].GetBounds(min, max) == false) || (GetCellRange(min, max, minCell, maxCell) == false))
+        {
+            m_UnboundedEdits.push_back(editIndex);
+            return;
+        }
+
+        // edits are added in journal order, so every cell stays sorted
+        for (onyxS32 z = minCell[2]; z <= maxCell[2]; ++z)
+        {
+            for (onyxS32 y = minCell[1]; y <= maxCell[1]; ++y)
+            {
+                for (onyxS32 x = minCell[0]; x <= maxCell[0]; ++x)
+                    m_Cells[GetCellKey(x, y, z)].push_back(editIndex);
+            }
+        }
+    }
+
+    void VolumeEditJournal::RebuildIndex()
+    {
+        m_Cells.clear();
+        m_UnboundedEdits.clear();
+        for (onyxU32 i = 0; i < GetEditCount(); ++i)
+            AddToIndex(i);
+    }
+}
+
+namespace Onyx
+{
+    bool Serialization<Volume::VolumeEdit>::Serialize(Serializer& serializer, const Volume::VolumeEdit& edit)
+    {
+        const DynamicArray<onyxF32> data(edit.Data.begin(), edit.Data.end());
+        return serializer.Write<"type">(edit.Type) &&
+            serializer.Write<"operation">(edit.Operation) &&
+            serializer.Write<"data">(data);
+    }
+
+    bool Serialization<Volume::VolumeEdit>::Deserialize(const Deserializer& deserializer, Volume::VolumeEdit& outEdit)
+    {
+        DynamicArray<onyxF32> data;
+        const bool success = deserializer.Read<"type">(outEdit.Type) &&
+            deserializer.Read<"operation">(outEdit.Operation) &&
+            deserializer.Read<"data">(data);
+
+        if (success == false)
+            return false;
+
+        outEdit.Data = {};
+        std::copy_n(data.begin(), std::min<onyxU64>(data.size(), Volume::VOLUME_EDIT_DATA_SIZE), outEdit.Data.begin());
+        return true;
+    }
+
+    bool Serialization<Volume::VolumeEditJournal>::Serialize(Serializer& serializer, const Volume::VolumeEditJournal& journal)
+    {
+        return serializer.Write<"edits">(journal.m_Edits);
+    }
+
+    bool Serialization<Volume::VolumeEditJournal>::Deserialize(const Deserializer& deserializer, Volume::VolumeEditJournal& outJournal)
+    {
+        outJournal.Clear();
+        if (deserializer.Read<"edits">(outJournal.m_Edits) == false)
+            return false;
+
+        outJournal.RebuildIndex();
+        return true;
+    }
+}
@@ -0,0 +1,96 @@
+#include <onyx/volume/source/volumesamplecache.h>
+
+#include <onyx/morton.h>
+
+namespace Onyx::Volume
+{
+    namespace
+    {
+        // coordinates of 64 bit morton codes have 21 bits and the lattice includes both chunk borders
+        constexpr onyxU8 MAX_LATTICE_LEVEL = 20;
+        // in lattice units, sample positions are built from node half extents so they only differ by rounding errors
+        constexpr onyxF32 LATTICE_TOLERANCE = 1e-3f;
+    }
+
+    onyxF32 VolumeSampleCache::Statistics::GetHitRate() const
+    {
+        const onyxU64 sampleCount = Hits + Misses + Uncached;
+        if (sampleCount == 0)
+            return 0.0f;
+
+        return static_cast<onyxF32>(Hits) / static_cast<onyxF32>(sampleCount);
+    }
+
+    VolumeSampleCache::VolumeSampleCache(const VolumeBase& source, const Vector3f32& chunkCenter, onyxF32 chunkSize, onyxU8 maxOctreeLevel)
+        : m_Source(&source)
+        , m_LatticeOrigin(chunkCenter - Vector3f32(chunkSize * 0.5f))
+    {
+        ONYX_ASSERT(chunkSize > 0.0f, "Chunk size has to be positive");
+
+        // the smallest nodes are one level below the max octree level and the split policies sample at their half extent
+        const onyxU32 latticeLevel = std::min<onyxU32>(maxOctreeLevel + 2u, MAX_LATTICE_LEVEL);
+        m_LatticeResolution = 1u << latticeLevel;
+        m_InverseLatticeSpacing = static_cast<onyxF32>(m_LatticeResolution) / chunkSize;
+    }
+
+    Vector4f32 VolumeSampleCache::GetValueAndGradient(const Vector3f32& position) const
+    {
+        onyxU64 key = 0;
+        if (GetKey(position, key) == false)
+        {
+            ++m_Statistics.Uncached;
+            return m_Source->GetValueAndGradient(position);
+        }
+
+        auto sampleIt = m_Samples.find(key);
+        if ((sampleIt != m_Samples.end()) && sampleIt->second.HasGradient)
+        {
+            ++m_Statistics.Hits;
+            return sampleIt->second.ValueAndGradient;
+        }
+
+        ++m_Statistics.Misses;
+        const Vector4f32 valueAndGradient = m_Source->GetValueAndGradient(position);
+        m_Samples.insert_or_assign(key, Sample{ valueAndGradient, true });
+        return valueAndGradient;
+    }
+
+    onyxF32 VolumeSampleCache::GetValue(const Vector3f32& position) const
+    {
+        onyxU64 key = 0;
+        if (GetKey(position, key) == false)
+        {
+            ++m_Statistics.Uncached;
+            return m_Source->GetValue(position);
+        }
+
+        auto sampleIt = m_Samples.find(key);
+        if (sampleIt != m_Samples.end())
+        {
+            ++m_Statistics.Hits;
+            return sampleIt->second.ValueAndGradient[3];
+        }
+
+        ++m_Statistics.Misses;
+        const onyxF32 value = m_Source->GetValue(position);
+        m_Samples.emplace(key, Sample{ Vector4f32(0.0f, 0.0f, 0.0f, value), false });
+        return value;
+    }
+
+    bool VolumeSampleCache::GetKey(const Vector3f32& position, onyxU64& outKey) const
+    {
+        onyxU32 coordinates[3];
+        for (onyxU8 i = 0; i < 3; ++i)
+        {
+            const onyxF32 latticePosition = (position[i] - m_LatticeOrigin[i]) * m_InverseLatticeSpacing;
+            const onyxF32 latticeCoordinate = std::round(latticePosition);
+            if ((latticeCoordinate < 0.0f) || (latticeCoordinate > static_cast<onyxF32>(m_LatticeResolution)) || (std::abs(latticePosition - latticeCoordinate) > LATTICE_TOLERANCE))
+                return false;
+
+            coordinates[i] = static_cast<onyxU32>(latticeCoordinate);
+        }
+
+        outKey = MortonCode3D_U64::Encode(coordinates[0], coordinates[1], coordinates[2]);
+        return true;
+    }
+}
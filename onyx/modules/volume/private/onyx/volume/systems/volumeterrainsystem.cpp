@@ -6,12 +6,16 @@
 #include <onyx/gamecore/gamecore.h>
 #include <onyx/gamecore/components/freecameracomponent.gen.h>
 #include <onyx/gamecore/components/transformcomponent.gen.h>
+#include <onyx/gamecore/scene/transformhierarchy.h>
 #include <onyx/rhi/commandbuffer.h>
 #include <onyx/rhi/graphicssystem.h>
 #include <onyx/volume/components/volumeterraincomponent.gen.h>
 #include <onyx/volume/shadergraph/volumeshadergraph.h>
+#include <onyx/volume/source/volumeeditjournal.h>
 #include <onyx/volume/terrain/worldsparseoctreenode.h>
 
+#include <bit>
+
 namespace Onyx::Volume::Terrain
 {
     namespace
@@ -26,9 +30,175 @@ namespace Onyx::Volume::Terrain
         Graphics::BufferHandle IsoSurfaceRequestsBuffer;
 
         Graphics::BufferHandle TransientVertexBuffer;
+
+        // sources the editor tools can append on the GPU before their edits got recorded in the journal
+        constexpr onyxU32 PENDING_SOURCES_CAPACITY = 32;
+        constexpr onyxU32 MIN_SOURCES_CAPACITY = 128;
+
+        // matches WorldVolumeSourcesList in includes/volume/volumesources.h
+        struct VolumeSourcesListHeader
+        {
+            onyxU32 Count;
+            // sources appended on the GPU after the indexed ones are not in the grid and always get evaluated
+            onyxU32 IndexedCount;
+            onyxU64 Grid;
+        };
+
+        struct VolumeSourceEntry
+        {
+            onyxU16 Type;
+            onyxU16 Operation;
+            onyxU32 DataIndex;
+        };
+
+        // staging copies of the source buffers per frame in flight, an upload never writes memory the GPU might still read
+        Array<Graphics::BufferHandle, Graphics::MAX_FRAMES_IN_FLIGHT> SourcesListStagingBuffers;
+        Array<Graphics::BufferHandle, Graphics::MAX_FRAMES_IN_FLIGHT> SourcesDataStagingBuffers;
+        Array<Graphics::BufferHandle, Graphics::MAX_FRAMES_IN_FLIGHT> SourcesGridStagingBuffers;
+
+        // source buffers replaced by bigger ones, released when their frame index comes around again
+        Array<DynamicArray<Graphics::BufferHandle>, Graphics::MAX_FRAMES_IN_FLIGHT> RetiredSourceBuffers;
     }
 
 
+    namespace Edits
+    {
+        Graphics::BufferProperties GetSourceBufferProperties(StringView debugName, onyxU64 size, bool isStaging)
+        {
+            Graphics::BufferProperties properties;
+            properties.m_DebugName = debugName;
+            properties.m_Size = size;
+            if (isStaging)
+            {
+                properties.m_CpuAccess = Graphics::CPUAccess::Write;
+                properties.m_GpuAccess = Graphics::GPUAccess::Staging;
+            }
+            else
+            {
+                properties.m_UsageFlags = static_cast<onyxU8>(Graphics::BufferUsage::Storage | Graphics::BufferUsage::DeviceAddress);
+                properties.m_GpuAccess = Graphics::GPUAccess::Write;
+                properties.m_IsWritable = true;
+            }
+
+            return properties;
+        }
+
+        void CreateSourceBuffers(Graphics::GraphicsSystem& graphicsSystem, TerrainWorldOctreeComponent& worldOctree, onyxU32 capacity, onyxU8 frameIndex)
+        {
+            // frames in flight still read the old buffers through their gpu addresses
+            if (worldOctree.VolumeObjects)
+            {
+                RetiredSourceBuffers[frameIndex].push_back(worldOctree.VolumeObjects);
+                RetiredSourceBuffers[frameIndex].push_back(worldOctree.VolumeObjectsData);
+            }
+
+            const onyxU64 listSize = sizeof(VolumeSourcesListHeader) + sizeof(VolumeSourceEntry) * capacity;
+            const onyxU64 dataSize = sizeof(onyxF32) * VOLUME_EDIT_DATA_SIZE * capacity;
+            graphicsSystem.CreateBuffer(worldOctree.VolumeObjects, GetSourceBufferProperties("Volume-SourcesList", listSize, false));
+            graphicsSystem.CreateBuffer(worldOctree.VolumeObjectsData, GetSourceBufferProperties("Volume-SourcesData", dataSize, false));
+
+            worldOctree.VolumeObjectsCapacity = capacity;
+        }
+
+        void CreateGridBuffer(Graphics::GraphicsSystem& graphicsSystem, TerrainWorldOctreeComponent& worldOctree, onyxU64 size, onyxU8 frameIndex)
+        {
+            if (worldOctree.VolumeObjectsGrid)
+                RetiredSourceBuffers[frameIndex].push_back(worldOctree.VolumeObjectsGrid);
+
+            graphicsSystem.CreateBuffer(worldOctree.VolumeObjectsGrid, GetSourceBufferProperties("Volume-SourcesGrid", std::bit_ceil(size), false));
+        }
+
+        void UploadEdits(Graphics::GraphicsSystem& graphicsSystem, TerrainEditsComponent& terrainEdits, TerrainWorldOctreeComponent& worldOctree)
+        {
+            // the frame index only comes around again once the GPU finished that frame
+            const onyxU8 frameIndex = graphicsSystem.GetFrameContext().FrameIndex;
+            RetiredSourceBuffers[frameIndex].clear();
+
+            VolumeEditJournal& journal = terrainEdits.Journal;
+            if (journal.ShouldCollapse())
+                journal.Collapse();
+
+            const onyxU32 editCount = journal.GetEditCount();
+            const bool needsResize = (worldOctree.VolumeObjects == false) || ((editCount + PENDING_SOURCES_CAPACITY) > worldOctree.VolumeObjectsCapacity);
+            if (needsResize)
+            {
+                const onyxU32 capacity = std::max(MIN_SOURCES_CAPACITY, std::bit_ceil(editCount + PENDING_SOURCES_CAPACITY));
+                CreateSourceBuffers(graphicsSystem, worldOctree, capacity, frameIndex);
+            }
+            else if (worldOctree.UploadedEditsVersion == journal.GetVersion())
+            {
+                return;
+            }
+
+            DynamicArray<onyxU32> grid;
+            journal.WriteGpuGrid(grid);
+
+            const onyxU64 gridSize = sizeof(onyxU32) * grid.size();
+            if ((worldOctree.VolumeObjectsGrid == false) || (worldOctree.VolumeObjectsGrid.Buffer->GetProperties().m_Size < gridSize))
+                CreateGridBuffer(graphicsSystem, worldOctree, gridSize, frameIndex);
+
+            // the copy writes the whole staging buffer, so it has the size of the source buffer
+            Graphics::BufferHandle& listStaging = SourcesListStagingBuffers[frameIndex];
+            Graphics::BufferHandle& dataStaging = SourcesDataStagingBuffers[frameIndex];
+            const onyxU64 listSize = worldOctree.VolumeObjects.Buffer->GetProperties().m_Size;
+            if ((listStaging == false) || (listStaging.Buffer->GetProperties().m_Size != listSize))
+            {
+                graphicsSystem.CreateBuffer(listStaging, GetSourceBufferProperties("Volume-SourcesList-Staging", listSize, true));
+                graphicsSystem.CreateBuffer(dataStaging, GetSourceBufferProperties("Volume-SourcesData-Staging", worldOctree.VolumeObjectsData.Buffer->GetProperties().m_Size, true));
+            }
+
+            Graphics::BufferHandle& gridStaging = SourcesGridStagingBuffers[frameIndex];
+            const onyxU64 gridBufferSize = worldOctree.VolumeObjectsGrid.Buffer->GetProperties().m_Size;
+            if ((gridStaging == false) || (gridStaging.Buffer->GetProperties().m_Size != gridBufferSize))
+                graphicsSystem.CreateBuffer(gridStaging, GetSourceBufferProperties("Volume-SourcesGrid-Staging", gridBufferSize, true));
+
+            DynamicArray<VolumeSourceEntry> entries;
+            DynamicArray<onyxF32> data;
+            entries.reserve(editCount);
+            data.reserve(editCount * VOLUME_EDIT_DATA_SIZE);
+
+            const DynamicArray<VolumeEdit>& edits = journal.GetEdits();
+            for (onyxU32 i = 0; i < editCount; ++i)
+            {
+                const VolumeEdit& edit = edits[i];
+                entries.emplace_back(Enums::ToIntegral(edit.Type), Enums::ToIntegral(edit.Operation), i);
+                data.insert(data.end(), edit.Data.begin(), edit.Data.end());
+            }
+
+            const VolumeSourcesListHeader header{ editCount, editCount, worldOctree.VolumeObjectsGrid.GetGpuAddress() };
+            listStaging.Buffer->SetData(0, &header, sizeof(VolumeSourcesListHeader));
+            gridStaging.Buffer->SetData(0, grid.data(), numeric_cast<onyxS32>(gridSize));
+            if (editCount != 0)
+            {
+                listStaging.Buffer->SetData(sizeof(VolumeSourcesListHeader), entries.data(), numeric_cast<onyxS32>(sizeof(VolumeSourceEntry) * editCount));
+                dataStaging.Buffer->SetData(0, data.data(), numeric_cast<onyxS32>(sizeof(onyxF32) * data.size()));
+            }
+
+            // ordered on the GPU timeline after every earlier frame that reads the source buffers
+            Graphics::CommandBuffer& commandBuffer = graphicsSystem.GetCommandBuffer(frameIndex, true);
+            commandBuffer.Barrier(worldOctree.VolumeObjects, Graphics::Context::Compute, Graphics::Access::TransferWrite);
+            commandBuffer.Barrier(worldOctree.VolumeObjectsData, Graphics::Context::Compute, Graphics::Access::TransferWrite);
+            commandBuffer.Barrier(worldOctree.VolumeObjectsGrid, Graphics::Context::Compute, Graphics::Access::TransferWrite);
+            commandBuffer.Copy(listStaging, worldOctree.VolumeObjects);
+            commandBuffer.Copy(dataStaging, worldOctree.VolumeObjectsData);
+            commandBuffer.Copy(gridStaging, worldOctree.VolumeObjectsGrid);
+            commandBuffer.Barrier(worldOctree.VolumeObjects, Graphics::Context::Compute, Graphics::Access::ShaderRead);
+            commandBuffer.Barrier(worldOctree.VolumeObjectsData, Graphics::Context::Compute, Graphics::Access::ShaderRead);
+            commandBuffer.Barrier(worldOctree.VolumeObjectsGrid, Graphics::Context::Compute, Graphics::Access::ShaderRead);
+
+            worldOctree.VolumeObjectsCount = editCount;
+            worldOctree.UploadedEditsVersion = journal.GetVersion();
+        }
+
+        // runs every frame, edits change independent of the octree rebuilds
+        using TerrainEntity = Entity::Entity<TerrainEditsComponent, TerrainWorldOctreeComponent>;
+        void System(TerrainEntity terrainEntity, Graphics::GraphicsSystem& graphicsSystem)
+        {
+            auto&& [terrainEdits, terrainWorldOctree] = terrainEntity.Get();
+            UploadEdits(graphicsSystem, terrainEdits, terrainWorldOctree);
+        }
+    }
+
     namespace Init
     {
         struct UpdateOctreePushConstants
@@ -64,7 +234,7 @@ namespace Onyx::Volume::Terrain
 
         void CreateBuffers(Graphics::GraphicsSystem& graphicsSystem, TerrainWorldOctreeComponent& worldOctree, TerrainRuntimeComponent& terrainMesh, onyxU32 nodeCount)
         {
-            if (worldOctree.VolumeObjects == false)
+            if (worldOctree.OctreeGpuBuffer == false)
             {
                 Graphics::BufferProperties ssboVolumeOctreeBufferProps;
                 ssboVolumeOctreeBufferProps.m_DebugName = "Volume-WorldOctree";
@@ -83,24 +253,6 @@ namespace Onyx::Volume::Terrain
                 graphicsSystem.CreateBuffer(worldOctree.OctreeChunksBuffer, ssboVolumeLeafNodesProps);
 
 
-                // TODO: Fix amount of max sources (100) and data size (vec4)
-                Graphics::BufferProperties ssboVolumeSourceListProps;
-                ssboVolumeSourceListProps.m_DebugName = "Volume-SourcesList";
-                ssboVolumeSourceListProps.m_Size = sizeof(onyxU64) * 100;
-                ssboVolumeSourceListProps.m_UsageFlags = static_cast<onyxU8>(Graphics::BufferUsage::Storage | Graphics::BufferUsage::DeviceAddress);
-                ssboVolumeSourceListProps.m_GpuAccess = Graphics::GPUAccess::Write;
-                ssboVolumeSourceListProps.m_IsWritable = true;
-                graphicsSystem.CreateBuffer(worldOctree.VolumeObjects, ssboVolumeSourceListProps);
-
-
-                Graphics::BufferProperties ssboVolumeSourcesDataProps;
-                ssboVolumeSourcesDataProps.m_DebugName = "Volume-SourcesData";
-                ssboVolumeSourcesDataProps.m_Size = sizeof(Vector4f32) * 100;
-                ssboVolumeSourcesDataProps.m_UsageFlags = static_cast<onyxU8>(Graphics::BufferUsage::Storage | Graphics::BufferUsage::DeviceAddress);
-                ssboVolumeSourcesDataProps.m_GpuAccess = Graphics::GPUAccess::Write;
-                ssboVolumeSourcesDataProps.m_IsWritable = true;
-                graphicsSystem.CreateBuffer(worldOctree.VolumeObjectsData, ssboVolumeSourcesDataProps);
-
                 // create mesh buffer
                 Graphics::BufferProperties ssboMeshVerticesProps;
                 ssboMeshVerticesProps.m_DebugName = "VolumeMeshVertices";
@@ -417,12 +569,16 @@ namespace Onyx::Volume::Terrain
 
         using CameraEntityQuery = Entity::EntityQuery<const GameCore::TransformComponent, const GameCore::FreeCameraRuntimeComponent>;
         using TerrainEntity = Entity::Entity<const TerrainSettingsComponent, VolumeGenerationComponent, TerrainWorldOctreeComponent, TerrainRuntimeComponent, InitTerrainFlag>;
-        void System(TerrainEntity terrainEntity, CameraEntityQuery cameraQuery, Assets::AssetSystem& assetSystem, Graphics::GraphicsSystem& graphicsSystem, Entity::EntityCommandBuffer entityCommandBuffer)
+        void System(TerrainEntity terrainEntity, CameraEntityQuery cameraQuery, Assets::AssetSystem& assetSystem, Graphics::GraphicsSystem& graphicsSystem, Entity::EntityCommandBuffer entityCommandBuffer, const GameCore::TransformHierarchy& transformHierarchy)
         {
             auto&& [terrainSettings, generationComponent, terrainWorldOctree, terrainRuntime] = terrainEntity.Get();
 
             LoadShaders(assetSystem, graphicsSystem, terrainSettings, generationComponent);
 
+            // the source buffers get created by the edits system
+            if (terrainWorldOctree.VolumeObjects == false)
+                return;
+
             if ((generationComponent.HasLoadedShaders == false) ||
                 !generationComponent.UpdateWorldOctreeShader.IsValid() ||
                 !generationComponent.ResetBuffersShader.IsValid() ||
@@ -434,14 +590,16 @@ namespace Onyx::Volume::Terrain
             
             CreateBuffers(graphicsSystem, terrainWorldOctree, terrainRuntime, nodeCount);
 
-            Graphics::CommandBuffer& computeCommandBuffer = graphicsSystem.GetCommandBuffer(graphicsSystem.GetFrameIndex(), true);
+            // the simulation frame context, the render side might be recording a different frame when pipelined
+            const Graphics::FrameContext& frameContext = graphicsSystem.GetFrameContext();
+            Graphics::CommandBuffer& computeCommandBuffer = graphicsSystem.GetCommandBuffer(frameContext.FrameIndex, true);
 
             Entity::EntityId cameraEntity = cameraQuery.GetView().front();
-            const GameCore::TransformComponent& cameraTransform = cameraQuery.GetView().get<const GameCore::TransformComponent>(cameraEntity);
+            const Vector3f32 cameraPosition(transformHierarchy.GetWorldMatrix(cameraEntity)[3]);
            
             ResetBuffers(computeCommandBuffer, generationComponent, IsoSurfaceRequestsBuffer, terrainRuntime.IndirectDrawBuffer, IndirectDispatchBuffer0, SplitRequestQueueBuffer0);
-            onyxF32 farPlane = graphicsSystem.GetViewContsants().Far;
-            BuildWorldOctree(computeCommandBuffer, terrainSettings, generationComponent, terrainWorldOctree, cameraTransform.Translation, farPlane);
+            onyxF32 farPlane = frameContext.ViewConstants.Far;
+            BuildWorldOctree(computeCommandBuffer, terrainSettings, generationComponent, terrainWorldOctree, cameraPosition, farPlane);
             ExtractIsoSurface(computeCommandBuffer, generationComponent, terrainWorldOctree, terrainRuntime);
 
             entityCommandBuffer.RemoveComponent<InitTerrainFlag>(terrainEntity.GetId());
@@ -452,16 +610,16 @@ namespace Onyx::Volume::Terrain
     {
         using CameraEntityAccess = Entity::EntityQuery<const GameCore::TransformComponent, const GameCore::FreeCameraRuntimeComponent>;
             using TerrainEntity = Entity::Entity<TerrainWorldOctreeComponent, TerrainRuntimeComponent>;
-            void System(TerrainEntity terrainEntity, CameraEntityAccess cameraQuery, Entity::EntityCommandBuffer entityCommandBuffer)
+            void System(TerrainEntity terrainEntity, CameraEntityAccess cameraQuery, Entity::EntityCommandBuffer entityCommandBuffer, const GameCore::TransformHierarchy& transformHierarchy)
         {
             // TODO: make smarter instead of updates every 50 meters of movement
             Entity::EntityId cameraEntity = cameraQuery.GetView().front();
-            const GameCore::TransformComponent& cameraTransform = cameraQuery.GetView().get<const GameCore::TransformComponent>(cameraEntity);
+            const Vector3f32 cameraPosition(transformHierarchy.GetWorldMatrix(cameraEntity)[3]);
 
-            static Vector3f32 lastPosition = cameraTransform.Translation;
-            if ((lastPosition - cameraTransform.Translation).LengthSquared() > (50 * 50))
+            static Vector3f32 lastPosition = cameraPosition;
+            if ((lastPosition - cameraPosition).LengthSquared() > (50 * 50))
             {
-                lastPosition = cameraTransform.Translation;
+                lastPosition = cameraPosition;
                 Entity::EntityId terrainEntityId = terrainEntity.GetId();
                 entityCommandBuffer.AddComponent<InitTerrainFlag>(terrainEntityId);
             }
@@ -476,14 +634,20 @@ namespace Onyx::Volume::Terrain
         registry.AddComponent<VolumeGenerationComponent>(entity);
         registry.AddComponent<TerrainWorldOctreeComponent>(entity);
 
+        // edits are serialized with the scene and might have been loaded already
+        if (registry.HasComponents<TerrainEditsComponent>(entity) == false)
+            registry.AddComponent<TerrainEditsComponent>(entity);
+
         registry.AddComponent<InitTerrainFlag>(entity);
     }
 
     void Register(Entity::EcsBuilder& ecsBuilder)
     {
         ecsBuilder.RegisterComponent<TerrainSettingsComponent>(factory);
+        ecsBuilder.RegisterComponent<TerrainEditsComponent>();
 
         ecsBuilder.RegisterSystem(Streaming::System);
+        ecsBuilder.RegisterSystem(Edits::System);
         ecsBuilder.RegisterSystem(Init::System);
     }
 }
@@ -6,6 +6,7 @@
 #include <onyx/thread/async/asynctask.h>
 #include <onyx/volume/isosurface/isosurface.h>
 #include <onyx/volume/chunk/volumechunk.h>
+#include <onyx/volume/source/volumesamplecache.h>
 
 
 namespace Onyx::Volume
@@ -54,6 +55,7 @@ public:
 
     //TODO: should not be part of the load request but the task
     MeshBuilder m_MeshBuilder;
+    VolumeSampleCache::Statistics m_SampleCacheStatistics;
 
     const VolumeBase* m_VolumeSource = nullptr;
 };
@@ -77,7 +79,7 @@ public:
 private:
     void LoadChunk();
 
-    void GenerateOctree(VolumeChunk::VolumeChunkOctree& octree);
+    void GenerateOctree(VolumeChunk::VolumeChunkOctree& octree, const VolumeBase& volumeBase);
     void GenerateOctreeChildren(VolumeChunk::VolumeChunkOctree::OctreeNodeT* node, onyxU8 octreeLevel);
     VolumeOctreeNodeMetaData GetNodeMetaData(const Vector3f32& nodeLocalPosition, onyxF32 nodeHalfExtents);
 
@@ -90,6 +90,8 @@ private:
     const OctreeNodeT& FindLeafInternal(const OctreeKeyT& key, const OctreeNodeT& startNode, KeyType startNodeLevel, KeyType& outLevel) const;
     OctreeNodeT& FindLeafInternal(const OctreeKeyT& key, OctreeNodeT& startNode, KeyType startNodeLevel, KeyType& outLevel);
 
+    // declared before the root so it outlives all nodes
+    typename OctreeNodeT::ChildrenPool m_ChildrenPool;
     UniquePtr<OctreeNodeT> m_Root;
 };
 
@@ -7,7 +7,7 @@ namespace Onyx::Volume
 {
     template <typename NodeDataContainer, typename KeyType>
     Octree<NodeDataContainer, KeyType>::Octree()
-        : m_Root(new OctreeNode<NodeDataContainer>())
+        : m_Root(new OctreeNode<NodeDataContainer>(m_ChildrenPool))
     {
     }
 
@@ -23,7 +23,7 @@ namespace Onyx::Volume
         const OctreeNodeT* currentNode = &startNode;
 		onyxU8 childBranchIndex = 0;
         //TODO protected against overflow!
-        while (const OctreeNodeT* children = currentNode->GetChildren())
+        while (const OctreeNodeT* children = currentNode->GetChildren().get())
         {
             startNodeLevel >>= 1;
             childBranchIndex = key.GetChildBranchBit(startNodeLevel);
@@ -40,7 +40,7 @@ namespace Onyx::Volume
         onyxU8 childBranchIndex = 0;
         onyxU32 levelMask = 1 << startNodeLevel;
         //TODO protected against overflow!
-        while (std::unique_ptr<OctreeNodeT[]>& children = currentNode->GetChildren())
+        while (OctreeNodeT* children = currentNode->GetChildren().get())
         {
             levelMask >>= 1;
             childBranchIndex = key.GetChildBranchBit(levelMask);
@@ -63,7 +63,7 @@ namespace Onyx::Volume
         if (state.m_Depth > super::m_MaxDepth)
         {
             OctreeNodeT& currentNode = *state.m_Node;
-            std::unique_ptr<OctreeNodeT[]>& children = currentNode.GetChildren();
+            typename OctreeNodeT::OctreeNodeChildrenPtr& children = currentNode.GetChildren();
 
             if (children != nullptr)
             {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <onyx/memory/objectpool.h>
+
 namespace Onyx::Volume
 {
 template <typename DataContainerT>
@@ -7,34 +9,43 @@ class OctreeNode
 {
 private:
     using OctreeNodeT = OctreeNode<DataContainerT>;
-    using OctreeNodeChildrenPtr = UniquePtr<OctreeNodeT[]>;
+    using OctreeNodeChildren = std::array<OctreeNodeT, 8>;
+
+public:
+    // children are allocated from the pool of the owning octree instead of a heap allocation per subdivide
+    using ChildrenPool = ChunkedObjectPool<OctreeNodeChildren>;
+
+private:
+    struct ChildrenDeleter
+    {
+        ChildrenPool* Pool = nullptr;
+        PoolHandle Handle;
+
+        void operator()(OctreeNodeT*) const { Pool->Destroy(Handle); }
+    };
 
 public:
+    using OctreeNodeChildrenPtr = std::unique_ptr<OctreeNodeT[], ChildrenDeleter>;
+
     OctreeNode();
+    explicit OctreeNode(ChildrenPool& childrenPool);
     ~OctreeNode();
 
+    // a standalone copy allocates its children from the pool of the copied node
     OctreeNode(const OctreeNode& other)
+        : m_ChildrenPool(other.m_ChildrenPool)
     {
-        //Clear
-        ClearChildren();
-        ClearData();
-
-        if (other.m_Children != nullptr)
-        {
-            for (onyxU8 i = 0; i < 8; ++i)
-            {
-                const OctreeNodeT& child = other[i];
-                m_Children[i] = child.DeepCopy();
-            }
-        }
+        CopyChildren(other);
     }
 
     OctreeNode(OctreeNode&& other) noexcept
         : m_Children(std::move(other.m_Children)),
-        m_Data(std::move(other.m_Data))
+        m_Data(std::move(other.m_Data)),
+        m_ChildrenPool(other.m_ChildrenPool)
     {
     }
 
+    // keeps the pool of this node, the copied children get allocated from it
     OctreeNode& operator=(const OctreeNode& other)
     {
         if (this == &other)
@@ -43,17 +54,11 @@ public:
         //Clear
         ClearChildren();
         ClearData();
-        
-        if (other.m_Children != nullptr)
-        {
-            for (onyxU8 i = 0; i < 8; ++i)
-            {
-                const OctreeNodeT& child = other[i];
-                m_Children[i] = child.DeepCopy();
-            }
-        }
 
+        if (m_ChildrenPool == nullptr)
+            m_ChildrenPool = other.m_ChildrenPool;
 
+        CopyChildren(other);
         return (*this);
     }
 
@@ -65,14 +70,30 @@ public:
 
         m_Data = std::move(other.m_Data);
         m_Children = std::move(other.m_Children);
+        m_ChildrenPool = other.m_ChildrenPool;
         
         return *this;
     }
 
-    void Subdivide()
+    // the node stays a leaf if it has no pool to allocate its children from
+    bool Subdivide()
     {
-        //TODO: assert(IsSubdivided() == false);
-        m_Children = std::make_unique<OctreeNodeT[]>(8);
+        ONYX_ASSERT(IsSubdivided() == false);
+        ONYX_ASSERT(m_ChildrenPool != nullptr, "Octree node is not owned by an octree");
+        if (m_ChildrenPool == nullptr)
+            return false;
+
+        PoolHandle handle;
+        OctreeNodeChildren* children = m_ChildrenPool->Emplace(handle);
+        ONYX_ASSERT(children != nullptr, "Octree node pool is exhausted");
+        if (children == nullptr)
+            return false;
+
+        for (OctreeNodeT& child : *children)
+            child.m_ChildrenPool = m_ChildrenPool;
+
+        m_Children = OctreeNodeChildrenPtr(children->data(), ChildrenDeleter{ m_ChildrenPool, handle });
+        return true;
     }
 
     void Merge()
@@ -129,7 +150,8 @@ public:
 
 private:
 
-    OctreeNodeT DeepCopy() const;
+    // children are copy assigned, so the whole subtree is allocated from the pool of this node
+    void CopyChildren(const OctreeNode& other);
 
     void ClearChildren();
     //TODO: template based on data type of DataContainer!!
@@ -144,6 +166,7 @@ private:
      */
     OctreeNodeChildrenPtr m_Children = nullptr;
     DataContainerT m_Data = DataContainerT();
+    /* non owning */ ChildrenPool* m_ChildrenPool = nullptr;
 };
 
 }
@@ -11,6 +11,14 @@ namespace Onyx::Volume
     {
     }
 
+    template <typename DataContainerT>
+    OctreeNode<DataContainerT>::OctreeNode(ChildrenPool& childrenPool)
+        : m_Children(nullptr)
+        , m_Data()
+        , m_ChildrenPool(&childrenPool)
+    {
+    }
+
     template <typename DataContainerT>
     OctreeNode<DataContainerT>::~OctreeNode()
     {
@@ -19,9 +27,13 @@ namespace Onyx::Volume
     }
 
     template <typename DataContainerT>
-    OctreeNode<DataContainerT> OctreeNode<DataContainerT>::DeepCopy() const
+    void OctreeNode<DataContainerT>::CopyChildren(const OctreeNode& other)
     {
-        return OctreeNode<DataContainerT>(*this);
+        if ((other.m_Children == nullptr) || (Subdivide() == false))
+            return;
+
+        for (onyxU8 i = 0; i < 8; ++i)
+            m_Children[i] = other[i];
     }
 
     template <typename DataContainerT>
@@ -7,6 +7,9 @@ namespace Onyx::Volume
     class VolumeShaderGraphGenerator : public Graphics::ShaderGenerator
     {
     public:
+        static constexpr StringId32 TypeId = "Onyx::Volume::VolumeShaderGraphGenerator";
+        StringId32 GetTypeId() const override { return TypeId; }
+
         VolumeShaderGraphGenerator();
 
         String GenerateShader() override;
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <onyx/serialize/serialization.h>
+
+namespace Onyx::Volume
+{
+    // matches VolumeSource_* in includes/volume/volumesources.h
+    enum class VolumeEditType : onyxU16
+    {
+        Sphere,
+        Cube,
+        Ellipsoid,
+        Plane,
+        Grid,
+        SphereBrush,
+        CubeBrush
+    };
+
+    // matches VolumeOperation_* in includes/volume/volumesources.h
+    enum class VolumeEditOperation : onyxU16
+    {
+        Union,
+        Difference,
+        Intersect
+    };
+
+    // GPU layout of a single source in the sources data buffer
+    constexpr onyxU32 VOLUME_EDIT_DATA_SIZE = 8;
+
+    // GPU layout of the grid, matches WorldVolumeSourcesGrid in includes/volume/volumesources.h
+    constexpr onyxU32 VOLUME_EDIT_GRID_HEADER_SIZE = 4;
+    constexpr onyxU32 VOLUME_EDIT_GRID_CELL_SIZE = 5;
+
+    struct VolumeEdit
+    {
+        static VolumeEdit CreateSphere(VolumeEditOperation operation, const Vector3f32& center, onyxF32 radius);
+        static VolumeEdit CreateCube(VolumeEditOperation operation, const Vector3f32& center, const Vector3f32& halfExtents);
+        static VolumeEdit CreateEllipsoid(VolumeEditOperation operation, const Vector3f32& center, const Vector3f32& radii);
+        static VolumeEdit CreateSphereBrush(VolumeEditOperation operation, const Vector3f32& center, onyxF32 radius, onyxF32 smoothness);
+
+        // false if the edit can change the surface everywhere, e.g.: intersections and planes
+        bool GetBounds(Vector3f32& outMin, Vector3f32& outMax) const;
+
+        VolumeEditType Type = VolumeEditType::Sphere;
+        VolumeEditOperation Operation = VolumeEditOperation::Union;
+        Array<onyxF32, VOLUME_EDIT_DATA_SIZE> Data{};
+    };
+
+    // All CSG edits of a terrain in the order they got applied, the list is unbounded and serialized with the scene.
+    // Edits are indexed by a sparse uniform grid over their bounds, so a query only visits the edits overlapping it.
+    // A grid keeps the edits of a cell in journal order, which matters as the CSG operations do not commute.
+    class VolumeEditJournal
+    {
+    public:
+        static constexpr onyxF32 DEFAULT_CELL_SIZE = 32.0f;
+
+        // edits covering more cells are treated as unbounded instead of being added to every cell
+        static constexpr onyxU32 MAX_CELLS_PER_EDIT = 4096;
+
+        // edits added between two collapses
+        static constexpr onyxU32 COLLAPSE_INTERVAL = 64;
+
+        VolumeEditJournal(onyxF32 cellSize = DEFAULT_CELL_SIZE);
+
+        onyxU32 Add(const VolumeEdit& edit);
+        void Clear();
+
+        onyxU32 GetEditCount() const { return static_cast<onyxU32>(m_Edits.size()); }
+        const DynamicArray<VolumeEdit>& GetEdits() const { return m_Edits; }
+
+        // incremented on every change, e.g.: to know when the GPU copy is outdated
+        onyxU32 GetVersion() const { return m_Version; }
+
+        // indices of the edits that can change the surface in the box, in journal order
+        void Query(const Vector3f32& min, const Vector3f32& max, DynamicArray<onyxU32>& outEditIndices) const;
+
+        // applies the edits overlapping the position to a sample (xyz gradient, w distance) of the base terrain, mirrors SampleVolumeSources on the GPU.
+        // edits are only evaluated inside their bounds, this keeps the surface but not the exact distance far away from it
+        Vector4f32 Apply(const Vector3f32& position, const Vector4f32& baseSample) const;
+
+        // writes the grid in the layout of WorldVolumeSourcesGrid, every cell lists all edits that can change the surface in it in journal order
+        void WriteGpuGrid(DynamicArray<onyxU32>& outGrid) const;
+
+        bool ShouldCollapse() const { return m_EditsSinceCollapse >= COLLAPSE_INTERVAL; }
+
+        // removes edits that lie completely inside a later union or difference, their effect on the surface is overwritten.
+        // returns the number of removed edits
+        onyxU32 Collapse();
+
+    private:
+        onyxU64 GetCellKey(onyxS32 x, onyxS32 y, onyxS32 z) const;
+        Vector3s32 GetCellCoordinates(onyxU64 cellKey) const;
+        bool GetCellRange(const Vector3f32& min, const Vector3f32& max, Vector3s32& outMinCell, Vector3s32& outMaxCell) const;
+
+        void AddToIndex(onyxU32 editIndex);
+        void RebuildIndex();
+
+    private:
+        onyxF32 m_CellSize;
+        onyxF32 m_InverseCellSize;
+
+        DynamicArray<VolumeEdit> m_Edits;
+
+        HashMap<onyxU64, DynamicArray<onyxU32>> m_Cells;
+        DynamicArray<onyxU32> m_UnboundedEdits;
+
+        onyxU32 m_Version = 0;
+        onyxU32 m_EditsSinceCollapse = 0;
+
+        template <typename T>
+        friend struct Onyx::Serialization;
+    };
+}
+
+namespace Onyx
+{
+    template <>
+    struct Serialization<Volume::VolumeEdit>
+    {
+        static bool Serialize(Serializer& serializer, const Volume::VolumeEdit& edit);
+        static bool Deserialize(const Deserializer& deserializer, Volume::VolumeEdit& outEdit);
+    };
+
+    template <>
+    struct Serialization<Volume::VolumeEditJournal>
+    {
+        static bool Serialize(Serializer& serializer, const Volume::VolumeEditJournal& journal);
+        static bool Deserialize(const Deserializer& deserializer, Volume::VolumeEditJournal& outJournal);
+    };
+}
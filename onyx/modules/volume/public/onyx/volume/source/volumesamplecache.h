@@ -0,0 +1,50 @@
+#pragma once
+
+#include <onyx/volume/source/volumebase.h>
+
+namespace Onyx::Volume
+{
+    // Caches density samples of a volume source for a single chunk build.
+    // Octree nodes share corners with their siblings and children, so samples are keyed by their position on the lattice of the smallest node half extent.
+    // Positions that are not on the lattice (e.g.: interpolated surface points) are passed through to the source.
+    // Not thread safe, every chunk build owns its cache.
+    class VolumeSampleCache : public VolumeBase
+    {
+    public:
+        struct Statistics
+        {
+            onyxU64 Hits = 0;
+            onyxU64 Misses = 0;
+            // samples that were not on the lattice
+            onyxU64 Uncached = 0;
+
+            onyxF32 GetHitRate() const;
+        };
+
+        VolumeSampleCache(const VolumeBase& source, const Vector3f32& chunkCenter, onyxF32 chunkSize, onyxU8 maxOctreeLevel);
+
+        Vector4f32 GetValueAndGradient(const Vector3f32& position) const override;
+        onyxF32 GetValue(const Vector3f32& position) const override;
+
+        const Statistics& GetStatistics() const { return m_Statistics; }
+
+    private:
+        struct Sample
+        {
+            Vector4f32 ValueAndGradient;
+            bool HasGradient = false;
+        };
+
+        bool GetKey(const Vector3f32& position, onyxU64& outKey) const;
+
+    private:
+        const VolumeBase* m_Source = nullptr;
+
+        Vector3f32 m_LatticeOrigin;
+        onyxF32 m_InverseLatticeSpacing = 0.0f;
+        onyxU32 m_LatticeResolution = 0;
+
+        mutable HashMap<onyxU64, Sample> m_Samples;
+        mutable Statistics m_Statistics;
+    };
+}
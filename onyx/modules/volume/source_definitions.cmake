@@ -65,6 +65,8 @@ set(onyx_TARGET_PUBLIC_SOURCES
     source/noise/simplexnoised.h
     source/noise/simplexnoisesource.h
     source/volumebase.h
+    source/volumeeditjournal.h
+    source/volumesamplecache.h
     systems/volumeterrainsystem.h
     systems/volumerendersystem.h
     terrain/worldsparseoctreenode.h
@@ -110,6 +112,8 @@ set(onyx_TARGET_PRIVATE_SOURCES
     source/csg/operations/csgunion.cpp
     source/noise/simplexnoised.cpp
     source/volumebase.cpp
+    source/volumeeditjournal.cpp
+    source/volumesamplecache.cpp
     systems/volumeterrainsystem.cpp
     systems/volumerendersystem.cpp
     volumeterrain.cpp
@@ -0,0 +1,163 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <onyx/assets/assethotreloadplanner.h>
+
+using namespace Onyx;
+using namespace Onyx::Assets;
+
+namespace
+{
+    // edges go from the dependency to the asset that loads it
+    struct DependencyGraph
+    {
+        void Add(onyxU64 dependency, onyxU64 dependent)
+        {
+            Dependents[dependency].push_back(dependent);
+            Dependencies[dependent].push_back(dependency);
+        }
+
+        AssetHotReloadDependencies GetLookup()
+        {
+            AssetHotReloadDependencies lookup;
+            lookup.GetDependents = [this](AssetId id) { return Find(Dependents, id); };
+            lookup.GetDependencies = [this](AssetId id) { return Find(Dependencies, id); };
+            return lookup;
+        }
+
+        static DynamicArray<AssetId> Find(const HashMap<onyxU64, DynamicArray<AssetId>>& edges, AssetId id)
+        {
+            auto it = edges.find(id.Get());
+            return it == edges.end() ? DynamicArray<AssetId>() : it->second;
+        }
+
+        HashMap<onyxU64, DynamicArray<AssetId>> Dependents;
+        HashMap<onyxU64, DynamicArray<AssetId>> Dependencies;
+    };
+
+    bool Contains(const DynamicArray<AssetId>& wave, onyxU64 id)
+    {
+        return std::ranges::find(wave, AssetId(id)) != wave.end();
+    }
+}
+
+TEST_CASE("Asset hot reload debounce", "[Assets]")
+{
+    constexpr onyxU64 DEBOUNCE = AssetHotReloadPlanner::DEBOUNCE_MILLISECONDS;
+
+    HashMap<AssetId, AssetHotReloadPendingChange> pendingChanges;
+    pendingChanges[AssetId(1)] = { .Path = "data:/a.txt", .LastEventTime = 1000 };
+    pendingChanges[AssetId(2)] = { .Path = "data:/b.txt", .LastEventTime = 1100 };
+
+    DynamicArray<FilePath> changedFiles;
+    HashSet<AssetId> changedAssets;
+
+    SECTION("Changes are held back until they settled")
+    {
+        AssetHotReloadPlanner::CollectSettledChanges(pendingChanges, 1000 + DEBOUNCE - 1, changedFiles, changedAssets);
+        REQUIRE(changedFiles.empty());
+        REQUIRE(changedAssets.empty());
+        REQUIRE(pendingChanges.size() == 2);
+    }
+
+    SECTION("Only the settled changes are collected")
+    {
+        AssetHotReloadPlanner::CollectSettledChanges(pendingChanges, 1000 + DEBOUNCE, changedFiles, changedAssets);
+        REQUIRE(changedFiles.size() == 1);
+        REQUIRE(changedFiles[0] == FilePath("data:/a.txt"));
+        REQUIRE(changedAssets.contains(AssetId(1)));
+        REQUIRE(pendingChanges.size() == 1);
+        REQUIRE(pendingChanges.contains(AssetId(2)));
+    }
+
+    SECTION("A new event restarts the debounce")
+    {
+        pendingChanges[AssetId(1)].LastEventTime = 1100;
+        AssetHotReloadPlanner::CollectSettledChanges(pendingChanges, 1000 + DEBOUNCE, changedFiles, changedAssets);
+        REQUIRE(changedFiles.empty());
+
+        AssetHotReloadPlanner::CollectSettledChanges(pendingChanges, 1100 + DEBOUNCE, changedFiles, changedAssets);
+        REQUIRE(changedFiles.size() == 2);
+        REQUIRE(pendingChanges.empty());
+    }
+}
+
+TEST_CASE("Asset hot reload waves", "[Assets]")
+{
+    DependencyGraph graph;
+    Queue<DynamicArray<AssetId>> waves;
+
+    SECTION("Unrelated asset is reloaded alone")
+    {
+        graph.Add(1, 2);
+        const onyxU32 cyclicCount = AssetHotReloadPlanner::PlanReloadWaves({ AssetId(3) }, graph.GetLookup(), waves);
+        REQUIRE(cyclicCount == 0);
+        REQUIRE(waves.size() == 1);
+        REQUIRE(waves.front().size() == 1);
+        REQUIRE(Contains(waves.front(), 3));
+    }
+
+    SECTION("Dependents are reloaded after their dependencies")
+    {
+        // include (1) -> shaders (2, 3) -> material (4) that uses both shaders
+        graph.Add(1, 2);
+        graph.Add(1, 3);
+        graph.Add(2, 4);
+        graph.Add(3, 4);
+
+        const onyxU32 cyclicCount = AssetHotReloadPlanner::PlanReloadWaves({ AssetId(1) }, graph.GetLookup(), waves);
+        REQUIRE(cyclicCount == 0);
+        REQUIRE(waves.size() == 3);
+
+        REQUIRE(waves.front().size() == 1);
+        REQUIRE(Contains(waves.front(), 1));
+        waves.pop();
+
+        REQUIRE(waves.front().size() == 2);
+        REQUIRE(Contains(waves.front(), 2));
+        REQUIRE(Contains(waves.front(), 3));
+        waves.pop();
+
+        REQUIRE(waves.front().size() == 1);
+        REQUIRE(Contains(waves.front(), 4));
+    }
+
+    SECTION("Dependencies outside of the reload set do not hold back a wave")
+    {
+        // 5 is loaded by 2 but did not change
+        graph.Add(1, 2);
+        graph.Add(5, 2);
+
+        AssetHotReloadPlanner::PlanReloadWaves({ AssetId(1) }, graph.GetLookup(), waves);
+        REQUIRE(waves.size() == 2);
+        REQUIRE(Contains(waves.front(), 1));
+        waves.pop();
+        REQUIRE(Contains(waves.front(), 2));
+    }
+
+    SECTION("Changed asset and its dependent in one batch")
+    {
+        graph.Add(1, 2);
+
+        AssetHotReloadPlanner::PlanReloadWaves({ AssetId(1), AssetId(2) }, graph.GetLookup(), waves);
+        REQUIRE(waves.size() == 2);
+        REQUIRE(waves.front().size() == 1);
+        REQUIRE(Contains(waves.front(), 1));
+    }
+
+    SECTION("Dependency cycle is reloaded last")
+    {
+        // 2 and 3 depend on each other
+        graph.Add(1, 2);
+        graph.Add(2, 3);
+        graph.Add(3, 2);
+
+        const onyxU32 cyclicCount = AssetHotReloadPlanner::PlanReloadWaves({ AssetId(1) }, graph.GetLookup(), waves);
+        REQUIRE(cyclicCount == 2);
+        REQUIRE(waves.size() == 2);
+        REQUIRE(Contains(waves.front(), 1));
+        waves.pop();
+        REQUIRE(waves.front().size() == 2);
+        REQUIRE(Contains(waves.front(), 2));
+        REQUIRE(Contains(waves.front(), 3));
+    }
+}
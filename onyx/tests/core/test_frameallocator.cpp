@@ -0,0 +1,113 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <onyx/memory/frameallocator.h>
+
+namespace Onyx
+{
+TEST_CASE("LinearAllocator - Alignment and reset", "[memory]")
+{
+    LinearAllocator allocator(64);
+
+    void* first = allocator.Allocate(3, 1);
+    void* aligned = allocator.Allocate(8, 16);
+    REQUIRE(first != nullptr);
+    REQUIRE((reinterpret_cast<uintptr_t>(aligned) % 16) == 0);
+
+    // does not fit into the first block anymore
+    void* large = allocator.Allocate(200, 8);
+    REQUIRE(large != nullptr);
+    REQUIRE(allocator.GetCapacity() > 64);
+
+    const size_t usedBytes = allocator.GetUsedBytes();
+    allocator.Reset();
+    REQUIRE(allocator.GetUsedBytes() == 0);
+    REQUIRE(allocator.GetHighWaterMark() == usedBytes);
+
+    // blocks got merged so the same workload fits into one block
+    const size_t capacity = allocator.GetCapacity();
+    allocator.Allocate(3, 1);
+    allocator.Allocate(8, 16);
+    allocator.Allocate(200, 8);
+    REQUIRE(allocator.GetCapacity() == capacity);
+}
+
+TEST_CASE("FrameAllocator - Frame ring", "[memory]")
+{
+    FrameAllocator frameAllocator(2, 1024);
+
+    frameAllocator.BeginFrame(0);
+    onyxU32* frame0 = frameAllocator.AllocateArray<onyxU32>(16);
+    frame0[0] = 42;
+
+    // memory of frame 0 stays valid while frame 1 is built
+    frameAllocator.BeginFrame(1);
+    onyxU32* frame1 = frameAllocator.AllocateArray<onyxU32>(16);
+    REQUIRE(frame1 != frame0);
+    REQUIRE(frame0[0] == 42);
+
+    // beginning frame 0 again reuses its memory
+    frameAllocator.BeginFrame(0);
+    REQUIRE(frameAllocator.GetStats().UsedBytes == 64);
+    REQUIRE(frameAllocator.AllocateArray<onyxU32>(16) == frame0);
+}
+
+TEST_CASE("FrameAllocator - Threads and containers", "[memory]")
+{
+    FrameAllocator frameAllocator(2, 1024);
+    frameAllocator.BeginFrame(0);
+
+    DynamicArray<std::thread> threads;
+    Atomic<onyxU32> sum = 0;
+    for (onyxU32 threadIndex = 0; threadIndex < 4; ++threadIndex)
+    {
+        threads.emplace_back([&]()
+        {
+            FrameArray<onyxU32> values{ FrameStdAllocator<onyxU32>(frameAllocator) };
+            for (onyxU32 i = 0; i < 1000; ++i)
+                values.push_back(i);
+
+            onyxU32 threadSum = 0;
+            for (onyxU32 value : values)
+                threadSum += value;
+
+            sum += threadSum;
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    REQUIRE(sum == 4 * 499500);
+
+    frameAllocator.BeginFrame(1);
+    frameAllocator.BeginFrame(0);
+    REQUIRE(frameAllocator.GetStats().ThreadCount > 0);
+    REQUIRE(frameAllocator.GetStats().HighWaterMark > 4 * 1000 * sizeof(onyxU32));
+}
+
+TEST_CASE("FrameAllocator - Bound thread frame", "[memory]")
+{
+    FrameAllocator frameAllocator(2, 1024);
+    frameAllocator.BeginFrame(0);
+
+    // a render thread keeps allocating into the frame it renders while the simulation begins the next one
+    std::thread renderThread([&]()
+    {
+        frameAllocator.BindThreadFrame(0);
+        onyxU32* renderMemory = frameAllocator.AllocateArray<onyxU32>(16);
+        renderMemory[0] = 42;
+
+        frameAllocator.BeginFrame(1);
+        REQUIRE(frameAllocator.AllocateArray<onyxU32>(16) == renderMemory + 16);
+        REQUIRE(renderMemory[0] == 42);
+
+        frameAllocator.UnbindThreadFrame();
+        frameAllocator.BeginFrame(0);
+
+        // unbound allocations follow the current frame again
+        REQUIRE(frameAllocator.AllocateArray<onyxU32>(16) == renderMemory);
+    });
+
+    renderThread.join();
+}
+}
@@ -0,0 +1,92 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <onyx/engine/frametimer.h>
+
+namespace Onyx
+{
+    namespace
+    {
+        constexpr onyxU64 MILLISECOND = 1'000'000;
+    }
+
+TEST_CASE("FrameTimer - Accumulates fixed steps", "[engine]")
+{
+    FrameTimerSettings settings;
+    settings.FixedUpdateRate = 100;
+    FrameTimer timer(settings);
+
+    timer.BeginFrame(0);
+    REQUIRE(timer.GetDelta().DeltaNanoseconds == 0);
+    REQUIRE(timer.GetFixedTime().StepCount == 0);
+
+    timer.BeginFrame(4 * MILLISECOND);
+    REQUIRE(timer.GetDelta().DeltaNanoseconds == 4 * MILLISECOND);
+    REQUIRE(timer.GetFixedTime().StepCount == 0);
+    REQUIRE(timer.GetFixedTime().Interpolation == 0.4f);
+
+    timer.BeginFrame(25 * MILLISECOND);
+    REQUIRE(timer.GetFixedTime().StepCount == 2);
+    REQUIRE(timer.GetFixedTime().StepDelta.DeltaNanoseconds == 10 * MILLISECOND);
+    REQUIRE(timer.GetFixedTime().Interpolation == 0.5f);
+    REQUIRE(timer.GetTime().Nanoseconds == 25 * MILLISECOND);
+}
+
+TEST_CASE("FrameTimer - Drops steps above the maximum", "[engine]")
+{
+    FrameTimerSettings settings;
+    settings.FixedUpdateRate = 100;
+    settings.MaxFixedStepsPerFrame = 3;
+    FrameTimer timer(settings);
+
+    timer.BeginFrame(0);
+    timer.BeginFrame(1003 * MILLISECOND);
+    REQUIRE(timer.GetFixedTime().StepCount == 3);
+
+    // the dropped time is not carried over into the next frame
+    timer.BeginFrame(1013 * MILLISECOND);
+    REQUIRE(timer.GetFixedTime().StepCount == 1);
+    REQUIRE(timer.GetFixedTime().Interpolation == 0.3f);
+}
+
+TEST_CASE("FrameTimer - Variable step without fixed update rate", "[engine]")
+{
+    FrameTimerSettings settings;
+    settings.FixedUpdateRate = 0;
+    FrameTimer timer(settings);
+
+    timer.BeginFrame(0);
+    timer.BeginFrame(7 * MILLISECOND);
+    REQUIRE(timer.GetFixedTime().StepCount == 1);
+    REQUIRE(timer.GetFixedTime().StepDelta.DeltaNanoseconds == 7 * MILLISECOND);
+}
+
+TEST_CASE("FrameTimer - Explicit delta", "[engine]")
+{
+    FrameTimerSettings settings;
+    settings.FixedUpdateRate = 100;
+    FrameTimer timer(settings);
+
+    timer.BeginFrame(0);
+    timer.BeginFrame(50 * MILLISECOND, 10 * MILLISECOND);
+    REQUIRE(timer.GetDelta().DeltaNanoseconds == 10 * MILLISECOND);
+    REQUIRE(timer.GetFixedTime().StepCount == 1);
+}
+
+TEST_CASE("FrameTimer - Limits frame rate", "[engine]")
+{
+    FrameTimerSettings settings;
+    settings.FrameRateLimit = 200;
+    FrameTimer timer(settings);
+
+    REQUIRE(timer.GetRemainingFrameTime(0) == 5 * MILLISECOND);
+
+    const onyxU64 start = Time::GetCurrentNanoseconds();
+    for (onyxU32 i = 0; i < 4; ++i)
+    {
+        timer.BeginFrame();
+        timer.LimitFrameRate();
+    }
+
+    REQUIRE((Time::GetCurrentNanoseconds() - start) >= 20 * MILLISECOND);
+}
+}
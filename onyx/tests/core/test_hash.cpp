@@ -0,0 +1,111 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <onyx/hash.h>
+
+namespace Onyx::Hash
+{
+    namespace
+    {
+        DynamicArray<onyxU8> CreateInput(onyxU64 length)
+        {
+            DynamicArray<onyxU8> input(length);
+            onyxU32 state = 0x12345678u;
+            for (onyxU8& value : input)
+            {
+                state = state * 1664525u + 1013904223u;
+                value = static_cast<onyxU8>(state >> 24);
+            }
+            return input;
+        }
+    }
+
+    TEST_CASE("FastHash streaming matches one shot", "[hash]")
+    {
+        // lengths around the short input, tail and block boundaries
+        constexpr onyxU64 LENGTHS[] = { 0, 1, 3, 4, 8, 15, 16, 17, 33, 48, 63, 64, 65, 112, 113, 127, 1000, 4099 };
+        constexpr onyxU64 CHUNK_SIZES[] = { 1, 7, 16, 48, 63, 64, 65, 500 };
+
+        for (onyxU64 length : LENGTHS)
+        {
+            const DynamicArray<onyxU8> input = CreateInput(length);
+            const onyxU64 expected64 = FastHash64Bytes(input.data(), length, 42);
+            const Hash128 expected128 = FastHash128Bytes(input.data(), length, 42);
+
+            REQUIRE(expected128.Low == expected64);
+
+            for (onyxU64 chunkSize : CHUNK_SIZES)
+            {
+                FastHasher hasher(42);
+                for (onyxU64 offset = 0; offset < length; offset += chunkSize)
+                    hasher.Update(input.data() + offset, std::min(chunkSize, length - offset));
+
+                REQUIRE(hasher.Finalize64() == expected64);
+                REQUIRE(hasher.Finalize128() == expected128);
+            }
+        }
+    }
+
+    TEST_CASE("FastHash depends on every input byte, the length and the seed", "[hash]")
+    {
+        DynamicArray<onyxU8> input = CreateInput(200);
+
+        SECTION("Flipping a single bit changes the hash")
+        {
+            HashSet<onyxU64> hashes;
+            hashes.insert(FastHash64Bytes(input.data(), input.size()));
+            for (onyxU64 i = 0; i < input.size(); ++i)
+            {
+                input[i] ^= 0x10;
+                hashes.insert(FastHash64Bytes(input.data(), input.size()));
+                input[i] ^= 0x10;
+            }
+
+            REQUIRE(hashes.size() == input.size() + 1);
+        }
+
+        SECTION("Zero padding changes the hash")
+        {
+            const DynamicArray<onyxU8> zeros(128, 0);
+            HashSet<onyxU64> hashes;
+            for (onyxU64 length = 0; length <= zeros.size(); ++length)
+                hashes.insert(FastHash64Bytes(zeros.data(), length));
+
+            REQUIRE(hashes.size() == zeros.size() + 1);
+        }
+
+        SECTION("Seed changes the hash")
+        {
+            REQUIRE(FastHash64Bytes(input.data(), input.size(), 0) != FastHash64Bytes(input.data(), input.size(), 1));
+            REQUIRE(FastHash64("onyx", 0) != FastHash64("onyx", 1));
+            // the string overload hashes the whole string and forwards the seed
+            REQUIRE(FastHash64("onyx", 1) == FastHash64Bytes("onyx", 4, 1));
+            REQUIRE(FastHash128("onyx", 1) == FastHash128Bytes("onyx", 4, 1));
+        }
+
+        SECTION("Halves of the 128 bit hash differ")
+        {
+            const Hash128 hash = FastHash128Bytes(input.data(), input.size());
+            REQUIRE(hash.Low != hash.High);
+        }
+    }
+
+    TEST_CASE("FastHash distributes short paths across buckets", "[hash]")
+    {
+        constexpr onyxU32 BUCKET_COUNT = 64;
+        constexpr onyxU32 KEY_COUNT = BUCKET_COUNT * 256;
+
+        onyxU32 buckets[BUCKET_COUNT] = {};
+        for (onyxU32 i = 0; i < KEY_COUNT; ++i)
+        {
+            const String path = Format::Format("engine:/shaders/shader_{}.oshader", i);
+            ++buckets[FastHash64(path) % BUCKET_COUNT];
+        }
+
+        // expected 256 keys per bucket, allow for a generous deviation
+        for (onyxU32 count : buckets)
+        {
+            REQUIRE(count > 192);
+            REQUIRE(count < 320);
+        }
+    }
+}
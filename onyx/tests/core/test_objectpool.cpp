@@ -0,0 +1,149 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <onyx/memory/objectpool.h>
+
+namespace Onyx
+{
+    namespace
+    {
+        struct PooledObject
+        {
+            PooledObject(onyxU32 value, onyxU32& destructionCount)
+                : Value(value)
+                , DestructionCount(&destructionCount)
+            {
+            }
+
+            ~PooledObject() { ++(*DestructionCount); }
+
+            onyxU32 Value = 0;
+            onyxU32* DestructionCount = nullptr;
+        };
+    }
+
+TEST_CASE("StaticObjectPool - Acquire and release", "[memory]")
+{
+    StaticObjectPool<PooledObject, 64> pool;
+    onyxU32 destructionCount = 0;
+
+    DynamicArray<PoolHandle> handles;
+    for (onyxU32 i = 0; i < 64; ++i)
+    {
+        PoolHandle& handle = handles.emplace_back();
+        PooledObject* object = pool.Emplace(handle, i, destructionCount);
+        REQUIRE(object != nullptr);
+        REQUIRE(handle.Index == i);
+    }
+
+    REQUIRE(pool.GetAcquiredCount() == 64);
+
+    PoolHandle overflowHandle;
+    REQUIRE(pool.Emplace(overflowHandle, 64u, destructionCount) == nullptr);
+
+    for (onyxU32 i = 0; i < 64; ++i)
+        REQUIRE(pool.Get(handles[i])->Value == i);
+
+    for (const PoolHandle& handle : handles)
+        pool.Destroy(handle);
+
+    REQUIRE(destructionCount == 64);
+    REQUIRE(pool.GetAcquiredCount() == 0);
+
+    // released slots are reused
+    for (onyxU32 i = 0; i < 64; ++i)
+        REQUIRE(pool.Emplace(handles[i], i, destructionCount) != nullptr);
+
+    for (const PoolHandle& handle : handles)
+        pool.Destroy(handle);
+}
+
+TEST_CASE("StaticObjectPool - Stale handles", "[memory]")
+{
+    StaticObjectPool<PooledObject, 16> pool;
+    onyxU32 destructionCount = 0;
+
+    PoolHandle handle;
+    pool.Emplace(handle, 1u, destructionCount);
+    REQUIRE(pool.IsValid(handle));
+
+    const PoolHandle staleHandle = handle;
+    pool.Destroy(handle);
+    REQUIRE(pool.IsValid(staleHandle) == false);
+    REQUIRE(pool.Get(staleHandle) == nullptr);
+
+    // the slot is reused with a new generation
+    PoolHandle newHandle;
+    pool.Emplace(newHandle, 2u, destructionCount);
+    REQUIRE(newHandle.Index == staleHandle.Index);
+    REQUIRE(newHandle.Generation != staleHandle.Generation);
+    REQUIRE(pool.Get(staleHandle) == nullptr);
+    REQUIRE(pool.Get(newHandle)->Value == 2);
+
+    pool.Destroy(newHandle);
+    REQUIRE(pool.IsValid(PoolHandle()) == false);
+}
+
+TEST_CASE("ChunkedObjectPool - Grows with stable addresses", "[memory]")
+{
+    ChunkedObjectPool<PooledObject, 16> pool;
+    onyxU32 destructionCount = 0;
+
+    DynamicArray<PoolHandle> handles(100);
+    DynamicArray<PooledObject*> objects;
+    for (onyxU32 i = 0; i < 100; ++i)
+        objects.push_back(pool.Emplace(handles[i], i, destructionCount));
+
+    REQUIRE(pool.GetCapacity() == 112);
+    for (onyxU32 i = 0; i < 100; ++i)
+    {
+        REQUIRE(pool.Get(handles[i]) == objects[i]);
+        REQUIRE(objects[i]->Value == i);
+    }
+
+    for (const PoolHandle& handle : handles)
+        pool.Destroy(handle);
+
+    REQUIRE(destructionCount == 100);
+}
+
+TEST_CASE("StaticObjectPool - Multithreaded", "[memory]")
+{
+    constexpr onyxU32 THREAD_COUNT = 4;
+    constexpr onyxU32 ITERATIONS = 10000;
+
+    StaticObjectPool<onyxU64, 256> pool;
+    Atomic<bool> hasFailed = false;
+
+    DynamicArray<std::thread> threads;
+    for (onyxU32 threadIndex = 0; threadIndex < THREAD_COUNT; ++threadIndex)
+    {
+        threads.emplace_back([&, threadIndex]()
+        {
+            PoolHandle handles[32];
+            for (onyxU32 i = 0; i < ITERATIONS; ++i)
+            {
+                PoolHandle& handle = handles[i % 32];
+                if (handle.IsValid())
+                {
+                    if (*pool.Get(handle) != (threadIndex * ITERATIONS + i - 32))
+                        hasFailed = true;
+
+                    pool.Destroy(handle);
+                }
+
+                if (pool.Emplace(handle, threadIndex * ITERATIONS + i) == nullptr)
+                    hasFailed = true;
+            }
+
+            for (const PoolHandle& handle : handles)
+                pool.Destroy(handle);
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    REQUIRE(hasFailed == false);
+    REQUIRE(pool.GetAcquiredCount() == 0);
+}
+}
@@ -0,0 +1,84 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <onyx/serialize/schemaserializer.h>
+
+namespace Onyx
+{
+    namespace
+    {
+        struct LightV1
+        {
+            onyxF32 Intensity = 1.0f;
+            Vector3f32 Color;
+        };
+
+        struct LightV1Copy
+        {
+            onyxF32 Intensity = 5.0f;
+            Vector3f32 Color{ 1.0f, 0.0f, 0.0f };
+        };
+
+        struct LightRenamed
+        {
+            onyxF32 Strength = 1.0f;
+            Vector3f32 Color;
+        };
+
+        struct LightAdded
+        {
+            onyxF32 Intensity = 1.0f;
+            Vector3f32 Color;
+            bool IsShadowCasting = true;
+        };
+
+        struct LightChangedType
+        {
+            onyxF64 Intensity = 1.0;
+            Vector3f32 Color;
+        };
+    }
+
+    template <>
+    struct Serialization<LightV1>
+    {
+        static bool Serialize(Serializer& serializer, const LightV1& value) { return serializer.Write<"intensity">(value.Intensity) && serializer.Write<"color">(value.Color); }
+    };
+
+    template <>
+    struct Serialization<LightV1Copy>
+    {
+        static bool Serialize(Serializer& serializer, const LightV1Copy& value) { return serializer.Write<"intensity">(value.Intensity) && serializer.Write<"color">(value.Color); }
+    };
+
+    template <>
+    struct Serialization<LightRenamed>
+    {
+        static bool Serialize(Serializer& serializer, const LightRenamed& value) { return serializer.Write<"strength">(value.Strength) && serializer.Write<"color">(value.Color); }
+    };
+
+    template <>
+    struct Serialization<LightAdded>
+    {
+        static bool Serialize(Serializer& serializer, const LightAdded& value)
+        {
+            return serializer.Write<"intensity">(value.Intensity) && serializer.Write<"color">(value.Color) && serializer.Write<"isShadowCasting">(value.IsShadowCasting);
+        }
+    };
+
+    template <>
+    struct Serialization<LightChangedType>
+    {
+        static bool Serialize(Serializer& serializer, const LightChangedType& value) { return serializer.Write<"intensity">(value.Intensity) && serializer.Write<"color">(value.Color); }
+    };
+
+    TEST_CASE("Schema id only depends on the structure", "[serialize]")
+    {
+        const onyxU64 schemaId = ComputeSchemaId<LightV1>();
+
+        REQUIRE(schemaId == ComputeSchemaId<LightV1Copy>());
+        REQUIRE(schemaId != ComputeSchemaId<LightV1>(1));
+        REQUIRE(schemaId != ComputeSchemaId<LightRenamed>());
+        REQUIRE(schemaId != ComputeSchemaId<LightAdded>());
+        REQUIRE(schemaId != ComputeSchemaId<LightChangedType>());
+    }
+}
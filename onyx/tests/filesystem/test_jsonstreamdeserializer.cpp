@@ -0,0 +1,143 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <onyx/filesystem/jsonstreamdeserializer.h>
+
+namespace Onyx::FileSystem
+{
+    namespace
+    {
+        struct TestItem
+        {
+            String Name;
+            onyxS32 Count = 0;
+            onyxF32 Scale = 0.0f;
+            bool IsEnabled = false;
+        };
+    }
+}
+
+namespace Onyx
+{
+    template <>
+    struct Serialization<FileSystem::TestItem>
+    {
+        static bool Deserialize(const Deserializer& deserializer, FileSystem::TestItem& outItem)
+        {
+            bool success = deserializer.Read<"name">(outItem.Name);
+            success &= deserializer.Read<"count">(outItem.Count);
+            success &= deserializer.Read<"scale">(outItem.Scale);
+            success &= deserializer.Read<"enabled">(outItem.IsEnabled);
+            return success;
+        }
+    };
+}
+
+namespace Onyx::FileSystem
+{
+    TEST_CASE("JsonStreamDeserializer reads nested values", "[json]")
+    {
+        constexpr StringView json = R"({
+            "version": 3,
+            "id": "ff",
+            "items": [
+                { "name": "first", "count": -2, "scale": 1.5, "enabled": true },
+                { "enabled": false, "scale": 2, "count": 1e2, "name": "esc\"aped\u00e9" }
+            ],
+            "Settings": { "a": 1, "b": 2 }
+        })";
+
+        JsonStreamDeserializer deserializer;
+        REQUIRE(deserializer.Parse(json));
+
+        onyxU32 version = 0;
+        REQUIRE(deserializer.Read<"version">(version));
+        REQUIRE(version == 3);
+
+        onyxU32 id = 0;
+        REQUIRE(deserializer.Read<"id">(id, 16));
+        REQUIRE(id == 0xff);
+
+        DynamicArray<TestItem> items;
+        REQUIRE(deserializer.Read("items", items));
+        REQUIRE(items.size() == 2);
+        REQUIRE(items[0].Name == "first");
+        REQUIRE(items[0].Count == -2);
+        REQUIRE(items[0].Scale == 1.5f);
+        REQUIRE(items[0].IsEnabled);
+        // members out of document order and numbers written as floating point
+        REQUIRE(items[1].Name == "esc\"aped\xC3\xA9");
+        REQUIRE(items[1].Count == 100);
+        REQUIRE(items[1].Scale == 2.0f);
+        REQUIRE(items[1].IsEnabled == false);
+
+        HashMap<StringView, onyxS32> settings;
+        REQUIRE(deserializer.Read("settings", settings));
+        REQUIRE(settings.size() == 2);
+        REQUIRE(settings["a"] == 1);
+        REQUIRE(settings["b"] == 2);
+
+        onyxU32 missing = 0;
+        REQUIRE(deserializer.Read<"missing">(missing) == false);
+        StringView wrongType;
+        REQUIRE(deserializer.Read<"version">(wrongType) == false);
+    }
+
+    TEST_CASE("JsonStreamDeserializer rejects malformed input", "[json]")
+    {
+        constexpr StringView malformedJsons[] =
+        {
+            "",
+            "   ",
+            R"({ "a": 1 )",
+            R"({ "a" 1 })",
+            R"({ a: 1 })",
+            R"({ "a": 1, })",
+            R"([1, 2,])",
+            R"([1 2])",
+            R"({ "a": "unterminated })",
+            R"({ "a": "bad \q escape" })",
+            R"({ "a": "\ud800" })",
+            R"({ "a": "\u12g4" })",
+            R"({ "a": 01x })",
+            R"({ "a": - })",
+            R"({ "a": tru })",
+            R"({ "a": 1 } trailing)",
+            "{ \"a\": \"control\x01\" }",
+        };
+
+        for (StringView json : malformedJsons)
+        {
+            JsonStreamDeserializer deserializer;
+            REQUIRE(deserializer.Parse(json) == false);
+            REQUIRE(deserializer.IsValid() == false);
+
+            // reading from a failed document fails instead of touching the partially parsed nodes
+            onyxS32 value = 0;
+            REQUIRE(deserializer.Read<"a">(value) == false);
+            DynamicArray<onyxS32> values;
+            REQUIRE(deserializer.Read("a", values) == false);
+        }
+    }
+
+    TEST_CASE("JsonStreamDeserializer rejects too deep nesting", "[json]")
+    {
+        const String json = String(1024, '[') + String(1024, ']');
+
+        JsonStreamDeserializer deserializer;
+        REQUIRE(deserializer.Parse(json) == false);
+        REQUIRE(deserializer.IsValid() == false);
+    }
+
+    TEST_CASE("JsonStreamDeserializer recovers after a failed parse", "[json]")
+    {
+        JsonStreamDeserializer deserializer;
+        REQUIRE(deserializer.Parse(R"({ "a": [1, 2 })") == false);
+
+        REQUIRE(deserializer.Parse(R"({ "a": 5 })"));
+        REQUIRE(deserializer.IsValid());
+
+        onyxS32 value = 0;
+        REQUIRE(deserializer.Read<"a">(value));
+        REQUIRE(value == 5);
+    }
+}
@@ -0,0 +1,185 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <onyx/entity/componentfactory.h>
+#include <onyx/gamecore/scene/scenesector.h>
+#include <onyx/gamecore/serialize/binarysector.h>
+#include <onyx/serialize/serializer.h>
+#include <onyx/serialize/deserializer.h>
+#include <onyx/stream/memorystream.h>
+
+namespace Onyx
+{
+    namespace
+    {
+        // stored raw
+        struct TestPodComponent
+        {
+            static constexpr StringId32 TypeId = "Onyx::Test::TestPodComponent";
+            StringId32 GetTypeId() const { return TypeId; }
+
+            onyxF32 Value = 0.0f;
+            onyxS32 Count = 0;
+        };
+
+        // stored as embedded json
+        struct TestNameComponent
+        {
+            static constexpr StringId32 TypeId = "Onyx::Test::TestNameComponent";
+            StringId32 GetTypeId() const { return TypeId; }
+
+            String Name;
+        };
+
+        struct TestFlagComponent
+        {
+            static constexpr StringId32 TypeId = "Onyx::Test::TestFlagComponent";
+            StringId32 GetTypeId() const { return TypeId; }
+        };
+
+        struct TestFailingComponent
+        {
+            static constexpr StringId32 TypeId = "Onyx::Test::TestFailingComponent";
+            StringId32 GetTypeId() const { return TypeId; }
+
+            onyxS32 Value = 0;
+        };
+    }
+
+    template <>
+    struct Serialization<TestPodComponent>
+    {
+        static bool Serialize(Serializer& serializer, const TestPodComponent& value) { return serializer.Write<"value">(value.Value) && serializer.Write<"count">(value.Count); }
+        static bool Deserialize(const Deserializer& deserializer, TestPodComponent& value) { return deserializer.Read<"value">(value.Value) && deserializer.Read<"count">(value.Count); }
+    };
+
+    template <>
+    struct Serialization<TestNameComponent>
+    {
+        static bool Serialize(Serializer& serializer, const TestNameComponent& value) { return serializer.Write<"name">(value.Name); }
+        static bool Deserialize(const Deserializer& deserializer, TestNameComponent& value) { return deserializer.Read<"name">(value.Name); }
+    };
+
+    template <>
+    struct Serialization<TestFailingComponent>
+    {
+        static bool Serialize(Serializer& serializer, const TestFailingComponent& value) { return serializer.Write<"value">(value.Value); }
+        static bool Deserialize(const Deserializer& deserializer, TestFailingComponent& value) { return deserializer.Read<"value">(value.Value); }
+    };
+
+    template <>
+    struct BinarySerialization<TestFailingComponent>
+    {
+        static constexpr onyxU64 SchemaId = 1;
+        static bool Serialize(Stream&, const TestFailingComponent&) { return false; }
+        static bool Deserialize(const Stream&, TestFailingComponent&) { return false; }
+    };
+
+    namespace
+    {
+        constexpr StringView JSON_SOURCE = "{ \"entities\": [] }";
+        constexpr StringView CHANGED_JSON_SOURCE = "{ \"entities\": [ {} ] }";
+
+        Entity::ComponentFactory CreateComponentFactory()
+        {
+            Entity::ComponentFactory componentFactory;
+            componentFactory.Register<TestPodComponent>();
+            componentFactory.Register<TestNameComponent>();
+            componentFactory.Register<TestFlagComponent>();
+            componentFactory.Register<TestFailingComponent>();
+            return componentFactory;
+        }
+
+        GameCore::SectorEntity& AddSectorEntity(Entity::EntityRegistry& registry, DynamicArray<GameCore::SectorEntity>& entities)
+        {
+            GameCore::SectorEntity& sectorEntity = entities.emplace_back();
+            sectorEntity.Position = Vector3f32(1.0f, 2.0f, 3.0f);
+            sectorEntity.BoundsRadius = 4.0;
+            sectorEntity.Entity = registry.CreateEntity();
+            return sectorEntity;
+        }
+    }
+
+    TEST_CASE("Binary sector", "[gamecore][serialize]")
+    {
+        const Entity::ComponentFactory componentFactory = CreateComponentFactory();
+
+        Entity::EntityRegistry registry;
+        DynamicArray<GameCore::SectorEntity> entities;
+        const GameCore::SectorEntity& sectorEntity = AddSectorEntity(registry, entities);
+
+        TestPodComponent podComponent;
+        podComponent.Value = 0.5f;
+        podComponent.Count = 7;
+        registry.AddComponent<TestPodComponent>(sectorEntity.Entity, podComponent);
+
+        TestNameComponent nameComponent;
+        nameComponent.Name = "sector entity";
+        registry.AddComponent<TestNameComponent>(sectorEntity.Entity, nameComponent);
+        registry.AddComponent<TestFlagComponent>(sectorEntity.Entity);
+
+        const onyxU64 sourceHash = GameCore::BinarySector::GetSourceHash(JSON_SOURCE);
+        MemoryStream stream;
+        REQUIRE(GameCore::BinarySector::Serialize(registry, componentFactory, entities, sourceHash, stream));
+
+        const DynamicArray<char>& buffer = stream.GetBuffer();
+        MemoryStream readStream(buffer.data(), buffer.size());
+
+        Entity::EntityRegistry loadedRegistry;
+        DynamicArray<GameCore::SectorEntity> loadedEntities;
+
+        SECTION("Roundtrip")
+        {
+            REQUIRE(GameCore::BinarySector::Deserialize(loadedRegistry, componentFactory, sourceHash, readStream, loadedEntities));
+            REQUIRE(loadedEntities.size() == 1);
+
+            const GameCore::SectorEntity& loadedEntity = loadedEntities[0];
+            REQUIRE(loadedEntity.Position == sectorEntity.Position);
+            REQUIRE(loadedEntity.BoundsRadius == sectorEntity.BoundsRadius);
+            REQUIRE(loadedEntity.BoundsRadiusSquared == sectorEntity.BoundsRadius * sectorEntity.BoundsRadius);
+
+            const TestPodComponent& loadedPodComponent = loadedRegistry.GetComponent<TestPodComponent>(loadedEntity.Entity);
+            REQUIRE(loadedPodComponent.Value == podComponent.Value);
+            REQUIRE(loadedPodComponent.Count == podComponent.Count);
+            REQUIRE(loadedRegistry.GetComponent<TestNameComponent>(loadedEntity.Entity).Name == nameComponent.Name);
+            REQUIRE(loadedRegistry.HasComponents<TestFlagComponent>(loadedEntity.Entity));
+        }
+
+        SECTION("Binary sector of a changed json source is rejected")
+        {
+            const onyxU64 changedSourceHash = GameCore::BinarySector::GetSourceHash(CHANGED_JSON_SOURCE);
+            REQUIRE(changedSourceHash != sourceHash);
+
+            REQUIRE(GameCore::BinarySector::Deserialize(loadedRegistry, componentFactory, changedSourceHash, readStream, loadedEntities) == false);
+            REQUIRE(loadedEntities.empty());
+        }
+
+        SECTION("Binary sector with an unknown component is rejected")
+        {
+            Entity::ComponentFactory otherComponentFactory;
+            otherComponentFactory.Register<TestPodComponent>();
+
+            REQUIRE(GameCore::BinarySector::Deserialize(loadedRegistry, otherComponentFactory, sourceHash, readStream, loadedEntities) == false);
+            REQUIRE(loadedEntities.empty());
+        }
+
+        SECTION("Truncated binary sector is rejected")
+        {
+            MemoryStream truncatedStream(buffer.data(), buffer.size() - 1);
+            REQUIRE(GameCore::BinarySector::Deserialize(loadedRegistry, componentFactory, sourceHash, truncatedStream, loadedEntities) == false);
+            REQUIRE(loadedEntities.empty());
+        }
+    }
+
+    TEST_CASE("Binary sector serialization reports failing components", "[gamecore][serialize]")
+    {
+        const Entity::ComponentFactory componentFactory = CreateComponentFactory();
+
+        Entity::EntityRegistry registry;
+        DynamicArray<GameCore::SectorEntity> entities;
+        const GameCore::SectorEntity& sectorEntity = AddSectorEntity(registry, entities);
+        registry.AddComponent<TestFailingComponent>(sectorEntity.Entity);
+
+        MemoryStream stream;
+        REQUIRE(GameCore::BinarySector::Serialize(registry, componentFactory, entities, GameCore::BinarySector::GetSourceHash(JSON_SOURCE), stream) == false);
+    }
+}
@@ -0,0 +1,179 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <onyx/entity/entityregistry.h>
+#include <onyx/gamecore/components/hierarchycomponent.gen.h>
+#include <onyx/gamecore/components/idcomponent.gen.h>
+#include <onyx/gamecore/components/transformcomponent.gen.h>
+#include <onyx/gamecore/scene/transformhierarchy.h>
+
+using namespace Onyx;
+using namespace Onyx::GameCore;
+
+namespace
+{
+    // every entity gets its index + 1 as persistent id
+    Entity::EntityId CreateEntity(Entity::EntityRegistry& registry, const Vector3f32& translation, onyxU64 parentId = 0)
+    {
+        const Entity::EntityId entity = registry.CreateEntity();
+        registry.AddComponent<IdComponent>(entity).Id = static_cast<onyxU64>(entity) + 1;
+        registry.AddComponent<TransformComponent>(entity).Translation = translation;
+        if (parentId != 0)
+            registry.AddComponent<HierarchyComponent>(entity).ParentId = parentId;
+
+        return entity;
+    }
+
+    onyxU64 GetId(const Entity::EntityRegistry& registry, Entity::EntityId entity)
+    {
+        return registry.GetComponent<IdComponent>(entity).Id;
+    }
+
+    Vector3f32 GetWorldPosition(const TransformHierarchy& hierarchy, Entity::EntityId entity)
+    {
+        return Vector3f32(hierarchy.GetWorldMatrix(entity)[3]);
+    }
+
+    onyxU32 GetIndex(const TransformHierarchy& hierarchy, Entity::EntityId entity)
+    {
+        const onyxS32 index = hierarchy.GetIndex(entity);
+        REQUIRE(index != INVALID_INDEX_32);
+        return static_cast<onyxU32>(index);
+    }
+}
+
+TEST_CASE("TransformHierarchy", "[gamecore][transform]")
+{
+    Entity::EntityRegistry registry;
+
+    //    root0          root1
+    //    /   \            |
+    //  a      b           d
+    //  |
+    //  c
+    const Entity::EntityId root0 = CreateEntity(registry, Vector3f32(10.0f, 0.0f, 0.0f));
+    const Entity::EntityId a = CreateEntity(registry, Vector3f32(1.0f, 0.0f, 0.0f), GetId(registry, root0));
+    const Entity::EntityId b = CreateEntity(registry, Vector3f32(0.0f, 1.0f, 0.0f), GetId(registry, root0));
+    const Entity::EntityId c = CreateEntity(registry, Vector3f32(0.0f, 0.0f, 1.0f), GetId(registry, a));
+    const Entity::EntityId root1 = CreateEntity(registry, Vector3f32(-10.0f, 0.0f, 0.0f));
+    const Entity::EntityId d = CreateEntity(registry, Vector3f32(0.0f, 2.0f, 0.0f), GetId(registry, root1));
+
+    TransformHierarchy hierarchy;
+    hierarchy.Update(registry);
+    REQUIRE(hierarchy.GetEntityCount() == 6);
+
+    SECTION("Entities are stored depth first")
+    {
+        const DynamicArray<onyxS32>& parents = hierarchy.GetParents();
+        for (onyxU32 i = 0; i < hierarchy.GetEntityCount(); ++i)
+            REQUIRE(parents[i] < static_cast<onyxS32>(i));
+
+        REQUIRE(parents[GetIndex(hierarchy, root0)] == INVALID_INDEX_32);
+        REQUIRE(parents[GetIndex(hierarchy, root1)] == INVALID_INDEX_32);
+        REQUIRE(parents[GetIndex(hierarchy, c)] == static_cast<onyxS32>(GetIndex(hierarchy, a)));
+
+        // subtrees are contiguous ranges behind their root
+        REQUIRE(GetIndex(hierarchy, c) == GetIndex(hierarchy, a) + 1);
+        REQUIRE(GetIndex(hierarchy, d) == GetIndex(hierarchy, root1) + 1);
+        const onyxU32 root0Index = GetIndex(hierarchy, root0);
+        for (Entity::EntityId entity : { a, b, c })
+        {
+            REQUIRE(GetIndex(hierarchy, entity) > root0Index);
+            REQUIRE(GetIndex(hierarchy, entity) <= root0Index + 3);
+        }
+
+        REQUIRE(GetWorldPosition(hierarchy, c) == Vector3f32(11.0f, 0.0f, 1.0f));
+        REQUIRE(GetWorldPosition(hierarchy, d) == Vector3f32(-10.0f, 2.0f, 0.0f));
+    }
+
+    SECTION("Changes propagate to the subtree only")
+    {
+        hierarchy.Update(registry);
+        for (onyxU32 i = 0; i < hierarchy.GetEntityCount(); ++i)
+            REQUIRE(hierarchy.HasChanged(i) == false);
+
+        registry.GetComponent<TransformComponent>(a).Translation = Vector3f32(2.0f, 0.0f, 0.0f);
+        hierarchy.Update(registry);
+
+        REQUIRE(hierarchy.HasChanged(GetIndex(hierarchy, a)));
+        REQUIRE(hierarchy.HasChanged(GetIndex(hierarchy, c)));
+        REQUIRE(hierarchy.HasChanged(GetIndex(hierarchy, root0)) == false);
+        REQUIRE(hierarchy.HasChanged(GetIndex(hierarchy, b)) == false);
+        REQUIRE(hierarchy.HasChanged(GetIndex(hierarchy, d)) == false);
+        REQUIRE(GetWorldPosition(hierarchy, c) == Vector3f32(12.0f, 0.0f, 1.0f));
+    }
+
+    SECTION("Reparenting is detected without marking the structure dirty")
+    {
+        registry.GetComponent<HierarchyComponent>(c).ParentId = GetId(registry, d);
+        hierarchy.Update(registry);
+
+        REQUIRE(hierarchy.GetParents()[GetIndex(hierarchy, c)] == static_cast<onyxS32>(GetIndex(hierarchy, d)));
+        REQUIRE(GetWorldPosition(hierarchy, c) == Vector3f32(-10.0f, 2.0f, 1.0f));
+    }
+
+    SECTION("Removing the parent turns the child into a root")
+    {
+        registry.RemoveComponent<HierarchyComponent>(d);
+        hierarchy.MarkStructureDirty();
+        hierarchy.Update(registry);
+
+        REQUIRE(hierarchy.GetParents()[GetIndex(hierarchy, d)] == INVALID_INDEX_32);
+        REQUIRE(GetWorldPosition(hierarchy, d) == Vector3f32(0.0f, 2.0f, 0.0f));
+    }
+
+    SECTION("Parent cycles are broken up")
+    {
+        registry.GetComponent<HierarchyComponent>(a).ParentId = GetId(registry, c);
+        hierarchy.Update(registry);
+
+        REQUIRE(hierarchy.GetEntityCount() == 6);
+
+        const onyxS32 aParent = hierarchy.GetParents()[GetIndex(hierarchy, a)];
+        const onyxS32 cParent = hierarchy.GetParents()[GetIndex(hierarchy, c)];
+        REQUIRE(((aParent == INVALID_INDEX_32) || (cParent == INVALID_INDEX_32)));
+    }
+}
+
+TEST_CASE("TransformHierarchy updates large hierarchies in multiple jobs", "[gamecore][transform]")
+{
+    // enough entities per root subtree that the roots get split over several jobs
+    constexpr onyxU32 rootCount = 8;
+    constexpr onyxU32 childCount = 600;
+
+    Entity::EntityRegistry registry;
+    DynamicArray<Entity::EntityId> roots;
+    DynamicArray<Entity::EntityId> children;
+    for (onyxU32 i = 0; i < rootCount; ++i)
+    {
+        const Entity::EntityId root = CreateEntity(registry, Vector3f32(static_cast<onyxF32>(i) * 100.0f, 0.0f, 0.0f));
+        roots.push_back(root);
+
+        for (onyxU32 j = 0; j < childCount; ++j)
+            children.push_back(CreateEntity(registry, Vector3f32(0.0f, static_cast<onyxF32>(j), 0.0f), GetId(registry, root)));
+    }
+
+    TransformHierarchy hierarchy;
+    hierarchy.Update(registry);
+    REQUIRE(hierarchy.GetEntityCount() == rootCount * (childCount + 1));
+
+    const auto requireWorldPositions = [&]()
+    {
+        for (onyxU32 i = 0; i < rootCount; ++i)
+        {
+            const Vector3f32 rootPosition = registry.GetComponent<TransformComponent>(roots[i]).Translation;
+            for (onyxU32 j = 0; j < childCount; ++j)
+                REQUIRE(GetWorldPosition(hierarchy, children[i * childCount + j]) == rootPosition + Vector3f32(0.0f, static_cast<onyxF32>(j), 0.0f));
+        }
+    };
+
+    requireWorldPositions();
+
+    // move the first and the last root, which end up in different jobs
+    registry.GetComponent<TransformComponent>(roots.front()).Translation = Vector3f32(0.0f, 0.0f, 50.0f);
+    registry.GetComponent<TransformComponent>(roots.back()).Translation = Vector3f32(0.0f, 0.0f, -50.0f);
+    hierarchy.Update(registry);
+
+    requireWorldPositions();
+    REQUIRE(hierarchy.HasChanged(GetIndex(hierarchy, children[0])));
+    REQUIRE(hierarchy.HasChanged(GetIndex(hierarchy, children[childCount])) == false);
+}
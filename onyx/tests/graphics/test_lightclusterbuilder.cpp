@@ -0,0 +1,220 @@
+#include <catch2/catch_test_macros.hpp>
+#include <onyx/graphics/lighting/lightclusterbuilder.h>
+#include <onyx/rhi/viewconstants.h>
+
+#include <random>
+
+using namespace Onyx;
+using namespace Onyx::Graphics;
+
+namespace
+{
+    // camera at the origin looking down -z, same projection as the perspective camera
+    ViewConstants MakeViewConstants()
+    {
+        constexpr onyxF32 nearPlane = 0.1f;
+        constexpr onyxF32 farPlane = 100.0f;
+        constexpr onyxF32 width = 1600.0f;
+        constexpr onyxF32 height = 900.0f;
+
+        const onyxF32 h = 1.0f / std::tan(0.5f * (60.0f * std::numbers::pi_v<onyxF32> / 180.0f));
+
+        Matrix4<onyxF32> projection(0.0f);
+        projection[0][0] = h * height / width;
+        projection[1][1] = h;
+        projection[2][2] = farPlane / (nearPlane - farPlane);
+        projection[2][3] = -1.0f;
+        projection[3][2] = -(farPlane * nearPlane) / (farPlane - nearPlane);
+
+        ViewConstants viewConstants;
+        viewConstants.ProjectionMatrix = projection;
+        viewConstants.InverseProjectionMatrix = projection.Inverse();
+        viewConstants.ViewMatrix = Matrix4<onyxF32>();
+        viewConstants.Viewport = Vector2f32(width, height);
+        viewConstants.Near = nearPlane;
+        viewConstants.Far = farPlane;
+        return viewConstants;
+    }
+
+    PointLight MakePointLight(const Vector3f32& position, onyxF32 radius)
+    {
+        PointLight light;
+        light.Position = position;
+        light.Radius = radius;
+        light.IsEnabled = 1;
+        return light;
+    }
+
+    bool IsSphereOverlappingCluster(const LightClusterAABB& cluster, const Vector3f32& center, onyxF32 radius)
+    {
+        onyxF32 distanceSquared = 0.0f;
+        for (onyxU32 axis = 0; axis < 3; ++axis)
+        {
+            const onyxF32 distance = std::max({ cluster.Min[axis] - center[axis], center[axis] - cluster.Max[axis], 0.0f });
+            distanceSquared += distance * distance;
+        }
+
+        return distanceSquared <= radius * radius;
+    }
+
+    DynamicArray<onyxU32> GetPointLights(const LightClusterBuilder& builder, onyxU32 clusterIndex)
+    {
+        const LightGridCell& cell = builder.GetLightGrid()[clusterIndex];
+        DynamicArray<onyxU32> lights;
+        for (onyxU32 i = 0; i < cell.PointLightCount; ++i)
+            lights.push_back(builder.GetLightIndices()[cell.PointLightOffset + i].PointLightIndex);
+
+        return lights;
+    }
+}
+
+TEST_CASE("Light cluster builder", "[Lighting]")
+{
+    const ViewConstants viewConstants = MakeViewConstants();
+
+    LightClusterSettings settings;
+    settings.UseWorkerThreads = false;
+    LightClusterBuilder builder(settings);
+
+    SECTION("Point lights match a brute force sphere test")
+    {
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<onyxF32> screen(-0.9f, 0.9f);
+        std::uniform_real_distribution<onyxF32> depth(1.0f, 80.0f);
+        std::uniform_real_distribution<onyxF32> radius(0.5f, 6.0f);
+
+        // centers inside of the frustum are never culled, so every overlapping cluster has to get the light
+        DynamicArray<PointLight> lights;
+        for (onyxU32 i = 0; i < 64; ++i)
+        {
+            const onyxF32 lightDepth = depth(generator);
+            const Vector3f32 position(screen(generator) * lightDepth, screen(generator) * lightDepth * 0.5f, -lightDepth);
+            lights.push_back(MakePointLight(position, radius(generator)));
+        }
+
+        builder.Build(viewConstants, Span<const PointLight>(lights.data(), lights.size()), Span<const SpotLight>());
+
+        for (onyxU32 clusterIndex = 0; clusterIndex < builder.GetClusterCount(); ++clusterIndex)
+        {
+            DynamicArray<onyxU32> expected;
+            for (onyxU32 lightIndex = 0; lightIndex < lights.size(); ++lightIndex)
+            {
+                if (IsSphereOverlappingCluster(builder.GetClusterBounds()[clusterIndex], lights[lightIndex].Position, lights[lightIndex].Radius))
+                    expected.push_back(lightIndex);
+            }
+
+            REQUIRE(GetPointLights(builder, clusterIndex) == expected);
+        }
+    }
+
+    SECTION("Lights outside of the frustum are culled")
+    {
+        DynamicArray<PointLight> lights;
+        lights.push_back(MakePointLight(Vector3f32(0.0f, 0.0f, 10.0f), 1.0f)); // behind the camera
+        lights.push_back(MakePointLight(Vector3f32(200.0f, 0.0f, -10.0f), 1.0f)); // right of the frustum
+        lights.push_back(MakePointLight(Vector3f32(0.0f, 0.0f, -150.0f), 1.0f)); // past the far plane
+        lights.push_back(MakePointLight(Vector3f32(0.0f, 0.0f, -10.0f), 1.0f));
+        lights[3].IsEnabled = 0;
+
+        builder.Build(viewConstants, Span<const PointLight>(lights.data(), lights.size()), Span<const SpotLight>());
+        REQUIRE(builder.GetVisiblePointLightCount() == 0);
+        REQUIRE(builder.GetLightIndices().empty());
+        for (const LightGridCell& cell : builder.GetLightGrid())
+            REQUIRE(cell.PointLightCount == 0);
+    }
+
+    SECTION("Spot lights only reach the clusters in front of them")
+    {
+        SpotLight spotLight;
+        spotLight.Position = Vector3f32(0.0f, 0.0f, -10.0f);
+        spotLight.Direction = Vector3f32(0.0f, 0.0f, -1.0f);
+        spotLight.Range = 20.0f;
+        spotLight.Angle = 30.0f;
+
+        builder.Build(viewConstants, Span<const PointLight>(), Span<const SpotLight>(&spotLight, 1));
+        REQUIRE(builder.GetVisibleSpotLightCount() == 1);
+
+        onyxU32 litClusters = 0;
+        for (onyxU32 clusterIndex = 0; clusterIndex < builder.GetClusterCount(); ++clusterIndex)
+        {
+            const LightGridCell& cell = builder.GetLightGrid()[clusterIndex];
+            if (cell.SpotLightCount == 0)
+                continue;
+
+            ++litClusters;
+            REQUIRE(builder.GetLightIndices()[cell.SpotLightOffset].SpotLightIndex == 0);
+
+            // nothing between the camera and the light
+            const LightClusterAABB& bounds = builder.GetClusterBounds()[clusterIndex];
+            REQUIRE(bounds.Min[2] < -5.0f);
+        }
+
+        REQUIRE(litClusters > 0);
+    }
+
+    SECTION("Light count per cluster is clamped")
+    {
+        LightClusterSettings clampedSettings = settings;
+        clampedSettings.MaxLightsPerCluster = 4;
+        LightClusterBuilder clampedBuilder(clampedSettings);
+
+        DynamicArray<PointLight> lights(10, MakePointLight(Vector3f32(0.0f, 0.0f, -10.0f), 2.0f));
+        clampedBuilder.Build(viewConstants, Span<const PointLight>(lights.data(), lights.size()), Span<const SpotLight>());
+
+        onyxU32 totalCount = 0;
+        for (const LightGridCell& cell : clampedBuilder.GetLightGrid())
+        {
+            REQUIRE(cell.PointLightCount <= 4);
+            totalCount += cell.PointLightCount;
+        }
+
+        REQUIRE(totalCount > 0);
+        REQUIRE(clampedBuilder.GetLightIndices().size() == totalCount);
+    }
+
+    SECTION("Worker threads produce the same result")
+    {
+        std::mt19937 generator(7);
+        std::uniform_real_distribution<onyxF32> position(-20.0f, 20.0f);
+        std::uniform_real_distribution<onyxF32> depth(-60.0f, -1.0f);
+
+        DynamicArray<PointLight> pointLights;
+        DynamicArray<SpotLight> spotLights;
+        for (onyxU32 i = 0; i < 64; ++i)
+        {
+            pointLights.push_back(MakePointLight(Vector3f32(position(generator), position(generator), depth(generator)), 4.0f));
+
+            SpotLight spotLight;
+            spotLight.Position = Vector3f32(position(generator), position(generator), depth(generator));
+            spotLight.Direction = Vector3f32(position(generator), position(generator), position(generator)).Normalized();
+            spotLight.Range = 10.0f;
+            spotLight.Angle = 45.0f;
+            spotLights.push_back(spotLight);
+        }
+
+        LightClusterSettings threadedSettings = settings;
+        threadedSettings.UseWorkerThreads = true;
+        threadedSettings.MinLightsForWorkerThreads = 0;
+        LightClusterBuilder threadedBuilder(threadedSettings);
+
+        builder.Build(viewConstants, Span<const PointLight>(pointLights.data(), pointLights.size()), Span<const SpotLight>(spotLights.data(), spotLights.size()));
+        threadedBuilder.Build(viewConstants, Span<const PointLight>(pointLights.data(), pointLights.size()), Span<const SpotLight>(spotLights.data(), spotLights.size()));
+
+        REQUIRE(builder.GetLightIndices().size() == threadedBuilder.GetLightIndices().size());
+        for (onyxU32 clusterIndex = 0; clusterIndex < builder.GetClusterCount(); ++clusterIndex)
+        {
+            const LightGridCell& cell = builder.GetLightGrid()[clusterIndex];
+            const LightGridCell& threadedCell = threadedBuilder.GetLightGrid()[clusterIndex];
+            REQUIRE(cell.PointLightOffset == threadedCell.PointLightOffset);
+            REQUIRE(cell.PointLightCount == threadedCell.PointLightCount);
+            REQUIRE(cell.SpotLightOffset == threadedCell.SpotLightOffset);
+            REQUIRE(cell.SpotLightCount == threadedCell.SpotLightCount);
+        }
+
+        for (onyxU64 i = 0; i < builder.GetLightIndices().size(); ++i)
+        {
+            REQUIRE(builder.GetLightIndices()[i].PointLightIndex == threadedBuilder.GetLightIndices()[i].PointLightIndex);
+            REQUIRE(builder.GetLightIndices()[i].SpotLightIndex == threadedBuilder.GetLightIndices()[i].SpotLightIndex);
+        }
+    }
+}
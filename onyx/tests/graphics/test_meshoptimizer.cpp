@@ -0,0 +1,226 @@
+#include <catch2/catch_test_macros.hpp>
+#include <onyx/graphics/mesh/cookedmesh.h>
+#include <onyx/graphics/mesh/objmeshimporter.h>
+#include <onyx/stream/memorystream.h>
+
+#include <algorithm>
+#include <random>
+
+using namespace Onyx;
+using namespace Onyx::Graphics;
+
+namespace
+{
+    constexpr onyxU32 GRID_SIZE = 32;
+
+    IndexedMesh CreateGrid(onyxU32 size)
+    {
+        IndexedMesh mesh;
+        for (onyxU32 y = 0; y <= size; ++y)
+        {
+            for (onyxU32 x = 0; x <= size; ++x)
+            {
+                Vertex& vertex = mesh.Vertices.emplace_back();
+                vertex.Position = Vector3f32(static_cast<onyxF32>(x), static_cast<onyxF32>(y), 0.0f);
+                vertex.Normal = Vector3f32(0.0f, 0.0f, 1.0f);
+            }
+        }
+
+        for (onyxU32 y = 0; y < size; ++y)
+        {
+            for (onyxU32 x = 0; x < size; ++x)
+            {
+                const onyxU32 corner = y * (size + 1) + x;
+                mesh.Indices.insert(mesh.Indices.end(), { corner, corner + 1, corner + size + 2 });
+                mesh.Indices.insert(mesh.Indices.end(), { corner, corner + size + 2, corner + size + 1 });
+            }
+        }
+
+        return mesh;
+    }
+
+    void ShuffleTriangles(DynamicArray<onyxU32>& indices)
+    {
+        const onyxU64 triangleCount = indices.size() / 3;
+        DynamicArray<onyxU64> order(triangleCount);
+        for (onyxU64 i = 0; i < triangleCount; ++i)
+            order[i] = i;
+
+        std::mt19937 engine(1337);
+        std::shuffle(order.begin(), order.end(), engine);
+
+        DynamicArray<onyxU32> shuffled;
+        shuffled.reserve(indices.size());
+        for (onyxU64 triangle : order)
+            shuffled.insert(shuffled.end(), { indices[triangle * 3], indices[triangle * 3 + 1], indices[triangle * 3 + 2] });
+
+        indices = std::move(shuffled);
+    }
+
+    // triangles as sorted position triplets, independent of triangle order, corner rotation and vertex order
+    DynamicArray<Array<onyxU64, 3>> GetSortedTriangles(const DynamicArray<Vertex>& vertices, const DynamicArray<onyxU32>& indices)
+    {
+        DynamicArray<Array<onyxU64, 3>> triangles;
+        for (onyxU64 i = 0; i < indices.size(); i += 3)
+        {
+            Array<onyxU64, 3> triangle;
+            for (onyxU64 corner = 0; corner < 3; ++corner)
+            {
+                const Vector3f32& position = vertices[indices[i + corner]].Position;
+                triangle[corner] = static_cast<onyxU64>(position.X) * 1000 + static_cast<onyxU64>(position.Y);
+            }
+
+            std::sort(triangle.begin(), triangle.end());
+            triangles.push_back(triangle);
+        }
+
+        std::sort(triangles.begin(), triangles.end());
+        return triangles;
+    }
+}
+
+TEST_CASE("MeshOptimizer", "[graphics][mesh]")
+{
+    IndexedMesh mesh = CreateGrid(GRID_SIZE);
+    ShuffleTriangles(mesh.Indices);
+    const DynamicArray<Array<onyxU64, 3>> sourceTriangles = GetSortedTriangles(mesh.Vertices, mesh.Indices);
+    const onyxU32 vertexCount = static_cast<onyxU32>(mesh.Vertices.size());
+
+    SECTION("Vertex cache optimization keeps the triangles and reduces cache misses")
+    {
+        const onyxF32 shuffledMissRatio = MeshOptimizer::GetAverageCacheMissRatio(mesh.Indices, vertexCount);
+
+        MeshOptimizer::OptimizeVertexCache(mesh.Indices, vertexCount);
+        const onyxF32 optimizedMissRatio = MeshOptimizer::GetAverageCacheMissRatio(mesh.Indices, vertexCount);
+
+        REQUIRE(GetSortedTriangles(mesh.Vertices, mesh.Indices) == sourceTriangles);
+        REQUIRE(optimizedMissRatio < shuffledMissRatio);
+        REQUIRE(optimizedMissRatio < 1.0f);
+    }
+
+    SECTION("Vertex fetch optimization orders vertices by first use and drops unused ones")
+    {
+        Vertex& unused = mesh.Vertices.emplace_back();
+        unused.Position = Vector3f32(-1.0f, -1.0f, 0.0f);
+
+        MeshOptimizer::OptimizeVertexFetch(mesh.Vertices, mesh.Indices);
+
+        REQUIRE(mesh.Vertices.size() == vertexCount);
+        REQUIRE(GetSortedTriangles(mesh.Vertices, mesh.Indices) == sourceTriangles);
+
+        onyxU32 nextNewIndex = 0;
+        for (onyxU32 index : mesh.Indices)
+        {
+            REQUIRE(index <= nextNewIndex);
+            if (index == nextNewIndex)
+                ++nextNewIndex;
+        }
+        REQUIRE(nextNewIndex == vertexCount);
+    }
+
+    SECTION("Meshlets cover every triangle within the limits")
+    {
+        constexpr onyxU32 maxVertices = 32;
+        constexpr onyxU32 maxTriangles = 40;
+
+        MeshOptimizer::OptimizeVertexCache(mesh.Indices, vertexCount);
+
+        MeshletBuildResult result;
+        MeshOptimizer::BuildMeshlets(mesh.Vertices, mesh.Indices, result, maxVertices, maxTriangles);
+        REQUIRE(result.Meshlets.size() > 1);
+
+        DynamicArray<onyxU32> meshletIndices;
+        for (const Meshlet& meshlet : result.Meshlets)
+        {
+            REQUIRE(meshlet.VertexCount > 0);
+            REQUIRE(meshlet.VertexCount <= maxVertices);
+            REQUIRE(meshlet.TriangleCount > 0);
+            REQUIRE(meshlet.TriangleCount <= maxTriangles);
+
+            for (onyxU32 i = 0; i < meshlet.VertexCount; ++i)
+            {
+                const Vector3f32& position = mesh.Vertices[result.MeshletVertices[meshlet.VertexOffset + i]].Position;
+                REQUIRE((position - meshlet.BoundsCenter).Length() <= meshlet.BoundsRadius + 0.001f);
+            }
+
+            for (onyxU32 i = 0; i < meshlet.TriangleCount * 3; ++i)
+            {
+                const onyxU8 localIndex = result.MeshletTriangles[meshlet.TriangleOffset + i];
+                REQUIRE(localIndex < meshlet.VertexCount);
+                meshletIndices.push_back(result.MeshletVertices[meshlet.VertexOffset + localIndex]);
+            }
+        }
+
+        REQUIRE(GetSortedTriangles(mesh.Vertices, meshletIndices) == sourceTriangles);
+    }
+}
+
+TEST_CASE("CookedMesh", "[graphics][mesh]")
+{
+    CookedMesh cookedMesh;
+    CookedMesh::Cook(CreateGrid(GRID_SIZE), cookedMesh);
+    REQUIRE(cookedMesh.Indices.size() == GRID_SIZE * GRID_SIZE * 6);
+    REQUIRE(cookedMesh.Meshlets.Meshlets.empty() == false);
+
+    SECTION("Serialization roundtrip")
+    {
+        MemoryStream stream;
+        cookedMesh.Serialize(stream);
+
+        const DynamicArray<char>& buffer = stream.GetBuffer();
+        MemoryStream readStream(buffer.data(), buffer.size());
+
+        CookedMesh loadedMesh;
+        REQUIRE(loadedMesh.Deserialize(readStream));
+        REQUIRE(loadedMesh.Indices == cookedMesh.Indices);
+        REQUIRE(loadedMesh.Vertices.size() == cookedMesh.Vertices.size());
+        REQUIRE(loadedMesh.Meshlets.Meshlets.size() == cookedMesh.Meshlets.Meshlets.size());
+        REQUIRE(loadedMesh.Meshlets.MeshletVertices == cookedMesh.Meshlets.MeshletVertices);
+        REQUIRE(loadedMesh.Meshlets.MeshletTriangles == cookedMesh.Meshlets.MeshletTriangles);
+        for (onyxU64 i = 0; i < cookedMesh.Vertices.size(); ++i)
+            REQUIRE(loadedMesh.Vertices[i].Position == cookedMesh.Vertices[i].Position);
+    }
+
+    SECTION("Truncated data is rejected")
+    {
+        MemoryStream stream;
+        cookedMesh.Serialize(stream);
+
+        const DynamicArray<char>& buffer = stream.GetBuffer();
+        MemoryStream readStream(buffer.data(), buffer.size() / 2);
+
+        CookedMesh loadedMesh;
+        REQUIRE(loadedMesh.Deserialize(readStream) == false);
+
+        MemoryStream headerOnlyStream(buffer.data(), sizeof(CookedMesh::MAGIC) + sizeof(CookedMesh::VERSION) + 4);
+        REQUIRE(loadedMesh.Deserialize(headerOnlyStream) == false);
+    }
+
+    SECTION("Out of range indices are rejected")
+    {
+        CookedMesh brokenMesh = cookedMesh;
+        brokenMesh.Indices.back() = static_cast<onyxU32>(brokenMesh.Vertices.size());
+
+        MemoryStream stream;
+        brokenMesh.Serialize(stream);
+        const DynamicArray<char>& buffer = stream.GetBuffer();
+        MemoryStream readStream(buffer.data(), buffer.size());
+
+        CookedMesh loadedMesh;
+        REQUIRE(loadedMesh.Deserialize(readStream) == false);
+    }
+
+    SECTION("Out of range meshlets are rejected")
+    {
+        CookedMesh brokenMesh = cookedMesh;
+        brokenMesh.Meshlets.Meshlets.back().TriangleOffset = static_cast<onyxU32>(brokenMesh.Meshlets.MeshletTriangles.size());
+
+        MemoryStream stream;
+        brokenMesh.Serialize(stream);
+        const DynamicArray<char>& buffer = stream.GetBuffer();
+        MemoryStream readStream(buffer.data(), buffer.size());
+
+        CookedMesh loadedMesh;
+        REQUIRE(loadedMesh.Deserialize(readStream) == false);
+    }
+}
@@ -0,0 +1,162 @@
+#include <catch2/catch_test_macros.hpp>
+#include <onyx/graphics/culling/meshvisibility.h>
+#include <onyx/rhi/viewconstants.h>
+
+#include <random>
+
+using namespace Onyx;
+using namespace Onyx::Graphics;
+
+namespace
+{
+    // camera at the origin looking down -z, same projection as the perspective camera
+    ViewConstants MakeViewConstants()
+    {
+        constexpr onyxF32 nearPlane = 0.1f;
+        constexpr onyxF32 farPlane = 100.0f;
+
+        const onyxF32 h = 1.0f / std::tan(0.5f * (60.0f * std::numbers::pi_v<onyxF32> / 180.0f));
+
+        Matrix4<onyxF32> projection(0.0f);
+        projection[0][0] = h;
+        projection[1][1] = h;
+        projection[2][2] = farPlane / (nearPlane - farPlane);
+        projection[2][3] = -1.0f;
+        projection[3][2] = -(farPlane * nearPlane) / (farPlane - nearPlane);
+
+        ViewConstants viewConstants;
+        viewConstants.ProjectionMatrix = projection;
+        viewConstants.ViewMatrix = Matrix4<onyxF32>();
+        viewConstants.ViewProjectionMatrix = projection;
+        viewConstants.Viewport = Vector2f32(1.0f, 1.0f);
+        viewConstants.Near = nearPlane;
+        viewConstants.Far = farPlane;
+        return viewConstants;
+    }
+
+    MeshBounds MakeBounds(const Vector3f32& center, onyxF32 halfSize)
+    {
+        return { center - Vector3f32(halfSize), center + Vector3f32(halfSize) };
+    }
+}
+
+TEST_CASE("Mesh visibility", "[Culling]")
+{
+    const ViewConstants viewConstants = MakeViewConstants();
+    MeshVisibility visibility;
+
+    SECTION("Draws outside of the frustum are culled")
+    {
+        visibility.AddDraw(MakeBounds(Vector3f32(0.0f, 0.0f, -10.0f), 1.0f), 0, 0, 0);
+        visibility.AddDraw(MakeBounds(Vector3f32(0.0f, 0.0f, 10.0f), 1.0f), 0, 0, 0); // behind the camera
+        visibility.AddDraw(MakeBounds(Vector3f32(50.0f, 0.0f, -10.0f), 1.0f), 0, 0, 0); // right of the frustum
+        visibility.AddDraw(MakeBounds(Vector3f32(0.0f, -50.0f, -10.0f), 1.0f), 0, 0, 0); // below the frustum
+        visibility.AddDraw(MakeBounds(Vector3f32(0.0f, 0.0f, -150.0f), 1.0f), 0, 0, 0); // past the far plane
+        visibility.AddDraw(MakeBounds(Vector3f32(6.5f, 0.0f, -10.0f), 1.0f), 0, 0, 0); // partially inside
+
+        visibility.Build(viewConstants);
+
+        const DynamicArray<onyxU32> expectedDraws{ 0, 5 };
+        REQUIRE(visibility.GetVisibleDraws() == expectedDraws);
+    }
+
+    SECTION("Visible draws are sorted by state and front to back")
+    {
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<onyxF32> depth(1.0f, 90.0f);
+        std::uniform_int_distribution<onyxU32> id(0, 3);
+
+        for (onyxU32 i = 0; i < 1000; ++i)
+            visibility.AddDraw(MakeBounds(Vector3f32(0.0f, 0.0f, -depth(generator)), 0.5f), id(generator), id(generator), id(generator));
+
+        visibility.Build(viewConstants);
+
+        const DynamicArray<onyxU32>& visibleDraws = visibility.GetVisibleDraws();
+        const DynamicArray<onyxU64>& sortKeys = visibility.GetSortKeys();
+        REQUIRE(visibleDraws.size() == 1000);
+        REQUIRE(std::ranges::is_sorted(sortKeys));
+
+        DynamicArray<onyxU32> sortedDraws = visibleDraws;
+        std::ranges::sort(sortedDraws);
+        for (onyxU32 i = 0; i < sortedDraws.size(); ++i)
+            REQUIRE(sortedDraws[i] == i);
+
+        // same key means same pipeline, material and mesh, so each combination ends up in exactly one batch
+        onyxU32 batchedDraws = 0;
+        HashSet<onyxU64> batchStates;
+        for (const MeshDrawBatch& batch : visibility.GetBatches())
+        {
+            REQUIRE(batch.FirstDraw == batchedDraws);
+            batchedDraws += batch.DrawCount;
+
+            const onyxU64 state = sortKeys[batch.FirstDraw] >> MeshVisibility::DEPTH_BITS;
+            REQUIRE(batchStates.insert(state).second);
+            REQUIRE((sortKeys[batch.FirstDraw + batch.DrawCount - 1] >> MeshVisibility::DEPTH_BITS) == state);
+        }
+
+        REQUIRE(batchedDraws == visibleDraws.size());
+        REQUIRE(visibility.GetBatches().size() <= 64);
+    }
+
+    SECTION("Equal keys keep their order")
+    {
+        for (onyxU32 i = 0; i < 10; ++i)
+            visibility.AddDraw(MakeBounds(Vector3f32(0.0f, 0.0f, -10.0f), 1.0f), 1, 2, 3);
+
+        visibility.Build(viewConstants);
+
+        const DynamicArray<onyxU32> expectedDraws{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+        REQUIRE(visibility.GetVisibleDraws() == expectedDraws);
+        REQUIRE(visibility.GetBatches().size() == 1);
+        REQUIRE(visibility.GetBatches()[0].DrawCount == 10);
+    }
+
+    SECTION("Default bounds are never culled")
+    {
+        Matrix4<onyxF32> transform;
+        transform[3] = Vector4f32(0.0f, 0.0f, 500.0f, 1.0f);
+
+        const MeshBounds bounds;
+        REQUIRE(bounds.IsInfinite());
+        REQUIRE(bounds.Transform(transform).IsInfinite());
+
+        visibility.AddDraw(bounds, 0, 0, 0);
+        visibility.AddDraw(bounds.Transform(transform), 0, 0, 0);
+        visibility.AddDraw(MakeBounds(Vector3f32(0.0f, 0.0f, 10.0f), 1.0f), 0, 0, 0); // behind the camera
+
+        visibility.Build(viewConstants);
+
+        const DynamicArray<onyxU32> expectedDraws{ 0, 1 };
+        REQUIRE(visibility.GetVisibleDraws() == expectedDraws);
+    }
+
+    SECTION("Transformed bounds contain the transformed corners")
+    {
+        const MeshBounds bounds{ Vector3f32(-1.0f, -2.0f, -3.0f), Vector3f32(1.0f, 2.0f, 3.0f) };
+
+        Matrix4<onyxF32> transform;
+        const onyxF32 angle = std::numbers::pi_v<onyxF32> * 0.25f;
+        transform[0][0] = std::cos(angle);
+        transform[0][1] = std::sin(angle);
+        transform[1][0] = -std::sin(angle);
+        transform[1][1] = std::cos(angle);
+        transform[3] = Vector4f32(5.0f, 0.0f, -1.0f, 1.0f);
+
+        const MeshBounds transformedBounds = bounds.Transform(transform);
+        for (onyxU32 corner = 0; corner < 8; ++corner)
+        {
+            const Vector4f32 position(
+                (corner & 1) ? bounds.Max[0] : bounds.Min[0],
+                (corner & 2) ? bounds.Max[1] : bounds.Min[1],
+                (corner & 4) ? bounds.Max[2] : bounds.Min[2],
+                1.0f);
+
+            const Vector3f32 transformedPosition(transform * position);
+            for (onyxU32 axis = 0; axis < 3; ++axis)
+            {
+                REQUIRE(transformedPosition[axis] >= transformedBounds.Min[axis] - 1e-4f);
+                REQUIRE(transformedPosition[axis] <= transformedBounds.Max[axis] + 1e-4f);
+            }
+        }
+    }
+}
@@ -0,0 +1,93 @@
+#include <catch2/catch_test_macros.hpp>
+#include <onyx/rhi/null/graphicsapi.h>
+#include <onyx/rhi/framecontext.h>
+#include <onyx/rhi/graphicsettings.h>
+#include <onyx/time.h>
+
+using namespace Onyx;
+using namespace Onyx::Graphics;
+
+namespace
+{
+    constexpr onyxU16 REFRESH_RATE = 50;
+    constexpr onyxU64 TARGET_FRAME_TIME = 1'000'000'000ull / REFRESH_RATE;
+
+    void RenderFrame(Null::NullGraphicsApi& api, FrameContext& context, onyxU32 dispatchCount)
+    {
+        REQUIRE(api.BeginFrame(context));
+
+        CommandBuffer& commandBuffer = api.GetComputeCommandBuffer(context.FrameIndex, true);
+        for (onyxU32 i = 0; i < dispatchCount; ++i)
+            commandBuffer.Dispatch(2, 2, 1);
+        commandBuffer.End();
+
+        REQUIRE(api.EndFrame(context));
+
+        ++context.AbsoluteFrame;
+        context.FrameIndex = (context.FrameIndex + 1) % MAX_FRAMES_IN_FLIGHT;
+    }
+}
+
+TEST_CASE("Null graphics api frames", "[Graphics][Null]")
+{
+    GraphicSettings settings;
+    settings.Api = ApiType::Null;
+    settings.RefreshRate = 0;
+
+    Null::NullGraphicsApi api;
+    api.Init(settings);
+
+    FrameContext context;
+
+    SECTION("Commands are counted per frame")
+    {
+        RenderFrame(api, context, 3);
+
+        const Null::FrameStatistics& firstFrame = api.GetLastFrameStatistics();
+        REQUIRE(firstFrame.AbsoluteFrame == 0);
+        REQUIRE(firstFrame.CommandBuffers == 1);
+        REQUIRE(firstFrame.ComputeCommands.Get(Null::CommandType::Dispatch) == 3);
+        REQUIRE(firstFrame.ComputeCommands.ThreadGroups == 12);
+        REQUIRE(firstFrame.GraphicsCommands.GetTotal() == 0);
+
+        RenderFrame(api, context, 1);
+
+        const Null::FrameStatistics& secondFrame = api.GetLastFrameStatistics();
+        REQUIRE(secondFrame.AbsoluteFrame == 1);
+        REQUIRE(secondFrame.CommandBuffers == 1);
+        REQUIRE(secondFrame.ComputeCommands.Get(Null::CommandType::Dispatch) == 1);
+    }
+
+    SECTION("Instant submits are part of the current frame")
+    {
+        REQUIRE(api.BeginFrame(context));
+        api.SubmitInstantCommandBuffer(Context::Graphics, context.FrameIndex, [](CommandBuffer& commandBuffer)
+        {
+            commandBuffer.Draw(PrimitiveTopology::Triangle, 0, 3, 0, 2);
+        });
+        REQUIRE(api.EndFrame(context));
+
+        const Null::FrameStatistics& frame = api.GetLastFrameStatistics();
+        REQUIRE(frame.InstantSubmits == 1);
+        REQUIRE(frame.GraphicsCommands.Get(Null::CommandType::Draw) == 1);
+        REQUIRE(frame.GraphicsCommands.Vertices == 6);
+        REQUIRE(frame.GraphicsCommands.Instances == 2);
+    }
+
+    SECTION("Frames are paced to the refresh rate")
+    {
+        api.SetRefreshRate(REFRESH_RATE);
+
+        const onyxU64 start = Time::GetCurrentNanoseconds();
+        RenderFrame(api, context, 0);
+        RenderFrame(api, context, 0);
+        RenderFrame(api, context, 0);
+        const onyxU64 elapsed = Time::GetCurrentNanoseconds() - start;
+
+        // the first frame starts right away, every following one waits for the previous frame time
+        REQUIRE(elapsed >= 2 * TARGET_FRAME_TIME);
+        REQUIRE(api.GetLastFrameStatistics().PacingNanoseconds > 0);
+    }
+
+    api.Shutdown();
+}
@@ -0,0 +1,171 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <onyx/graphics/mesh/objmeshimporter.h>
+
+using namespace Onyx;
+using namespace Onyx::Graphics;
+
+namespace
+{
+    const DynamicArray<onyxU32> TRIANGLE_INDICES{ 0, 1, 2 };
+
+    ObjImportOptions GetSequentialOptions()
+    {
+        ObjImportOptions options;
+        options.ParallelParseThreshold = onyxMax_U64;
+        return options;
+    }
+
+    // grid of quads in the xy plane, the last uv index of every face is relative so both index kinds cross chunk boundaries
+    String CreateGridSource(onyxU32 size)
+    {
+        String source;
+        source.reserve(static_cast<onyxU64>(size) * size * 96);
+        for (onyxU32 y = 0; y <= size; ++y)
+        {
+            for (onyxU32 x = 0; x <= size; ++x)
+                source += "v " + std::to_string(x) + " " + std::to_string(y) + " 0\nvt 0.5 0.25\n";
+        }
+
+        const onyxS32 vertexCount = static_cast<onyxS32>((size + 1) * (size + 1));
+        for (onyxU32 y = 0; y < size; ++y)
+        {
+            for (onyxU32 x = 0; x < size; ++x)
+            {
+                const onyxS32 corner = static_cast<onyxS32>(y * (size + 1) + x) + 1;
+                source += "f " + std::to_string(corner) + "/" + std::to_string(corner) + " " +
+                          std::to_string(corner + 1) + "/" + std::to_string(corner + 1) + " " +
+                          std::to_string(corner + size + 2) + "/" + std::to_string(corner + size + 2) + " " +
+                          std::to_string(corner + size + 1) + "/" + std::to_string(-(vertexCount - static_cast<onyxS32>(corner + size + 1) + 1)) + "\n";
+            }
+        }
+
+        return source;
+    }
+}
+
+TEST_CASE("ObjMeshImporter", "[graphics][mesh]")
+{
+    const ObjImportOptions options = GetSequentialOptions();
+
+    SECTION("Triangle with all attributes")
+    {
+        constexpr StringView source =
+            "# triangle\n"
+            "o triangle\n"
+            "v 0 0 0\n"
+            "v 1 0 0\n"
+            "v 0 1 0\n"
+            "vt 0 0\n"
+            "vt 1 0\n"
+            "vt 0 1\n"
+            "vn 0 0 1\n"
+            "f 1/1/1 2/2/1 3/3/1\n";
+
+        IndexedMesh mesh;
+        REQUIRE(ObjMeshImporter::Import(source, mesh, options));
+        REQUIRE(mesh.Vertices.size() == 3);
+        REQUIRE(mesh.Indices == TRIANGLE_INDICES);
+        REQUIRE(mesh.Vertices[1].Position == Vector3f32(1.0f, 0.0f, 0.0f));
+        REQUIRE(mesh.Vertices[2].UV == Vector2f32(0.0f, 1.0f));
+        REQUIRE(mesh.Vertices[0].Normal == Vector3f32(0.0f, 0.0f, 1.0f));
+    }
+
+    SECTION("Polygons are triangulated as fan and shared corners are deduplicated")
+    {
+        constexpr StringView source =
+            "v 0 0 0\n"
+            "v 1 0 0\n"
+            "v 1 1 0\n"
+            "v 0 1 0\n"
+            "f 1 2 3 4\n";
+
+        IndexedMesh mesh;
+        REQUIRE(ObjMeshImporter::Import(source, mesh, options));
+        REQUIRE(mesh.Vertices.size() == 4);
+        const DynamicArray<onyxU32> expectedIndices{ 0, 1, 2, 0, 2, 3 };
+        REQUIRE(mesh.Indices == expectedIndices);
+    }
+
+    SECTION("Relative indices reference the last elements")
+    {
+        constexpr StringView source =
+            "v 0 0 0\n"
+            "v 1 0 0\n"
+            "v 0 1 0\n"
+            "f -3 -2 -1\n";
+
+        IndexedMesh mesh;
+        REQUIRE(ObjMeshImporter::Import(source, mesh, options));
+        REQUIRE(mesh.Indices == TRIANGLE_INDICES);
+        REQUIRE(mesh.Vertices[2].Position == Vector3f32(0.0f, 1.0f, 0.0f));
+    }
+
+    SECTION("Texture coordinates with one to three components")
+    {
+        constexpr StringView source =
+            "v 0 0 0\n"
+            "v 1 0 0\n"
+            "v 0 1 0\n"
+            "vt 0.25\n"
+            "vt 0.5 0.75\n"
+            "vt 1 0.5 0.125\n"
+            "f 1/1 2/2 3/3\n";
+
+        IndexedMesh mesh;
+        REQUIRE(ObjMeshImporter::Import(source, mesh, options));
+        REQUIRE(mesh.Vertices[0].UV == Vector2f32(0.25f, 0.0f));
+        REQUIRE(mesh.Vertices[1].UV == Vector2f32(0.5f, 0.75f));
+        REQUIRE(mesh.Vertices[2].UV == Vector2f32(1.0f, 0.5f));
+    }
+
+    SECTION("Missing normals are generated")
+    {
+        constexpr StringView source =
+            "v 0 0 0\n"
+            "v 2 0 0\n"
+            "v 0 2 0\n"
+            "f 1 2 3\n";
+
+        IndexedMesh mesh;
+        REQUIRE(ObjMeshImporter::Import(source, mesh, options));
+        for (const Vertex& vertex : mesh.Vertices)
+            REQUIRE(vertex.Normal == Vector3f32(0.0f, 0.0f, 1.0f));
+    }
+
+    SECTION("Invalid sources are rejected")
+    {
+        IndexedMesh mesh;
+        REQUIRE(ObjMeshImporter::Import(StringView("v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 4\n"), mesh, options) == false);
+        REQUIRE(mesh.Vertices.empty());
+        REQUIRE(mesh.Indices.empty());
+
+        REQUIRE(ObjMeshImporter::Import(StringView("v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2\n"), mesh, options) == false);
+        REQUIRE(ObjMeshImporter::Import(StringView("v 0 zero 0\n"), mesh, options) == false);
+        REQUIRE(ObjMeshImporter::Import(StringView("v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1/x 2 3\n"), mesh, options) == false);
+    }
+
+    SECTION("Parallel parsing matches sequential parsing")
+    {
+        // large enough for multiple chunks
+        const String source = CreateGridSource(256);
+
+        IndexedMesh sequentialMesh;
+        REQUIRE(ObjMeshImporter::Import(StringView(source), sequentialMesh, options));
+        REQUIRE(sequentialMesh.Indices.size() == 256 * 256 * 6);
+
+        ObjImportOptions parallelOptions;
+        parallelOptions.ParallelParseThreshold = 0;
+        parallelOptions.MaxParseChunks = 4;
+
+        IndexedMesh parallelMesh;
+        REQUIRE(ObjMeshImporter::Import(StringView(source), parallelMesh, parallelOptions));
+        REQUIRE(parallelMesh.Indices == sequentialMesh.Indices);
+        REQUIRE(parallelMesh.Vertices.size() == sequentialMesh.Vertices.size());
+        for (onyxU64 i = 0; i < parallelMesh.Vertices.size(); ++i)
+        {
+            REQUIRE(parallelMesh.Vertices[i].Position == sequentialMesh.Vertices[i].Position);
+            REQUIRE(parallelMesh.Vertices[i].UV == sequentialMesh.Vertices[i].UV);
+        }
+    }
+}
@@ -0,0 +1,139 @@
+#include <catch2/catch_test_macros.hpp>
+#include <onyx/graphics/rendergraph/rendergraphbarrierplanner.h>
+
+using namespace Onyx;
+using namespace Onyx::Graphics;
+
+namespace
+{
+    RenderGraphBarrierResource MakeResource(onyxU64 id, bool isTexture = true, bool isTransient = true)
+    {
+        RenderGraphBarrierResource resource;
+        resource.Id = id;
+        resource.IsTexture = isTexture;
+        resource.IsTransient = isTransient;
+        return resource;
+    }
+
+    RenderGraphPassResourceUses MakePass(Context context, std::initializer_list<RenderGraphResourceUse> uses)
+    {
+        RenderGraphPassResourceUses pass;
+        pass.ExecutionContext = context;
+        pass.Uses.assign(uses.begin(), uses.end());
+        return pass;
+    }
+}
+
+TEST_CASE("Render graph barrier planner", "[RenderGraph]")
+{
+    RenderGraphBarrierPlan plan;
+    DynamicArray<RenderGraphBarrierResource> resources;
+    DynamicArray<RenderGraphPassResourceUses> passes;
+
+    SECTION("Producer and consumer get one barrier each")
+    {
+        resources.push_back(MakeResource(1));
+        passes.push_back(MakePass(Context::Graphics, { { 1, RenderGraphResourceUsage::ColorAttachment } }));
+        passes.push_back(MakePass(Context::Graphics, { { 1, RenderGraphResourceUsage::Sampled } }));
+
+        RenderGraphBarrierPlanner::Plan(resources, passes, plan);
+        REQUIRE(plan.BarrierCount == 2);
+        REQUIRE(plan.PassBarriers[0].size() == 1);
+        REQUIRE(plan.PassBarriers[0][0].DiscardContents);
+        REQUIRE(plan.PassBarriers[0][0].After.Layout == ImageLayout::AttachmentOptimal);
+        REQUIRE(plan.PassBarriers[1][0].DiscardContents == false);
+        REQUIRE(plan.PassBarriers[1][0].Before.Layout == ImageLayout::AttachmentOptimal);
+        REQUIRE(plan.PassBarriers[1][0].After.Layout == ImageLayout::ReadOptimal);
+    }
+
+    SECTION("Consecutive reads in the same layout are elided")
+    {
+        resources.push_back(MakeResource(1));
+        passes.push_back(MakePass(Context::Graphics, { { 1, RenderGraphResourceUsage::ColorAttachment } }));
+        passes.push_back(MakePass(Context::Graphics, { { 1, RenderGraphResourceUsage::Sampled } }));
+        passes.push_back(MakePass(Context::Graphics, { { 1, RenderGraphResourceUsage::Sampled } }));
+        passes.push_back(MakePass(Context::Graphics, { { 1, RenderGraphResourceUsage::Sampled } }));
+
+        RenderGraphBarrierPlanner::Plan(resources, passes, plan);
+        REQUIRE(plan.BarrierCount == 2);
+        REQUIRE(plan.ElidedCount == 2);
+        REQUIRE(plan.PassBarriers[2].empty());
+        REQUIRE(plan.PassBarriers[3].empty());
+    }
+
+    SECTION("Barriers of a pass boundary are batched")
+    {
+        resources.push_back(MakeResource(1));
+        resources.push_back(MakeResource(2));
+        resources.push_back(MakeResource(3, false));
+        passes.push_back(MakePass(Context::Compute, { { 1, RenderGraphResourceUsage::StorageWrite }, { 3, RenderGraphResourceUsage::StorageWrite } }));
+        passes.push_back(MakePass(Context::Graphics, { { 2, RenderGraphResourceUsage::ColorAttachment } }));
+        passes.push_back(MakePass(Context::Graphics, { { 1, RenderGraphResourceUsage::Sampled }, { 2, RenderGraphResourceUsage::Sampled }, { 3, RenderGraphResourceUsage::StorageRead } }));
+
+        RenderGraphBarrierPlanner::Plan(resources, passes, plan);
+        REQUIRE(plan.PassBarriers[0].size() == 2);
+        REQUIRE(plan.PassBarriers[2].size() == 3);
+        REQUIRE(plan.PassBarriers[2][0].Before.ExecutionContext == Context::Compute);
+        REQUIRE(plan.PassBarriers[2][0].After.ExecutionContext == Context::Graphics);
+    }
+
+    SECTION("Multiple uses in one pass are merged")
+    {
+        resources.push_back(MakeResource(1));
+        passes.push_back(MakePass(Context::Compute, { { 1, RenderGraphResourceUsage::Sampled }, { 1, RenderGraphResourceUsage::StorageWrite } }));
+
+        RenderGraphBarrierPlanner::Plan(resources, passes, plan);
+        REQUIRE(plan.BarrierCount == 1);
+        REQUIRE(plan.PassBarriers[0][0].After.Layout == ImageLayout::General);
+        REQUIRE(Enums::HasAllFlags(plan.PassBarriers[0][0].After.AccessMask, Access::ShaderRead | Access::ShaderWrite));
+    }
+
+    SECTION("External depth image is transitioned and keeps its contents")
+    {
+        RenderGraphBarrierResource depth = MakeResource(1, true, false);
+        depth.IsDepth = true;
+        resources.push_back(depth);
+        passes.push_back(MakePass(Context::Graphics, { { 1, RenderGraphResourceUsage::DepthStencilAttachment } }));
+        passes.push_back(MakePass(Context::Graphics, { { 1, RenderGraphResourceUsage::InputAttachment } }));
+
+        RenderGraphBarrierPlanner::Plan(resources, passes, plan);
+        REQUIRE(plan.PassBarriers[0].size() == 1);
+        REQUIRE(plan.PassBarriers[0][0].DiscardContents == false);
+        REQUIRE(plan.PassBarriers[0][0].After.Layout == ImageLayout::AttachmentOptimal);
+        REQUIRE(Enums::HasAllFlags(plan.PassBarriers[0][0].After.AccessMask, Access::DepthStencilWrite));
+        // reading the depth as input attachment after writing it still needs the writes to be visible
+        REQUIRE(plan.PassBarriers[1].size() == 1);
+    }
+
+    SECTION("Hazards always need a barrier")
+    {
+        const RenderGraphResourceState read = RenderGraphBarrierPlanner::GetRequiredState(RenderGraphResourceUsage::StorageRead, Context::Compute, false);
+        const RenderGraphResourceState write = RenderGraphBarrierPlanner::GetRequiredState(RenderGraphResourceUsage::StorageWrite, Context::Compute, false);
+
+        REQUIRE(RenderGraphBarrierPlanner::NeedsBarrier(read, read, false) == false);
+        REQUIRE(RenderGraphBarrierPlanner::NeedsBarrier(read, write, false));
+        REQUIRE(RenderGraphBarrierPlanner::NeedsBarrier(write, read, false));
+        REQUIRE(RenderGraphBarrierPlanner::NeedsBarrier(write, write, false));
+    }
+
+    SECTION("Reads in another execution context need a barrier")
+    {
+        const RenderGraphResourceState computeRead = RenderGraphBarrierPlanner::GetRequiredState(RenderGraphResourceUsage::Sampled, Context::Compute, false);
+        const RenderGraphResourceState graphicsRead = RenderGraphBarrierPlanner::GetRequiredState(RenderGraphResourceUsage::Sampled, Context::Graphics, false);
+        REQUIRE(RenderGraphBarrierPlanner::NeedsBarrier(computeRead, graphicsRead, true));
+
+        resources.push_back(MakeResource(1));
+        passes.push_back(MakePass(Context::Graphics, { { 1, RenderGraphResourceUsage::ColorAttachment } }));
+        passes.push_back(MakePass(Context::Graphics, { { 1, RenderGraphResourceUsage::Sampled } }));
+        passes.push_back(MakePass(Context::Compute, { { 1, RenderGraphResourceUsage::Sampled } }));
+        passes.push_back(MakePass(Context::Compute, { { 1, RenderGraphResourceUsage::Sampled } }));
+
+        RenderGraphBarrierPlanner::Plan(resources, passes, plan);
+        REQUIRE(plan.BarrierCount == 3);
+        REQUIRE(plan.ElidedCount == 1);
+        REQUIRE(plan.PassBarriers[2].size() == 1);
+        REQUIRE(plan.PassBarriers[2][0].Before.ExecutionContext == Context::Graphics);
+        REQUIRE(plan.PassBarriers[2][0].After.ExecutionContext == Context::Compute);
+        REQUIRE(plan.PassBarriers[3].empty());
+    }
+}
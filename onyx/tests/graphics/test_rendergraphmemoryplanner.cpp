@@ -0,0 +1,105 @@
+#include <catch2/catch_test_macros.hpp>
+#include <onyx/graphics/rendergraph/rendergraphmemoryplanner.h>
+
+using namespace Onyx;
+using namespace Onyx::Graphics;
+
+namespace
+{
+    TransientResourceLifetime MakeResource(onyxU64 id, onyxU64 size, onyxU32 firstUse, onyxU32 lastUse, onyxU32 compatibilityClass = 0)
+    {
+        TransientResourceLifetime resource;
+        resource.Id = id;
+        resource.Size = size;
+        resource.FirstUse = firstUse;
+        resource.LastUse = lastUse;
+        resource.CompatibilityClass = compatibilityClass;
+        return resource;
+    }
+}
+
+TEST_CASE("Transient memory planner", "[RenderGraph]")
+{
+    TransientMemoryPlan plan;
+
+    SECTION("Resources with disjoint lifetimes share a heap")
+    {
+        DynamicArray<TransientResourceLifetime> resources;
+        resources.push_back(MakeResource(1, 100, 0, 1));
+        resources.push_back(MakeResource(2, 50, 2, 3));
+        resources.push_back(MakeResource(3, 80, 4, 4));
+
+        TransientMemoryPlanner::Plan(resources, plan);
+        REQUIRE(plan.Heaps.size() == 1);
+        REQUIRE(plan.Heaps[0].Resources[0] == 0);
+        REQUIRE(plan.TotalSize == 100);
+        REQUIRE(plan.UnaliasedSize == 230);
+        REQUIRE(plan.PeakLiveSize == 100);
+    }
+
+    SECTION("Overlapping lifetimes never share a heap")
+    {
+        DynamicArray<TransientResourceLifetime> resources;
+        resources.push_back(MakeResource(1, 100, 0, 2));
+        resources.push_back(MakeResource(2, 100, 1, 3));
+        resources.push_back(MakeResource(3, 60, 3, 4));
+
+        TransientMemoryPlanner::Plan(resources, plan);
+        REQUIRE(plan.Heaps.size() == 2);
+        REQUIRE(plan.ResourceHeaps[0] != plan.ResourceHeaps[1]);
+        REQUIRE(plan.ResourceHeaps[2] == plan.ResourceHeaps[0]);
+        REQUIRE(plan.TotalSize == 200);
+        REQUIRE(plan.PeakLiveSize == 200);
+    }
+
+    SECTION("Incompatible resources never share a heap")
+    {
+        DynamicArray<TransientResourceLifetime> resources;
+        resources.push_back(MakeResource(1, 100, 0, 0, 0));
+        resources.push_back(MakeResource(2, 100, 1, 1, 1));
+
+        TransientMemoryPlanner::Plan(resources, plan);
+        REQUIRE(plan.Heaps.size() == 2);
+        REQUIRE(plan.Heaps[plan.ResourceHeaps[0]].CompatibilityClass == 0);
+        REQUIRE(plan.Heaps[plan.ResourceHeaps[1]].CompatibilityClass == 1);
+    }
+
+    SECTION("Heaps are padded to the largest alignment of their resources")
+    {
+        DynamicArray<TransientResourceLifetime> resources;
+        resources.push_back(MakeResource(1, 100, 0, 0));
+        resources.push_back(MakeResource(2, 90, 1, 1));
+        resources[1].Alignment = 64;
+
+        TransientMemoryPlanner::Plan(resources, plan);
+        REQUIRE(plan.Heaps.size() == 1);
+        REQUIRE(plan.Heaps[0].Alignment == 64);
+        REQUIRE(plan.Heaps[0].Size == 128);
+        REQUIRE(plan.TotalSize == 128);
+        REQUIRE(plan.UnaliasedSize == 190);
+    }
+
+    SECTION("Every heap is as big as its first resource")
+    {
+        DynamicArray<TransientResourceLifetime> resources;
+        for (onyxU32 i = 0; i < 32; ++i)
+        {
+            resources.push_back(MakeResource(i, 16 + (i * 7919) % 113, i % 5, (i % 5) + (i % 3)));
+        }
+
+        TransientMemoryPlanner::Plan(resources, plan);
+        REQUIRE(plan.TotalSize >= plan.PeakLiveSize);
+        REQUIRE(plan.TotalSize <= plan.UnaliasedSize);
+
+        for (const TransientMemoryHeap& heap : plan.Heaps)
+        {
+            REQUIRE(heap.Size == resources[heap.Resources[0]].Size);
+            for (onyxU32 i = 0; i < heap.Resources.size(); ++i)
+            {
+                REQUIRE(resources[heap.Resources[i]].Size <= heap.Size);
+                for (onyxU32 j = i + 1; j < heap.Resources.size(); ++j)
+                    REQUIRE(resources[heap.Resources[i]].Overlaps(resources[heap.Resources[j]]) == false);
+            }
+        }
+    }
+}
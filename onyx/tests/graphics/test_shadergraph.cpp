@@ -0,0 +1,196 @@
+#include <catch2/catch_test_macros.hpp>
+#include <onyx/graphics/shadergraph/shadergraph.h>
+#include <onyx/graphics/shadergraph/nodes/fragmentshaderoutnode.h>
+#include <onyx/graphics/shadergraph/nodes/getworldposition.h>
+#include <onyx/graphics/shadergraph/nodes/math/arithmeticnodes.h>
+#include <onyx/rhi/shader/generators/shadergenerator.h>
+
+using namespace Onyx;
+using namespace Onyx::Graphics;
+
+namespace
+{
+    using LocalNodeId = NodeGraph::NodeGraph::LocalNodeId;
+
+    // returns the node code only, so the tests do not depend on the vertex and fragment boilerplate
+    class NodeCodeGenerator : public ShaderGenerator
+    {
+    public:
+        static constexpr StringId32 TypeId = "Onyx::Graphics::Test::NodeCodeGenerator";
+        StringId32 GetTypeId() const override { return TypeId; }
+
+        String GenerateShader() override { return m_ShaderStagesCode[Enums::ToIntegral(ShaderStage::Fragment)]; }
+    };
+
+    Guid64 GetOutputPinId(NodeGraph::NodeGraph& graph, LocalNodeId nodeId)
+    {
+        return graph.GetNode(nodeId).GetOutputPin(0)->GetGlobalId();
+    }
+
+    void Link(NodeGraph::NodeGraph& graph, LocalNodeId fromNodeId, LocalNodeId toNodeId, onyxU32 inputIndex)
+    {
+        const Guid64 outputPinId = GetOutputPinId(graph, fromNodeId);
+        NodeGraph::PinBase* inputPin = graph.GetNode(toNodeId).GetInputPin(inputIndex);
+
+        graph.AddEdge(outputPinId, inputPin->GetGlobalId());
+        inputPin->ConnectPin(outputPinId);
+    }
+
+    void SetConstant(NodeGraph::NodeGraph& graph, LocalNodeId nodeId, onyxU32 inputIndex, const Vector4f32& value)
+    {
+        graph.GetConstantPinData()[graph.GetNode(nodeId).GetInputPin(inputIndex)->GetGlobalId()] = value;
+    }
+
+    // every generated node starts with a comment containing its id
+    bool HasNodeCode(const String& shaderCode, NodeGraph::NodeGraph& graph, LocalNodeId nodeId)
+    {
+        const String nodeComment = Format::Format("0x{:x} ", graph.GetNode(nodeId).GetId().Get());
+        return shaderCode.find(nodeComment) != String::npos;
+    }
+
+    bool HasPinAlias(const String& shaderCode, Guid64 pinId, Guid64 originalPinId)
+    {
+        const String alias = Format::Format("vec4 pin_{:x} = pin_{:x};", pinId.Get(), originalPinId.Get());
+        return shaderCode.find(alias) != String::npos;
+    }
+}
+
+TEST_CASE("ShaderGraph folds pure nodes with constant inputs", "[Graphics][ShaderGraph]")
+{
+    ShaderGraph shaderGraph;
+    NodeGraph::NodeGraph& graph = shaderGraph.GetNodeGraph();
+
+    const LocalNodeId addNode = graph.Emplace<ShaderGraphNodes::AddNodeVector4f32>();
+    const LocalNodeId outNode = graph.Emplace<ShaderGraphNodes::FragmentShaderOutNode>();
+    SetConstant(graph, addNode, 0, Vector4f32(1.0f, 2.0f, 3.0f, 4.0f));
+    SetConstant(graph, addNode, 1, Vector4f32(3.0f, 4.0f, 5.0f, 6.5f));
+    Link(graph, addNode, outNode, 0);
+
+    NodeCodeGenerator generator;
+    REQUIRE(shaderGraph.GenerateShader(generator));
+
+    const String& shaderCode = shaderGraph.GetShaderCode();
+    const Guid64 addOutputPinId = GetOutputPinId(graph, addNode);
+    const String foldedCode = Format::Format("const vec4 pin_{:x} = vec4(4.0, 6.0, 8.0, 10.5);", addOutputPinId.Get());
+    REQUIRE(shaderCode.find(foldedCode) != String::npos);
+
+    const String outputCode = Format::Format("outColor = pin_{:x};", addOutputPinId.Get());
+    REQUIRE(shaderCode.find(outputCode) != String::npos);
+}
+
+TEST_CASE("ShaderGraph merges equal pure nodes", "[Graphics][ShaderGraph]")
+{
+    ShaderGraph shaderGraph;
+    NodeGraph::NodeGraph& graph = shaderGraph.GetNodeGraph();
+
+    const LocalNodeId positionNode = graph.Emplace<ShaderGraphNodes::GetWorldPositionNode>();
+    const LocalNodeId firstAddNode = graph.Emplace<ShaderGraphNodes::AddNodeVector4f32>();
+    const LocalNodeId secondAddNode = graph.Emplace<ShaderGraphNodes::AddNodeVector4f32>();
+    const LocalNodeId differentAddNode = graph.Emplace<ShaderGraphNodes::AddNodeVector4f32>();
+    const LocalNodeId combineNode = graph.Emplace<ShaderGraphNodes::AddNodeVector4f32>();
+    const LocalNodeId finalNode = graph.Emplace<ShaderGraphNodes::AddNodeVector4f32>();
+    const LocalNodeId outNode = graph.Emplace<ShaderGraphNodes::FragmentShaderOutNode>();
+
+    // both nodes compute position + 1, the third one uses a different constant
+    Link(graph, positionNode, firstAddNode, 0);
+    SetConstant(graph, firstAddNode, 1, Vector4f32(1.0f, 1.0f, 1.0f, 1.0f));
+    Link(graph, positionNode, secondAddNode, 0);
+    SetConstant(graph, secondAddNode, 1, Vector4f32(1.0f, 1.0f, 1.0f, 1.0f));
+    Link(graph, positionNode, differentAddNode, 0);
+    SetConstant(graph, differentAddNode, 1, Vector4f32(2.0f, 1.0f, 1.0f, 1.0f));
+
+    Link(graph, firstAddNode, combineNode, 0);
+    Link(graph, secondAddNode, combineNode, 1);
+    Link(graph, combineNode, finalNode, 0);
+    Link(graph, differentAddNode, finalNode, 1);
+    Link(graph, finalNode, outNode, 0);
+
+    NodeCodeGenerator generator;
+    REQUIRE(shaderGraph.GenerateShader(generator));
+
+    const String& shaderCode = shaderGraph.GetShaderCode();
+    const Guid64 firstPinId = GetOutputPinId(graph, firstAddNode);
+    const Guid64 secondPinId = GetOutputPinId(graph, secondAddNode);
+    const Guid64 differentPinId = GetOutputPinId(graph, differentAddNode);
+
+    // whichever node is generated first is kept, the other one reuses its result
+    const bool isSecondMerged = HasPinAlias(shaderCode, secondPinId, firstPinId);
+    const bool isFirstMerged = HasPinAlias(shaderCode, firstPinId, secondPinId);
+    REQUIRE(isSecondMerged != isFirstMerged);
+
+    REQUIRE(HasPinAlias(shaderCode, differentPinId, firstPinId) == false);
+    REQUIRE(HasPinAlias(shaderCode, differentPinId, secondPinId) == false);
+}
+
+TEST_CASE("ShaderGraph skips nodes that do not reach an output", "[Graphics][ShaderGraph]")
+{
+    ShaderGraph shaderGraph;
+    NodeGraph::NodeGraph& graph = shaderGraph.GetNodeGraph();
+
+    const LocalNodeId positionNode = graph.Emplace<ShaderGraphNodes::GetWorldPositionNode>();
+    const LocalNodeId liveNode = graph.Emplace<ShaderGraphNodes::AddNodeVector4f32>();
+    const LocalNodeId deadNode = graph.Emplace<ShaderGraphNodes::AddNodeVector4f32>();
+    const LocalNodeId deadChildNode = graph.Emplace<ShaderGraphNodes::AddNodeVector4f32>();
+    const LocalNodeId outNode = graph.Emplace<ShaderGraphNodes::FragmentShaderOutNode>();
+
+    Link(graph, positionNode, liveNode, 0);
+    Link(graph, liveNode, outNode, 0);
+
+    // a chain that consumes live values but is never read
+    Link(graph, positionNode, deadNode, 0);
+    Link(graph, liveNode, deadNode, 1);
+    Link(graph, deadNode, deadChildNode, 0);
+
+    NodeCodeGenerator generator;
+    REQUIRE(shaderGraph.GenerateShader(generator));
+
+    const String& shaderCode = shaderGraph.GetShaderCode();
+    REQUIRE(HasNodeCode(shaderCode, graph, positionNode));
+    REQUIRE(HasNodeCode(shaderCode, graph, liveNode));
+    REQUIRE(HasNodeCode(shaderCode, graph, outNode));
+    REQUIRE(HasNodeCode(shaderCode, graph, deadNode) == false);
+    REQUIRE(HasNodeCode(shaderCode, graph, deadChildNode) == false);
+}
+
+TEST_CASE("ShaderGraph reuses generated code", "[Graphics][ShaderGraph]")
+{
+    ShaderGraph shaderGraph;
+    NodeGraph::NodeGraph& graph = shaderGraph.GetNodeGraph();
+
+    const LocalNodeId addNode = graph.Emplace<ShaderGraphNodes::AddNodeVector4f32>();
+    const LocalNodeId outNode = graph.Emplace<ShaderGraphNodes::FragmentShaderOutNode>();
+    SetConstant(graph, addNode, 0, Vector4f32(1.0f, 2.0f, 3.0f, 4.0f));
+    Link(graph, addNode, outNode, 0);
+
+    NodeCodeGenerator generator;
+    REQUIRE(shaderGraph.GenerateShader(generator));
+    const String nodeCode = shaderGraph.GetShaderCode();
+
+    SECTION("Unchanged graph fills the caller's generator")
+    {
+        NodeCodeGenerator reusedGenerator;
+        REQUIRE(shaderGraph.GenerateShader(reusedGenerator));
+        REQUIRE(shaderGraph.GetShaderCode() == nodeCode);
+        REQUIRE(reusedGenerator.GenerateShader() == nodeCode);
+    }
+
+    SECTION("Different generator type regenerates the code")
+    {
+        ShaderGenerator otherGenerator;
+        REQUIRE(shaderGraph.GenerateShader(otherGenerator));
+        REQUIRE(shaderGraph.GetShaderCode() != nodeCode);
+
+        NodeCodeGenerator reusedGenerator;
+        REQUIRE(shaderGraph.GenerateShader(reusedGenerator));
+        REQUIRE(shaderGraph.GetShaderCode() == nodeCode);
+    }
+
+    SECTION("Changed constant regenerates the code")
+    {
+        SetConstant(graph, addNode, 0, Vector4f32(2.0f, 2.0f, 3.0f, 4.0f));
+
+        NodeCodeGenerator changedGenerator;
+        REQUIRE(shaderGraph.GenerateShader(changedGenerator));
+        REQUIRE(shaderGraph.GetShaderCode() != nodeCode);
+    }
+}
@@ -0,0 +1,167 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <onyx/input/inputsystem.h>
+#include <onyx/inputactions/inputactionsystem.h>
+#include <onyx/inputactions/bindings/inputbindingaxis1d.h>
+#include <onyx/inputactions/bindings/inputbindingaxis1dcomposite.h>
+#include <onyx/inputactions/bindings/inputbindingaxis2d.h>
+#include <onyx/inputactions/bindings/inputbindingaxis2dcomposite.h>
+#include <onyx/inputactions/bindings/inputbindingaxis3d.h>
+#include <onyx/inputactions/bindings/inputbindingaxis3dcomposite.h>
+#include <onyx/inputactions/bindings/inputbindingbool.h>
+#include <onyx/inputactions/triggers/inputtrigger.h>
+
+using namespace Onyx;
+using namespace Onyx::InputActions;
+
+namespace
+{
+    constexpr StringId32 CONTEXT_ID = "Test";
+    constexpr StringId32 OTHER_CONTEXT_ID = "Other";
+
+    constexpr onyxU32 BINDING_TYPE_COUNT = 7;
+    constexpr Array<StringId64, BINDING_TYPE_COUNT> BATCHED_ACTION_IDS{ "BatchedBool", "BatchedAxis1DComposite", "BatchedAxis2DComposite", "BatchedAxis3DComposite", "BatchedAxis1D", "BatchedAxis2D", "BatchedAxis3D" };
+    constexpr Array<StringId64, BINDING_TYPE_COUNT> VIRTUAL_ACTION_IDS{ "VirtualBool", "VirtualAxis1DComposite", "VirtualAxis2DComposite", "VirtualAxis3DComposite", "VirtualAxis1D", "VirtualAxis2D", "VirtualAxis3D" };
+
+    // bindings with triggers are not batched, so the same binding with this trigger runs through DoUpdate
+    class AlwaysTrigger : public InputTrigger
+    {
+    public:
+        StringId32 GetTypeId() const override { return "AlwaysTrigger"; }
+        bool IsTriggered(const Input::InputSystem&, const InputActionSystem&) const override { return true; }
+    };
+
+    Input::InputID ToInputId(Input::Key key) { return Input::InputID{ Enums::ToIntegral(key) }; }
+    Input::InputID ToInputId(Input::MouseAxis axis) { return Input::InputID{ Enums::ToIntegral(axis) }; }
+
+    template <typename BindingT>
+    void AddBinding(InputAction& action, const DynamicArray<Input::InputID>& inputs, bool isVirtual)
+    {
+        UniquePtr<InputBinding> binding = MakeUnique<BindingT>();
+        for (onyxU32 slot = 0; slot < inputs.size(); ++slot)
+            binding->SetInputBindingSlot(slot, inputs[slot]);
+
+        if (isVirtual)
+            binding->GetTriggers().push_back(MakeUnique<AlwaysTrigger>());
+
+        action.GetBindings().push_back(std::move(binding));
+    }
+
+    void AddActions(InputActionsMap& map, const Array<StringId64, BINDING_TYPE_COUNT>& actionIds, bool isVirtual)
+    {
+        DynamicArray<InputAction>& actions = map.GetActions();
+        for (StringId64 actionId : actionIds)
+            actions.emplace_back(actionId);
+
+        InputAction* action = &actions[actions.size() - BINDING_TYPE_COUNT];
+        AddBinding<InputBindingBool>(*action++, { ToInputId(Input::Key::Space) }, isVirtual);
+        AddBinding<InputBindingAxis1DComposite>(*action++, { ToInputId(Input::Key::E), ToInputId(Input::Key::Q) }, isVirtual);
+        AddBinding<InputBindingAxis2DComposite>(*action++, { ToInputId(Input::Key::W), ToInputId(Input::Key::S), ToInputId(Input::Key::A), ToInputId(Input::Key::D) }, isVirtual);
+        AddBinding<InputBindingAxis3DComposite>(*action++, { ToInputId(Input::Key::Up), ToInputId(Input::Key::Down), ToInputId(Input::Key::Left), ToInputId(Input::Key::Right), ToInputId(Input::Key::W), ToInputId(Input::Key::S) }, isVirtual);
+        AddBinding<InputBindingAxis1D>(*action++, { ToInputId(Input::MouseAxis::Wheel) }, isVirtual);
+        AddBinding<InputBindingAxis2D>(*action++, { ToInputId(Input::MouseAxis::DeltaX), ToInputId(Input::MouseAxis::DeltaY) }, isVirtual);
+        AddBinding<InputBindingAxis3D>(*action, { ToInputId(Input::MouseAxis::X), ToInputId(Input::MouseAxis::Y), ToInputId(Input::MouseAxis::Wheel) }, isVirtual);
+    }
+
+    Assets::AssetHandle<InputActionsAsset> CreateActionsAsset()
+    {
+        Reference<InputActionsAsset> asset(new InputActionsAsset());
+        InputActionsMap& map = asset->GetMaps()[CONTEXT_ID];
+        AddActions(map, BATCHED_ACTION_IDS, false);
+        AddActions(map, VIRTUAL_ACTION_IDS, true);
+
+        asset->GetMaps()[OTHER_CONTEXT_ID].GetActions().emplace_back(StringId64("OtherAction"));
+        return Assets::AssetHandle<InputActionsAsset>(Assets::AssetId("test.oinput"), asset);
+    }
+
+    void SetKey(Input::InputSystem& inputSystem, Input::Key key, bool isDown)
+    {
+        inputSystem.AddEvent(Input::KeyboardEvent{ 0, key, isDown ? Input::ButtonState::Down : Input::ButtonState::Up });
+    }
+
+    void CheckEquivalence(const InputActionSystem& inputActionSystem)
+    {
+        for (onyxU32 i = 0; i < BINDING_TYPE_COUNT; ++i)
+        {
+            const InputActionState* batchedState = inputActionSystem.GetActionState(BATCHED_ACTION_IDS[i]).value_or(nullptr);
+            const InputActionState* virtualState = inputActionSystem.GetActionState(VIRTUAL_ACTION_IDS[i]).value_or(nullptr);
+            REQUIRE(batchedState != nullptr);
+            REQUIRE(virtualState != nullptr);
+            REQUIRE(batchedState->Value == virtualState->Value);
+        }
+    }
+}
+
+TEST_CASE("InputActionSystem - Batched and virtual bindings are equivalent", "[inputactions]")
+{
+    Input::InputSystem inputSystem;
+    InputActionSystem inputActionSystem(inputSystem);
+    inputActionSystem.SetActionsMapAsset(CreateActionsAsset());
+    inputActionSystem.SetCurrentInputActionMap(CONTEXT_ID);
+
+    // nothing pressed
+    inputSystem.Update();
+    inputActionSystem.Update();
+    CheckEquivalence(inputActionSystem);
+    REQUIRE(inputActionSystem.IsActionTriggered(StringId64("BatchedBool")) == false);
+
+    // single keys and opposing keys of the composites
+    SetKey(inputSystem, Input::Key::Space, true);
+    SetKey(inputSystem, Input::Key::E, true);
+    SetKey(inputSystem, Input::Key::W, true);
+    SetKey(inputSystem, Input::Key::A, true);
+    SetKey(inputSystem, Input::Key::D, true);
+    SetKey(inputSystem, Input::Key::Down, true);
+    inputSystem.AddEvent(Input::MousePositionEvent{ Vector2s32(12, -7) });
+    inputSystem.AddEvent(Input::MouseAxisEvent{ 3 });
+    inputSystem.Update();
+    inputActionSystem.Update();
+    CheckEquivalence(inputActionSystem);
+    REQUIRE(inputActionSystem.IsActionTriggered(StringId64("BatchedBool")));
+    REQUIRE(inputActionSystem.IsActionTriggered(StringId64("BatchedAxis3DComposite")));
+
+    // releases and mouse movement in the other direction
+    SetKey(inputSystem, Input::Key::Space, false);
+    SetKey(inputSystem, Input::Key::A, false);
+    SetKey(inputSystem, Input::Key::Q, true);
+    inputSystem.AddEvent(Input::MousePositionEvent{ Vector2s32(-4, 9) });
+    inputSystem.Update();
+    inputActionSystem.Update();
+    CheckEquivalence(inputActionSystem);
+    REQUIRE(inputActionSystem.IsActionTriggered(StringId64("BatchedBool")) == false);
+}
+
+TEST_CASE("InputActionSystem - Action handles stay stable", "[inputactions]")
+{
+    Input::InputSystem inputSystem;
+    InputActionSystem inputActionSystem(inputSystem);
+
+    // handles can be resolved before the action is part of a map
+    const InputActionHandle boolHandle = inputActionSystem.GetActionHandle(BATCHED_ACTION_IDS[0]);
+    const InputActionHandle otherHandle = inputActionSystem.GetActionHandle(StringId64("OtherAction"));
+    REQUIRE(boolHandle.IsValid());
+    REQUIRE(inputActionSystem.GetActionState(boolHandle).has_value() == false);
+
+    inputActionSystem.SetActionsMapAsset(CreateActionsAsset());
+    inputActionSystem.SetCurrentInputActionMap(CONTEXT_ID);
+    REQUIRE(inputActionSystem.GetActionHandle(BATCHED_ACTION_IDS[0]).Index == boolHandle.Index);
+    REQUIRE(inputActionSystem.GetActionState(boolHandle).has_value());
+    REQUIRE(inputActionSystem.GetActionState(otherHandle).has_value() == false);
+
+    SetKey(inputSystem, Input::Key::Space, true);
+    inputSystem.Update();
+    inputActionSystem.Update();
+    REQUIRE(inputActionSystem.IsActionTriggered(boolHandle));
+
+    inputActionSystem.SetCurrentInputActionMap(OTHER_CONTEXT_ID);
+    REQUIRE(inputActionSystem.GetActionState(boolHandle).has_value() == false);
+    REQUIRE(inputActionSystem.GetActionState(otherHandle).has_value());
+
+    inputActionSystem.SetCurrentInputActionMap(CONTEXT_ID);
+    REQUIRE(inputActionSystem.GetActionHandle(BATCHED_ACTION_IDS[0]).Index == boolHandle.Index);
+    REQUIRE(inputActionSystem.GetActionHandle(StringId64("OtherAction")).Index == otherHandle.Index);
+
+    inputSystem.Update();
+    inputActionSystem.Update();
+    REQUIRE(inputActionSystem.IsActionTriggered(boolHandle));
+}
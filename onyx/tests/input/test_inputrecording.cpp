@@ -0,0 +1,140 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <onyx/input/inputrecording.h>
+#include <onyx/stream/memorystream.h>
+
+#include <filesystem>
+
+using namespace Onyx;
+using namespace Onyx::Input;
+
+namespace
+{
+    // 60 frames per second in nanoseconds
+    constexpr onyxU64 FIXED_DELTA_TIME = 16'666'666;
+
+    InputRecording CreateRecording()
+    {
+        InputRecording recording;
+        recording.FixedDeltaTime = FIXED_DELTA_TIME;
+        recording.FrameCount = 4;
+        recording.Events.push_back({ 0, MouseAxisEvent{ -3 } });
+        recording.Events.push_back({ 0, MouseButtonEvent{ MouseButton::Button_2, ButtonState::Down } });
+        recording.Events.push_back({ 1, MousePositionEvent{ Vector2s32(-120, 640) } });
+        recording.Events.push_back({ 1, KeyboardEvent{ 'w', Key::W, ButtonState::Repeat } });
+        recording.Events.push_back({ 2, GameControllerButtonEvent{ 1, GameControllerButton::South, ButtonState::Up } });
+        recording.Events.push_back({ 3, GameControllerAxisEvent{ 1, GameControllerAxis::LeftStick_Y, -32768 } });
+        return recording;
+    }
+
+    bool IsEqual(const MouseAxisEvent& lhs, const MouseAxisEvent& rhs) { return lhs.Value == rhs.Value; }
+    bool IsEqual(const MouseButtonEvent& lhs, const MouseButtonEvent& rhs) { return (lhs.Button == rhs.Button) && (lhs.State == rhs.State); }
+    bool IsEqual(const MousePositionEvent& lhs, const MousePositionEvent& rhs) { return lhs.Position == rhs.Position; }
+    bool IsEqual(const KeyboardEvent& lhs, const KeyboardEvent& rhs) { return (lhs.Char == rhs.Char) && (lhs.Key == rhs.Key) && (lhs.State == rhs.State); }
+    bool IsEqual(const GameControllerButtonEvent& lhs, const GameControllerButtonEvent& rhs) { return (lhs.ControllerIndex == rhs.ControllerIndex) && (lhs.Button == rhs.Button) && (lhs.State == rhs.State); }
+    bool IsEqual(const GameControllerAxisEvent& lhs, const GameControllerAxisEvent& rhs) { return (lhs.ControllerIndex == rhs.ControllerIndex) && (lhs.Axis == rhs.Axis) && (lhs.Value == rhs.Value); }
+
+    void CheckRecording(const InputRecording& recording, const InputRecording& expected)
+    {
+        REQUIRE(recording.FixedDeltaTime == expected.FixedDeltaTime);
+        REQUIRE(recording.FrameCount == expected.FrameCount);
+        REQUIRE(recording.Events.size() == expected.Events.size());
+
+        for (onyxU64 i = 0; i < expected.Events.size(); ++i)
+        {
+            const RecordedInputEvent& recordedEvent = recording.Events[i];
+            const RecordedInputEvent& expectedEvent = expected.Events[i];
+            REQUIRE(recordedEvent.Frame == expectedEvent.Frame);
+            REQUIRE(recordedEvent.Event.index() == expectedEvent.Event.index());
+
+            const bool isEqual = std::visit([&](const auto& event)
+                {
+                    return IsEqual(event, std::get<std::decay_t<decltype(event)>>(expectedEvent.Event));
+                }, recordedEvent.Event);
+            REQUIRE(isEqual);
+        }
+    }
+}
+
+TEST_CASE("InputRecording", "[input]")
+{
+    const InputRecording expected = CreateRecording();
+
+    MemoryStream stream;
+    expected.Serialize(stream);
+
+    SECTION("Roundtrip through a stream")
+    {
+        MemoryStream inStream(stream.GetBuffer().data(), stream.GetBuffer().size());
+
+        InputRecording recording;
+        REQUIRE(recording.Deserialize(inStream));
+        CheckRecording(recording, expected);
+        REQUIRE(inStream.GetRemainingLength() == 0);
+    }
+
+    SECTION("Roundtrip through a file")
+    {
+        const FilePath path = std::filesystem::temp_directory_path() / "onyx_test_recording.oinput";
+        REQUIRE(expected.Save(path));
+
+        InputRecording recording;
+        REQUIRE(recording.Load(path));
+        CheckRecording(recording, expected);
+
+        std::filesystem::remove(path);
+    }
+
+    SECTION("Events are written without struct padding")
+    {
+        // header: magic, version, fixed delta time, frame count, event count
+        onyxU64 expectedSize = sizeof(onyxU32) * 2 + sizeof(onyxU64) + sizeof(onyxU32) * 2;
+        // frame and type index per event
+        expectedSize += expected.Events.size() * (sizeof(onyxU32) + sizeof(onyxU8));
+        expectedSize += sizeof(onyxS16);
+        expectedSize += sizeof(MouseButton) + sizeof(ButtonState);
+        expectedSize += sizeof(onyxS32) * 2;
+        expectedSize += sizeof(onyxU16) + sizeof(Key) + sizeof(ButtonState);
+        expectedSize += sizeof(onyxU32) + sizeof(GameControllerButton) + sizeof(ButtonState);
+        expectedSize += sizeof(onyxU32) + sizeof(GameControllerAxis) + sizeof(onyxS16);
+
+        REQUIRE(stream.GetBuffer().size() == expectedSize);
+    }
+
+    SECTION("Truncated recordings are rejected")
+    {
+        const DynamicArray<char>& buffer = stream.GetBuffer();
+        for (onyxU64 size : { onyxU64(0), onyxU64(8), buffer.size() - 1 })
+        {
+            MemoryStream inStream(buffer.data(), size);
+
+            InputRecording recording;
+            REQUIRE(recording.Deserialize(inStream) == false);
+        }
+    }
+
+    SECTION("Recordings of other versions are rejected")
+    {
+        DynamicArray<char> buffer = stream.GetBuffer();
+        const onyxU32 version = InputRecording::VERSION - 1;
+        std::memcpy(buffer.data() + sizeof(onyxU32), &version, sizeof(version));
+
+        MemoryStream inStream(buffer.data(), buffer.size());
+
+        InputRecording recording;
+        REQUIRE(recording.Deserialize(inStream) == false);
+    }
+
+    SECTION("Unknown event types are rejected")
+    {
+        DynamicArray<char> buffer = stream.GetBuffer();
+        // type index of the first event, after the header and its frame
+        const onyxU64 typeIndexOffset = sizeof(onyxU32) * 2 + sizeof(onyxU64) + sizeof(onyxU32) * 2 + sizeof(onyxU32);
+        buffer[typeIndexOffset] = static_cast<char>(std::variant_size_v<InputEventVariant>);
+
+        MemoryStream inStream(buffer.data(), buffer.size());
+
+        InputRecording recording;
+        REQUIRE(recording.Deserialize(inStream) == false);
+    }
+}
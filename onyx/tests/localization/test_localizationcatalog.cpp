@@ -0,0 +1,164 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <onyx/localization/localizationcatalog.h>
+#include <onyx/localization/serialize/portableobjectserializer.h>
+#include <onyx/stream/memorystream.h>
+
+#include <filesystem>
+#include <fstream>
+
+using namespace Onyx;
+using namespace Onyx::Localization;
+
+namespace
+{
+    constexpr onyxU64 SOURCE_HASH = 0x1234567890ABCDEFull;
+    constexpr onyxU32 GENERATED_ENTRY_COUNT = 64;
+
+    LocalizationId GetGeneratedId(onyxU32 index)
+    {
+        return LocalizationId(StringId32(String("generated.") + std::to_string(index)));
+    }
+
+    String GetGeneratedText(onyxU32 index)
+    {
+        return String("Generated ") + std::to_string(index);
+    }
+
+    LocalizationCatalog::SourceEntries CreateEntries()
+    {
+        LocalizationCatalog::SourceEntries entries;
+        entries[LocalizationId(StringId32("menu.start"))] = { "Start" };
+        entries[LocalizationId(StringId32("menu"), StringId32("title"))] = { "Main Menu" };
+        entries[LocalizationId(StringId32("item"), StringId32("title"))] = { "Item" };
+        entries[LocalizationId(StringId32("apples"))] = { "apple", "apples" };
+
+        // enough entries for multiple buckets in the perfect hash
+        for (onyxU32 i = 0; i < GENERATED_ENTRY_COUNT; ++i)
+            entries[GetGeneratedId(i)] = { GetGeneratedText(i) };
+
+        return entries;
+    }
+
+    void CheckCatalog(const LocalizationCatalog& catalog)
+    {
+        REQUIRE(catalog.IsValid());
+        REQUIRE(catalog.GetEntryCount() == (GENERATED_ENTRY_COUNT + 4));
+        REQUIRE(catalog.GetPluralRuleIndex() == PluralRules::DEFAULT_INDEX);
+        REQUIRE(catalog.GetSourceHash() == SOURCE_HASH);
+
+        REQUIRE(catalog.GetLocalized(LocalizationId(StringId32("menu.start"))) == "Start");
+        REQUIRE(catalog.GetLocalized(LocalizationId(StringId32("menu"), StringId32("title"))) == "Main Menu");
+        REQUIRE(catalog.GetLocalized(LocalizationId(StringId32("item"), StringId32("title"))) == "Item");
+        REQUIRE(catalog.GetLocalized(LocalizationId(StringId32("apples")), 1) == "apple");
+        REQUIRE(catalog.GetLocalized(LocalizationId(StringId32("apples")), 3) == "apples");
+
+        for (onyxU32 i = 0; i < GENERATED_ENTRY_COUNT; ++i)
+            REQUIRE(catalog.GetLocalized(GetGeneratedId(i)) == GetGeneratedText(i));
+
+        REQUIRE(catalog.GetLocalized(LocalizationId(StringId32("missing"))).has_value() == false);
+        REQUIRE(catalog.GetLocalized(LocalizationId(StringId32("title"))).has_value() == false);
+        REQUIRE(catalog.GetLocalized(LocalizationId(StringId32("menu.start")), 2).has_value() == false);
+    }
+}
+
+TEST_CASE("LocalizationCatalog", "[localization]")
+{
+    SECTION("Compiled catalog loads from memory")
+    {
+        MemoryStream stream;
+        LocalizationCatalog::Compile(CreateEntries(), PluralRules::DEFAULT_INDEX, SOURCE_HASH, stream);
+
+        LocalizationCatalog catalog;
+        REQUIRE(catalog.Load(DynamicArray<char>(stream.GetBuffer())));
+        CheckCatalog(catalog);
+    }
+
+    SECTION("Compiling the same entries results in the same catalog")
+    {
+        MemoryStream first;
+        MemoryStream second;
+        LocalizationCatalog::Compile(CreateEntries(), PluralRules::DEFAULT_INDEX, SOURCE_HASH, first);
+        LocalizationCatalog::Compile(CreateEntries(), PluralRules::DEFAULT_INDEX, SOURCE_HASH, second);
+        REQUIRE(first.GetBuffer() == second.GetBuffer());
+    }
+
+    SECTION("Compiled catalog loads from file")
+    {
+        const FilePath path = std::filesystem::temp_directory_path() / "onyx_test_catalog.olc";
+        REQUIRE(LocalizationCatalog::Compile(CreateEntries(), PluralRules::DEFAULT_INDEX, SOURCE_HASH, path));
+
+        {
+            LocalizationCatalog catalog;
+            REQUIRE(catalog.Load(path));
+            CheckCatalog(catalog);
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    SECTION("Truncated catalog is rejected")
+    {
+        MemoryStream stream;
+        LocalizationCatalog::Compile(CreateEntries(), PluralRules::DEFAULT_INDEX, SOURCE_HASH, stream);
+
+        DynamicArray<char> data(stream.GetBuffer());
+        data.pop_back();
+
+        LocalizationCatalog catalog;
+        REQUIRE(catalog.Load(std::move(data)) == false);
+        REQUIRE(catalog.IsValid() == false);
+        REQUIRE(catalog.GetLocalized(LocalizationId(StringId32("menu.start"))).has_value() == false);
+    }
+
+    SECTION("Empty catalog")
+    {
+        MemoryStream stream;
+        LocalizationCatalog::Compile({}, PluralRules::DEFAULT_INDEX, SOURCE_HASH, stream);
+
+        LocalizationCatalog catalog;
+        REQUIRE(catalog.Load(DynamicArray<char>(stream.GetBuffer())));
+        REQUIRE(catalog.GetEntryCount() == 0);
+        REQUIRE(catalog.GetLocalized(LocalizationId(StringId32("menu.start"))).has_value() == false);
+    }
+}
+
+TEST_CASE("PortableObjectSerializer compiles po files", "[localization]")
+{
+    const FilePath poPath = std::filesystem::temp_directory_path() / "onyx_test_localization.po";
+    const FilePath catalogPath = std::filesystem::temp_directory_path() / "onyx_test_localization.olc";
+
+    {
+        std::ofstream poFile(poPath, std::ios::binary);
+        poFile << "msgid \"\"\n"
+                  "msgstr \"\"\n"
+                  "\"Plural-Forms: nplurals=2; plural=(n>1);\"\n"
+                  "\n"
+                  "# main menu\n"
+                  "msgid \"menu.start\"\n"
+                  "msgstr \"Commencer\"\n"
+                  "\n"
+                  "msgid \"apples\"\n"
+                  "msgid_plural \"apples\"\n"
+                  "msgstr[0] \"pomme\"\n"
+                  "msgstr[1] \"pommes\"\n";
+    }
+
+    REQUIRE(PortableObjectSerializer::Compile(poPath, catalogPath));
+
+    {
+        LocalizationCatalog catalog;
+        REQUIRE(catalog.Load(catalogPath));
+        REQUIRE(catalog.GetEntryCount() == 2);
+        REQUIRE(catalog.GetPluralRuleIndex() == PluralRules::Find("nplurals=2;plural=(n>1);"));
+        REQUIRE(catalog.GetSourceHash() != 0);
+        REQUIRE(catalog.GetLocalized(LocalizationId(StringId32("menu.start"))) == "Commencer");
+        REQUIRE(catalog.GetLocalized(LocalizationId(StringId32("apples")), 1) == "pomme");
+        REQUIRE(catalog.GetLocalized(LocalizationId(StringId32("apples")), 2) == "pommes");
+    }
+
+    REQUIRE(PortableObjectSerializer::Compile(poPath / "missing.po", catalogPath) == false);
+
+    std::filesystem::remove(poPath);
+    std::filesystem::remove(catalogPath);
+}
@@ -225,4 +225,128 @@ SCENARIO("MortonCode3D_U64", "[morton][64bit][3d]")
     }
 }
 
-}
\ No newline at end of file
+SCENARIO("MortonCode3D_U64 neighbor arithmetic", "[morton][64bit][3d]")
+{
+    using namespace std;
+    using namespace Onyx;
+
+    using MortonT = MortonCode3D_U64;
+    using CoordinateT = MortonT::CoordinateT;
+    constexpr CoordinateT COORD_MASK = 2097151;
+
+    GIVEN("A random morton code")
+    {
+        auto [initialX, initialY, initialZ] = GENERATE(
+            make_tuple<CoordinateT, CoordinateT, CoordinateT>(0, 0, 0),
+            make_tuple<CoordinateT, CoordinateT, CoordinateT>(2097151, 2097151, 2097151),
+            take(100, randomNumberTriple<CoordinateT>(0, 2097151)));
+
+        const MortonT morton = MortonT::Encode(initialX, initialY, initialZ);
+
+        WHEN("Getting face, edge and corner neighbors at different levels")
+        {
+            THEN("The coordinates change by the offset scaled to the level")
+            {
+                for (onyxU8 level : { 0, 1, 5, 12 })
+                {
+                    for (onyxS32 dZ = -1; dZ <= 1; ++dZ)
+                    {
+                        for (onyxS32 dY = -1; dY <= 1; ++dY)
+                        {
+                            for (onyxS32 dX = -1; dX <= 1; ++dX)
+                            {
+                                CoordinateT x, y, z;
+                                MortonT::Decode(morton.GetNeighbor(dX, dY, dZ, level), x, y, z);
+                                REQUIRE(x == ((initialX + static_cast<CoordinateT>(dX << level)) & COORD_MASK));
+                                REQUIRE(y == ((initialY + static_cast<CoordinateT>(dY << level)) & COORD_MASK));
+                                REQUIRE(z == ((initialZ + static_cast<CoordinateT>(dZ << level)) & COORD_MASK));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        WHEN("Adding and subtracting another code")
+        {
+            const MortonT other = MortonT::Encode(initialZ, initialX, initialY);
+            THEN("Subtracting reverts the addition")
+            {
+                CoordinateT x, y, z;
+                MortonT::Decode(morton.Add(other), x, y, z);
+                REQUIRE(x == ((initialX + initialZ) & COORD_MASK));
+                REQUIRE(y == ((initialY + initialX) & COORD_MASK));
+                REQUIRE(z == ((initialZ + initialY) & COORD_MASK));
+
+                REQUIRE(morton.Add(other).Subtract(other) == morton);
+            }
+        }
+
+        WHEN("Encoding at runtime")
+        {
+            THEN("The result matches the constexpr encoding")
+            {
+                REQUIRE(Morton::Encode3D(initialX, initialY, initialZ) == morton);
+
+                CoordinateT x, y, z;
+                Morton::Decode3D(morton, x, y, z);
+                REQUIRE(x == initialX);
+                REQUIRE(y == initialY);
+                REQUIRE(z == initialZ);
+            }
+        }
+    }
+}
+
+SCENARIO("Batched morton encoding", "[morton][64bit]")
+{
+    using namespace Onyx;
+
+    GIVEN("Arrays of coordinates")
+    {
+        DynamicArray<onyxU32> x(256);
+        DynamicArray<onyxU32> y(256);
+        DynamicArray<onyxU32> z(256);
+        for (onyxU32 i = 0; i < 256; ++i)
+        {
+            x[i] = i * 2654435761u;
+            y[i] = i * 40503u + 7;
+            z[i] = (i * 97u) & 2097151;
+        }
+
+        WHEN("Encoding and decoding them in a batch")
+        {
+            DynamicArray<onyxU64> codes2D(256);
+            DynamicArray<onyxU64> codes3D(256);
+            Morton::Encode2D({ x.data(), x.size() }, { y.data(), y.size() }, { codes2D.data(), codes2D.size() });
+            Morton::Encode3D({ x.data(), x.size() }, { y.data(), y.size() }, { z.data(), z.size() }, { codes3D.data(), codes3D.size() });
+
+            DynamicArray<onyxU32> outX(256);
+            DynamicArray<onyxU32> outY(256);
+            DynamicArray<onyxU32> outZ(256);
+
+            THEN("The results match the single value encoding")
+            {
+                for (onyxU32 i = 0; i < 256; ++i)
+                {
+                    REQUIRE(codes2D[i] == MortonCode2D_U64::Encode(x[i], y[i]));
+                    REQUIRE(codes3D[i] == MortonCode3D_U64::Encode(x[i], y[i], z[i]));
+                }
+
+                Morton::Decode2D({ codes2D.data(), codes2D.size() }, { outX.data(), outX.size() }, { outY.data(), outY.size() });
+                REQUIRE(outX == x);
+                REQUIRE(outY == y);
+
+                Morton::Decode3D({ codes3D.data(), codes3D.size() }, { outX.data(), outX.size() }, { outY.data(), outY.size() }, { outZ.data(), outZ.size() });
+                for (onyxU32 i = 0; i < 256; ++i)
+                {
+                    REQUIRE(outX[i] == (x[i] & 2097151));
+                    REQUIRE(outY[i] == (y[i] & 2097151));
+                    REQUIRE(outZ[i] == z[i]);
+                }
+            }
+        }
+    }
+}
+
+}
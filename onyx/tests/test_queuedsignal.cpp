@@ -0,0 +1,113 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <onyx/function/queuedsignal.h>
+
+namespace Onyx
+{
+    namespace
+    {
+        struct Listener
+        {
+            void OnValue(onyxU32 value)
+            {
+                Sum += value;
+                ++CallCount;
+            }
+
+            void OnValueDisconnect(onyxU32 value)
+            {
+                OnValue(value);
+                Signal->Disconnect(this);
+            }
+
+            QueuedSignal<void(onyxU32)>* Signal = nullptr;
+            onyxU64 Sum = 0;
+            onyxU32 CallCount = 0;
+        };
+    }
+
+TEST_CASE("QueuedSignal - Deferred delivery", "[signal]")
+{
+    QueuedSignal<void(onyxU32)> signal;
+    Listener listener;
+    signal.Connect<&Listener::OnValue>(listener);
+
+    REQUIRE(signal.Publish(1));
+    REQUIRE(signal.Publish(2));
+    REQUIRE(listener.CallCount == 0);
+
+    REQUIRE(signal.Dispatch() == 2);
+    REQUIRE(listener.CallCount == 2);
+    REQUIRE(listener.Sum == 3);
+
+    REQUIRE(signal.Dispatch() == 0);
+}
+
+TEST_CASE("QueuedSignal - Publish from multiple threads", "[signal]")
+{
+    constexpr onyxU32 THREAD_COUNT = 4;
+    constexpr onyxU32 EVENTS_PER_THREAD = 1000;
+
+    QueuedSignal<void(onyxU32), 1024> signal;
+    Listener listener;
+    signal.Connect<&Listener::OnValue>(listener);
+
+    DynamicArray<std::thread> threads;
+    for (onyxU32 i = 0; i < THREAD_COUNT; ++i)
+    {
+        threads.emplace_back([&signal]()
+        {
+            for (onyxU32 value = 1; value <= EVENTS_PER_THREAD; ++value)
+            {
+                // the queue is bounded, retry until the consumer made room
+                while (signal.Publish(value) == false)
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    onyxU32 dispatchedCount = 0;
+    while (dispatchedCount < THREAD_COUNT * EVENTS_PER_THREAD)
+        dispatchedCount += signal.Dispatch();
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    REQUIRE(listener.CallCount == THREAD_COUNT * EVENTS_PER_THREAD);
+    REQUIRE(listener.Sum == THREAD_COUNT * (EVENTS_PER_THREAD * (EVENTS_PER_THREAD + 1) / 2));
+}
+
+TEST_CASE("QueuedSignal - Disconnect while dispatching", "[signal]")
+{
+    QueuedSignal<void(onyxU32)> signal;
+    Listener selfDisconnecting;
+    selfDisconnecting.Signal = &signal;
+    Listener listener;
+
+    signal.Connect<&Listener::OnValueDisconnect>(selfDisconnecting);
+    signal.Connect<&Listener::OnValue>(listener);
+
+    signal.Publish(1);
+    signal.Publish(2);
+    signal.Dispatch();
+
+    REQUIRE(selfDisconnecting.CallCount == 1);
+    REQUIRE(listener.CallCount == 2);
+    REQUIRE(signal.HasListeners());
+}
+
+TEST_CASE("QueuedSignal - Full queue drops events", "[signal]")
+{
+    QueuedSignal<void(onyxU32), 4> signal;
+    Listener listener;
+    signal.Connect<&Listener::OnValue>(listener);
+
+    for (onyxU32 i = 0; i < 4; ++i)
+        REQUIRE(signal.Publish(i));
+
+    REQUIRE(signal.Publish(4) == false);
+    REQUIRE(signal.GetDroppedCount() == 1);
+    REQUIRE(signal.Dispatch() == 4);
+    REQUIRE(signal.Publish(5));
+}
+}
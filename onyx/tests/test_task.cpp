@@ -0,0 +1,188 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <onyx/thread/async/asynctask.h>
+#include <onyx/thread/async/task.h>
+#include <onyx/thread/threadpool/threadpool.h>
+
+namespace Onyx::Threading
+{
+    namespace
+    {
+        Task<onyxS32> AddOnPool(ThreadPool& executor, Future<onyxS32> future, onyxS32 value)
+        {
+            co_await ResumeOn(executor);
+            const onyxS32 result = co_await future;
+            co_return result + value;
+        }
+
+        Task<void> RecordResumeThread(ThreadPool& executor, std::thread::id& outThreadId)
+        {
+            co_await ResumeOn(executor);
+            outThreadId = std::this_thread::get_id();
+        }
+
+        Task<onyxS32> AwaitTask(Task<onyxS32> task)
+        {
+            const onyxS32 result = co_await task;
+            co_return result * 2;
+        }
+
+        Task<void> ResumeOnMain(MainThreadQueue& queue, std::thread::id& outThreadId)
+        {
+            co_await ResumeOnMainThread(queue);
+            outThreadId = std::this_thread::get_id();
+        }
+    }
+
+TEST_CASE("Future - Then after completion", "[threading][async]")
+{
+    Promise<onyxS32> promise;
+    Future<onyxS32> future = promise.GetFuture();
+    promise.SetValue(5);
+
+    bool hasRun = false;
+    future.Then([&]() { hasRun = true; });
+
+    REQUIRE(hasRun);
+    REQUIRE(future.Get() == 5);
+}
+
+TEST_CASE("Future - Multiple continuations", "[threading][async]")
+{
+    Promise<void> promise;
+    Future<void> future = promise.GetFuture();
+
+    DynamicArray<onyxU32> order;
+    future.Then([&]() { order.push_back(0); });
+    future.Then([&]() { order.push_back(1); });
+    future.Finally([&]() { order.push_back(2); });
+
+    promise.SetValue();
+
+    const DynamicArray<onyxU32> expectedOrder = { 0, 1, 2 };
+    REQUIRE(order == expectedOrder);
+}
+
+TEST_CASE("Future - Only Finally runs on cancel", "[threading][async]")
+{
+    Promise<void> promise;
+    Future<void> future = promise.GetFuture();
+
+    bool hasThenRun = false;
+    bool hasFinallyRun = false;
+    future.Then([&]() { hasThenRun = true; });
+    future.Finally([&]() { hasFinallyRun = true; });
+
+    future.Cancel();
+    promise.SetValue();
+
+    REQUIRE(future.IsCancelled());
+    REQUIRE(hasThenRun == false);
+    REQUIRE(hasFinallyRun);
+}
+
+TEST_CASE("Task - Await future on thread pool", "[threading][async]")
+{
+    ThreadPool executor;
+
+    Promise<onyxS32> promise;
+    Task<onyxS32> task = AddOnPool(executor, promise.GetFuture(), 2);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    REQUIRE(task.IsPending());
+
+    promise.SetValue(40);
+    REQUIRE(task.Get() == 42);
+}
+
+TEST_CASE("Task - Resume on thread pool", "[threading][async]")
+{
+    ThreadPool executor;
+
+    std::thread::id resumeThreadId;
+    Task<void> task = RecordResumeThread(executor, resumeThreadId);
+    task.Get();
+
+    REQUIRE(task.IsCompleted());
+    REQUIRE(resumeThreadId != std::this_thread::get_id());
+}
+
+TEST_CASE("Task - Resume on full thread pool", "[threading][async]")
+{
+    constexpr onyxS32 TASK_COUNT = 16;
+
+    ThreadPoolOptions options(1);
+    options.SetQueueSize(2);
+    ThreadPool executor(options);
+
+    // keeps the only worker busy so the resumptions have to wait for a free slot
+    executor.Post([]() { std::this_thread::sleep_for(std::chrono::milliseconds(20)); });
+
+    std::thread::id resumeThreadIds[TASK_COUNT];
+    DynamicArray<Future<void>> futures;
+    for (std::thread::id& resumeThreadId : resumeThreadIds)
+        futures.push_back(RecordResumeThread(executor, resumeThreadId).GetFuture());
+
+    WhenAll(futures).Wait();
+
+    for (const std::thread::id& resumeThreadId : resumeThreadIds)
+        REQUIRE(resumeThreadId == resumeThreadIds[0]);
+    REQUIRE(resumeThreadIds[0] != std::this_thread::get_id());
+}
+
+TEST_CASE("Task - Await task", "[threading][async]")
+{
+    ThreadPool executor;
+
+    Promise<onyxS32> promise;
+    Task<onyxS32> inner = AddOnPool(executor, promise.GetFuture(), 1);
+    Task<onyxS32> outer = AwaitTask(inner);
+
+    promise.SetValue(20);
+
+    REQUIRE(outer.Get() == 42);
+    REQUIRE(inner.Get() == 21);
+}
+
+TEST_CASE("Task - Resume on main thread", "[threading][async]")
+{
+    Thread::MAIN_THREAD_ID = std::this_thread::get_id();
+
+    MainThreadQueue queue;
+    std::thread::id resumeThreadId;
+    std::thread worker([&]() { ResumeOnMain(queue, resumeThreadId); });
+    worker.join();
+
+    REQUIRE(resumeThreadId != std::this_thread::get_id());
+
+    queue.Dispatch();
+    REQUIRE(resumeThreadId == std::this_thread::get_id());
+}
+
+TEST_CASE("Task - WhenAll and WhenAny", "[threading][async]")
+{
+    ThreadPool executor;
+
+    DynamicArray<Promise<onyxS32>> promises(3);
+    DynamicArray<Future<onyxS32>> futures;
+    for (Promise<onyxS32>& promise : promises)
+        futures.push_back(promise.GetFuture());
+
+    Future<void> all = WhenAll(futures);
+    Future<onyxU32> any = WhenAny(futures);
+
+    REQUIRE(all.IsPending());
+    REQUIRE(any.IsPending());
+
+    promises[1].SetValue(1);
+    REQUIRE(any.Get() == 1);
+    REQUIRE(all.IsPending());
+
+    promises[0].SetValue(0);
+    promises[2].SetValue(2);
+    all.Wait();
+    REQUIRE(all.IsCompleted());
+
+    REQUIRE(WhenAll(DynamicArray<Future<onyxS32>>()).IsCompleted());
+}
+}
@@ -1,7 +1,9 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <onyx/thread/threadpool/threadpool.h>
+#include <onyx/thread/threadpool/parallelfor.h>
 #include <onyx/thread/async/future.h>
+#include <onyx/thread/synchronization/atomic_latch.h>
 
 #include <iostream>
 
@@ -145,4 +147,119 @@ TEST_CASE("Idle thread pool", "[threading][benchmark]")
     REQUIRE(true);
 }
 
+TEST_CASE("Thread pool wakes workers for every batch", "[threading]")
+{
+    using namespace Onyx;
+    using namespace Onyx::Threading;
+
+    // small batches with idle gaps, every batch would hang if a worker missed the wake up of its post
+    constexpr onyxS32 BATCH_COUNT = 2000;
+    constexpr onyxS32 TASKS_PER_BATCH = 3;
+
+    ThreadPool threadPool(ThreadPoolOptions(4));
+    AtomicLatch latch;
+    Atomic<onyxS32> executedTasks = 0;
+
+    for (onyxS32 batch = 0; batch < BATCH_COUNT; ++batch)
+    {
+        latch.SetCounter(TASKS_PER_BATCH);
+        for (onyxS32 i = 0; i < TASKS_PER_BATCH; ++i)
+        {
+            threadPool.Post([&]()
+            {
+                ++executedTasks;
+                latch.Decrement();
+            });
+        }
+
+        latch.Wait();
+    }
+
+    REQUIRE(executedTasks == BATCH_COUNT * TASKS_PER_BATCH);
+}
+
+TEST_CASE("Thread pool workers steal tasks posted from a worker", "[threading]")
+{
+    using namespace Onyx;
+    using namespace Onyx::Threading;
+
+    constexpr onyxS32 CHILD_COUNT = 64;
+
+    ThreadPool threadPool(ThreadPoolOptions(4));
+    AtomicLatch latch(CHILD_COUNT);
+    Atomic<onyxS32> blockedChildren = 0;
+    Atomic<bool> release = false;
+
+    // the parent worker blocks until another worker took one of its children, which only works by stealing
+    threadPool.Post([&]()
+    {
+        for (onyxS32 i = 0; i < CHILD_COUNT; ++i)
+        {
+            threadPool.Post([&]()
+            {
+                ++blockedChildren;
+                latch.Decrement();
+            });
+        }
+
+        while (blockedChildren.load() == 0)
+            std::this_thread::yield();
+
+        release = true;
+    });
+
+    latch.Wait();
+    while (release.load() == false)
+        std::this_thread::yield();
+
+    REQUIRE(blockedChildren == CHILD_COUNT);
+}
+
+TEST_CASE("ParallelFor runs every job once", "[threading]")
+{
+    using namespace Onyx;
+    using namespace Onyx::Threading;
+
+    constexpr onyxU32 JOB_COUNT = 1000;
+
+    ThreadPool threadPool(ThreadPoolOptions(4));
+    DynamicArray<Atomic<onyxS32>> runCounts(JOB_COUNT);
+
+    ParallelFor(threadPool, JOB_COUNT, [&](onyxU32 index) { ++runCounts[index]; });
+
+    REQUIRE(std::ranges::all_of(runCounts, [](const Atomic<onyxS32>& runCount) { return runCount.load() == 1; }));
+}
+
+TEST_CASE("ParallelFor from every worker of the pool does not deadlock", "[threading]")
+{
+    using namespace Onyx;
+    using namespace Onyx::Threading;
+
+    constexpr onyxS32 THREAD_COUNT = 2;
+    constexpr onyxU32 JOB_COUNT = 64;
+
+    const ThreadPoolOptions options(THREAD_COUNT);
+    ThreadPool threadPool(options);
+    AtomicLatch latch(THREAD_COUNT);
+    Atomic<onyxU32> executedJobs = 0;
+    Atomic<onyxS32> startedWorkers = 0;
+
+    // every worker is busy in its own parallel for, so none of the posted tasks can run until the callers are done
+    for (onyxS32 i = 0; i < THREAD_COUNT; ++i)
+    {
+        threadPool.Post([&]()
+        {
+            ++startedWorkers;
+            while (startedWorkers.load() != THREAD_COUNT)
+                std::this_thread::yield();
+
+            ParallelFor(threadPool, JOB_COUNT, [&](onyxU32) { ++executedJobs; });
+            latch.Decrement();
+        });
+    }
+
+    latch.Wait();
+    REQUIRE(executedJobs == THREAD_COUNT * JOB_COUNT);
+}
+
 }
@@ -0,0 +1,51 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <onyx/volume/octree/octreenode.h>
+
+namespace Onyx::Volume
+{
+    namespace
+    {
+        using TestNode = OctreeNode<onyxU32>;
+
+        bool IsAllocatedFrom(const TestNode& node, const TestNode::ChildrenPool& pool)
+        {
+            if (node.IsSubdivided() == false)
+                return true;
+
+            if (node.GetChildren().get_deleter().Pool != &pool)
+                return false;
+
+            for (onyxU8 i = 0; i < 8; ++i)
+            {
+                if (IsAllocatedFrom(node[i], pool) == false)
+                    return false;
+            }
+
+            return true;
+        }
+    }
+
+    TEST_CASE("OctreeNode copy assignment allocates from its own pool", "[volume]")
+    {
+        TestNode::ChildrenPool sourcePool;
+        TestNode::ChildrenPool destinationPool;
+
+        TestNode source(sourcePool);
+        REQUIRE(source.Subdivide());
+        REQUIRE(source[3].Subdivide());
+
+        TestNode destination(destinationPool);
+        destination = source;
+
+        REQUIRE(destination.IsSubdivided());
+        REQUIRE(destination[3].IsSubdivided());
+        REQUIRE(destination[2].IsSubdivided() == false);
+        REQUIRE(IsAllocatedFrom(destination, destinationPool));
+        REQUIRE(IsAllocatedFrom(source, sourcePool));
+
+        // children of the copy subdivide into the destination pool as well
+        REQUIRE(destination[2].Subdivide());
+        REQUIRE(IsAllocatedFrom(destination, destinationPool));
+    }
+}
@@ -0,0 +1,165 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <onyx/volume/source/volumeeditjournal.h>
+
+#include <bit>
+#include <cmath>
+
+namespace Onyx::Volume
+{
+    namespace
+    {
+        // flat ground at y = 0, negative below
+        Vector4f32 GetGroundSample(const Vector3f32& position)
+        {
+            return Vector4f32(0.0f, 1.0f, 0.0f, position[1]);
+        }
+
+        // same lookup as FindVolumeSourcesCell in includes/volume/volumesources.h
+        DynamicArray<onyxU32> FindGridCell(const DynamicArray<onyxU32>& grid, const Vector3f32& position)
+        {
+            const onyxF32 inverseCellSize = std::bit_cast<onyxF32>(grid[0]);
+            const onyxU32 tableMask = grid[1];
+            const onyxS32 x = static_cast<onyxS32>(std::floor(position[0] * inverseCellSize));
+            const onyxS32 y = static_cast<onyxS32>(std::floor(position[1] * inverseCellSize));
+            const onyxS32 z = static_cast<onyxS32>(std::floor(position[2] * inverseCellSize));
+
+            onyxU32 start = grid[2];
+            onyxU32 count = grid[3];
+            onyxU32 slot = ((static_cast<onyxU32>(x) * 73856093u) ^ (static_cast<onyxU32>(y) * 19349663u) ^ (static_cast<onyxU32>(z) * 83492791u)) & tableMask;
+            while (grid[VOLUME_EDIT_GRID_HEADER_SIZE + slot * VOLUME_EDIT_GRID_CELL_SIZE + 4] != 0)
+            {
+                const onyxU32 cellOffset = VOLUME_EDIT_GRID_HEADER_SIZE + slot * VOLUME_EDIT_GRID_CELL_SIZE;
+                if ((static_cast<onyxS32>(grid[cellOffset]) == x) && (static_cast<onyxS32>(grid[cellOffset + 1]) == y) && (static_cast<onyxS32>(grid[cellOffset + 2]) == z))
+                {
+                    start = grid[cellOffset + 3];
+                    count = grid[cellOffset + 4];
+                    break;
+                }
+
+                slot = (slot + 1) & tableMask;
+            }
+
+            return DynamicArray<onyxU32>(grid.begin() + start, grid.begin() + start + count);
+        }
+    }
+
+    TEST_CASE("VolumeEditJournal queries only overlapping edits", "[volume]")
+    {
+        VolumeEditJournal journal(16.0f);
+        const onyxU32 first = journal.Add(VolumeEdit::CreateSphere(VolumeEditOperation::Union, Vector3f32(0.0f, 0.0f, 0.0f), 4.0f));
+        const onyxU32 second = journal.Add(VolumeEdit::CreateSphere(VolumeEditOperation::Difference, Vector3f32(1000.0f, 0.0f, 0.0f), 4.0f));
+        const onyxU32 third = journal.Add(VolumeEdit::CreateCube(VolumeEditOperation::Union, Vector3f32(2.0f, 0.0f, 0.0f), Vector3f32(20.0f, 1.0f, 1.0f)));
+        const onyxU32 intersection = journal.Add(VolumeEdit::CreateSphere(VolumeEditOperation::Intersect, Vector3f32(0.0f, 0.0f, 0.0f), 5000.0f));
+
+        DynamicArray<onyxU32> edits;
+        journal.Query(Vector3f32(-1.0f), Vector3f32(1.0f), edits);
+
+        const DynamicArray<onyxU32> expectedNearOrigin{ first, third, intersection };
+        REQUIRE(edits == expectedNearOrigin);
+
+        journal.Query(Vector3f32(999.0f, -1.0f, -1.0f), Vector3f32(1001.0f, 1.0f, 1.0f), edits);
+
+        const DynamicArray<onyxU32> expectedFarAway{ second, intersection };
+        REQUIRE(edits == expectedFarAway);
+    }
+
+    TEST_CASE("VolumeEditJournal keeps the surface of a full evaluation", "[volume]")
+    {
+        VolumeEditJournal journal(8.0f);
+        for (onyxU32 i = 0; i < 32; ++i)
+        {
+            const onyxF32 offset = static_cast<onyxF32>(i) * 6.0f;
+            const VolumeEditOperation operation = (i % 3 == 0) ? VolumeEditOperation::Difference : VolumeEditOperation::Union;
+            journal.Add(VolumeEdit::CreateSphereBrush(operation, Vector3f32(offset, 0.0f, offset * 0.5f), 5.0f, 0.5f));
+        }
+
+        // reference that visits every edit
+        VolumeEditJournal reference(1.0e9f);
+        for (const VolumeEdit& edit : journal.GetEdits())
+            reference.Add(edit);
+
+        for (onyxF32 x = -10.0f; x < 200.0f; x += 3.7f)
+        {
+            for (onyxF32 y = -8.0f; y < 8.0f; y += 1.3f)
+            {
+                const Vector3f32 position(x, y, x * 0.5f);
+                const onyxF32 value = journal.Apply(position, GetGroundSample(position))[3];
+                const onyxF32 referenceValue = reference.Apply(position, GetGroundSample(position))[3];
+                REQUIRE((value < 0.0f) == (referenceValue < 0.0f));
+            }
+        }
+    }
+
+    TEST_CASE("VolumeEditJournal collapses overwritten edits", "[volume]")
+    {
+        VolumeEditJournal journal;
+        journal.Add(VolumeEdit::CreateSphere(VolumeEditOperation::Union, Vector3f32(0.0f, 0.0f, 0.0f), 1.0f));
+        journal.Add(VolumeEdit::CreateSphere(VolumeEditOperation::Difference, Vector3f32(0.5f, 0.0f, 0.0f), 1.0f));
+        journal.Add(VolumeEdit::CreateSphere(VolumeEditOperation::Union, Vector3f32(50.0f, 0.0f, 0.0f), 1.0f));
+        journal.Add(VolumeEdit::CreateCube(VolumeEditOperation::Difference, Vector3f32(0.0f, 0.0f, 0.0f), Vector3f32(3.0f)));
+
+        const Vector3f32 insideCube(0.5f, 0.0f, 0.0f);
+        const onyxF32 valueBefore = journal.Apply(insideCube, GetGroundSample(insideCube))[3];
+
+        const onyxU32 versionBefore = journal.GetVersion();
+        REQUIRE(journal.Collapse() == 2);
+        REQUIRE(journal.GetEditCount() == 2);
+        REQUIRE(journal.GetVersion() != versionBefore);
+        REQUIRE(journal.GetEdits()[0].Data[0] == 50.0f);
+
+        const onyxF32 valueAfter = journal.Apply(insideCube, GetGroundSample(insideCube))[3];
+        REQUIRE(valueBefore > 0.0f);
+        REQUIRE(valueAfter > 0.0f);
+
+        // the index got rebuilt for the remaining edits
+        DynamicArray<onyxU32> edits;
+        journal.Query(Vector3f32(49.0f), Vector3f32(51.0f), edits);
+        REQUIRE(edits.size() == 0);
+        journal.Query(Vector3f32(49.0f, -1.0f, -1.0f), Vector3f32(51.0f, 1.0f, 1.0f), edits);
+        REQUIRE(edits.size() == 1);
+    }
+
+    TEST_CASE("VolumeEditJournal GPU grid matches the queried cells", "[volume]")
+    {
+        VolumeEditJournal journal(4.0f);
+        journal.Add(VolumeEdit::CreateSphere(VolumeEditOperation::Union, Vector3f32(0.0f, 0.0f, 0.0f), 3.0f));
+        journal.Add(VolumeEdit::CreateSphere(VolumeEditOperation::Intersect, Vector3f32(0.0f, 0.0f, 0.0f), 5000.0f));
+        journal.Add(VolumeEdit::CreateCube(VolumeEditOperation::Difference, Vector3f32(-10.0f, 2.0f, -6.0f), Vector3f32(3.0f)));
+        for (onyxU32 i = 0; i < 16; ++i)
+            journal.Add(VolumeEdit::CreateSphere(VolumeEditOperation::Union, Vector3f32(static_cast<onyxF32>(i) * 5.0f, -3.0f, 1.0f), 2.0f));
+
+        DynamicArray<onyxU32> grid;
+        journal.WriteGpuGrid(grid);
+
+        DynamicArray<onyxU32> edits;
+        for (onyxS32 x = -16; x <= 80; x += 3)
+        {
+            for (onyxS32 y = -8; y <= 8; y += 3)
+            {
+                const Vector3f32 position(static_cast<onyxF32>(x) + 0.5f, static_cast<onyxF32>(y) + 0.5f, 0.5f);
+                journal.Query(position, position, edits);
+                REQUIRE(FindGridCell(grid, position) == edits);
+            }
+        }
+
+        // cells without an edit only see the unbounded intersection
+        const DynamicArray<onyxU32> expectedEmptyCell{ 1 };
+        REQUIRE(FindGridCell(grid, Vector3f32(-1000.0f, 1000.0f, 0.0f)) == expectedEmptyCell);
+    }
+
+    TEST_CASE("VolumeEditJournal requests a collapse periodically", "[volume]")
+    {
+        VolumeEditJournal journal;
+        for (onyxU32 i = 0; i < VolumeEditJournal::COLLAPSE_INTERVAL - 1; ++i)
+            journal.Add(VolumeEdit::CreateSphere(VolumeEditOperation::Union, Vector3f32(static_cast<onyxF32>(i) * 10.0f, 0.0f, 0.0f), 1.0f));
+
+        REQUIRE(journal.ShouldCollapse() == false);
+        journal.Add(VolumeEdit::CreateSphere(VolumeEditOperation::Union, Vector3f32(-10.0f, 0.0f, 0.0f), 1.0f));
+        REQUIRE(journal.ShouldCollapse());
+
+        journal.Collapse();
+        REQUIRE(journal.ShouldCollapse() == false);
+        REQUIRE(journal.GetEditCount() == VolumeEditJournal::COLLAPSE_INTERVAL);
+    }
+}
@@ -0,0 +1,58 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <onyx/volume/source/volumesamplecache.h>
+
+namespace Onyx::Volume
+{
+    namespace
+    {
+        class CountingVolume : public VolumeBase
+        {
+        public:
+            Vector4f32 GetValueAndGradient(const Vector3f32& position) const override
+            {
+                ++GradientSampleCount;
+                return Vector4f32(1.0f, 0.0f, 0.0f, position[0]);
+            }
+
+            onyxF32 GetValue(const Vector3f32& position) const override
+            {
+                ++ValueSampleCount;
+                return position[0];
+            }
+
+            mutable onyxU32 GradientSampleCount = 0;
+            mutable onyxU32 ValueSampleCount = 0;
+        };
+    }
+
+    TEST_CASE("VolumeSampleCache reuses lattice samples", "[volume]")
+    {
+        CountingVolume volume;
+        // 16 sized chunk at level 2 has a lattice spacing of 1
+        VolumeSampleCache cache(volume, Vector3f32(0.0f), 16.0f, 2);
+
+        const Vector3f32 corner(-4.0f, 2.0f, 8.0f);
+        REQUIRE(cache.GetValueAndGradient(corner)[3] == -4.0f);
+        REQUIRE(cache.GetValueAndGradient(corner)[3] == -4.0f);
+        REQUIRE(cache.GetValue(corner) == -4.0f);
+        REQUIRE(volume.GradientSampleCount == 1);
+        REQUIRE(volume.ValueSampleCount == 0);
+
+        // values without gradient are upgraded on the first gradient request
+        const Vector3f32 other(1.0f, 1.0f, 1.0f);
+        REQUIRE(cache.GetValue(other) == 1.0f);
+        REQUIRE(cache.GetValueAndGradient(other)[3] == 1.0f);
+        REQUIRE(volume.ValueSampleCount == 1);
+        REQUIRE(volume.GradientSampleCount == 2);
+
+        // off lattice and outside of the chunk
+        REQUIRE(cache.GetValue(Vector3f32(0.5f, 0.0f, 0.0f)) == 0.5f);
+        REQUIRE(cache.GetValue(Vector3f32(9.0f, 0.0f, 0.0f)) == 9.0f);
+
+        const VolumeSampleCache::Statistics& statistics = cache.GetStatistics();
+        REQUIRE(statistics.Hits == 2);
+        REQUIRE(statistics.Misses == 3);
+        REQUIRE(statistics.Uncached == 2);
+    }
+}